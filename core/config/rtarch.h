@@ -363,12 +363,26 @@
 #define RT_REGS 32      /* <- 30 on predicated x64 AVX-512/1K4 & ARM-SVE */
 #endif /* RT_REGS: 8, 16, 32 */
 
+/*
+ * Determine code generation mode for ASM sections (x32/x64 targets only).
+ * 0 - ASM sections are assembled statically with compiler's inline assembler.
+ * 1 - ASM sections are generated at runtime into executable buffer (rtcode.h).
+ */
+#ifndef RT_RUNTIME
+#define RT_RUNTIME 0
+#endif /* RT_RUNTIME: 0, 1 */
+
+#if RT_RUNTIME != 0 && !(defined RT_X32) && !(defined RT_X64)
+#error "runtime code generation is only supported on x32/x64, check build flags"
+#endif /* RT_RUNTIME */
+
 /*
  * Short name for true-condition sign in assembler evaluation of (A == B).
  * The result of the condition evaluation is used as a mask for selection:
  * ((A == B) & C) | ((A != B) & D), therefore it needs to be (-1) if true.
+ * With runtime code generation conditions are evaluated in C/C++, (+1) if true.
  */
-#if __clang__ && __clang_major__ <= 6
+#if RT_RUNTIME != 0 || (__clang__ && __clang_major__ <= 6)
 #define M   -
 #else /* gcc or clang-7 and beyond */
 #define M   +
@@ -1562,10 +1576,30 @@
 #define ASM_BEG /*internal*/    ""
 #define ASM_END /*internal*/    "\n"
 
+#if RT_RUNTIME == 0
+
 #define EMPTY                   ASM_BEG ASM_END /* endian-agnostic */
 #define EMITB(b)                ASM_BEG ASM_OP1(.byte, b) ASM_END
 #define EMITW(w)                ASM_BEG ASM_OP1(.long, w) ASM_END
 
+/* conditional emission, (c) is evaluated by the assembler */
+#define ASM_IF(c)               ASM_BEG ASM_OP1(.if, c) ASM_END
+#define ASM_ENDIF               ASM_BEG ASM_OP0(.endif) ASM_END
+
+#else /* RT_RUNTIME */
+
+#include "rtcode.h"
+
+#define EMPTY                   /* nothing to emit at runtime */
+#define EMITB(b)                code_emitb(__Code__, (rt_ui32)(b));
+#define EMITW(w)                code_emitw(__Code__, (rt_ui32)(w));
+
+/* conditional emission, (c) is evaluated at generation time */
+#define ASM_IF(c)               if (c) {
+#define ASM_ENDIF               }
+
+#endif /* RT_RUNTIME */
+
 #define EMITH(h)                                                            \
         EMITB((h) >> 0x00 & 0xFF)                                           \
         EMITB((h) >> 0x08 & 0xFF)
@@ -1573,10 +1607,20 @@
 #define movlb_ld(lb)/*Reax*/    ASM_BEG ASM_OP2(movq, %%rax, lb) ASM_END
 #define movlb_st(lb)/*Reax*/    ASM_BEG ASM_OP2(movq, lb, %%rax) ASM_END
 
-#if   (defined RT_X32)
+#if   RT_RUNTIME == 0
 
-#define label_ld(lb)/*Reax*/                                                \
-        ASM_BEG ASM_OP2(leaq, %%rax, lb) ASM_END
+#define label_ld(lb)/*Reax*/  /* lea with RIP-relative address, PIE-safe */ \
+        ASM_BEG ASM_OP2(leaq, %%rax, lb(%%rip)) ASM_END
+
+#else /* RT_RUNTIME */
+
+#define label_ld(lb)/*Reax*/ /* lea with RIP-relative fixup to the label */ \
+        EMITB(0x48) EMITB(0x8D) EMITB(0x05)                                 \
+        code_refer(__Code__, #lb);
+
+#endif /* RT_RUNTIME */
+
+#if   (defined RT_X32)
 
 #define label_st(lb, MD, DD)                                                \
         label_ld(lb)/*Reax*/                                                \
@@ -1586,9 +1630,6 @@
 
 #elif (defined RT_X64)
 
-#define label_ld(lb)/*Reax*/                                                \
-        ASM_BEG ASM_OP2(leaq, %%rax, lb) ASM_END
-
 #define label_st(lb, MD, DD)                                                \
         label_ld(lb)/*Reax*/                                                \
     ADR REW(0,       RXB(MD)) EMITB(0x89)                                   \
@@ -1658,6 +1699,12 @@
 #define RT_SIMD_COMPAT_FMR      RT_SIMD_COMPAT_FMR_MASTER
 #endif /* RT_SIMD_COMPAT_FMR */
 
+/* RT_SIMD_COMPAT_DOT when enabled picks AVX512-VNNI dot-products
+ * for dph/dpb on AVX512BW targets (RT_256=8, RT_512=2+8) */
+#ifndef RT_SIMD_COMPAT_DOT
+#define RT_SIMD_COMPAT_DOT      0 /* applicable to AVX512-VNNI */
+#endif /* RT_SIMD_COMPAT_DOT */
+
 /* RT_BASE_COMPAT_BMI when enabled changes the default behavior
  * of some bit-manipulation instructions to use BMI variants */
 #ifdef  RT_SIMD_CODE
@@ -1727,18 +1774,88 @@
  * The SIMD unit is set to operate in its default mode (non-IEEE on ARMv7).
  */
 
-#if RT_SIMD_FLUSH_ZERO == 0
-#if RT_SIMD_FAST_FCTRL == 0
+#if RT_RUNTIME == 0
 
 /* use 1 local to fix optimized builds, where locals are referenced via SP,
  * while stack ops from within the asm block aren't counted into offsets */
-#define ASM_ENTER(__Info__)                                                 \
+#define ASM_CODE_ENTER(__Info__) /* internal, loads Info to Reax */         \
 {                                                                           \
     rt_full __Reax__;                                                       \
     asm volatile                                                            \
     (                                                                       \
         movlb_st(%[Reax_])                                                  \
-        movlb_ld(%[Info_])                                                  \
+        movlb_ld(%[Info_])
+
+#define ASM_CODE_LEAVE(__Info__) /* internal, restores Reax */              \
+        movlb_ld(%[Reax_])                                                  \
+        : [Reax_] "+r" (__Reax__)                                           \
+        : [Info_]  "r" ((rt_full)__Info__)                                  \
+        : "cc",  "memory"                                                   \
+    );                                                                      \
+}
+
+#else /* RT_RUNTIME */
+
+/* generated function takes Info as its 1st argument in ABI-specific register,
+ * which is moved to Reax (caller-saved) to match the static version above,
+ * the function is called upon ASM_LEAVE, then released or kept in the cache */
+#if   (defined RT_WIN64)
+
+#define ASM_CODE_INFO   Recx /* internal, 1st argument of generated code */
+
+#else  /* RT_LINUX */
+
+#define ASM_CODE_INFO   Redi /* internal, 1st argument of generated code */
+
+#endif /* ------------- OS specific ----------------------------------------- */
+
+#if RT_CODE_CACHE == 0
+
+#define ASM_CODE_ENTER(__Info__) /* internal, loads Info to Reax */         \
+{                                                                           \
+    rt_CODE __Code__[1];                                                    \
+    code_init(__Code__);                                                    \
+        movzx_rr(Reax, ASM_CODE_INFO)
+
+#define ASM_CODE_LEAVE(__Info__) /* internal, returns from function */      \
+        EMITB(0xC3)                                                         \
+    code_seal(__Code__)((rt_pntr)(__Info__));                               \
+    code_done(__Code__);                                                    \
+}
+
+#else /* RT_CODE_CACHE */
+
+/* code is only generated if the cache has no entry for the given call site
+ * (kernel id), SIMD target mask and specialization key (see ASM_ENTER_K),
+ * the entry is pinned for the call */
+#define ASM_CODE_ENTER(__Info__) /* internal, loads Info to Reax */         \
+{                                                                           \
+    static rt_CODE_SITE __Site__ = {__FILE__, __LINE__, __COUNTER__};       \
+    rt_ui32 __Ver__ = ((rt_SIMD_INFO *)(__Info__))->ver;                    \
+    rt_CODE_ENTRY *__Func__ = code_look(&__Site__, __Ver__, __Spec__);      \
+    if (__Func__ == RT_NULL)                                                \
+    {                                                                       \
+        rt_CODE __Code__[1];                                                \
+        code_init(__Code__);                                                \
+        movzx_rr(Reax, ASM_CODE_INFO)
+
+#define ASM_CODE_LEAVE(__Info__) /* internal, returns from function */      \
+        EMITB(0xC3)                                                         \
+        __Func__ = code_save(__Code__, &__Site__, __Ver__, __Spec__);       \
+    }                                                                       \
+    ((rt_FUNC_CODE)(rt_uptr)__Func__->buf)((rt_pntr)(__Info__));            \
+    code_drop(__Func__);                                                    \
+}
+
+#endif /* RT_CODE_CACHE */
+
+#endif /* RT_RUNTIME */
+
+#if RT_SIMD_FLUSH_ZERO == 0
+#if RT_SIMD_FAST_FCTRL == 0
+
+#define ASM_ENTER(__Info__)                                                 \
+        ASM_CODE_ENTER(__Info__)                                            \
         stack_sa()                                                          \
         movxx_rr(Rebp, Reax)                                                \
         sregs_sa()                                                          \
@@ -1747,24 +1864,12 @@
 #define ASM_LEAVE(__Info__)                                                 \
         sregs_la()                                                          \
         stack_la()                                                          \
-        movlb_ld(%[Reax_])                                                  \
-        : [Reax_] "+r" (__Reax__)                                           \
-        : [Info_]  "r" ((rt_full)__Info__)                                  \
-        : "cc",  "memory"                                                   \
-    );                                                                      \
-}
+        ASM_CODE_LEAVE(__Info__)
 
 #else /* RT_SIMD_FAST_FCTRL */
 
-/* use 1 local to fix optimized builds, where locals are referenced via SP,
- * while stack ops from within the asm block aren't counted into offsets */
 #define ASM_ENTER(__Info__)                                                 \
-{                                                                           \
-    rt_full __Reax__;                                                       \
-    asm volatile                                                            \
-    (                                                                       \
-        movlb_st(%[Reax_])                                                  \
-        movlb_ld(%[Info_])                                                  \
+        ASM_CODE_ENTER(__Info__)                                            \
         stack_sa()                                                          \
         movxx_rr(Rebp, Reax)                                                \
         sregs_sa()                                                          \
@@ -1776,12 +1881,7 @@
 #define ASM_LEAVE(__Info__)                                                 \
         sregs_la()                                                          \
         stack_la()                                                          \
-        movlb_ld(%[Reax_])                                                  \
-        : [Reax_] "+r" (__Reax__)                                           \
-        : [Info_]  "r" ((rt_full)__Info__)                                  \
-        : "cc",  "memory"                                                   \
-    );                                                                      \
-}
+        ASM_CODE_LEAVE(__Info__)
 
 #endif /* RT_SIMD_FAST_FCTRL */
 #else /* RT_SIMD_FLUSH_ZERO */
@@ -1814,15 +1914,8 @@
 
 #if RT_SIMD_FAST_FCTRL == 0
 
-/* use 1 local to fix optimized builds, where locals are referenced via SP,
- * while stack ops from within the asm block aren't counted into offsets */
 #define ASM_ENTER_F(__Info__)                                               \
-{                                                                           \
-    rt_full __Reax__;                                                       \
-    asm volatile                                                            \
-    (                                                                       \
-        movlb_st(%[Reax_])                                                  \
-        movlb_ld(%[Info_])                                                  \
+        ASM_CODE_ENTER(__Info__)                                            \
         stack_sa()                                                          \
         movxx_rr(Rebp, Reax)                                                \
         movxx_ld(Rebx, Mebp, inf_REGS)                                      \
@@ -1842,24 +1935,12 @@
         mxcsr_ld(Mebp, inf_FCTRL(0*4))                                      \
         sregs_la()                                                          \
         stack_la()                                                          \
-        movlb_ld(%[Reax_])                                                  \
-        : [Reax_] "+r" (__Reax__)                                           \
-        : [Info_]  "r" ((rt_full)__Info__)                                  \
-        : "cc",  "memory"                                                   \
-    );                                                                      \
-}
+        ASM_CODE_LEAVE(__Info__)
 
 #else /* RT_SIMD_FAST_FCTRL */
 
-/* use 1 local to fix optimized builds, where locals are referenced via SP,
- * while stack ops from within the asm block aren't counted into offsets */
 #define ASM_ENTER_F(__Info__)                                               \
-{                                                                           \
-    rt_full __Reax__;                                                       \
-    asm volatile                                                            \
-    (                                                                       \
-        movlb_st(%[Reax_])                                                  \
-        movlb_ld(%[Info_])                                                  \
+        ASM_CODE_ENTER(__Info__)                                            \
         stack_sa()                                                          \
         movxx_rr(Rebp, Reax)                                                \
         movxx_ld(Rebx, Mebp, inf_REGS)                                      \
@@ -1885,18 +1966,85 @@
         mxcsr_ld(Mebp, inf_FCTRL(0*4))                                      \
         sregs_la()                                                          \
         stack_la()                                                          \
-        movlb_ld(%[Reax_])                                                  \
-        : [Reax_] "+r" (__Reax__)                                           \
-        : [Info_]  "r" ((rt_full)__Info__)                                  \
-        : "cc",  "memory"                                                   \
-    );                                                                      \
-}
+        ASM_CODE_LEAVE(__Info__)
 
 #endif /* RT_SIMD_FAST_FCTRL */
 
+/*
+ * The ASM_ENTER_R/ASM_LEAVE_R versions only save/load registers, which are
+ * declared by the section as used in the BASE (__Base__) and SIMD (__Simd__)
+ * masks built with RM(), e.g. RM(Recx) | RM(Resi) and RM(Xmm0) | RM(Xmm1),
+ * thus reducing the overhead for small sections called in tight loops.
+ * Reax, Rebp and r15 (used internally) are always saved, while SIMD mask
+ * registers (AVX-512) are not preserved, masks must be constant expressions.
+ * Registers implicitly used by instructions (Redx in mul/div) must be listed.
+ * In non-IEEE mode (RT_SIMD_FLUSH_ZERO) they map to ASM_ENTER_F/ASM_LEAVE_F.
+ */
+
+#define RM(RG)  RMK(RG) /* register bit in ASM_ENTER_R/ASM_LEAVE_R masks */
+
+#if RT_SIMD_FLUSH_ZERO == 0
+#if RT_SIMD_FAST_FCTRL == 0
+
+#define ASM_ENTER_R(__Info__, __Base__, __Simd__)                           \
+        ASM_CODE_ENTER(__Info__)                                            \
+        stack_sr(__Base__)                                                  \
+        movxx_rr(Rebp, Reax)                                                \
+        sregs_sr(__Simd__)                                                  \
+        movwx_mi(Mebp, inf_FCTRL(0*4), IH(0x1F80))
+
+#define ASM_LEAVE_R(__Info__, __Base__, __Simd__)                           \
+        sregs_lr(__Simd__)                                                  \
+        stack_lr(__Base__)                                                  \
+        ASM_CODE_LEAVE(__Info__)
+
+#else /* RT_SIMD_FAST_FCTRL */
+
+#define ASM_ENTER_R(__Info__, __Base__, __Simd__)                           \
+        ASM_CODE_ENTER(__Info__)                                            \
+        stack_sr(__Base__)                                                  \
+        movxx_rr(Rebp, Reax)                                                \
+        sregs_sr(__Simd__)                                                  \
+        movwx_mi(Mebp, inf_FCTRL(3*4), IH(0x7F80))                          \
+        movwx_mi(Mebp, inf_FCTRL(2*4), IH(0x5F80))                          \
+        movwx_mi(Mebp, inf_FCTRL(1*4), IH(0x3F80))                          \
+        movwx_mi(Mebp, inf_FCTRL(0*4), IH(0x1F80))
+
+#define ASM_LEAVE_R(__Info__, __Base__, __Simd__)                           \
+        sregs_lr(__Simd__)                                                  \
+        stack_lr(__Base__)                                                  \
+        ASM_CODE_LEAVE(__Info__)
+
+#endif /* RT_SIMD_FAST_FCTRL */
+#else /* RT_SIMD_FLUSH_ZERO */
+
+#define ASM_ENTER_R(__Info__, __Base__, __Simd__) ASM_ENTER_F(__Info__)
+
+#define ASM_LEAVE_R(__Info__, __Base__, __Simd__) ASM_LEAVE_F(__Info__)
+
+#endif /* RT_SIMD_FLUSH_ZERO */
+
+/*
+ * The ASM_ENTER_B/ASM_LEAVE_B versions only save/load BASE registers and
+ * leave SIMD registers and the SIMD control register untouched, thus sections
+ * with BASE instructions only (like verxx_xx) can run on any processor of
+ * given arch, regardless of the SIMD target the object is compiled for.
+ */
+
+#define ASM_ENTER_B(__Info__)                                               \
+        ASM_CODE_ENTER(__Info__)                                            \
+        stack_sa()                                                          \
+        movxx_rr(Rebp, Reax)
+
+#define ASM_LEAVE_B(__Info__)                                               \
+        stack_la()                                                          \
+        ASM_CODE_LEAVE(__Info__)
+
 #ifndef RT_SIMD_CODE
 #define sregs_sa()
 #define sregs_la()
+#define sregs_sr(SM)
+#define sregs_lr(SM)
 #define mxcsr_ld(MS, DS)
 #endif /* RT_SIMD_CODE */
 
@@ -2511,6 +2659,141 @@
 
 #endif /* OS, COMPILER, ARCH */
 
+/******************************************************************************/
+/*********************************   CONST   **********************************/
+/******************************************************************************/
+
+/*
+ * Generation-time constants are values (sizes, strides, loop counts) passed
+ * to ASM sections via rt_SIMD_INFOX fields, which can be bound to the code
+ * when it is generated at runtime (RT_RUNTIME=1) instead of being loaded.
+ * ASM_ENTER_K/ASM_LEAVE_K take a specialization key in addition to Info,
+ * which must be different for each combination of bound values (for instance
+ * the values packed together), as generated code is cached per key.
+ * Instructions with "_rk" suffix take both the field's displacement (DS)
+ * and its value (KS), Mebp must point to Info as set by ASM_ENTER_K.
+ * Static builds load the field from memory and ignore the key, while runtime
+ * builds encode the value (evaluated at generation time) as an immediate.
+ * Bound values are limited to 31-bit unsigned range (IV) for cmdx* subset.
+ * Within RT_RUNTIME sections bound values can also be used in IB/IH/IW,
+ * DP/DV or to unroll loops written in C/C++ in between the instructions.
+ */
+
+#if RT_RUNTIME == 0
+
+#define ASM_ENTER_K(__Info__, __Key__)                                      \
+        ASM_ENTER(__Info__)
+
+#define ASM_LEAVE_K(__Info__)                                               \
+        ASM_LEAVE(__Info__)
+
+#define movwx_rk(RD, DS, KS)                                                \
+        movwx_ld(W(RD), Mebp, W(DS))
+
+#define movxx_rk(RD, DS, KS)                                                \
+        movxx_ld(W(RD), Mebp, W(DS))
+
+#define addwx_rk(RG, DS, KS)                                                \
+        addwx_ld(W(RG), Mebp, W(DS))
+
+#define addxx_rk(RG, DS, KS)                                                \
+        addxx_ld(W(RG), Mebp, W(DS))
+
+#define subwx_rk(RG, DS, KS)                                                \
+        subwx_ld(W(RG), Mebp, W(DS))
+
+#define subxx_rk(RG, DS, KS)                                                \
+        subxx_ld(W(RG), Mebp, W(DS))
+
+#define mulwx_rk(RG, DS, KS)                                                \
+        mulwx_ld(W(RG), Mebp, W(DS))
+
+#define mulxx_rk(RG, DS, KS)                                                \
+        mulxx_ld(W(RG), Mebp, W(DS))
+
+#define cmpwx_rk(RS, DT, KT)                                                \
+        cmpwx_rm(W(RS), Mebp, W(DT))
+
+#define cmpxx_rk(RS, DT, KT)                                                \
+        cmpxx_rm(W(RS), Mebp, W(DT))
+
+#else /* RT_RUNTIME */
+
+#define ASM_ENTER_K(__Info__, __Key__)                                      \
+{                                                                           \
+    rt_ui64 __Spec__ = (rt_ui64)(__Key__);                                  \
+        ASM_ENTER(__Info__)
+
+#define ASM_LEAVE_K(__Info__)                                               \
+        ASM_LEAVE(__Info__)                                                 \
+}
+
+#define movwx_rk(RD, DS, KS)                                                \
+        movwx_ri(W(RD), IW(KS))
+
+#define movxx_rk(RD, DS, KS)                                                \
+        movxx_ri(W(RD), IV(KS))
+
+#define addwx_rk(RG, DS, KS)                                                \
+        addwx_ri(W(RG), IW(KS))
+
+#define addxx_rk(RG, DS, KS)                                                \
+        addxx_ri(W(RG), IV(KS))
+
+#define subwx_rk(RG, DS, KS)                                                \
+        subwx_ri(W(RG), IW(KS))
+
+#define subxx_rk(RG, DS, KS)                                                \
+        subxx_ri(W(RG), IV(KS))
+
+#define mulwx_rk(RG, DS, KS)                                                \
+        mulwx_ri(W(RG), IW(KS))
+
+#define mulxx_rk(RG, DS, KS)                                                \
+        mulxx_ri(W(RG), IV(KS))
+
+#define cmpwx_rk(RS, DT, KT)                                                \
+        cmpwx_ri(W(RS), IW(KT))
+
+#define cmpxx_rk(RS, DT, KT)                                                \
+        cmpxx_ri(W(RS), IV(KT))
+
+#endif /* RT_RUNTIME */
+
+/*
+ * Targets without partial register save/load (all but x86_64 for now)
+ * map ASM_ENTER_R/ASM_LEAVE_R to the full ASM_ENTER/ASM_LEAVE versions,
+ * register masks are ignored there.
+ */
+
+#ifndef ASM_ENTER_R
+
+#define RM(RG)  0
+
+#define ASM_ENTER_R(__Info__, __Base__, __Simd__)                           \
+        ASM_ENTER(__Info__)
+
+#define ASM_LEAVE_R(__Info__, __Base__, __Simd__)                           \
+        ASM_LEAVE(__Info__)
+
+#endif /* ASM_ENTER_R */
+
+/*
+ * Targets without BASE-only sections (all but x86_64 for now, multi-target
+ * builds are only supported there) map ASM_ENTER_B/ASM_LEAVE_B
+ * to the full ASM_ENTER/ASM_LEAVE versions.
+ */
+
+#ifndef ASM_ENTER_B
+
+#define ASM_ENTER_B(__Info__)                                               \
+        ASM_ENTER(__Info__)
+
+#define ASM_LEAVE_B(__Info__)                                               \
+        ASM_LEAVE(__Info__)
+
+#endif /* ASM_ENTER_B */
+
 #endif /* RT_RTARCH_H */
 
 /******************************************************************************/
@@ -1567,6 +1567,47 @@
         EMITW(0x1B008000 | MRM(Tedx,    Teax,    TMxx) | Tedx << 10)        \
                                                           /* Redx<-rem */
 
+/* cnt (D = number of bits set in S), population count
+ * clz (D = number of leading zeroes in S), 32 if S is 0
+ * ctz (D = number of trailing zeroes in S), 32 if S is 0
+ * set-flags: undefined
+ * cnt uses v31 (TmmM of SIMD-targets) internally as a temp register */
+
+#define cntwx_rr(RD, RS)                                                    \
+        EMITW(0x1E270000 | MRM(0x1F,    REG(RS), 0x00))                     \
+        EMITW(0x0E205800 | MRM(0x1F,    0x1F,    0x00))                     \
+        EMITW(0x0E31B800 | MRM(0x1F,    0x1F,    0x00))                     \
+        EMITW(0x1E260000 | MRM(REG(RD), 0x1F,    0x00))
+
+#define cntwx_ld(RD, MS, DS)                                                \
+        movwx_ld(W(RD), W(MS), W(DS))                                       \
+        cntwx_rr(W(RD), W(RD))
+
+#define clzwx_rr(RD, RS)                                                    \
+        EMITW(0x5AC01000 | MRM(REG(RD), REG(RS), 0x00))
+
+#define clzwx_ld(RD, MS, DS)                                                \
+        movwx_ld(W(RD), W(MS), W(DS))                                       \
+        clzwx_rr(W(RD), W(RD))
+
+#define ctzwx_rr(RD, RS)                                                    \
+        EMITW(0x5AC00000 | MRM(REG(RD), REG(RS), 0x00))                     \
+        EMITW(0x5AC01000 | MRM(REG(RD), REG(RD), 0x00))
+
+#define ctzwx_ld(RD, MS, DS)                                                \
+        movwx_ld(W(RD), W(MS), W(DS))                                       \
+        ctzwx_rr(W(RD), W(RD))
+
+/* bsw (D = S with the order of bytes reversed), byte-swap
+ * set-flags: no */
+
+#define bswwx_rr(RD, RS)                                                    \
+        EMITW(0x5AC00800 | MRM(REG(RD), REG(RS), 0x00))
+
+#define bswwx_ld(RD, MS, DS)                                                \
+        movwx_ld(W(RD), W(MS), W(DS))                                       \
+        bswwx_rr(W(RD), W(RD))
+
 /* arj (G = G op S, if cc G then jump lb)
  * set-flags: undefined
  * refer to individual instruction descriptions
@@ -1806,7 +1847,9 @@
         shlwx_ri(Recx, IB(26))                                              \
         orrwx_rr(Resi, Recx)  /* 2K8-bit to RT_2K8=4 */                     \
         andwx_ri(Resi, IV(0x5515174F)) /* NEON: 0,1,2,3,6,8,9; SVE: rest */ \
-        movwx_st(Resi, Mebp, inf_VER)
+        movwx_st(Resi, Mebp, inf_VER)                                       \
+        EMITW(0xD53B00E0 | MRM(Teax, 0x00, 0x00)) /* DCZID_EL0 for zcl */   \
+        movwx_st(Reax, Mebp, inf_DCZID)
 
 /************************* address-sized instructions *************************/
 
@@ -1817,6 +1860,62 @@
         AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C3(DS), EMPTY2)   \
         EMITW(0x0B000000 | MRM(REG(RD), MOD(MS), TDxx) | ADR)
 
+/* pf0, pf1, pf2, pfn (prefetch [S] into cache, T0/T1/T2-hints, NTA-hint)
+ * T0 - all cache levels, T1 - L2 and up, T2 - L3 and up (if available),
+ * NTA - non-temporal (streaming), hints are advisory, never fault on [S]
+ * set-flags: no */
+
+#define pf0xx_ld(MS, DS)                                                    \
+        AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C3(DS), EMPTY2)   \
+        EMITW(0xF8A06800 | MRM(0x00,    MOD(MS), TDxx))
+
+#define pf1xx_ld(MS, DS)                                                    \
+        AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C3(DS), EMPTY2)   \
+        EMITW(0xF8A06800 | MRM(0x02,    MOD(MS), TDxx))
+
+#define pf2xx_ld(MS, DS)                                                    \
+        AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C3(DS), EMPTY2)   \
+        EMITW(0xF8A06800 | MRM(0x04,    MOD(MS), TDxx))
+
+#define pfnxx_ld(MS, DS)                                                    \
+        AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C3(DS), EMPTY2)   \
+        EMITW(0xF8A06800 | MRM(0x01,    MOD(MS), TDxx))
+
+/* sfn (fence for stores), orders all prior stores before any later stores
+ * place after non-temporal stores (stn) before [D] is read by other threads
+ * set-flags: no */
+
+#define sfnce_xx()                                                          \
+        EMITW(0xD5033ABF)
+
+/* zcl (zero 128-byte block at [D]), [D] must be aligned to 128 bytes
+ * two dc zva (no read-for-ownership) if DCZID_EL0 saved by verxx_xx reports
+ * enabled 64-byte blocks, otherwise (or if verxx_xx wasn't run) 8 stp of xzr
+ * set-flags: no */
+
+#define zclxx_st(MD, DD)                                                    \
+        AUW(SIB(MD),  EMPTY,  EMPTY,    MOD(MD), VAL(DD), C3(DD), EMPTY2)   \
+        EMITW(0x0B000000 | MRM(TDxx,    MOD(MD), TDxx) | ADR)               \
+        zclxx_ld(Mebp,  inf_DCZID)                                          \
+        EMITW(0x521E0000 | MRM(TMxx,    TMxx,    0x00)) /* eor #4 */        \
+        EMITW(0x350000A0 | MRM(TMxx,    0x00,    0x00)) /* cbnz +5 */       \
+        EMITW(0xD50B7420 | MRM(TDxx,    0x00,    0x00))                     \
+        EMITW(0x11010000 | MRM(TDxx,    TDxx,    0x00) | ADR)               \
+        EMITW(0xD50B7420 | MRM(TDxx,    0x00,    0x00))                     \
+        EMITW(0x14000009)                                  /* b +9 */       \
+        zclxx_r4(0x00)                                                      \
+        zclxx_r4(0x40)
+
+#define zclxx_ld(MS, DS) /* not portable, do not use outside */             \
+        AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C1(DS), EMPTY2)   \
+        EMITW(0xB8400000 | MDM(TMxx,    MOD(MS), VAL(DS), B1(DS), P1(DS)))
+
+#define zclxx_r4(dp) /* not portable, do not use outside */                 \
+        EMITW(0xA9007C1F | MRM(0x00,    TDxx,    0x00) | (dp+0x00) << 12)   \
+        EMITW(0xA9007C1F | MRM(0x00,    TDxx,    0x00) | (dp+0x10) << 12)   \
+        EMITW(0xA9007C1F | MRM(0x00,    TDxx,    0x00) | (dp+0x20) << 12)   \
+        EMITW(0xA9007C1F | MRM(0x00,    TDxx,    0x00) | (dp+0x30) << 12)
+
 /************************* pointer-sized instructions *************************/
 
 /* label (D = Reax = adr lb)
@@ -243,6 +243,13 @@
         AUW(SIB(MD),  EMPTY,  EMPTY,    MOD(MD), VAL(DD), C2(DD), EMPTY2)   \
         EMITW(0x3C800000 | MPM(REG(XS), MOD(MD), VAL(DD), B2(DD), P2(DD)))
 
+/* bcs (D = [M]) broadcast scalar element from memory into all SIMD elements */
+
+#define bcsix_ld(XD, MS, DS)                                                \
+        AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C1(DS), EMPTY2)   \
+        EMITW(0xBC400000 | MPM(REG(XD), MOD(MS), VAL(DS), B1(DS), P1(DS)))  \
+        EMITW(0x4E040400 | MXM(REG(XD), REG(XD), 0x00))
+
 /* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
  * uses Xmm0 implicitly as a mask register, destroys Xmm0, 0-masked XS elems */
 
@@ -260,6 +267,118 @@
         EMITW(0x6EA01C00 | MXM(TmmM,    REG(XS), Tmm0))                     \
         EMITW(0x3C800000 | MPM(TmmM,    MOD(MG), VAL(DG), B2(DG), P2(DG)))
 
+/* shf (G = G[IS]), (D = S[IT]) shuffle elements within each 128-bit lane
+ * 2-bit fields of the immediate select 32-bit elements in each 128-bit lane */
+
+#define shfix_ri(XG, IS)                                                    \
+        shfix3ri(W(XG), W(XG), W(IS))
+
+#define shfix3ri(XD, XS, IT)                                                \
+        shfix_rx(REG(XS), VAL(IT), 0)                                       \
+        shfix_rx(REG(XS), VAL(IT), 1)                                       \
+        shfix_rx(REG(XS), VAL(IT), 2)                                       \
+        shfix_rx(REG(XS), VAL(IT), 3)                                       \
+        EMITW(0x4EA01C00 | MXM(REG(XD), TmmM,    TmmM))
+
+#define shfix_rx(XS, it, nx) /* not portable, do not use outside */         \
+        EMITW(0x6E040400 | MXM(TmmM,    (XS),    0x00) |                    \
+                           (nx) << 19 | (3 & (it) >> (nx)*2) << 13)
+
+/* tbl (G = G[S]), (D = S[T]) permute elements across the SIMD register
+ * indices are in elements, taken modulo the number of elements in SIMD */
+
+#define tblix_rr(XG, XS)                                                    \
+        tblix3rr(W(XG), W(XG), W(XS))
+
+#define tblix3rr(XD, XS, XT)                                                \
+        EMITW(0x4F3E5400 | MXM(TmmM,    REG(XT), 0x00))                     \
+        EMITW(0x6F240400 | MXM(TmmM,    TmmM,    0x00))                     \
+        EMITW(0x6F285400 | MXM(TmmM,    TmmM,    0x00))                     \
+        EMITW(0x6F305400 | MXM(TmmM,    TmmM,    0x00))                     \
+        EMITW(0x4F003420 | MXM(TmmM,    0x00,    0x00))                     \
+        EMITW(0x4F005440 | MXM(TmmM,    0x00,    0x00))                     \
+        EMITW(0x4F007460 | MXM(TmmM,    0x00,    0x00))                     \
+        EMITW(0x4E000000 | MXM(REG(XD), REG(XS), TmmM))
+
+/* aln (G = [S:G] >> IT) concatenate S and G, shift right by IT elements
+ * keeping the lower half, bc0 (D = S[0]) broadcast element 0 (not portable) */
+
+#define alnix_ri(XG, XS, IT) /* not portable, do not use outside */         \
+        EMITW(0x6E000000 | MXM(REG(XG), REG(XG), REG(XS)) |                 \
+                           (0x03 & VAL(IT)) << 13)
+
+#define bc0ix_rr(XD, XS) /* not portable, do not use outside */             \
+        EMITW(0x4E040400 | MXM(REG(XD), REG(XS), 0x00))
+
+/* scn (D[i] = S[0] op .. op S[i]) inclusive scan of S with "op" in log2
+ * steps, scz shifts in zeroes (add), scs repeats S[0] (min/max, idempotent),
+ * sce shifts D up by one element (exclusive scan), Xmm0 is used as a temp */
+
+#define sczix_rx(XD, XS, op) /* not portable, do not use outside */         \
+        xorix_rr(Xmm0, Xmm0)                                                \
+        alnix_ri(Xmm0, W(XS), IB(3))                                        \
+        op(Xmm0, W(XS))                                                     \
+        xorix_rr(W(XD), W(XD))                                              \
+        alnix_ri(W(XD), Xmm0, IB(2))                                        \
+        op(W(XD), Xmm0)
+
+#define scsix_rx(XD, XS, op) /* not portable, do not use outside */         \
+        bc0ix_rr(Xmm0, W(XS))                                               \
+        alnix_ri(Xmm0, W(XS), IB(3))                                        \
+        op(Xmm0, W(XS))                                                     \
+        bc0ix_rr(W(XD), Xmm0)                                               \
+        alnix_ri(W(XD), Xmm0, IB(2))                                        \
+        op(W(XD), Xmm0)
+
+#define sceix_rx(XD) /* not portable, do not use outside */                 \
+        xorix_rr(Xmm0, Xmm0)                                                \
+        alnix_ri(Xmm0, W(XD), IB(3))                                        \
+        movix_rr(W(XD), Xmm0)
+
+/* adi (D[i] = S[0] + .. + S[i]) inclusive prefix sum of elements of S
+ * uses Xmm0 implicitly as a temp register, destroys Xmm0, XD/XS != Xmm0 */
+
+#define adiis_rr(XD, XS)                                                    \
+        sczix_rx(W(XD), W(XS), addis_rr)
+
+#define adiix_rr(XD, XS)                                                    \
+        sczix_rx(W(XD), W(XS), addix_rr)
+
+/* ade (D[i] = S[0] + .. + S[i-1]) exclusive prefix sum of S, D[0] = 0
+ * uses Xmm0 implicitly as a temp register, destroys Xmm0, XD/XS != Xmm0 */
+
+#define adeis_rr(XD, XS)                                                    \
+        sczix_rx(W(XD), W(XS), addis_rr)                                    \
+        sceix_rx(W(XD))
+
+#define adeix_rr(XD, XS)                                                    \
+        sczix_rx(W(XD), W(XS), addix_rr)                                    \
+        sceix_rx(W(XD))
+
+/* mni (D[i] = min(S[0], .. , S[i])) inclusive prefix min of elements of S
+ * uses Xmm0 implicitly as a temp register, destroys Xmm0, XD/XS != Xmm0 */
+
+#define mniis_rr(XD, XS)                                                    \
+        scsix_rx(W(XD), W(XS), minis_rr)
+
+#define mniix_rr(XD, XS)                                                    \
+        scsix_rx(W(XD), W(XS), minix_rr)
+
+#define mniin_rr(XD, XS)                                                    \
+        scsix_rx(W(XD), W(XS), minin_rr)
+
+/* mxi (D[i] = max(S[0], .. , S[i])) inclusive prefix max of elements of S
+ * uses Xmm0 implicitly as a temp register, destroys Xmm0, XD/XS != Xmm0 */
+
+#define mxiis_rr(XD, XS)                                                    \
+        scsix_rx(W(XD), W(XS), maxis_rr)
+
+#define mxiix_rr(XD, XS)                                                    \
+        scsix_rx(W(XD), W(XS), maxix_rr)
+
+#define mxiin_rr(XD, XS)                                                    \
+        scsix_rx(W(XD), W(XS), maxin_rr)
+
 /* and (G = G & S), (D = S & T) if (#D != #T) */
 
 #define andix_rr(XG, XS)                                                    \
@@ -422,6 +541,13 @@
         /* mlp, mlh are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  mlhis_rr
+#define mlhis_rr(XD, XS) /* horizontal reductive mul */                     \
+        EMITW(0x6E004000 | MXM(TmmM,    REG(XS), REG(XS)))                  \
+        EMITW(0x6E20DC00 | MXM(REG(XD), REG(XS), TmmM))                     \
+        EMITW(0x4EA00800 | MXM(TmmM,    REG(XD), 0x00))                     \
+        EMITW(0x6E20DC00 | MXM(REG(XD), REG(XD), TmmM))
+
 /* div (G = G / S), (D = S / T) if (#D != #T) and on ARMv7 if (#D != #S) */
 
 #define divis_rr(XG, XS)                                                    \
@@ -541,6 +667,16 @@
         /* mnp, mnh are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  mnpis3rr
+#define mnpis3rr(XD, XS, XT)                                                \
+        EMITW(0x6EA0F400 | MXM(REG(XD), REG(XS), REG(XT)))
+
+#undef  mnpis3ld
+#define mnpis3ld(XD, XS, MT, DT)                                            \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x3CC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x6EA0F400 | MXM(REG(XD), REG(XS), TmmM))
+
 /* max (G = G > S ? G : S), (D = S > T ? S : T) if (#D != #T) */
 
 #define maxis_rr(XG, XS)                                                    \
@@ -560,6 +696,16 @@
         /* mxp, mxh are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  mxpis3rr
+#define mxpis3rr(XD, XS, XT)                                                \
+        EMITW(0x6E20F400 | MXM(REG(XD), REG(XS), REG(XT)))
+
+#undef  mxpis3ld
+#define mxpis3ld(XD, XS, MT, DT)                                            \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x3CC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x6E20F400 | MXM(REG(XD), REG(XS), TmmM))
+
 /* ceq (G = G == S ? -1 : 0), (D = S == T ? -1 : 0) if (#D != #T) */
 
 #define ceqis_rr(XG, XS)                                                    \
@@ -813,6 +959,27 @@
         EMITW(0x4E21A800 | MXM(REG(XD), REG(XS), 0x00) |                    \
         (RT_SIMD_MODE_##mode&1) << 23 | (RT_SIMD_MODE_##mode&2) << 11)
 
+/* cvy (D = fp16-to-fp32 S), widens lower half of fp16 elements in S
+ * cvx (D = fp32-to-fp16 S), narrows to lower half of D, upper half is 0
+ * narrowing rounds to nearest-even, _ld/_st access the lower half only
+ * NOTE: fcvtn rounds as set in fp control register (in FCTRL blocks) */
+
+#define cvygs_rr(XD, XS)                                                    \
+        EMITW(0x0E217800 | MXM(REG(XD), REG(XS), 0x00))
+
+#define cvygs_ld(XD, MS, DS)                                                \
+        AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C1(DS), EMPTY2)   \
+        EMITW(0xFC400000 | MPM(TmmM,    MOD(MS), VXL(DS), B1(DS), P1(DS)))  \
+        EMITW(0x0E217800 | MXM(REG(XD), TmmM,    0x00))
+
+#define cvxis_rr(XD, XS)                                                    \
+        EMITW(0x0E216800 | MXM(REG(XD), REG(XS), 0x00))
+
+#define cvxis_st(XS, MD, DD)                                                \
+        EMITW(0x0E216800 | MXM(TmmM,    REG(XS), 0x00))                     \
+        AUW(SIB(MD),  EMPTY,  EMPTY,    MOD(MD), VAL(DD), C1(DD), EMPTY2)   \
+        EMITW(0xFC000000 | MPM(TmmM,    MOD(MD), VXL(DD), B1(DD), P1(DD)))
+
 /************   packed single-precision integer arithmetic/shifts   ***********/
 
 /* add (G = G + S), (D = S + T) if (#D != #T) */
@@ -863,6 +1030,35 @@
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
         EMITW(0x4EA09C00 | MXM(REG(XD), REG(XS), TmmM))
 
+/* muh (G = G * S), keeps upper half of the full-width product of elements
+ * unsigned-[x] or signed-[n], lower half is returned by mul
+ * lower and upper pairs of elements are multiplied into 64-bit products
+ * with umull/umull2 (smull/smull2), then uzp2 gathers their upper halves */
+
+#define muhix_rr(XG, XS)                                                    \
+        EMITW(0x2EA0C000 | MXM(TmmM,    REG(XG), REG(XS)))                  \
+        EMITW(0x6EA0C000 | MXM(REG(XG), REG(XG), REG(XS)))                  \
+        EMITW(0x4E805800 | MXM(REG(XG), TmmM,    REG(XG)))
+
+#define muhix_ld(XG, MS, DS)                                                \
+        AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C2(DS), EMPTY2)   \
+        EMITW(0x3CC00000 | MPM(TmmM,    MOD(MS), VAL(DS), B2(DS), P2(DS)))  \
+        EMITW(0x2EA0C000 | MXM(TmmQ,    REG(XG), TmmM))                     \
+        EMITW(0x6EA0C000 | MXM(REG(XG), REG(XG), TmmM))                     \
+        EMITW(0x4E805800 | MXM(REG(XG), TmmQ,    REG(XG)))
+
+#define muhin_rr(XG, XS)                                                    \
+        EMITW(0x0EA0C000 | MXM(TmmM,    REG(XG), REG(XS)))                  \
+        EMITW(0x4EA0C000 | MXM(REG(XG), REG(XG), REG(XS)))                  \
+        EMITW(0x4E805800 | MXM(REG(XG), TmmM,    REG(XG)))
+
+#define muhin_ld(XG, MS, DS)                                                \
+        AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C2(DS), EMPTY2)   \
+        EMITW(0x3CC00000 | MPM(TmmM,    MOD(MS), VAL(DS), B2(DS), P2(DS)))  \
+        EMITW(0x0EA0C000 | MXM(TmmQ,    REG(XG), TmmM))                     \
+        EMITW(0x4EA0C000 | MXM(REG(XG), REG(XG), TmmM))                     \
+        EMITW(0x4E805800 | MXM(REG(XG), TmmQ,    REG(XG)))
+
 /* shl (G = G << S), (D = S << T) if (#D != #T) - plain, unsigned
  * for maximum compatibility: shift count must be modulo elem-size */
 
@@ -980,6 +1176,54 @@
         EMITW(0x6EA0B800 | MXM(TmmM,    TmmM,    0x00))                     \
         EMITW(0x4EA04400 | MXM(REG(XD), REG(XS), TmmM))
 
+/* cnt (D = number of bits set in each element of S), population count */
+
+#define cntix_rr(XD, XS)                                                    \
+        EMITW(0x4E205800 | MXM(REG(XD), REG(XS), 0x00))                     \
+        EMITW(0x6E202800 | MXM(REG(XD), REG(XD), 0x00))                     \
+        EMITW(0x6E602800 | MXM(REG(XD), REG(XD), 0x00))
+
+#define cntix_ld(XD, MS, DS)                                                \
+        AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C2(DS), EMPTY2)   \
+        EMITW(0x3CC00000 | MPM(TmmM,    MOD(MS), VAL(DS), B2(DS), P2(DS)))  \
+        EMITW(0x4E205800 | MXM(REG(XD), TmmM,    0x00))                     \
+        EMITW(0x6E202800 | MXM(REG(XD), REG(XD), 0x00))                     \
+        EMITW(0x6E602800 | MXM(REG(XD), REG(XD), 0x00))
+
+/* clz (D = number of leading zeroes in each element of S), 32 if 0 */
+
+#define clzix_rr(XD, XS)                                                    \
+        EMITW(0x6EA04800 | MXM(REG(XD), REG(XS), 0x00))
+
+#define clzix_ld(XD, MS, DS)                                                \
+        AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C2(DS), EMPTY2)   \
+        EMITW(0x3CC00000 | MPM(TmmM,    MOD(MS), VAL(DS), B2(DS), P2(DS)))  \
+        EMITW(0x6EA04800 | MXM(REG(XD), TmmM,    0x00))
+
+/* ctz (D = number of trailing zeroes in each element of S), 32 if 0 */
+
+#define ctzix_rr(XD, XS)                                                    \
+        EMITW(0x6E605800 | MXM(REG(XD), REG(XS), 0x00))                     \
+        EMITW(0x6E200800 | MXM(REG(XD), REG(XD), 0x00))                     \
+        EMITW(0x6EA04800 | MXM(REG(XD), REG(XD), 0x00))
+
+#define ctzix_ld(XD, MS, DS)                                                \
+        AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C2(DS), EMPTY2)   \
+        EMITW(0x3CC00000 | MPM(TmmM,    MOD(MS), VAL(DS), B2(DS), P2(DS)))  \
+        EMITW(0x6E605800 | MXM(REG(XD), TmmM,    0x00))                     \
+        EMITW(0x6E200800 | MXM(REG(XD), REG(XD), 0x00))                     \
+        EMITW(0x6EA04800 | MXM(REG(XD), REG(XD), 0x00))
+
+/* bsw (D = S with the order of bytes reversed in each element) */
+
+#define bswix_rr(XD, XS)                                                    \
+        EMITW(0x6E200800 | MXM(REG(XD), REG(XS), 0x00))
+
+#define bswix_ld(XD, MS, DS)                                                \
+        AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C2(DS), EMPTY2)   \
+        EMITW(0x3CC00000 | MPM(TmmM,    MOD(MS), VAL(DS), B2(DS), P2(DS)))  \
+        EMITW(0x6E200800 | MXM(REG(XD), TmmM,    0x00))
+
 /****************   packed single-precision integer compare   *****************/
 
 /* min (G = G < S ? G : S), (D = S < T ? S : T) if (#D != #T), unsigned */
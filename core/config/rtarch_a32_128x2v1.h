@@ -186,6 +186,15 @@
         EMITW(0x6EA01C00 | MXM(TmmM,    RYG(XS), Tmm0+16))                  \
         EMITW(0x3D800000 | MPM(TmmM,    MOD(MG), VYL(DG), B4(DG), L2(DG)))
 
+/* hrd (D = S op S op ..) reduce all elements of S with "op" into each of D
+ * combining halves first, then via in-register pairwise "pp" steps */
+
+#define hrdcs_rx(XD, XS, op, pp) /* not portable, do not use outside */     \
+        EMITW(op | MXM(TmmM,    REG(XS), RYG(XS)))                          \
+        EMITW(pp | MXM(TmmM,    TmmM,    TmmM))                             \
+        EMITW(pp | MXM(REG(XD), TmmM,    TmmM))                             \
+        EMITW(pp | MXM(RYG(XD), TmmM,    TmmM))
+
 /* and (G = G & S), (D = S & T) if (#D != #T) */
 
 #define andcx_rr(XG, XS)                                                    \
@@ -336,6 +345,10 @@
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
         EMITW(0x6E20D400 | MXM(RYG(XD), RYG(XD), TmmM))
 
+#undef  adhcs_rr
+#define adhcs_rr(XD, XS) /* horizontal reductive add, first 15-regs only */ \
+        hrdcs_rx(W(XD), W(XS), 0x4E20D400, 0x6E20D400)
+
 /* sub (G = G - S), (D = S - T) if (#D != #T) */
 
 #define subcs_rr(XG, XS)                                                    \
@@ -377,6 +390,15 @@
         /* mlp, mlh are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  mlhcs_rr
+#define mlhcs_rr(XD, XS) /* horizontal reductive mul */                     \
+        EMITW(0x6E20DC00 | MXM(TmmM,    REG(XS), RYG(XS)))                  \
+        EMITW(0x6E004000 | MXM(REG(XD), TmmM,    TmmM))                     \
+        EMITW(0x6E20DC00 | MXM(TmmM,    TmmM,    REG(XD)))                  \
+        EMITW(0x4EA00800 | MXM(REG(XD), TmmM,    0x00))                     \
+        EMITW(0x6E20DC00 | MXM(REG(XD), REG(XD), TmmM))                     \
+        EMITW(0x4EA01C00 | MXM(RYG(XD), REG(XD), REG(XD)))
+
 /* div (G = G / S), (D = S / T) if (#D != #T) and on ARMv7 if (#D != #S) */
 
 #define divcs_rr(XG, XS)                                                    \
@@ -518,6 +540,10 @@
         /* mnp, mnh are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  mnhcs_rr
+#define mnhcs_rr(XD, XS) /* horizontal reductive min */                     \
+        hrdcs_rx(W(XD), W(XS), 0x4EA0F400, 0x6EA0F400)
+
 /* max (G = G > S ? G : S), (D = S > T ? S : T) if (#D != #T) */
 
 #define maxcs_rr(XG, XS)                                                    \
@@ -540,6 +566,10 @@
         /* mxp, mxh are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  mxhcs_rr
+#define mxhcs_rr(XD, XS) /* horizontal reductive max */                     \
+        hrdcs_rx(W(XD), W(XS), 0x4E20F400, 0x6E20F400)
+
 /* ceq (G = G == S ? -1 : 0), (D = S == T ? -1 : 0) if (#D != #T) */
 
 #define ceqcs_rr(XG, XS)                                                    \
@@ -192,6 +192,163 @@
         EMITW(0x05A0C400 | MXM(TmmM,    REG(XS), TmmM))                     \
         EMITW(0xE5804000 | MPM(TmmM,    MOD(MG), VAL(DG), B3(DG), F1(DG)))
 
+/* mtl (D = S) move the first RS lanes only (loop tails), 0 <= RS <= S
+ * load zeroes the remaining lanes of XD, store keeps memory past RS lanes,
+ * memory past RS lanes is never accessed, RS holds the count as cmdw value,
+ * uses p1 as a temp predicate register here (whilelt) */
+
+#define mtlox_ld(XD, RS, MS, DS)                                            \
+        adrox_xa(W(MS), W(DS))                                              \
+        EMITW(0x25A00400 | MRM(0x01,    TZxx,    REG(RS)))                  \
+        EMITW(0xA540A400 | MRM(REG(XD), TPxx,    0x00))
+
+#define mtlox_st(XS, RS, MD, DD)                                            \
+        adrox_xa(W(MD), W(DD))                                              \
+        EMITW(0x25A00400 | MRM(0x01,    TZxx,    REG(RS)))                  \
+        EMITW(0xE540E400 | MRM(REG(XS), TPxx,    0x00))
+
+/* gat (D = [M + S]) gather elements at per-lane indices S from M/DS,
+ * indices are in elements within [0, 2^31) (sign-extended 32-bit ones),
+ * M*** or Oeax, but not indexed modes (I***, ...), XD/XS differ,
+ * native SVE ld1w with sxtw-extended vector-index scaled by element size */
+
+#define gatox_ld(XD, XS, MS, DS)                                            \
+        adrox_xa(W(MS), W(DS))                                              \
+        EMITW(0x85604000 | MXM(REG(XD), TPxx,    REG(XS)))
+
+/* sct (M + T = S) scatter elements of S to per-lane indices T at M/DD,
+ * indices are in elements within [0, 2^31) (sign-extended 32-bit ones),
+ * M*** or Oeax, but not indexed modes (I***, ...),
+ * colliding indices are written in lane order (the highest lane wins),
+ * native SVE st1w with sxtw-extended vector-index scaled by element size */
+
+#define sctox_st(XS, XT, MD, DD)                                            \
+        adrox_xa(W(MD), W(DD))                                              \
+        EMITW(0xE560C000 | MXM(REG(XS), TPxx,    REG(XT)))
+
+/* computes full address M/DS into TPxx for SVE modes lacking displacement */
+
+#define adrox_xa(MS, DS) /* not portable, do not use outside */             \
+        AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C3(DS), EMPTY2)   \
+        EMITW(0x0B000000 | MRM(TPxx,    MOD(MS), TDxx) | ADR)
+
+/* tbl (G = G[S]), (D = S[T]) permute elements across the SIMD register
+ * indices are in elements, taken modulo the number of elements in SIMD */
+
+#define tblox_rr(XG, XS)                                                    \
+        tblox3rr(W(XG), W(XG), W(XS))
+
+#define tblox3rr(XD, XS, XT)                                                \
+        EMITW(0x25B8C000 | MXM(TmmM,    (RT_SIMD/32-1), 0x00))              \
+        EMITW(0x04203000 | MXM(TmmM,    REG(XT), TmmM))                     \
+        EMITW(0x05A03000 | MXM(REG(XD), REG(XS), TmmM))
+
+/* aln (G = [S:G] >> IT) concatenate S and G, shift right by IT elements
+ * keeping the lower half, bc0 (D = S[0]) broadcast element 0 (not portable) */
+
+#define alnox_ri(XG, XS, IT) /* not portable, do not use outside */         \
+        EMITW(0x05200000 | MXM(REG(XG), REG(XS), 0x00) |                    \
+                           (0x04 & VAL(IT) << 2) << 10 |                    \
+                           (0xF8 & VAL(IT) << 2) << 13)
+
+#define bc0ox_rr(XD, XS) /* not portable, do not use outside */             \
+        EMITW(0x05242000 | MXM(REG(XD), REG(XS), 0x00))
+
+/* scn (D[i] = S[0] op .. op S[i]) inclusive scan of S with "op" in log2
+ * steps, scz shifts in zeroes (add), scs repeats S[0] (min/max, idempotent),
+ * sce shifts D up by one element (exclusive scan), Xmm0 is used as a temp
+ * the number of log2 steps is set by RT_SIMD, sce is done via insr */
+
+#define sczox_rx(XD, XS, op) /* not portable, do not use outside */         \
+        movox_rr(W(XD), W(XS))                                              \
+        scnox_sa(W(XD), op, sczox_rf)
+
+#define scsox_rx(XD, XS, op) /* not portable, do not use outside */         \
+        movox_rr(W(XD), W(XS))                                              \
+        scnox_sa(W(XD), op, bc0ox_rr)
+
+#define sceox_rx(XD) /* not portable, do not use outside */                 \
+        EMITW(0x05A43BE0 | MXM(REG(XD), 0x00,    0x00))
+
+#define sczox_rf(XD, XS) /* not portable, do not use outside */             \
+        xorox_rr(W(XD), W(XD))
+
+#define scnox_sn(XD, op, fl, nk) /* not portable, do not use outside */     \
+        fl(Xmm0, W(XD))                                                     \
+        alnox_ri(Xmm0, W(XD), IB(RT_SIMD/32-(nk)))                          \
+        op(W(XD), Xmm0)
+
+#define scnox_s1(XD, op, fl) /* not portable, do not use outside */         \
+        scnox_sn(W(XD), op, fl, 0x01)                                       \
+        scnox_sn(W(XD), op, fl, 0x02)                                       \
+        scnox_sn(W(XD), op, fl, 0x04)
+
+#define scnox_s2(XD, op, fl) /* not portable, do not use outside */         \
+        scnox_s1(W(XD), op, fl)                                             \
+        scnox_sn(W(XD), op, fl, 0x08)
+
+#define scnox_s4(XD, op, fl) /* not portable, do not use outside */         \
+        scnox_s2(W(XD), op, fl)                                             \
+        scnox_sn(W(XD), op, fl, 0x10)
+
+#define scnox_s8(XD, op, fl) /* not portable, do not use outside */         \
+        scnox_s4(W(XD), op, fl)                                             \
+        scnox_sn(W(XD), op, fl, 0x20)
+
+#if   (RT_SIMD == 2048)
+#define scnox_sa(XD, op, fl)    scnox_s8(W(XD), op, fl)
+#elif (RT_SIMD == 1024)
+#define scnox_sa(XD, op, fl)    scnox_s4(W(XD), op, fl)
+#elif (RT_SIMD == 512)
+#define scnox_sa(XD, op, fl)    scnox_s2(W(XD), op, fl)
+#elif (RT_SIMD == 256)
+#define scnox_sa(XD, op, fl)    scnox_s1(W(XD), op, fl)
+#endif /* RT_SIMD: 2048, 1024, 512, 256 */
+
+/* adi (D[i] = S[0] + .. + S[i]) inclusive prefix sum of elements of S
+ * uses Xmm0 implicitly as a temp register, destroys Xmm0, XD/XS != Xmm0 */
+
+#define adios_rr(XD, XS)                                                    \
+        sczox_rx(W(XD), W(XS), addos_rr)
+
+#define adiox_rr(XD, XS)                                                    \
+        sczox_rx(W(XD), W(XS), addox_rr)
+
+/* ade (D[i] = S[0] + .. + S[i-1]) exclusive prefix sum of S, D[0] = 0
+ * uses Xmm0 implicitly as a temp register, destroys Xmm0, XD/XS != Xmm0 */
+
+#define adeos_rr(XD, XS)                                                    \
+        sczox_rx(W(XD), W(XS), addos_rr)                                    \
+        sceox_rx(W(XD))
+
+#define adeox_rr(XD, XS)                                                    \
+        sczox_rx(W(XD), W(XS), addox_rr)                                    \
+        sceox_rx(W(XD))
+
+/* mni (D[i] = min(S[0], .. , S[i])) inclusive prefix min of elements of S
+ * uses Xmm0 implicitly as a temp register, destroys Xmm0, XD/XS != Xmm0 */
+
+#define mnios_rr(XD, XS)                                                    \
+        scsox_rx(W(XD), W(XS), minos_rr)
+
+#define mniox_rr(XD, XS)                                                    \
+        scsox_rx(W(XD), W(XS), minox_rr)
+
+#define mnion_rr(XD, XS)                                                    \
+        scsox_rx(W(XD), W(XS), minon_rr)
+
+/* mxi (D[i] = max(S[0], .. , S[i])) inclusive prefix max of elements of S
+ * uses Xmm0 implicitly as a temp register, destroys Xmm0, XD/XS != Xmm0 */
+
+#define mxios_rr(XD, XS)                                                    \
+        scsox_rx(W(XD), W(XS), maxos_rr)
+
+#define mxiox_rr(XD, XS)                                                    \
+        scsox_rx(W(XD), W(XS), maxox_rr)
+
+#define mxion_rr(XD, XS)                                                    \
+        scsox_rx(W(XD), W(XS), maxon_rr)
+
 /* and (G = G & S), (D = S & T) if (#D != #T) */
 
 #define andox_rr(XG, XS)                                                    \
@@ -909,6 +1066,30 @@
         rnros_rr(W(XD), W(XS), mode)                                        \
         cvzos_rr(W(XD), W(XD))
 
+/* cvy (D = fp16-to-fp32 S), widens lower half of fp16 elements in S
+ * cvx (D = fp32-to-fp16 S), narrows to lower half of D, upper half is 0
+ * narrowing rounds to nearest-even, _ld/_st access the lower half only
+ * NOTE: fcvt rounds as set in fp control register (in FCTRL blocks) */
+
+#define cvyms_rr(XD, XS)                                                    \
+        EMITW(0x05606000 | MXM(TmmM,    REG(XS), REG(XS)))                  \
+        EMITW(0x6589A000 | MXM(REG(XD), TmmM,    0x00))
+
+#define cvyms_ld(XD, MS, DS)                                                \
+        adrox_xa(W(MS), W(DS))                                              \
+        EMITW(0xA4C0A000 | MXM(TmmM,    TPxx,    0x00))                     \
+        EMITW(0x6589A000 | MXM(REG(XD), TmmM,    0x00))
+
+#define cvxos_rr(XD, XS)                                                    \
+        EMITW(0x6588A000 | MXM(TmmM,    REG(XS), 0x00))                     \
+        EMITW(0x25B8C000 | MXM(REG(XD), 0x00,    0x00))                     \
+        EMITW(0x05606800 | MXM(REG(XD), TmmM,    REG(XD)))
+
+#define cvxos_st(XS, MD, DD)                                                \
+        EMITW(0x6588A000 | MXM(TmmM,    REG(XS), 0x00))                     \
+        adrox_xa(W(MD), W(DD))                                              \
+        EMITW(0xE4C0E000 | MXM(TmmM,    TPxx,    0x00))
+
 /************   packed single-precision integer arithmetic/shifts   ***********/
 
 /* add (G = G + S), (D = S + T) if (#D != #T) */
@@ -1081,6 +1262,38 @@
         movox_rr(W(XD), W(XS))                                              \
         svron_ld(W(XD), W(MT), W(DT))
 
+/* cnt (D = number of bits set in each element of S), population count */
+
+#define cntox_rr(XD, XS)                                                    \
+        EMITW(0x049AA000 | MXM(REG(XD), REG(XS), 0x00))
+
+#define cntox_ld(XD, MS, DS)                                                \
+        AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), A1(DS), EMPTY2)   \
+        EMITW(0x85804000 | MPM(TmmM,    MOD(MS), VAL(DS), B3(DS), F1(DS)))  \
+        EMITW(0x049AA000 | MXM(REG(XD), TmmM,    0x00))
+
+/* clz (D = number of leading zeroes in each element of S), 32 if 0 */
+
+#define clzox_rr(XD, XS)                                                    \
+        EMITW(0x0499A000 | MXM(REG(XD), REG(XS), 0x00))
+
+#define clzox_ld(XD, MS, DS)                                                \
+        AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), A1(DS), EMPTY2)   \
+        EMITW(0x85804000 | MPM(TmmM,    MOD(MS), VAL(DS), B3(DS), F1(DS)))  \
+        EMITW(0x0499A000 | MXM(REG(XD), TmmM,    0x00))
+
+/* ctz (D = number of trailing zeroes in each element of S), 32 if 0 */
+
+#define ctzox_rr(XD, XS)                                                    \
+        EMITW(0x05A78000 | MXM(REG(XD), REG(XS), 0x00))                     \
+        EMITW(0x0499A000 | MXM(REG(XD), REG(XD), 0x00))
+
+#define ctzox_ld(XD, MS, DS)                                                \
+        AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), A1(DS), EMPTY2)   \
+        EMITW(0x85804000 | MPM(TmmM,    MOD(MS), VAL(DS), B3(DS), F1(DS)))  \
+        EMITW(0x05A78000 | MXM(TmmM,    TmmM,    0x00))                     \
+        EMITW(0x0499A000 | MXM(REG(XD), TmmM,    0x00))
+
 /****************   packed single-precision integer compare   *****************/
 
 /* min (G = G < S ? G : S), (D = S < T ? S : T) if (#D != #T), unsigned */
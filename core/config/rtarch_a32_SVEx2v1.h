@@ -204,6 +204,54 @@
         EMITW(0x05A0C400 | MXM(TmmM,    RYG(XS), TmmM))                     \
         EMITW(0xE5804000 | MPM(TmmM,    MOD(MG), VZL(DG), B3(DG), K1(DG)))
 
+/* mtl (D = S) move the first RS lanes only (loop tails), 0 <= RS <= S
+ * load zeroes the remaining lanes of XD, store keeps memory past RS lanes,
+ * memory past RS lanes is never accessed, RS holds the count as cmdw value,
+ * uses p1 as a temp predicate register here (whilelt) */
+
+#define mtlox_ld(XD, RS, MS, DS)                                            \
+        adrox_xa(W(MS), W(DS))                                              \
+        EMITW(0x25A00400 | MRM(0x01,    TZxx,    REG(RS)))                  \
+        EMITW(0xA540A400 | MRM(REG(XD), TPxx,    0x00))                     \
+        EMITW(0x52800000 | MRM(TDxx,    0x00,    0x00) | (RT_SIMD/64) << 5) \
+        EMITW(0x25A00400 | MRM(0x01,    TDxx,    REG(RS)))                  \
+        EMITW(0xA540A400 | MRM(RYG(XD), TPxx,    0x00) | 0x00010000)
+
+#define mtlox_st(XS, RS, MD, DD)                                            \
+        adrox_xa(W(MD), W(DD))                                              \
+        EMITW(0x25A00400 | MRM(0x01,    TZxx,    REG(RS)))                  \
+        EMITW(0xE540E400 | MRM(REG(XS), TPxx,    0x00))                     \
+        EMITW(0x52800000 | MRM(TDxx,    0x00,    0x00) | (RT_SIMD/64) << 5) \
+        EMITW(0x25A00400 | MRM(0x01,    TDxx,    REG(RS)))                  \
+        EMITW(0xE540E400 | MRM(RYG(XS), TPxx,    0x00) | 0x00010000)
+
+/* gat (D = [M + S]) gather elements at per-lane indices S from M/DS,
+ * indices are in elements within [0, 2^31) (sign-extended 32-bit ones),
+ * M*** or Oeax, but not indexed modes (I***, ...), XD/XS differ,
+ * native SVE ld1w with sxtw-extended vector-index scaled by element size */
+
+#define gatox_ld(XD, XS, MS, DS)                                            \
+        adrox_xa(W(MS), W(DS))                                              \
+        EMITW(0x85604000 | MXM(REG(XD), TPxx,    REG(XS)))                  \
+        EMITW(0x85604000 | MXM(RYG(XD), TPxx,    RYG(XS)))
+
+/* sct (M + T = S) scatter elements of S to per-lane indices T at M/DD,
+ * indices are in elements within [0, 2^31) (sign-extended 32-bit ones),
+ * M*** or Oeax, but not indexed modes (I***, ...),
+ * colliding indices are written in lane order (the highest lane wins),
+ * native SVE st1w with sxtw-extended vector-index scaled by element size */
+
+#define sctox_st(XS, XT, MD, DD)                                            \
+        adrox_xa(W(MD), W(DD))                                              \
+        EMITW(0xE560C000 | MXM(REG(XS), TPxx,    REG(XT)))                  \
+        EMITW(0xE560C000 | MXM(RYG(XS), TPxx,    RYG(XT)))
+
+/* computes full address M/DS into TPxx for SVE modes lacking displacement */
+
+#define adrox_xa(MS, DS) /* not portable, do not use outside */             \
+        AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C3(DS), EMPTY2)   \
+        EMITW(0x0B000000 | MRM(TPxx,    MOD(MS), TDxx) | ADR)
+
 /* and (G = G & S), (D = S & T) if (#D != #T) */
 
 #define andox_rr(XG, XS)                                                    \
@@ -893,6 +941,37 @@
         rnros_rr(W(XD), W(XS), mode)                                        \
         cvzos_rr(W(XD), W(XD))
 
+/* cvy (D = fp16-to-fp32 S), widens lower half of fp16 elements in S
+ * cvx (D = fp32-to-fp16 S), narrows to lower half of D, upper half is 0
+ * narrowing rounds to nearest-even, _ld/_st access the lower half only
+ * NOTE: fcvt rounds as set in fp control register (in FCTRL blocks) */
+
+#define cvyms_rr(XD, XS)                                                    \
+        EMITW(0x05606400 | MXM(TmmM,    REG(XS), REG(XS)))                  \
+        EMITW(0x6589A000 | MXM(RYG(XD), TmmM,    0x00))                     \
+        EMITW(0x05606000 | MXM(TmmM,    REG(XS), REG(XS)))                  \
+        EMITW(0x6589A000 | MXM(REG(XD), TmmM,    0x00))
+
+#define cvyms_ld(XD, MS, DS)                                                \
+        adrox_xa(W(MS), W(DS))                                              \
+        EMITW(0xA4C0A000 | MXM(TmmM,    TPxx,    0x00))                     \
+        EMITW(0x6589A000 | MXM(REG(XD), TmmM,    0x00))                     \
+        EMITW(0xA4C1A000 | MXM(TmmM,    TPxx,    0x00))                     \
+        EMITW(0x6589A000 | MXM(RYG(XD), TmmM,    0x00))
+
+#define cvxos_rr(XD, XS)                                                    \
+        EMITW(0x6588A000 | MXM(TmmM,    REG(XS), 0x00))                     \
+        EMITW(0x6588A000 | MXM(RYG(XD), RYG(XS), 0x00))                     \
+        EMITW(0x05606800 | MXM(REG(XD), TmmM,    RYG(XD)))                  \
+        EMITW(0x25B8C000 | MXM(RYG(XD), 0x00,    0x00))
+
+#define cvxos_st(XS, MD, DD)                                                \
+        adrox_xa(W(MD), W(DD))                                              \
+        EMITW(0x6588A000 | MXM(TmmM,    REG(XS), 0x00))                     \
+        EMITW(0xE4C0E000 | MXM(TmmM,    TPxx,    0x00))                     \
+        EMITW(0x6588A000 | MXM(TmmM,    RYG(XS), 0x00))                     \
+        EMITW(0xE4C1E000 | MXM(TmmM,    TPxx,    0x00))
+
 /************   packed single-precision integer arithmetic/shifts   ***********/
 
 /* add (G = G + S), (D = S + T) if (#D != #T) */
@@ -1095,6 +1174,49 @@
         movox_rr(W(XD), W(XS))                                              \
         svron_ld(W(XD), W(MT), W(DT))
 
+/* cnt (D = number of bits set in each element of S), population count */
+
+#define cntox_rr(XD, XS)                                                    \
+        EMITW(0x049AA000 | MXM(REG(XD), REG(XS), 0x00))                     \
+        EMITW(0x049AA000 | MXM(RYG(XD), RYG(XS), 0x00))
+
+#define cntox_ld(XD, MS, DS)                                                \
+        AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), A1(DS), EMPTY2)   \
+        EMITW(0x85804000 | MPM(TmmM,    MOD(MS), VAL(DS), B3(DS), K1(DS)))  \
+        EMITW(0x049AA000 | MXM(REG(XD), TmmM,    0x00))                     \
+        EMITW(0x85804000 | MPM(TmmM,    MOD(MS), VZL(DS), B3(DS), K1(DS)))  \
+        EMITW(0x049AA000 | MXM(RYG(XD), TmmM,    0x00))
+
+/* clz (D = number of leading zeroes in each element of S), 32 if 0 */
+
+#define clzox_rr(XD, XS)                                                    \
+        EMITW(0x0499A000 | MXM(REG(XD), REG(XS), 0x00))                     \
+        EMITW(0x0499A000 | MXM(RYG(XD), RYG(XS), 0x00))
+
+#define clzox_ld(XD, MS, DS)                                                \
+        AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), A1(DS), EMPTY2)   \
+        EMITW(0x85804000 | MPM(TmmM,    MOD(MS), VAL(DS), B3(DS), K1(DS)))  \
+        EMITW(0x0499A000 | MXM(REG(XD), TmmM,    0x00))                     \
+        EMITW(0x85804000 | MPM(TmmM,    MOD(MS), VZL(DS), B3(DS), K1(DS)))  \
+        EMITW(0x0499A000 | MXM(RYG(XD), TmmM,    0x00))
+
+/* ctz (D = number of trailing zeroes in each element of S), 32 if 0 */
+
+#define ctzox_rr(XD, XS)                                                    \
+        EMITW(0x05A78000 | MXM(REG(XD), REG(XS), 0x00))                     \
+        EMITW(0x0499A000 | MXM(REG(XD), REG(XD), 0x00))                     \
+        EMITW(0x05A78000 | MXM(RYG(XD), RYG(XS), 0x00))                     \
+        EMITW(0x0499A000 | MXM(RYG(XD), RYG(XD), 0x00))
+
+#define ctzox_ld(XD, MS, DS)                                                \
+        AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), A1(DS), EMPTY2)   \
+        EMITW(0x85804000 | MPM(TmmM,    MOD(MS), VAL(DS), B3(DS), K1(DS)))  \
+        EMITW(0x05A78000 | MXM(TmmM,    TmmM,    0x00))                     \
+        EMITW(0x0499A000 | MXM(REG(XD), TmmM,    0x00))                     \
+        EMITW(0x85804000 | MPM(TmmM,    MOD(MS), VZL(DS), B3(DS), K1(DS)))  \
+        EMITW(0x05A78000 | MXM(TmmM,    TmmM,    0x00))                     \
+        EMITW(0x0499A000 | MXM(RYG(XD), TmmM,    0x00))
+
 /****************   packed single-precision integer compare   *****************/
 
 /* min (G = G < S ? G : S), (D = S < T ? S : T) if (#D != #T), unsigned */
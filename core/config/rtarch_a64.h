@@ -1208,6 +1208,47 @@
         EMITW(0x9B008000 | MRM(Tedx,    Teax,    TMxx) | Tedx << 10)        \
                                                           /* Redx<-rem */
 
+/* cnt (D = number of bits set in S), population count
+ * clz (D = number of leading zeroes in S), 64 if S is 0
+ * ctz (D = number of trailing zeroes in S), 64 if S is 0
+ * set-flags: undefined
+ * cnt uses v31 (TmmM of SIMD-targets) internally as a temp register */
+
+#define cntzx_rr(RD, RS)                                                    \
+        EMITW(0x9E670000 | MRM(0x1F,    REG(RS), 0x00))                     \
+        EMITW(0x0E205800 | MRM(0x1F,    0x1F,    0x00))                     \
+        EMITW(0x0E31B800 | MRM(0x1F,    0x1F,    0x00))                     \
+        EMITW(0x9E660000 | MRM(REG(RD), 0x1F,    0x00))
+
+#define cntzx_ld(RD, MS, DS)                                                \
+        movzx_ld(W(RD), W(MS), W(DS))                                       \
+        cntzx_rr(W(RD), W(RD))
+
+#define clzzx_rr(RD, RS)                                                    \
+        EMITW(0xDAC01000 | MRM(REG(RD), REG(RS), 0x00))
+
+#define clzzx_ld(RD, MS, DS)                                                \
+        movzx_ld(W(RD), W(MS), W(DS))                                       \
+        clzzx_rr(W(RD), W(RD))
+
+#define ctzzx_rr(RD, RS)                                                    \
+        EMITW(0xDAC00000 | MRM(REG(RD), REG(RS), 0x00))                     \
+        EMITW(0xDAC01000 | MRM(REG(RD), REG(RD), 0x00))
+
+#define ctzzx_ld(RD, MS, DS)                                                \
+        movzx_ld(W(RD), W(MS), W(DS))                                       \
+        ctzzx_rr(W(RD), W(RD))
+
+/* bsw (D = S with the order of bytes reversed), byte-swap
+ * set-flags: no */
+
+#define bswzx_rr(RD, RS)                                                    \
+        EMITW(0xDAC00C00 | MRM(REG(RD), REG(RS), 0x00))
+
+#define bswzx_ld(RD, MS, DS)                                                \
+        movzx_ld(W(RD), W(MS), W(DS))                                       \
+        bswzx_rr(W(RD), W(RD))
+
 /* arj (G = G op S, if cc G then jump lb)
  * set-flags: undefined
  * refer to individual instruction descriptions
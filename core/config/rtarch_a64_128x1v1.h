@@ -154,6 +154,13 @@
         AUW(SIB(MD),  EMPTY,  EMPTY,    MOD(MD), VAL(DD), C2(DD), EMPTY2)   \
         EMITW(0x3C800000 | MPM(REG(XS), MOD(MD), VAL(DD), B2(DD), P2(DD)))
 
+/* bcs (D = [M]) broadcast scalar element from memory into all SIMD elements */
+
+#define bcsjx_ld(XD, MS, DS)                                                \
+        AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C1(DS), EMPTY2)   \
+        EMITW(0xFC400000 | MPM(REG(XD), MOD(MS), VXL(DS), B1(DS), P1(DS)))  \
+        EMITW(0x4E080400 | MXM(REG(XD), REG(XD), 0x00))
+
 /* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
  * uses Xmm0 implicitly as a mask register, destroys Xmm0, 0-masked XS elems */
 
@@ -171,6 +178,94 @@
         EMITW(0x6EA01C00 | MXM(TmmM,    REG(XS), Tmm0))                     \
         EMITW(0x3C800000 | MPM(TmmM,    MOD(MG), VAL(DG), B2(DG), P2(DG)))
 
+/* shf (G = G[IS]), (D = S[IT]) shuffle elements within each 128-bit lane
+ * 1-bit fields of the immediate select 64-bit elements in each 128-bit lane */
+
+#define shfjx_ri(XG, IS)                                                    \
+        shfjx3ri(W(XG), W(XG), W(IS))
+
+#define shfjx3ri(XD, XS, IT)                                                \
+        EMITW(0x6E080400 | MXM(TmmM,    REG(XS), 0x00) |                    \
+                           (1 & VAL(IT) >> 0) << 14)                        \
+        EMITW(0x6E180400 | MXM(TmmM,    REG(XS), 0x00) |                    \
+                           (1 & VAL(IT) >> 1) << 14)                        \
+        EMITW(0x4EA01C00 | MXM(REG(XD), TmmM,    TmmM))
+
+/* aln (G = [S:G] >> IT) concatenate S and G, shift right by IT elements
+ * keeping the lower half, bc0 (D = S[0]) broadcast element 0 (not portable) */
+
+#define alnjx_ri(XG, XS, IT) /* not portable, do not use outside */         \
+        EMITW(0x6E000000 | MXM(REG(XG), REG(XG), REG(XS)) |                 \
+                           (0x01 & VAL(IT)) << 14)
+
+#define bc0jx_rr(XD, XS) /* not portable, do not use outside */             \
+        EMITW(0x4E080400 | MXM(REG(XD), REG(XS), 0x00))
+
+/* scn (D[i] = S[0] op .. op S[i]) inclusive scan of S with "op" in log2
+ * steps, scz shifts in zeroes (add), scs repeats S[0] (min/max, idempotent),
+ * sce shifts D up by one element (exclusive scan), Xmm0 is used as a temp */
+
+#define sczjx_rx(XD, XS, op) /* not portable, do not use outside */         \
+        xorjx_rr(Xmm0, Xmm0)                                                \
+        alnjx_ri(Xmm0, W(XS), IB(1))                                        \
+        op(Xmm0, W(XS))                                                     \
+        movjx_rr(W(XD), Xmm0)
+
+#define scsjx_rx(XD, XS, op) /* not portable, do not use outside */         \
+        bc0jx_rr(Xmm0, W(XS))                                               \
+        alnjx_ri(Xmm0, W(XS), IB(1))                                        \
+        op(Xmm0, W(XS))                                                     \
+        movjx_rr(W(XD), Xmm0)
+
+#define scejx_rx(XD) /* not portable, do not use outside */                 \
+        xorjx_rr(Xmm0, Xmm0)                                                \
+        alnjx_ri(Xmm0, W(XD), IB(1))                                        \
+        movjx_rr(W(XD), Xmm0)
+
+/* adi (D[i] = S[0] + .. + S[i]) inclusive prefix sum of elements of S
+ * uses Xmm0 implicitly as a temp register, destroys Xmm0, XD/XS != Xmm0 */
+
+#define adijs_rr(XD, XS)                                                    \
+        sczjx_rx(W(XD), W(XS), addjs_rr)
+
+#define adijx_rr(XD, XS)                                                    \
+        sczjx_rx(W(XD), W(XS), addjx_rr)
+
+/* ade (D[i] = S[0] + .. + S[i-1]) exclusive prefix sum of S, D[0] = 0
+ * uses Xmm0 implicitly as a temp register, destroys Xmm0, XD/XS != Xmm0 */
+
+#define adejs_rr(XD, XS)                                                    \
+        sczjx_rx(W(XD), W(XS), addjs_rr)                                    \
+        scejx_rx(W(XD))
+
+#define adejx_rr(XD, XS)                                                    \
+        sczjx_rx(W(XD), W(XS), addjx_rr)                                    \
+        scejx_rx(W(XD))
+
+/* mni (D[i] = min(S[0], .. , S[i])) inclusive prefix min of elements of S
+ * uses Xmm0 implicitly as a temp register, destroys Xmm0, XD/XS != Xmm0 */
+
+#define mnijs_rr(XD, XS)                                                    \
+        scsjx_rx(W(XD), W(XS), minjs_rr)
+
+#define mnijx_rr(XD, XS)                                                    \
+        scsjx_rx(W(XD), W(XS), minjx_rr)
+
+#define mnijn_rr(XD, XS)                                                    \
+        scsjx_rx(W(XD), W(XS), minjn_rr)
+
+/* mxi (D[i] = max(S[0], .. , S[i])) inclusive prefix max of elements of S
+ * uses Xmm0 implicitly as a temp register, destroys Xmm0, XD/XS != Xmm0 */
+
+#define mxijs_rr(XD, XS)                                                    \
+        scsjx_rx(W(XD), W(XS), maxjs_rr)
+
+#define mxijx_rr(XD, XS)                                                    \
+        scsjx_rx(W(XD), W(XS), maxjx_rr)
+
+#define mxijn_rr(XD, XS)                                                    \
+        scsjx_rx(W(XD), W(XS), maxjn_rr)
+
 /* and (G = G & S), (D = S & T) if (#D != #T) */
 
 #define andjx_rr(XG, XS)                                                    \
@@ -333,6 +428,11 @@
         /* mlp, mlh are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  mlhjs_rr
+#define mlhjs_rr(XD, XS) /* horizontal reductive mul */                     \
+        EMITW(0x6E004000 | MXM(TmmM,    REG(XS), REG(XS)))                  \
+        EMITW(0x6E60DC00 | MXM(REG(XD), REG(XS), TmmM))
+
 /* div (G = G / S), (D = S / T) if (#D != #T) and on ARMv7 if (#D != #S) */
 
 #define divjs_rr(XG, XS)                                                    \
@@ -452,6 +552,16 @@
         /* mnp, mnh are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  mnpjs3rr
+#define mnpjs3rr(XD, XS, XT)                                                \
+        EMITW(0x6EE0F400 | MXM(REG(XD), REG(XS), REG(XT)))
+
+#undef  mnpjs3ld
+#define mnpjs3ld(XD, XS, MT, DT)                                            \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x3CC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x6EE0F400 | MXM(REG(XD), REG(XS), TmmM))
+
 /* max (G = G > S ? G : S), (D = S > T ? S : T) if (#D != #T) */
 
 #define maxjs_rr(XG, XS)                                                    \
@@ -471,6 +581,16 @@
         /* mxp, mxh are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  mxpjs3rr
+#define mxpjs3rr(XD, XS, XT)                                                \
+        EMITW(0x6E60F400 | MXM(REG(XD), REG(XS), REG(XT)))
+
+#undef  mxpjs3ld
+#define mxpjs3ld(XD, XS, MT, DT)                                            \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x3CC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x6E60F400 | MXM(REG(XD), REG(XS), TmmM))
+
 /* ceq (G = G == S ? -1 : 0), (D = S == T ? -1 : 0) if (#D != #T) */
 
 #define ceqjs_rr(XG, XS)                                                    \
@@ -724,6 +844,31 @@
         EMITW(0x4E61A800 | MXM(REG(XD), REG(XS), 0x00) |                    \
         (RT_SIMD_MODE_##mode&1) << 23 | (RT_SIMD_MODE_##mode&2) << 11)
 
+/* cvy (D = fp32-to-fp64 S), widens lower half of fp32 elements in S
+ * cvu (D = fp32-to-fp64 S), widens upper half of fp32 elements in S
+ * cvx (D = fp64-to-fp32 S), narrows to lower half of D, upper half is 0
+ * narrowing rounds as set in fp control register (in FCTRL blocks)
+ * _ld/_st access the lower half only */
+
+#define cvyis_rr(XD, XS)                                                    \
+        EMITW(0x0E617800 | MXM(REG(XD), REG(XS), 0x00))
+
+#define cvyis_ld(XD, MS, DS)                                                \
+        AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C1(DS), EMPTY2)   \
+        EMITW(0xFC400000 | MPM(TmmM,    MOD(MS), VXL(DS), B1(DS), P1(DS)))  \
+        EMITW(0x0E617800 | MXM(REG(XD), TmmM,    0x00))
+
+#define cvuis_rr(XD, XS)                                                    \
+        EMITW(0x4E617800 | MXM(REG(XD), REG(XS), 0x00))
+
+#define cvxjs_rr(XD, XS)                                                    \
+        EMITW(0x0E616800 | MXM(REG(XD), REG(XS), 0x00))
+
+#define cvxjs_st(XS, MD, DD)                                                \
+        EMITW(0x0E616800 | MXM(TmmM,    REG(XS), 0x00))                     \
+        AUW(SIB(MD),  EMPTY,  EMPTY,    MOD(MD), VAL(DD), C1(DD), EMPTY2)   \
+        EMITW(0xFC000000 | MPM(TmmM,    MOD(MD), VXL(DD), B1(DD), P1(DD)))
+
 /************   packed double-precision integer arithmetic/shifts   ***********/
 
 /* add (G = G + S), (D = S + T) if (#D != #T) */
@@ -793,6 +938,34 @@
         stack_ld(Recx)                                                      \
         movjx_ld(W(XD), Mebp, inf_SCR01(0))
 
+/* muw (G = G * S), multiplies lower 32-bit halves of 64-bit elements into
+ * full 64-bit products, unsigned-[x] or signed-[n], upper halves are ignored
+ * mul-high of 64-bit elements has no native form and uses BASE in rtconf.h */
+
+#define muwjx_rr(XG, XS)                                                    \
+        EMITW(0x0EA12800 | MXM(TmmM,    REG(XS), 0x00))                     \
+        EMITW(0x0EA12800 | MXM(REG(XG), REG(XG), 0x00))                     \
+        EMITW(0x2EA0C000 | MXM(REG(XG), REG(XG), TmmM))
+
+#define muwjx_ld(XG, MS, DS)                                                \
+        AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C2(DS), EMPTY2)   \
+        EMITW(0x3CC00000 | MPM(TmmM,    MOD(MS), VAL(DS), B2(DS), P2(DS)))  \
+        EMITW(0x0EA12800 | MXM(TmmM,    TmmM,    0x00))                     \
+        EMITW(0x0EA12800 | MXM(REG(XG), REG(XG), 0x00))                     \
+        EMITW(0x2EA0C000 | MXM(REG(XG), REG(XG), TmmM))
+
+#define muwjn_rr(XG, XS)                                                    \
+        EMITW(0x0EA12800 | MXM(TmmM,    REG(XS), 0x00))                     \
+        EMITW(0x0EA12800 | MXM(REG(XG), REG(XG), 0x00))                     \
+        EMITW(0x0EA0C000 | MXM(REG(XG), REG(XG), TmmM))
+
+#define muwjn_ld(XG, MS, DS)                                                \
+        AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C2(DS), EMPTY2)   \
+        EMITW(0x3CC00000 | MPM(TmmM,    MOD(MS), VAL(DS), B2(DS), P2(DS)))  \
+        EMITW(0x0EA12800 | MXM(TmmM,    TmmM,    0x00))                     \
+        EMITW(0x0EA12800 | MXM(REG(XG), REG(XG), 0x00))                     \
+        EMITW(0x0EA0C000 | MXM(REG(XG), REG(XG), TmmM))
+
 /* shl (G = G << S), (D = S << T) if (#D != #T) - plain, unsigned
  * for maximum compatibility: shift count must be modulo elem-size */
 
@@ -910,6 +1083,55 @@
         EMITW(0x6EE0B800 | MXM(TmmM,    TmmM,    0x00))                     \
         EMITW(0x4EE04400 | MXM(REG(XD), REG(XS), TmmM))
 
+/* cnt (D = number of bits set in each element of S), population count */
+
+#define cntjx_rr(XD, XS)                                                    \
+        EMITW(0x4E205800 | MXM(REG(XD), REG(XS), 0x00))                     \
+        EMITW(0x6E202800 | MXM(REG(XD), REG(XD), 0x00))                     \
+        EMITW(0x6E602800 | MXM(REG(XD), REG(XD), 0x00))                     \
+        EMITW(0x6EA02800 | MXM(REG(XD), REG(XD), 0x00))
+
+#define cntjx_ld(XD, MS, DS)                                                \
+        AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C2(DS), EMPTY2)   \
+        EMITW(0x3CC00000 | MPM(TmmM,    MOD(MS), VAL(DS), B2(DS), P2(DS)))  \
+        EMITW(0x4E205800 | MXM(REG(XD), TmmM,    0x00))                     \
+        EMITW(0x6E202800 | MXM(REG(XD), REG(XD), 0x00))                     \
+        EMITW(0x6E602800 | MXM(REG(XD), REG(XD), 0x00))                     \
+        EMITW(0x6EA02800 | MXM(REG(XD), REG(XD), 0x00))
+
+/* bsw (D = S with the order of bytes reversed in each element) */
+
+#define bswjx_rr(XD, XS)                                                    \
+        EMITW(0x4E200800 | MXM(REG(XD), REG(XS), 0x00))
+
+#define bswjx_ld(XD, MS, DS)                                                \
+        AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C2(DS), EMPTY2)   \
+        EMITW(0x3CC00000 | MPM(TmmM,    MOD(MS), VAL(DS), B2(DS), P2(DS)))  \
+        EMITW(0x4E200800 | MXM(REG(XD), TmmM,    0x00))
+
+/* cvy (D = S), zero-[x] or sign-[n] extends lower half of 32-bit elements
+ * cvu (D = S), zero-[x] or sign-[n] extends upper half of 32-bit elements
+ * cvx (D = S), narrows signed 64-bit elements to lower half of D, upper is 0
+ * with unsigned-[x] or signed-[n] saturation into 32-bit elements */
+
+#define cvyix_rr(XD, XS)                                                    \
+        EMITW(0x2F20A400 | MXM(REG(XD), REG(XS), 0x00))
+
+#define cvyin_rr(XD, XS)                                                    \
+        EMITW(0x0F20A400 | MXM(REG(XD), REG(XS), 0x00))
+
+#define cvuix_rr(XD, XS)                                                    \
+        EMITW(0x6F20A400 | MXM(REG(XD), REG(XS), 0x00))
+
+#define cvuin_rr(XD, XS)                                                    \
+        EMITW(0x4F20A400 | MXM(REG(XD), REG(XS), 0x00))
+
+#define cvxjx_rr(XD, XS)                                                    \
+        EMITW(0x2EA12800 | MXM(REG(XD), REG(XS), 0x00))
+
+#define cvxjn_rr(XD, XS)                                                    \
+        EMITW(0x0EA14800 | MXM(REG(XD), REG(XS), 0x00))
+
 /****************   packed double-precision integer compare   *****************/
 
 /* min (G = G < S ? G : S), (D = S < T ? S : T) if (#D != #T), unsigned */
@@ -180,6 +180,14 @@
         EMITW(0x6EA01C00 | MXM(TmmM,    RYG(XS), Tmm0+16))                  \
         EMITW(0x3D800000 | MPM(TmmM,    MOD(MG), VYL(DG), B4(DG), L2(DG)))
 
+/* hrd (D = S op S op ..) reduce all elements of S with "op" into each of D
+ * combining halves first, then via in-register pairwise "pp" step */
+
+#define hrdds_rx(XD, XS, op, pp) /* not portable, do not use outside */     \
+        EMITW(op | MXM(TmmM,    REG(XS), RYG(XS)))                          \
+        EMITW(pp | MXM(REG(XD), TmmM,    TmmM))                             \
+        EMITW(pp | MXM(RYG(XD), TmmM,    TmmM))
+
 /* and (G = G & S), (D = S & T) if (#D != #T) */
 
 #define anddx_rr(XG, XS)                                                    \
@@ -330,6 +338,10 @@
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
         EMITW(0x6E60D400 | MXM(RYG(XD), RYG(XD), TmmM))
 
+#undef  adhds_rr
+#define adhds_rr(XD, XS) /* horizontal reductive add, first 15-regs only */ \
+        hrdds_rx(W(XD), W(XS), 0x4E60D400, 0x6E60D400)
+
 /* sub (G = G - S), (D = S - T) if (#D != #T) */
 
 #define subds_rr(XG, XS)                                                    \
@@ -371,6 +383,13 @@
         /* mlp, mlh are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  mlhds_rr
+#define mlhds_rr(XD, XS) /* horizontal reductive mul */                     \
+        EMITW(0x6E60DC00 | MXM(TmmM,    REG(XS), RYG(XS)))                  \
+        EMITW(0x6E004000 | MXM(REG(XD), TmmM,    TmmM))                     \
+        EMITW(0x6E60DC00 | MXM(REG(XD), REG(XD), TmmM))                     \
+        EMITW(0x4EA01C00 | MXM(RYG(XD), REG(XD), REG(XD)))
+
 /* div (G = G / S), (D = S / T) if (#D != #T) and on ARMv7 if (#D != #S) */
 
 #define divds_rr(XG, XS)                                                    \
@@ -512,6 +531,10 @@
         /* mnp, mnh are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  mnhds_rr
+#define mnhds_rr(XD, XS) /* horizontal reductive min */                     \
+        hrdds_rx(W(XD), W(XS), 0x4EE0F400, 0x6EE0F400)
+
 /* max (G = G > S ? G : S), (D = S > T ? S : T) if (#D != #T) */
 
 #define maxds_rr(XG, XS)                                                    \
@@ -534,6 +557,10 @@
         /* mxp, mxh are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  mxhds_rr
+#define mxhds_rr(XD, XS) /* horizontal reductive max */                     \
+        hrdds_rx(W(XD), W(XS), 0x4E60F400, 0x6E60F400)
+
 /* ceq (G = G == S ? -1 : 0), (D = S == T ? -1 : 0) if (#D != #T) */
 
 #define ceqds_rr(XG, XS)                                                    \
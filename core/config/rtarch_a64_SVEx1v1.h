@@ -174,6 +174,161 @@
         EMITW(0x05E0C400 | MXM(TmmM,    REG(XS), TmmM))                     \
         EMITW(0xE5804000 | MPM(TmmM,    MOD(MG), VAL(DG), B3(DG), F1(DG)))
 
+/* mtl (D = S) move the first RS lanes only (loop tails), 0 <= RS <= S
+ * load zeroes the remaining lanes of XD, store keeps memory past RS lanes,
+ * memory past RS lanes is never accessed, RS holds the count as cmdw value,
+ * uses p1 as a temp predicate register here (whilelt) */
+
+#define mtlqx_ld(XD, RS, MS, DS)                                            \
+        adrqx_xa(W(MS), W(DS))                                              \
+        EMITW(0x25E00400 | MRM(0x01,    TZxx,    REG(RS)))                  \
+        EMITW(0xA5E0A400 | MRM(REG(XD), TPxx,    0x00))
+
+#define mtlqx_st(XS, RS, MD, DD)                                            \
+        adrqx_xa(W(MD), W(DD))                                              \
+        EMITW(0x25E00400 | MRM(0x01,    TZxx,    REG(RS)))                  \
+        EMITW(0xE5E0E400 | MRM(REG(XS), TPxx,    0x00))
+
+/* gat (D = [M + S]) gather elements at per-lane indices S from M/DS,
+ * indices are 64-bit in elements (full range with 64-bit base address),
+ * M*** or Oeax, but not indexed modes (I***, ...), XD/XS differ,
+ * native SVE ld1d with 64-bit vector-index scaled by element size */
+
+#define gatqx_ld(XD, XS, MS, DS)                                            \
+        adrqx_xa(W(MS), W(DS))                                              \
+        EMITW(0xC5E0C000 | MXM(REG(XD), TPxx,    REG(XS)))
+
+/* sct (M + T = S) scatter elements of S to per-lane indices T at M/DD,
+ * indices are 64-bit in elements (full range with 64-bit base address),
+ * M*** or Oeax, but not indexed modes (I***, ...),
+ * colliding indices are written in lane order (the highest lane wins),
+ * native SVE st1d with 64-bit vector-index scaled by element size */
+
+#define sctqx_st(XS, XT, MD, DD)                                            \
+        adrqx_xa(W(MD), W(DD))                                              \
+        EMITW(0xE5A0A000 | MXM(REG(XS), TPxx,    REG(XT)))
+
+/* computes full address M/DS into TPxx for SVE modes lacking displacement */
+
+#define adrqx_xa(MS, DS) /* not portable, do not use outside */             \
+        AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C3(DS), EMPTY2)   \
+        EMITW(0x0B000000 | MRM(TPxx,    MOD(MS), TDxx) | ADR)
+
+/* tbl (G = G[S]), (D = S[T]) permute elements across the SIMD register
+ * indices are in elements, taken modulo the number of elements in SIMD */
+
+#define tblqx_rr(XG, XS)                                                    \
+        tblqx3rr(W(XG), W(XG), W(XS))
+
+#define tblqx3rr(XD, XS, XT)                                                \
+        EMITW(0x25F8C000 | MXM(TmmM,    (RT_SIMD/64-1), 0x00))              \
+        EMITW(0x04203000 | MXM(TmmM,    REG(XT), TmmM))                     \
+        EMITW(0x05E03000 | MXM(REG(XD), REG(XS), TmmM))
+
+/* aln (G = [S:G] >> IT) concatenate S and G, shift right by IT elements
+ * keeping the lower half, bc0 (D = S[0]) broadcast element 0 (not portable) */
+
+#define alnqx_ri(XG, XS, IT) /* not portable, do not use outside */         \
+        EMITW(0x05200000 | MXM(REG(XG), REG(XS), 0x00) |                    \
+                           (0xF8 & VAL(IT) << 3) << 13)
+
+#define bc0qx_rr(XD, XS) /* not portable, do not use outside */             \
+        EMITW(0x05282000 | MXM(REG(XD), REG(XS), 0x00))
+
+/* scn (D[i] = S[0] op .. op S[i]) inclusive scan of S with "op" in log2
+ * steps, scz shifts in zeroes (add), scs repeats S[0] (min/max, idempotent),
+ * sce shifts D up by one element (exclusive scan), Xmm0 is used as a temp
+ * the number of log2 steps is set by RT_SIMD, sce is done via insr */
+
+#define sczqx_rx(XD, XS, op) /* not portable, do not use outside */         \
+        movqx_rr(W(XD), W(XS))                                              \
+        scnqx_sa(W(XD), op, sczqx_rf)
+
+#define scsqx_rx(XD, XS, op) /* not portable, do not use outside */         \
+        movqx_rr(W(XD), W(XS))                                              \
+        scnqx_sa(W(XD), op, bc0qx_rr)
+
+#define sceqx_rx(XD) /* not portable, do not use outside */                 \
+        EMITW(0x05E43BE0 | MXM(REG(XD), 0x00,    0x00))
+
+#define sczqx_rf(XD, XS) /* not portable, do not use outside */             \
+        xorqx_rr(W(XD), W(XD))
+
+#define scnqx_sn(XD, op, fl, nk) /* not portable, do not use outside */     \
+        fl(Xmm0, W(XD))                                                     \
+        alnqx_ri(Xmm0, W(XD), IB(RT_SIMD/64-(nk)))                          \
+        op(W(XD), Xmm0)
+
+#define scnqx_s1(XD, op, fl) /* not portable, do not use outside */         \
+        scnqx_sn(W(XD), op, fl, 0x01)                                       \
+        scnqx_sn(W(XD), op, fl, 0x02)
+
+#define scnqx_s2(XD, op, fl) /* not portable, do not use outside */         \
+        scnqx_s1(W(XD), op, fl)                                             \
+        scnqx_sn(W(XD), op, fl, 0x04)
+
+#define scnqx_s4(XD, op, fl) /* not portable, do not use outside */         \
+        scnqx_s2(W(XD), op, fl)                                             \
+        scnqx_sn(W(XD), op, fl, 0x08)
+
+#define scnqx_s8(XD, op, fl) /* not portable, do not use outside */         \
+        scnqx_s4(W(XD), op, fl)                                             \
+        scnqx_sn(W(XD), op, fl, 0x10)
+
+#if   (RT_SIMD == 2048)
+#define scnqx_sa(XD, op, fl)    scnqx_s8(W(XD), op, fl)
+#elif (RT_SIMD == 1024)
+#define scnqx_sa(XD, op, fl)    scnqx_s4(W(XD), op, fl)
+#elif (RT_SIMD == 512)
+#define scnqx_sa(XD, op, fl)    scnqx_s2(W(XD), op, fl)
+#elif (RT_SIMD == 256)
+#define scnqx_sa(XD, op, fl)    scnqx_s1(W(XD), op, fl)
+#endif /* RT_SIMD: 2048, 1024, 512, 256 */
+
+/* adi (D[i] = S[0] + .. + S[i]) inclusive prefix sum of elements of S
+ * uses Xmm0 implicitly as a temp register, destroys Xmm0, XD/XS != Xmm0 */
+
+#define adiqs_rr(XD, XS)                                                    \
+        sczqx_rx(W(XD), W(XS), addqs_rr)
+
+#define adiqx_rr(XD, XS)                                                    \
+        sczqx_rx(W(XD), W(XS), addqx_rr)
+
+/* ade (D[i] = S[0] + .. + S[i-1]) exclusive prefix sum of S, D[0] = 0
+ * uses Xmm0 implicitly as a temp register, destroys Xmm0, XD/XS != Xmm0 */
+
+#define adeqs_rr(XD, XS)                                                    \
+        sczqx_rx(W(XD), W(XS), addqs_rr)                                    \
+        sceqx_rx(W(XD))
+
+#define adeqx_rr(XD, XS)                                                    \
+        sczqx_rx(W(XD), W(XS), addqx_rr)                                    \
+        sceqx_rx(W(XD))
+
+/* mni (D[i] = min(S[0], .. , S[i])) inclusive prefix min of elements of S
+ * uses Xmm0 implicitly as a temp register, destroys Xmm0, XD/XS != Xmm0 */
+
+#define mniqs_rr(XD, XS)                                                    \
+        scsqx_rx(W(XD), W(XS), minqs_rr)
+
+#define mniqx_rr(XD, XS)                                                    \
+        scsqx_rx(W(XD), W(XS), minqx_rr)
+
+#define mniqn_rr(XD, XS)                                                    \
+        scsqx_rx(W(XD), W(XS), minqn_rr)
+
+/* mxi (D[i] = max(S[0], .. , S[i])) inclusive prefix max of elements of S
+ * uses Xmm0 implicitly as a temp register, destroys Xmm0, XD/XS != Xmm0 */
+
+#define mxiqs_rr(XD, XS)                                                    \
+        scsqx_rx(W(XD), W(XS), maxqs_rr)
+
+#define mxiqx_rr(XD, XS)                                                    \
+        scsqx_rx(W(XD), W(XS), maxqx_rr)
+
+#define mxiqn_rr(XD, XS)                                                    \
+        scsqx_rx(W(XD), W(XS), maxqn_rr)
+
 /* and (G = G & S), (D = S & T) if (#D != #T) */
 
 #define andqx_rr(XG, XS)                                                    \
@@ -887,6 +1042,35 @@
         rnrqs_rr(W(XD), W(XS), mode)                                        \
         cvzqs_rr(W(XD), W(XD))
 
+/* cvy (D = fp32-to-fp64 S), widens lower half of fp32 elements in S
+ * cvu (D = fp32-to-fp64 S), widens upper half of fp32 elements in S
+ * cvx (D = fp64-to-fp32 S), narrows to lower half of D, upper half is 0
+ * narrowing rounds as set in fp control register (in FCTRL blocks)
+ * _ld/_st access the lower half only */
+
+#define cvyos_rr(XD, XS)                                                    \
+        EMITW(0x05A06000 | MXM(TmmM,    REG(XS), REG(XS)))                  \
+        EMITW(0x65CBA000 | MXM(REG(XD), TmmM,    0x00))
+
+#define cvyos_ld(XD, MS, DS)                                                \
+        adrqx_xa(W(MS), W(DS))                                              \
+        EMITW(0xA560A000 | MXM(TmmM,    TPxx,    0x00))                     \
+        EMITW(0x65CBA000 | MXM(REG(XD), TmmM,    0x00))
+
+#define cvuos_rr(XD, XS)                                                    \
+        EMITW(0x05A06400 | MXM(TmmM,    REG(XS), REG(XS)))                  \
+        EMITW(0x65CBA000 | MXM(REG(XD), TmmM,    0x00))
+
+#define cvxqs_rr(XD, XS)                                                    \
+        EMITW(0x65CAA000 | MXM(TmmM,    REG(XS), 0x00))                     \
+        EMITW(0x25B8C000 | MXM(REG(XD), 0x00,    0x00))                     \
+        EMITW(0x05A06800 | MXM(REG(XD), TmmM,    REG(XD)))
+
+#define cvxqs_st(XS, MD, DD)                                                \
+        EMITW(0x65CAA000 | MXM(TmmM,    REG(XS), 0x00))                     \
+        adrqx_xa(W(MD), W(DD))                                              \
+        EMITW(0xE560E000 | MXM(TmmM,    TPxx,    0x00))
+
 /************   packed double-precision integer arithmetic/shifts   ***********/
 
 /* add (G = G + S), (D = S + T) if (#D != #T) */
@@ -1062,6 +1246,38 @@
         movqx_rr(W(XD), W(XS))                                              \
         svrqn_ld(W(XD), W(MT), W(DT))
 
+/* cnt (D = number of bits set in each element of S), population count */
+
+#define cntqx_rr(XD, XS)                                                    \
+        EMITW(0x04DAA000 | MXM(REG(XD), REG(XS), 0x00))
+
+#define cntqx_ld(XD, MS, DS)                                                \
+        AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), A1(DS), EMPTY2)   \
+        EMITW(0x85804000 | MPM(TmmM,    MOD(MS), VAL(DS), B3(DS), F1(DS)))  \
+        EMITW(0x04DAA000 | MXM(REG(XD), TmmM,    0x00))
+
+/* clz (D = number of leading zeroes in each element of S), 64 if 0 */
+
+#define clzqx_rr(XD, XS)                                                    \
+        EMITW(0x04D9A000 | MXM(REG(XD), REG(XS), 0x00))
+
+#define clzqx_ld(XD, MS, DS)                                                \
+        AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), A1(DS), EMPTY2)   \
+        EMITW(0x85804000 | MPM(TmmM,    MOD(MS), VAL(DS), B3(DS), F1(DS)))  \
+        EMITW(0x04D9A000 | MXM(REG(XD), TmmM,    0x00))
+
+/* ctz (D = number of trailing zeroes in each element of S), 64 if 0 */
+
+#define ctzqx_rr(XD, XS)                                                    \
+        EMITW(0x05E78000 | MXM(REG(XD), REG(XS), 0x00))                     \
+        EMITW(0x04D9A000 | MXM(REG(XD), REG(XD), 0x00))
+
+#define ctzqx_ld(XD, MS, DS)                                                \
+        AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), A1(DS), EMPTY2)   \
+        EMITW(0x85804000 | MPM(TmmM,    MOD(MS), VAL(DS), B3(DS), F1(DS)))  \
+        EMITW(0x05E78000 | MXM(TmmM,    TmmM,    0x00))                     \
+        EMITW(0x04D9A000 | MXM(REG(XD), TmmM,    0x00))
+
 /****************   packed double-precision integer compare   *****************/
 
 /* min (G = G < S ? G : S), (D = S < T ? S : T) if (#D != #T), unsigned */
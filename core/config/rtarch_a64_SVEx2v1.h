@@ -186,6 +186,54 @@
         EMITW(0x05E0C400 | MXM(TmmM,    RYG(XS), TmmM))                     \
         EMITW(0xE5804000 | MPM(TmmM,    MOD(MG), VZL(DG), B3(DG), K1(DG)))
 
+/* mtl (D = S) move the first RS lanes only (loop tails), 0 <= RS <= S
+ * load zeroes the remaining lanes of XD, store keeps memory past RS lanes,
+ * memory past RS lanes is never accessed, RS holds the count as cmdw value,
+ * uses p1 as a temp predicate register here (whilelt) */
+
+#define mtlqx_ld(XD, RS, MS, DS)                                            \
+        adrqx_xa(W(MS), W(DS))                                              \
+        EMITW(0x25E00400 | MRM(0x01,    TZxx,    REG(RS)))                  \
+        EMITW(0xA5E0A400 | MRM(REG(XD), TPxx,    0x00))                     \
+        EMITW(0x52800000 | MRM(TDxx,    0x00,    0x00) | (RT_SIMD/128) << 5) \
+        EMITW(0x25E00400 | MRM(0x01,    TDxx,    REG(RS)))                  \
+        EMITW(0xA5E0A400 | MRM(RYG(XD), TPxx,    0x00) | 0x00010000)
+
+#define mtlqx_st(XS, RS, MD, DD)                                            \
+        adrqx_xa(W(MD), W(DD))                                              \
+        EMITW(0x25E00400 | MRM(0x01,    TZxx,    REG(RS)))                  \
+        EMITW(0xE5E0E400 | MRM(REG(XS), TPxx,    0x00))                     \
+        EMITW(0x52800000 | MRM(TDxx,    0x00,    0x00) | (RT_SIMD/128) << 5) \
+        EMITW(0x25E00400 | MRM(0x01,    TDxx,    REG(RS)))                  \
+        EMITW(0xE5E0E400 | MRM(RYG(XS), TPxx,    0x00) | 0x00010000)
+
+/* gat (D = [M + S]) gather elements at per-lane indices S from M/DS,
+ * indices are 64-bit in elements (full range with 64-bit base address),
+ * M*** or Oeax, but not indexed modes (I***, ...), XD/XS differ,
+ * native SVE ld1d with 64-bit vector-index scaled by element size */
+
+#define gatqx_ld(XD, XS, MS, DS)                                            \
+        adrqx_xa(W(MS), W(DS))                                              \
+        EMITW(0xC5E0C000 | MXM(REG(XD), TPxx,    REG(XS)))                  \
+        EMITW(0xC5E0C000 | MXM(RYG(XD), TPxx,    RYG(XS)))
+
+/* sct (M + T = S) scatter elements of S to per-lane indices T at M/DD,
+ * indices are 64-bit in elements (full range with 64-bit base address),
+ * M*** or Oeax, but not indexed modes (I***, ...),
+ * colliding indices are written in lane order (the highest lane wins),
+ * native SVE st1d with 64-bit vector-index scaled by element size */
+
+#define sctqx_st(XS, XT, MD, DD)                                            \
+        adrqx_xa(W(MD), W(DD))                                              \
+        EMITW(0xE5A0A000 | MXM(REG(XS), TPxx,    REG(XT)))                  \
+        EMITW(0xE5A0A000 | MXM(RYG(XS), TPxx,    RYG(XT)))
+
+/* computes full address M/DS into TPxx for SVE modes lacking displacement */
+
+#define adrqx_xa(MS, DS) /* not portable, do not use outside */             \
+        AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C3(DS), EMPTY2)   \
+        EMITW(0x0B000000 | MRM(TPxx,    MOD(MS), TDxx) | ADR)
+
 /* and (G = G & S), (D = S & T) if (#D != #T) */
 
 #define andqx_rr(XG, XS)                                                    \
@@ -875,6 +923,44 @@
         rnrqs_rr(W(XD), W(XS), mode)                                        \
         cvzqs_rr(W(XD), W(XD))
 
+/* cvy (D = fp32-to-fp64 S), widens lower half of fp32 elements in S
+ * cvu (D = fp32-to-fp64 S), widens upper half of fp32 elements in S
+ * cvx (D = fp64-to-fp32 S), narrows to lower half of D, upper half is 0
+ * narrowing rounds as set in fp control register (in FCTRL blocks)
+ * _ld/_st access the lower half only */
+
+#define cvyos_rr(XD, XS)                                                    \
+        EMITW(0x05A06400 | MXM(TmmM,    REG(XS), REG(XS)))                  \
+        EMITW(0x65CBA000 | MXM(RYG(XD), TmmM,    0x00))                     \
+        EMITW(0x05A06000 | MXM(TmmM,    REG(XS), REG(XS)))                  \
+        EMITW(0x65CBA000 | MXM(REG(XD), TmmM,    0x00))
+
+#define cvyos_ld(XD, MS, DS)                                                \
+        adrqx_xa(W(MS), W(DS))                                              \
+        EMITW(0xA560A000 | MXM(TmmM,    TPxx,    0x00))                     \
+        EMITW(0x65CBA000 | MXM(REG(XD), TmmM,    0x00))                     \
+        EMITW(0xA561A000 | MXM(TmmM,    TPxx,    0x00))                     \
+        EMITW(0x65CBA000 | MXM(RYG(XD), TmmM,    0x00))
+
+#define cvuos_rr(XD, XS)                                                    \
+        EMITW(0x05A06000 | MXM(TmmM,    RYG(XS), RYG(XS)))                  \
+        EMITW(0x65CBA000 | MXM(REG(XD), TmmM,    0x00))                     \
+        EMITW(0x05A06400 | MXM(TmmM,    RYG(XS), RYG(XS)))                  \
+        EMITW(0x65CBA000 | MXM(RYG(XD), TmmM,    0x00))
+
+#define cvxqs_rr(XD, XS)                                                    \
+        EMITW(0x65CAA000 | MXM(TmmM,    REG(XS), 0x00))                     \
+        EMITW(0x65CAA000 | MXM(RYG(XD), RYG(XS), 0x00))                     \
+        EMITW(0x05A06800 | MXM(REG(XD), TmmM,    RYG(XD)))                  \
+        EMITW(0x25B8C000 | MXM(RYG(XD), 0x00,    0x00))
+
+#define cvxqs_st(XS, MD, DD)                                                \
+        adrqx_xa(W(MD), W(DD))                                              \
+        EMITW(0x65CAA000 | MXM(TmmM,    REG(XS), 0x00))                     \
+        EMITW(0xE560E000 | MXM(TmmM,    TPxx,    0x00))                     \
+        EMITW(0x65CAA000 | MXM(TmmM,    RYG(XS), 0x00))                     \
+        EMITW(0xE561E000 | MXM(TmmM,    TPxx,    0x00))
+
 /************   packed double-precision integer arithmetic/shifts   ***********/
 
 /* add (G = G + S), (D = S + T) if (#D != #T) */
@@ -1083,6 +1169,49 @@
         movqx_rr(W(XD), W(XS))                                              \
         svrqn_ld(W(XD), W(MT), W(DT))
 
+/* cnt (D = number of bits set in each element of S), population count */
+
+#define cntqx_rr(XD, XS)                                                    \
+        EMITW(0x04DAA000 | MXM(REG(XD), REG(XS), 0x00))                     \
+        EMITW(0x04DAA000 | MXM(RYG(XD), RYG(XS), 0x00))
+
+#define cntqx_ld(XD, MS, DS)                                                \
+        AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), A1(DS), EMPTY2)   \
+        EMITW(0x85804000 | MPM(TmmM,    MOD(MS), VAL(DS), B3(DS), K1(DS)))  \
+        EMITW(0x04DAA000 | MXM(REG(XD), TmmM,    0x00))                     \
+        EMITW(0x85804000 | MPM(TmmM,    MOD(MS), VZL(DS), B3(DS), K1(DS)))  \
+        EMITW(0x04DAA000 | MXM(RYG(XD), TmmM,    0x00))
+
+/* clz (D = number of leading zeroes in each element of S), 64 if 0 */
+
+#define clzqx_rr(XD, XS)                                                    \
+        EMITW(0x04D9A000 | MXM(REG(XD), REG(XS), 0x00))                     \
+        EMITW(0x04D9A000 | MXM(RYG(XD), RYG(XS), 0x00))
+
+#define clzqx_ld(XD, MS, DS)                                                \
+        AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), A1(DS), EMPTY2)   \
+        EMITW(0x85804000 | MPM(TmmM,    MOD(MS), VAL(DS), B3(DS), K1(DS)))  \
+        EMITW(0x04D9A000 | MXM(REG(XD), TmmM,    0x00))                     \
+        EMITW(0x85804000 | MPM(TmmM,    MOD(MS), VZL(DS), B3(DS), K1(DS)))  \
+        EMITW(0x04D9A000 | MXM(RYG(XD), TmmM,    0x00))
+
+/* ctz (D = number of trailing zeroes in each element of S), 64 if 0 */
+
+#define ctzqx_rr(XD, XS)                                                    \
+        EMITW(0x05E78000 | MXM(REG(XD), REG(XS), 0x00))                     \
+        EMITW(0x04D9A000 | MXM(REG(XD), REG(XD), 0x00))                     \
+        EMITW(0x05E78000 | MXM(RYG(XD), RYG(XS), 0x00))                     \
+        EMITW(0x04D9A000 | MXM(RYG(XD), RYG(XD), 0x00))
+
+#define ctzqx_ld(XD, MS, DS)                                                \
+        AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), A1(DS), EMPTY2)   \
+        EMITW(0x85804000 | MPM(TmmM,    MOD(MS), VAL(DS), B3(DS), K1(DS)))  \
+        EMITW(0x05E78000 | MXM(TmmM,    TmmM,    0x00))                     \
+        EMITW(0x04D9A000 | MXM(REG(XD), TmmM,    0x00))                     \
+        EMITW(0x85804000 | MPM(TmmM,    MOD(MS), VZL(DS), B3(DS), K1(DS)))  \
+        EMITW(0x05E78000 | MXM(TmmM,    TmmM,    0x00))                     \
+        EMITW(0x04D9A000 | MXM(RYG(XD), TmmM,    0x00))
+
 /****************   packed double-precision integer compare   *****************/
 
 /* min (G = G < S ? G : S), (D = S < T ? S : T) if (#D != #T), unsigned */
@@ -476,6 +476,16 @@
         EMITW(0x6E60B800 | MXM(TmmM,    TmmM,    0x00))                     \
         EMITW(0x4E604400 | MXM(REG(XD), REG(XS), TmmM))
 
+/* bsw (D = S with the order of bytes reversed in each element) */
+
+#define bswgx_rr(XD, XS)                                                    \
+        EMITW(0x4E201800 | MXM(REG(XD), REG(XS), 0x00))
+
+#define bswgx_ld(XD, MS, DS)                                                \
+        AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C2(DS), EMPTY2)   \
+        EMITW(0x3CC00000 | MPM(TmmM,    MOD(MS), VAL(DS), B2(DS), P2(DS)))  \
+        EMITW(0x4E201800 | MXM(REG(XD), TmmM,    0x00))
+
 /*****************   packed half-precision integer compare   ******************/
 
 /* min (G = G < S ? G : S), (D = S < T ? S : T) if (#D != #T), unsigned */
@@ -734,6 +744,27 @@
         EMITW(0x6EA01C00 | MXM(TmmM,    REG(XS), Tmm0))                     \
         EMITW(0x3C800000 | MPM(TmmM,    MOD(MG), VAL(DG), B2(DG), P2(DG)))
 
+/* tbl (G = G[S]), (D = S[T]) if (#D != #T) look up bytes within 128-bit lanes
+ * indices 0-15 pick bytes in the same lane, 0x80-0xFF produce zero bytes */
+
+#define tblgb_rr(XG, XS)                                                    \
+        tblgb3rr(W(XG), W(XG), W(XS))
+
+#define tblgb_ld(XG, MS, DS)                                                \
+        tblgb3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define tblgb3rr(XD, XS, XT)                                                \
+        EMITW(0x4F04E5E0 | MXM(TmmM,    0x00,    0x00))                     \
+        EMITW(0x4E201C00 | MXM(TmmM,    REG(XT), TmmM))                     \
+        EMITW(0x4E000000 | MXM(REG(XD), REG(XS), TmmM))
+
+#define tblgb3ld(XD, XS, MT, DT)                                            \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x3CC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x6F039600 | MXM(TmmM,    0x00,    0x00))                     \
+        EMITW(0x6F03B600 | MXM(TmmM,    0x00,    0x00))                     \
+        EMITW(0x4E000000 | MXM(REG(XD), REG(XS), TmmM))
+
 /* move/logic instructions are sizeless and provided in 16-bit subset above */
 
 /*************   packed byte-precision integer arithmetic/shifts   ************/
@@ -857,6 +857,34 @@
         EMITW(0x6EA01C00 | MXM(TmmM,    RYG(XS), Tmm0+16))                  \
         EMITW(0x3D800000 | MPM(TmmM,    MOD(MG), VYL(DG), B4(DG), L2(DG)))
 
+/* tbl (G = G[S]), (D = S[T]) if (#D != #T) look up bytes within 128-bit lanes
+ * indices 0-15 pick bytes in the same lane, 0x80-0xFF produce zero bytes */
+
+#define tblab_rr(XG, XS)                                                    \
+        tblab3rr(W(XG), W(XG), W(XS))
+
+#define tblab_ld(XG, MS, DS)                                                \
+        tblab3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define tblab3rr(XD, XS, XT)                                                \
+        EMITW(0x4F04E5E0 | MXM(TmmM,    0x00,    0x00))                     \
+        EMITW(0x4E201C00 | MXM(TmmM,    REG(XT), TmmM))                     \
+        EMITW(0x4E000000 | MXM(REG(XD), REG(XS), TmmM))                     \
+        EMITW(0x4F04E5E0 | MXM(TmmM,    0x00,    0x00))                     \
+        EMITW(0x4E201C00 | MXM(TmmM,    RYG(XT), TmmM))                     \
+        EMITW(0x4E000000 | MXM(RYG(XD), RYG(XS), TmmM))
+
+#define tblab3ld(XD, XS, MT, DT)                                            \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A2(DT), EMPTY2)   \
+        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B4(DT), L2(DT)))  \
+        EMITW(0x6F039600 | MXM(TmmM,    0x00,    0x00))                     \
+        EMITW(0x6F03B600 | MXM(TmmM,    0x00,    0x00))                     \
+        EMITW(0x4E000000 | MXM(REG(XD), REG(XS), TmmM))                     \
+        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
+        EMITW(0x6F039600 | MXM(TmmM,    0x00,    0x00))                     \
+        EMITW(0x6F03B600 | MXM(TmmM,    0x00,    0x00))                     \
+        EMITW(0x4E000000 | MXM(RYG(XD), RYG(XS), TmmM))
+
 /* move/logic instructions are sizeless and provided in 16-bit subset above */
 
 /*************   packed byte-precision integer arithmetic/shifts   ************/
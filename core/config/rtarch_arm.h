@@ -1602,6 +1602,55 @@
         EMITW(0xE0600090 | MRM(Tedx,    Tedx,    TMxx) | Teax << 8)         \
                                                           /* Redx<-rem */
 
+/* cnt (D = number of bits set in S), population count
+ * clz (D = number of leading zeroes in S), 32 if S is 0
+ * ctz (D = number of trailing zeroes in S), 32 if S is 0
+ * set-flags: undefined */
+
+#define cntwx_rr(RD, RS)                                                    \
+        G32(TIxx, 0x55555555)                                               \
+        EMITW(0xE00000A0 | MRM(TMxx,    TIxx,    REG(RS)))                  \
+        EMITW(0xE0400000 | MRM(REG(RD), REG(RS), TMxx))                     \
+        G32(TIxx, 0x33333333)                                               \
+        EMITW(0xE0000120 | MRM(TMxx,    TIxx,    REG(RD)))                  \
+        EMITW(0xE0000000 | MRM(REG(RD), REG(RD), TIxx))                     \
+        EMITW(0xE0800000 | MRM(REG(RD), REG(RD), TMxx))                     \
+        EMITW(0xE0800220 | MRM(REG(RD), REG(RD), REG(RD)))                  \
+        G32(TIxx, 0x0F0F0F0F)                                               \
+        EMITW(0xE0000000 | MRM(REG(RD), REG(RD), TIxx))                     \
+        EMITW(0xE0800420 | MRM(REG(RD), REG(RD), REG(RD)))                  \
+        EMITW(0xE0800820 | MRM(REG(RD), REG(RD), REG(RD)))                  \
+        EMITW(0xE200003F | MRM(REG(RD), REG(RD), 0x00))
+
+#define cntwx_ld(RD, MS, DS)                                                \
+        movwx_ld(W(RD), W(MS), W(DS))                                       \
+        cntwx_rr(W(RD), W(RD))
+
+#define clzwx_rr(RD, RS)                                                    \
+        EMITW(0xE16F0F10 | MRM(REG(RD), 0x00,    REG(RS)))
+
+#define clzwx_ld(RD, MS, DS)                                                \
+        movwx_ld(W(RD), W(MS), W(DS))                                       \
+        clzwx_rr(W(RD), W(RD))
+
+#define ctzwx_rr(RD, RS)                                                    \
+        EMITW(0xE6FF0F30 | MRM(REG(RD), 0x00,    REG(RS)))                  \
+        EMITW(0xE16F0F10 | MRM(REG(RD), 0x00,    REG(RD)))
+
+#define ctzwx_ld(RD, MS, DS)                                                \
+        movwx_ld(W(RD), W(MS), W(DS))                                       \
+        ctzwx_rr(W(RD), W(RD))
+
+/* bsw (D = S with the order of bytes reversed), byte-swap
+ * set-flags: no */
+
+#define bswwx_rr(RD, RS)                                                    \
+        EMITW(0xE6BF0F30 | MRM(REG(RD), 0x00,    REG(RS)))
+
+#define bswwx_ld(RD, MS, DS)                                                \
+        movwx_ld(W(RD), W(MS), W(DS))                                       \
+        bswwx_rr(W(RD), W(RD))
+
 /* arj (G = G op S, if cc G then jump lb)
  * set-flags: undefined
  * refer to individual instruction descriptions
@@ -1815,6 +1864,57 @@
         AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C3(DS), EMPTY2)   \
         EMITW(0xE0800000 | MRM(REG(RD), MOD(MS), TDxx))
 
+/* pf0, pf1, pf2, pfn (prefetch [S] into cache, T0/T1/T2-hints, NTA-hint)
+ * T0 - all cache levels, T1 - L2 and up, T2 - L3 and up (if available),
+ * NTA - non-temporal (streaming), hints are advisory, never fault on [S]
+ * set-flags: no */
+
+#define pf0xx_ld(MS, DS)                                                    \
+        AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C3(DS), EMPTY2)   \
+        EMITW(0xF7D0F000 | MRM(0x00,    MOD(MS), TDxx))
+
+#define pf1xx_ld(MS, DS)                                                    \
+        AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C3(DS), EMPTY2)   \
+        EMITW(0xF7D0F000 | MRM(0x00,    MOD(MS), TDxx))
+
+#define pf2xx_ld(MS, DS)                                                    \
+        AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C3(DS), EMPTY2)   \
+        EMITW(0xF7D0F000 | MRM(0x00,    MOD(MS), TDxx))
+
+#define pfnxx_ld(MS, DS)                                                    \
+        AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C3(DS), EMPTY2)   \
+        EMITW(0xF7D0F000 | MRM(0x00,    MOD(MS), TDxx))
+
+/* sfn (fence for stores), orders all prior stores before any later stores
+ * place after non-temporal stores (stn) before [D] is read by other threads
+ * set-flags: no */
+
+#define sfnce_xx()                                                          \
+        EMITW(0xF57FF05A)
+
+/* zcl (zero 128-byte block at [D]), [D] must be aligned to 128 bytes
+ * no cache-line zeroing in ISA, 32 regular 32-bit stores of zero in TMxx
+ * set-flags: no */
+
+#define zclxx_st(MD, DD)                                                    \
+        AUW(SIB(MD),  EMPTY,  EMPTY,    MOD(MD), VAL(DD), C3(DD), EMPTY2)   \
+        EMITW(0xE0800000 | MRM(TDxx,    MOD(MD), TDxx))                     \
+        EMITW(0xE3A00000 | MRM(TMxx,    0x00,    0x00))                     \
+        zclxx_r8(0x00)                                                      \
+        zclxx_r8(0x20)                                                      \
+        zclxx_r8(0x40)                                                      \
+        zclxx_r8(0x60)
+
+#define zclxx_r8(dp) /* not portable, do not use outside */                 \
+        EMITW(0xE5800000 | MRM(TMxx,    TDxx,    dp+0x00))                  \
+        EMITW(0xE5800000 | MRM(TMxx,    TDxx,    dp+0x04))                  \
+        EMITW(0xE5800000 | MRM(TMxx,    TDxx,    dp+0x08))                  \
+        EMITW(0xE5800000 | MRM(TMxx,    TDxx,    dp+0x0C))                  \
+        EMITW(0xE5800000 | MRM(TMxx,    TDxx,    dp+0x10))                  \
+        EMITW(0xE5800000 | MRM(TMxx,    TDxx,    dp+0x14))                  \
+        EMITW(0xE5800000 | MRM(TMxx,    TDxx,    dp+0x18))                  \
+        EMITW(0xE5800000 | MRM(TMxx,    TDxx,    dp+0x1C))
+
 /************************* pointer-sized instructions *************************/
 
 /* label (D = Reax = adr lb)
@@ -243,6 +243,13 @@
 #define movjx_st(XS, MD, DD)                                                \
         movix_st(W(XS), W(MD), W(DD))
 
+/* bcs (D = [M]) broadcast scalar element from memory into all SIMD elements */
+
+#define bcsix_ld(XD, MS, DS)                                                \
+        AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C4(DS), EMPTY2)   \
+        EMITW(0xE0800000 | MPM(TPxx,    MOD(MS), VAL(DS), B4(DS), P4(DS)))  \
+        EMITW(0xF4A00CBF | MXM(REG(XD), TPxx,    0x00))
+
 /* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
  * uses Xmm0 implicitly as a mask register, destroys Xmm0, 0-masked XS elems */
 
@@ -272,6 +279,14 @@
 #define mmvjx_st(XS, MG, DG)                                                \
         mmvix_st(W(XS), W(MG), W(DG))
 
+/* hrd (D = S op S op ..) reduce all elements of S with "op" into each of D
+ * via pairwise "pp" steps on 64-bit halves of the register */
+
+#define hrdis_rx(XD, XS, pp) /* not portable, do not use outside */         \
+        EMITW(pp | MXM(REG(XD)+0, REG(XS)+0, REG(XS)+1))                    \
+        EMITW(pp | MXM(REG(XD)+0, REG(XD)+0, REG(XD)+0))                    \
+        EMITW(0xF2200110 | MXM(REG(XD)+1, REG(XD)+0, REG(XD)+0))
+
 /* and (G = G & S), (D = S & T) if (#D != #T) */
 
 #define andix_rr(XG, XS)                                                    \
@@ -506,6 +521,10 @@
         EMITW(0xF3000D00 | MXM(REG(XD)+0, REG(XS)+0, REG(XS)+1))            \
         EMITW(0xF3000D00 | MXM(REG(XD)+1,    TmmM+0,    TmmM+1))
 
+#undef  adhis_rr
+#define adhis_rr(XD, XS) /* horizontal reductive add, first 15-regs only */ \
+        hrdis_rx(W(XD), W(XS), 0xF3000D00)
+
 /* sub (G = G - S), (D = S - T) if (#D != #T) */
 
 #define subis_rr(XG, XS)                                                    \
@@ -579,6 +598,13 @@
         /* mlp, mlh are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  mlhis_rr
+#define mlhis_rr(XD, XS) /* horizontal reductive mul */                     \
+        EMITW(0xF3000D10 | MXM(TmmM+0,    REG(XS)+0, REG(XS)+1))            \
+        EMITW(0xF3B80000 | MXM(REG(XD)+0, 0x00,      TmmM+0))               \
+        EMITW(0xF3000D10 | MXM(REG(XD)+0, REG(XD)+0, TmmM+0))               \
+        EMITW(0xF2200110 | MXM(REG(XD)+1, REG(XD)+0, REG(XD)+0))
+
 /* div (G = G / S), (D = S / T) if (#D != #T) and on ARMv7 if (#D != #S) */
 
 #define divis_rr(XG, XS)                                                    \
@@ -1000,6 +1026,10 @@
         /* mnp, mnh are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  mnhis_rr
+#define mnhis_rr(XD, XS) /* horizontal reductive min */                     \
+        hrdis_rx(W(XD), W(XS), 0xF3200F00)
+
 /* max (G = G > S ? G : S), (D = S > T ? S : T) if (#D != #T) */
 
 #define maxis_rr(XG, XS)                                                    \
@@ -1020,6 +1050,10 @@
         /* mxp, mxh are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  mxhis_rr
+#define mxhis_rr(XD, XS) /* horizontal reductive max */                     \
+        hrdis_rx(W(XD), W(XS), 0xF3000F00)
+
 /* ceq (G = G == S ? -1 : 0), (D = S == T ? -1 : 0) if (#D != #T) */
 
 #define ceqis_rr(XG, XS)                                                    \
@@ -1607,6 +1641,15 @@
         EMITW(0xF3B903C0 | MXM(TmmM,    0x00,    TmmM))                     \
         EMITW(0xF2200440 | MXM(REG(XD), TmmM,    REG(XS)))
 
+/* bsw (D = S with the order of bytes reversed in each element) */
+
+#define bswix_rr(XD, XS)                                                    \
+        EMITW(0xF3B000C0 | MXM(REG(XD), 0x00,    REG(XS)))
+
+#define bswix_ld(XD, MS, DS)                                                \
+        movix_ld(W(XD), W(MS), W(DS))                                       \
+        bswix_rr(W(XD), W(XD))
+
 /****************   packed single-precision integer compare   *****************/
 
 /* min (G = G < S ? G : S), (D = S < T ? S : T) if (#D != #T), unsigned */
@@ -2219,6 +2262,15 @@
         EMITW(0xF3B503C0 | MXM(TmmM,    0x00,    TmmM))                     \
         EMITW(0xF2100440 | MXM(REG(XD), TmmM,    REG(XS)))
 
+/* bsw (D = S with the order of bytes reversed in each element) */
+
+#define bswgx_rr(XD, XS)                                                    \
+        EMITW(0xF3B00140 | MXM(REG(XD), 0x00,    REG(XS)))
+
+#define bswgx_ld(XD, MS, DS)                                                \
+        movgx_ld(W(XD), W(MS), W(DS))                                       \
+        bswgx_rr(W(XD), W(XD))
+
 /*****************   packed half-precision integer compare   ******************/
 
 /* min (G = G < S ? G : S), (D = S < T ? S : T) if (#D != #T), unsigned */
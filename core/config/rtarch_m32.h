@@ -1845,6 +1845,77 @@
 
 #endif /* RT_BASE_COMPAT_REV >= 6 : r6 */
 
+/* cnt (D = number of bits set in S), population count
+ * clz (D = number of leading zeroes in S), 32 if S is 0
+ * ctz (D = number of trailing zeroes in S), 32 if S is 0
+ * set-flags: undefined */
+
+#define cntwx_rr(RD, RS)                                                    \
+        EMITW(0x00000042 | MSM(TMxx,    REG(RS), 0x00))                     \
+        G32(TIxx, 0x55555555)                                               \
+        EMITW(0x00000024 | MRM(TMxx,    TMxx,    TIxx))                     \
+        EMITW(0x00000023 | MRM(REG(RD), REG(RS), TMxx))                     \
+        G32(TIxx, 0x33333333)                                               \
+        EMITW(0x00000082 | MSM(TMxx,    REG(RD), 0x00))                     \
+        EMITW(0x00000024 | MRM(TMxx,    TMxx,    TIxx))                     \
+        EMITW(0x00000024 | MRM(REG(RD), REG(RD), TIxx))                     \
+        EMITW(0x00000021 | MRM(REG(RD), REG(RD), TMxx))                     \
+        EMITW(0x00000102 | MSM(TMxx,    REG(RD), 0x00))                     \
+        EMITW(0x00000021 | MRM(REG(RD), REG(RD), TMxx))                     \
+        G32(TIxx, 0x0F0F0F0F)                                               \
+        EMITW(0x00000024 | MRM(REG(RD), REG(RD), TIxx))                     \
+        EMITW(0x00000202 | MSM(TMxx,    REG(RD), 0x00))                     \
+        EMITW(0x00000021 | MRM(REG(RD), REG(RD), TMxx))                     \
+        EMITW(0x00000402 | MSM(TMxx,    REG(RD), 0x00))                     \
+        EMITW(0x00000021 | MRM(REG(RD), REG(RD), TMxx))                     \
+        EMITW(0x3000003F | MTM(REG(RD), REG(RD), 0x00))
+
+#define cntwx_ld(RD, MS, DS)                                                \
+        movwx_ld(W(RD), W(MS), W(DS))                                       \
+        cntwx_rr(W(RD), W(RD))
+
+#define clzwx_rr(RD, RS)                                                    \
+        clzwx_rx(REG(RD), REG(RS))
+
+#if (RT_BASE_COMPAT_REV < 6) /* pre-r6 */
+
+#define clzwx_rx(rd, rs) /* not portable, do not use outside */             \
+        EMITW(0x70000020 | MRM((rd),    (rs),    (rd)))
+
+#else /* RT_BASE_COMPAT_REV >= 6 : r6 */
+
+#define clzwx_rx(rd, rs) /* not portable, do not use outside */             \
+        EMITW(0x00000050 | MRM((rd),    (rs),    0x00))
+
+#endif /* RT_BASE_COMPAT_REV >= 6 : r6 */
+
+#define clzwx_ld(RD, MS, DS)                                                \
+        movwx_ld(W(RD), W(MS), W(DS))                                       \
+        clzwx_rr(W(RD), W(RD))
+
+#define ctzwx_rr(RD, RS)   /* ctz(S) = 32 - clz(~S & (S - 1)) */            \
+        EMITW(0x2400FFFF | MTM(TMxx,    REG(RS), 0x00))                     \
+        EMITW(0x00000027 | MRM(TIxx,    REG(RS), TZxx))                     \
+        EMITW(0x00000024 | MRM(TMxx,    TMxx,    TIxx))                     \
+        clzwx_rx(REG(RD), TMxx)                                             \
+        EMITW(0x24000020 | MTM(TIxx,    TZxx,    0x00))                     \
+        EMITW(0x00000023 | MRM(REG(RD), TIxx,    REG(RD)))
+
+#define ctzwx_ld(RD, MS, DS)                                                \
+        movwx_ld(W(RD), W(MS), W(DS))                                       \
+        ctzwx_rr(W(RD), W(RD))
+
+/* bsw (D = S with the order of bytes reversed), byte-swap
+ * set-flags: no */
+
+#define bswwx_rr(RD, RS)                                                    \
+        EMITW(0x7C0000A0 | MRM(REG(RD), 0x00,    REG(RS)))                  \
+        EMITW(0x00200402 | MRM(REG(RD), 0x00,    REG(RD)))
+
+#define bswwx_ld(RD, MS, DS)                                                \
+        movwx_ld(W(RD), W(MS), W(DS))                                       \
+        bswwx_rr(W(RD), W(RD))
+
 /* arj (G = G op S, if cc G then jump lb)
  * set-flags: undefined
  * refer to individual instruction descriptions
@@ -2069,6 +2140,86 @@
         AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C3(DS), EMPTY2)   \
         EMITW(0x00000021 | MRM(REG(RD), MOD(MS), TDxx) | ADR)
 
+/* pf0, pf1, pf2, pfn (prefetch [S] into cache, T0/T1/T2-hints, NTA-hint)
+ * T0 - all cache levels, T1 - L2 and up, T2 - L3 and up (if available),
+ * NTA - non-temporal (streaming), hints are advisory, never fault on [S]
+ * set-flags: no */
+
+#if (RT_BASE_COMPAT_REV < 6) /* pre-r6 */
+
+#define pf0xx_ld(MS, DS)                                                    \
+        AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C3(DS), EMPTY2)   \
+        EMITW(0x00000021 | MRM(TDxx,    MOD(MS), TDxx) | ADR)               \
+        EMITW(0xCC000000 | MTM(0x00,    TDxx,    0x00))
+
+#define pf1xx_ld(MS, DS)                                                    \
+        AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C3(DS), EMPTY2)   \
+        EMITW(0x00000021 | MRM(TDxx,    MOD(MS), TDxx) | ADR)               \
+        EMITW(0xCC000000 | MTM(0x00,    TDxx,    0x00))
+
+#define pf2xx_ld(MS, DS)                                                    \
+        AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C3(DS), EMPTY2)   \
+        EMITW(0x00000021 | MRM(TDxx,    MOD(MS), TDxx) | ADR)               \
+        EMITW(0xCC000000 | MTM(0x00,    TDxx,    0x00))
+
+#define pfnxx_ld(MS, DS)                                                    \
+        AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C3(DS), EMPTY2)   \
+        EMITW(0x00000021 | MRM(TDxx,    MOD(MS), TDxx) | ADR)               \
+        EMITW(0xCC000000 | MTM(0x04,    TDxx,    0x00))
+
+#else /* RT_BASE_COMPAT_REV >= 6 : r6 */
+
+#define pf0xx_ld(MS, DS)                                                    \
+        AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C3(DS), EMPTY2)   \
+        EMITW(0x00000021 | MRM(TDxx,    MOD(MS), TDxx) | ADR)               \
+        EMITW(0x7C000035 | MTM(0x00,    TDxx,    0x00))
+
+#define pf1xx_ld(MS, DS)                                                    \
+        AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C3(DS), EMPTY2)   \
+        EMITW(0x00000021 | MRM(TDxx,    MOD(MS), TDxx) | ADR)               \
+        EMITW(0x7C000035 | MTM(0x00,    TDxx,    0x00))
+
+#define pf2xx_ld(MS, DS)                                                    \
+        AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C3(DS), EMPTY2)   \
+        EMITW(0x00000021 | MRM(TDxx,    MOD(MS), TDxx) | ADR)               \
+        EMITW(0x7C000035 | MTM(0x00,    TDxx,    0x00))
+
+#define pfnxx_ld(MS, DS)                                                    \
+        AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C3(DS), EMPTY2)   \
+        EMITW(0x00000021 | MRM(TDxx,    MOD(MS), TDxx) | ADR)               \
+        EMITW(0x7C000035 | MTM(0x04,    TDxx,    0x00))
+
+#endif /* RT_BASE_COMPAT_REV >= 6 : r6 */
+
+/* sfn (fence for stores), orders all prior stores before any later stores
+ * place after non-temporal stores (stn) before [D] is read by other threads
+ * set-flags: no */
+
+#define sfnce_xx()                                                          \
+        EMITW(0x0000000F)
+
+/* zcl (zero 128-byte block at [D]), [D] must be aligned to 128 bytes
+ * no user-level cache-line zeroing in ISA, 32 regular stores of zero
+ * set-flags: no */
+
+#define zclxx_st(MD, DD)                                                    \
+        AUW(SIB(MD),  EMPTY,  EMPTY,    MOD(MD), VAL(DD), C3(DD), EMPTY2)   \
+        EMITW(0x00000021 | MRM(TDxx,    MOD(MD), TDxx) | ADR)               \
+        zclxx_r8(0x00)                                                      \
+        zclxx_r8(0x20)                                                      \
+        zclxx_r8(0x40)                                                      \
+        zclxx_r8(0x60)
+
+#define zclxx_r8(dp) /* not portable, do not use outside */                 \
+        EMITW(0xAC000000 | MTM(TZxx,    TDxx,    0x00) | (dp+0x00))         \
+        EMITW(0xAC000000 | MTM(TZxx,    TDxx,    0x00) | (dp+0x04))         \
+        EMITW(0xAC000000 | MTM(TZxx,    TDxx,    0x00) | (dp+0x08))         \
+        EMITW(0xAC000000 | MTM(TZxx,    TDxx,    0x00) | (dp+0x0C))         \
+        EMITW(0xAC000000 | MTM(TZxx,    TDxx,    0x00) | (dp+0x10))         \
+        EMITW(0xAC000000 | MTM(TZxx,    TDxx,    0x00) | (dp+0x14))         \
+        EMITW(0xAC000000 | MTM(TZxx,    TDxx,    0x00) | (dp+0x18))         \
+        EMITW(0xAC000000 | MTM(TZxx,    TDxx,    0x00) | (dp+0x1C))
+
 /************************* pointer-sized instructions *************************/
 
 /* label (D = Reax = adr lb)
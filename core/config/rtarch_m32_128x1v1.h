@@ -284,6 +284,13 @@
     SHF(EMITW(0x78000026 | MFM(TmmM,    MOD(MD), VAL(DD), B4(DD), F2(DD)))) \
     SHX(EMITW(0x78000026 | MFM(REG(XS), MOD(MD), VAL(DD), B4(DD), F2(DD))))
 
+/* bcs (D = [M]) broadcast scalar element from memory into all SIMD elements */
+
+#define bcsix_ld(XD, MS, DS)                                                \
+        AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), A1(DS), EMPTY2)   \
+        EMITW(0x8C000000 | MDM(TMxx,    MOD(MS), VAL(DS), B3(DS), P1(DS)))  \
+        EMITW(0x7B02001E | MXM(REG(XD), TMxx,    0x00))
+
 /* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
  * uses Xmm0 implicitly as a mask register, destroys Xmm0, 0-masked XS elems */
 
@@ -304,6 +311,110 @@
     SHF(EMITW(0x7AB10002 | MXM(TmmM,    TmmM,    0x00)))                    \
         EMITW(0x78000026 | MFM(TmmM,    MOD(MG), VAL(DG), B4(DG), F2(DG)))
 
+/* hrd (D = S op S op ..) reduce all elements of S with "op" into each of D
+ * in log2 steps via in-register permutes, TmmM is used as a temporary */
+
+#define hrdis_rx(XD, XS, op) /* not portable, do not use outside */         \
+        EMITW(0x7A4E0002 | MXM(TmmM,    REG(XS), 0x00))                     \
+        EMITW(op | MXM(REG(XD), REG(XS), TmmM))                             \
+        EMITW(0x7AB10002 | MXM(TmmM,    REG(XD), 0x00))                     \
+        EMITW(op | MXM(REG(XD), REG(XD), TmmM))
+
+/* shf (G = G[IS]), (D = S[IT]) shuffle elements within each 128-bit lane
+ * 2-bit fields of the immediate select 32-bit elements in each 128-bit lane */
+
+#define shfix_ri(XG, IS)                                                    \
+        shfix3ri(W(XG), W(XG), W(IS))
+
+#define shfix3ri(XD, XS, IT)                                                \
+        EMITW(0x7A000002 | MXM(REG(XD), REG(XS), 0x00) |                    \
+                           (0xFF & VAL(IT)) << 16)
+
+/* tbl (G = G[S]), (D = S[T]) permute elements across the SIMD register
+ * indices are in elements, taken modulo the number of elements in SIMD */
+
+#define tblix_rr(XG, XS)                                                    \
+        tblix3rr(W(XG), W(XG), W(XS))
+
+#define tblix3rr(XD, XS, XT)                                                \
+        EMITW(0x78000000 | MXM(TmmM,    REG(XT), 0x00) | 0x03 << 16)        \
+        EMITW(0x78400015 | MXM(TmmM,    REG(XS), REG(XS)))                  \
+        EMITW(0x78BE0019 | MXM(REG(XD), TmmM,    0x00))
+
+/* scn (D[i] = S[0] op .. op S[i]) inclusive scan of S with "op" in log2
+ * steps, scz shifts in zeroes (add), scs repeats S[0] (min/max, idempotent),
+ * sce shifts D up by one element (exclusive scan), Xmm0 is used as a temp
+ * sldi.b slides a copy of D up by nb bytes filling in from TmmZ/TmmM */
+
+#define sczix_rx(XD, XS, op) /* not portable, do not use outside */         \
+    SHF(EMITW(0x7AB10002 | MXM(REG(XD), REG(XS), 0x00)))                    \
+    SHX(movix_rr(W(XD), W(XS)))                                             \
+        scnix_rs(W(XD), Xmm0, op, TmmZ, 0x0C)                               \
+        scnix_rs(W(XD), Xmm0, op, TmmZ, 0x08)                               \
+    SHF(EMITW(0x7AB10002 | MXM(REG(XD), REG(XD), 0x00)))
+
+#define scsix_rx(XD, XS, op) /* not portable, do not use outside */         \
+    SHF(EMITW(0x7AB10002 | MXM(REG(XD), REG(XS), 0x00)))                    \
+    SHX(movix_rr(W(XD), W(XS)))                                             \
+        EMITW(0x78700019 | MXM(TmmM,    REG(XD), 0x00))                     \
+        scnix_rs(W(XD), Xmm0, op, TmmM, 0x0C)                               \
+        scnix_rs(W(XD), Xmm0, op, TmmM, 0x08)                               \
+    SHF(EMITW(0x7AB10002 | MXM(REG(XD), REG(XD), 0x00)))
+
+#define sceix_rx(XD) /* not portable, do not use outside */                 \
+    SHF(EMITW(0x7AB10002 | MXM(REG(XD), REG(XD), 0x00)))                    \
+        EMITW(0x78000019 | MXM(REG(XD), TmmZ,    0x0C))                     \
+    SHF(EMITW(0x7AB10002 | MXM(REG(XD), REG(XD), 0x00)))
+
+#define scnix_rs(XD, XT, op, fl, nb) /* not portable, do not use outside */ \
+        movix_rr(W(XT), W(XD))                                              \
+        EMITW(0x78000019 | MXM(REG(XT), (fl),    (nb)))                     \
+        op(W(XD), W(XT))
+
+/* adi (D[i] = S[0] + .. + S[i]) inclusive prefix sum of elements of S
+ * uses Xmm0 implicitly as a temp register, destroys Xmm0, XD/XS != Xmm0 */
+
+#define adiis_rr(XD, XS)                                                    \
+        sczix_rx(W(XD), W(XS), addis_rr)
+
+#define adiix_rr(XD, XS)                                                    \
+        sczix_rx(W(XD), W(XS), addix_rr)
+
+/* ade (D[i] = S[0] + .. + S[i-1]) exclusive prefix sum of S, D[0] = 0
+ * uses Xmm0 implicitly as a temp register, destroys Xmm0, XD/XS != Xmm0 */
+
+#define adeis_rr(XD, XS)                                                    \
+        sczix_rx(W(XD), W(XS), addis_rr)                                    \
+        sceix_rx(W(XD))
+
+#define adeix_rr(XD, XS)                                                    \
+        sczix_rx(W(XD), W(XS), addix_rr)                                    \
+        sceix_rx(W(XD))
+
+/* mni (D[i] = min(S[0], .. , S[i])) inclusive prefix min of elements of S
+ * uses Xmm0 implicitly as a temp register, destroys Xmm0, XD/XS != Xmm0 */
+
+#define mniis_rr(XD, XS)                                                    \
+        scsix_rx(W(XD), W(XS), minis_rr)
+
+#define mniix_rr(XD, XS)                                                    \
+        scsix_rx(W(XD), W(XS), minix_rr)
+
+#define mniin_rr(XD, XS)                                                    \
+        scsix_rx(W(XD), W(XS), minin_rr)
+
+/* mxi (D[i] = max(S[0], .. , S[i])) inclusive prefix max of elements of S
+ * uses Xmm0 implicitly as a temp register, destroys Xmm0, XD/XS != Xmm0 */
+
+#define mxiis_rr(XD, XS)                                                    \
+        scsix_rx(W(XD), W(XS), maxis_rr)
+
+#define mxiix_rr(XD, XS)                                                    \
+        scsix_rx(W(XD), W(XS), maxix_rr)
+
+#define mxiin_rr(XD, XS)                                                    \
+        scsix_rx(W(XD), W(XS), maxin_rr)
+
 /* and (G = G & S), (D = S & T) if (#D != #T) */
 
 #define andix_rr(XG, XS)                                                    \
@@ -436,6 +547,10 @@
         /* adp, adh are defined in rtbase.h (first 15-regs only)
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  adhis_rr
+#define adhis_rr(XD, XS) /* horizontal reductive add, first 15-regs only */ \
+        hrdis_rx(W(XD), W(XS), 0x7800001B)
+
 /* sub (G = G - S), (D = S - T) if (#D != #T) */
 
 #define subis_rr(XG, XS)                                                    \
@@ -473,6 +588,10 @@
         /* mlp, mlh are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  mlhis_rr
+#define mlhis_rr(XD, XS) /* horizontal reductive mul */                     \
+        hrdis_rx(W(XD), W(XS), 0x7880001B)
+
 /* div (G = G / S), (D = S / T) if (#D != #T) and on ARMv7 if (#D != #S) */
 
 #define divis_rr(XG, XS)                                                    \
@@ -592,6 +711,10 @@
         /* mnp, mnh are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  mnhis_rr
+#define mnhis_rr(XD, XS) /* horizontal reductive min */                     \
+        hrdis_rx(W(XD), W(XS), 0x7B00001B)
+
 /* max (G = G > S ? G : S), (D = S > T ? S : T) if (#D != #T) */
 
 #define maxis_rr(XG, XS)                                                    \
@@ -612,6 +735,10 @@
         /* mxp, mxh are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  mxhis_rr
+#define mxhis_rr(XD, XS) /* horizontal reductive max */                     \
+        hrdis_rx(W(XD), W(XS), 0x7B80001B)
+
 /* ceq (G = G == S ? -1 : 0), (D = S == T ? -1 : 0) if (#D != #T) */
 
 #define ceqis_rr(XG, XS)                                                    \
@@ -939,6 +1066,49 @@
     SHF(EMITW(0x7AB10002 | MXM(TmmM,    TmmM,    0x00)))                    \
         EMITW(0x78400012 | MXM(REG(XD), REG(XS), TmmM))
 
+/* muh (G = G * S), keeps upper half of the full-width product of elements
+ * unsigned-[x] or signed-[n], lower half is returned by mul
+ * even and odd elements are zero-extended against TmmZ, multiplied with dotp,
+ * then ilvod.w gathers upper halves, ld form reuses TmmZ and clears it */
+
+#define muhix_rr(XG, XS)                                                    \
+        EMITW(0x7B400014 | MXM(TmmM,    TmmZ,    REG(XG)))                  \
+        EMITW(0x78E00013 | MXM(TmmM,    TmmM,    REG(XS)))                  \
+        EMITW(0x7BC00014 | MXM(REG(XG), REG(XG), TmmZ))                     \
+        EMITW(0x78E00013 | MXM(REG(XG), REG(XG), REG(XS)))                  \
+        EMITW(0x7BC00014 | MXM(REG(XG), REG(XG), TmmM))
+
+#define muhix_ld(XG, MS, DS)                                                \
+        AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), A2(DS), EMPTY2)   \
+        EMITW(0x78000022 | MFM(TmmM,    MOD(MS), VAL(DS), B4(DS), F2(DS)))  \
+    SHF(EMITW(0x7AB10002 | MXM(TmmM,    TmmM,    0x00)))                    \
+        EMITW(0x7B400014 | MXM(TmmZ,    TmmZ,    REG(XG)))                  \
+        EMITW(0x78E00013 | MXM(TmmZ,    TmmZ,    TmmM))                     \
+        EMITW(0x79200009 | MXM(REG(XG), REG(XG), 0x00))                     \
+        EMITW(0x79200009 | MXM(TmmM,    TmmM,    0x00))                     \
+        EMITW(0x78E00013 | MXM(REG(XG), REG(XG), TmmM))                     \
+        EMITW(0x7BC00014 | MXM(REG(XG), REG(XG), TmmZ))                     \
+        EMITW(0x7860001E | MXM(TmmZ,    TmmZ,    TmmZ))
+
+#define muhin_rr(XG, XS)                                                    \
+        EMITW(0x7B400014 | MXM(TmmM,    TmmZ,    REG(XG)))                  \
+        EMITW(0x78600013 | MXM(TmmM,    TmmM,    REG(XS)))                  \
+        EMITW(0x7BC00014 | MXM(REG(XG), REG(XG), TmmZ))                     \
+        EMITW(0x78600013 | MXM(REG(XG), REG(XG), REG(XS)))                  \
+        EMITW(0x7BC00014 | MXM(REG(XG), REG(XG), TmmM))
+
+#define muhin_ld(XG, MS, DS)                                                \
+        AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), A2(DS), EMPTY2)   \
+        EMITW(0x78000022 | MFM(TmmM,    MOD(MS), VAL(DS), B4(DS), F2(DS)))  \
+    SHF(EMITW(0x7AB10002 | MXM(TmmM,    TmmM,    0x00)))                    \
+        EMITW(0x7B400014 | MXM(TmmZ,    TmmZ,    REG(XG)))                  \
+        EMITW(0x78600013 | MXM(TmmZ,    TmmZ,    TmmM))                     \
+        EMITW(0x79200009 | MXM(REG(XG), REG(XG), 0x00))                     \
+        EMITW(0x79200009 | MXM(TmmM,    TmmM,    0x00))                     \
+        EMITW(0x78600013 | MXM(REG(XG), REG(XG), TmmM))                     \
+        EMITW(0x7BC00014 | MXM(REG(XG), REG(XG), TmmZ))                     \
+        EMITW(0x7860001E | MXM(TmmZ,    TmmZ,    TmmZ))
+
 /* shl (G = G << S), (D = S << T) if (#D != #T) - plain, unsigned
  * for maximum compatibility: shift count must be modulo elem-size */
 
@@ -1050,6 +1220,49 @@
     SHF(EMITW(0x7AB10002 | MXM(TmmM,    TmmM,    0x00)))                    \
         EMITW(0x78C0000D | MXM(REG(XD), REG(XS), TmmM))
 
+/* cnt (D = number of bits set in each element of S), population count */
+
+#define cntix_rr(XD, XS)                                                    \
+        EMITW(0x7B06001E | MXM(REG(XD), REG(XS), 0x00))
+
+#define cntix_ld(XD, MS, DS)                                                \
+        AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), A2(DS), EMPTY2)   \
+        EMITW(0x78000022 | MFM(TmmM,    MOD(MS), VAL(DS), B4(DS), F2(DS)))  \
+    SHF(EMITW(0x7AB10002 | MXM(TmmM,    TmmM,    0x00)))                    \
+        EMITW(0x7B06001E | MXM(REG(XD), TmmM,    0x00))
+
+/* clz (D = number of leading zeroes in each element of S), 32 if 0 */
+
+#define clzix_rr(XD, XS)                                                    \
+        EMITW(0x7B0E001E | MXM(REG(XD), REG(XS), 0x00))
+
+#define clzix_ld(XD, MS, DS)                                                \
+        AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), A2(DS), EMPTY2)   \
+        EMITW(0x78000022 | MFM(TmmM,    MOD(MS), VAL(DS), B4(DS), F2(DS)))  \
+    SHF(EMITW(0x7AB10002 | MXM(TmmM,    TmmM,    0x00)))                    \
+        EMITW(0x7B0E001E | MXM(REG(XD), TmmM,    0x00))
+
+/* ctz (D = number of trailing zeroes in each element of S), 32 if 0 */
+
+#define ctzix_rr(XD, XS)                                                    \
+        EMITW(0x78C10006 | MXM(TmmM,    REG(XS), 0x00))                     \
+        EMITW(0x7840001E | MXM(REG(XD), REG(XS), REG(XS)))                  \
+        EMITW(0x7800001E | MXM(REG(XD), REG(XD), TmmM))                     \
+        EMITW(0x7B06001E | MXM(REG(XD), REG(XD), 0x00))
+
+#define ctzix_ld(XD, MS, DS)                                                \
+        movix_ld(W(XD), W(MS), W(DS))                                       \
+        ctzix_rr(W(XD), W(XD))
+
+/* bsw (D = S with the order of bytes reversed in each element) */
+
+#define bswix_rr(XD, XS)                                                    \
+        EMITW(0x781B0002 | MXM(REG(XD), REG(XS), 0x00))
+
+#define bswix_ld(XD, MS, DS)                                                \
+        movix_ld(W(XD), W(MS), W(DS))                                       \
+        bswix_rr(W(XD), W(XD))
+
 /****************   packed single-precision integer compare   *****************/
 
 /* min (G = G < S ? G : S), (D = S < T ? S : T) if (#D != #T), unsigned */
@@ -198,6 +198,17 @@
     SJF(EMITW(0x7AB10002 | MXM(TmmM,    TmmM,    0x00)))                    \
         EMITW(0x78000026 | MFM(TmmM,    MOD(MG), VYL(DG), B4(DG), K2(DG)))
 
+/* hrd (D = S op S op ..) reduce all elements of S with "op" into each of D
+ * combining halves first, then in log2 steps via in-register permutes */
+
+#define hrdcs_rx(XD, XS, op) /* not portable, do not use outside */         \
+        EMITW(op | MXM(TmmM,    REG(XS), RYG(XS)))                          \
+        EMITW(0x7A4E0002 | MXM(REG(XD), TmmM,    0x00))                     \
+        EMITW(op | MXM(TmmM,    TmmM,    REG(XD)))                          \
+        EMITW(0x7AB10002 | MXM(REG(XD), TmmM,    0x00))                     \
+        EMITW(op | MXM(REG(XD), REG(XD), TmmM))                             \
+        EMITW(0x78BE0019 | MXM(RYG(XD), REG(XD), 0x00))
+
 /* and (G = G & S), (D = S & T) if (#D != #T) */
 
 #define andcx_rr(XG, XS)                                                    \
@@ -349,6 +360,10 @@
         /* adp, adh are defined in rtbase.h (first 15-regs only)
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  adhcs_rr
+#define adhcs_rr(XD, XS) /* horizontal reductive add, first 15-regs only */ \
+        hrdcs_rx(W(XD), W(XS), 0x7800001B)
+
 /* sub (G = G - S), (D = S - T) if (#D != #T) */
 
 #define subcs_rr(XG, XS)                                                    \
@@ -394,6 +409,10 @@
         /* mlp, mlh are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  mlhcs_rr
+#define mlhcs_rr(XD, XS) /* horizontal reductive mul */                     \
+        hrdcs_rx(W(XD), W(XS), 0x7880001B)
+
 /* div (G = G / S), (D = S / T) if (#D != #T) and on ARMv7 if (#D != #S) */
 
 #define divcs_rr(XG, XS)                                                    \
@@ -535,6 +554,10 @@
         /* mnp, mnh are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  mnhcs_rr
+#define mnhcs_rr(XD, XS) /* horizontal reductive min */                     \
+        hrdcs_rx(W(XD), W(XS), 0x7B00001B)
+
 /* max (G = G > S ? G : S), (D = S > T ? S : T) if (#D != #T) */
 
 #define maxcs_rr(XG, XS)                                                    \
@@ -559,6 +582,10 @@
         /* mxp, mxh are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  mxhcs_rr
+#define mxhcs_rr(XD, XS) /* horizontal reductive max */                     \
+        hrdcs_rx(W(XD), W(XS), 0x7B80001B)
+
 /* ceq (G = G == S ? -1 : 0), (D = S == T ? -1 : 0) if (#D != #T) */
 
 #define ceqcs_rr(XG, XS)                                                    \
@@ -1456,6 +1456,84 @@
 
 #endif /* RT_BASE_COMPAT_REV >= 6 : r6 */
 
+/* cnt (D = number of bits set in S), population count
+ * clz (D = number of leading zeroes in S), 64 if S is 0
+ * ctz (D = number of trailing zeroes in S), 64 if S is 0
+ * set-flags: undefined */
+
+#define cntzx_rr(RD, RS)                                                    \
+        EMITW(0x0000007A | MSM(TMxx,    REG(RS), 0x00))                     \
+        cntzx_rx(0x55555555)                                                \
+        EMITW(0x00000024 | MRM(TMxx,    TMxx,    TIxx))                     \
+        EMITW(0x0000002F | MRM(REG(RD), REG(RS), TMxx))                     \
+        cntzx_rx(0x33333333)                                                \
+        EMITW(0x000000BA | MSM(TMxx,    REG(RD), 0x00))                     \
+        EMITW(0x00000024 | MRM(TMxx,    TMxx,    TIxx))                     \
+        EMITW(0x00000024 | MRM(REG(RD), REG(RD), TIxx))                     \
+        EMITW(0x0000002D | MRM(REG(RD), REG(RD), TMxx))                     \
+        EMITW(0x0000013A | MSM(TMxx,    REG(RD), 0x00))                     \
+        EMITW(0x0000002D | MRM(REG(RD), REG(RD), TMxx))                     \
+        cntzx_rx(0x0F0F0F0F)                                                \
+        EMITW(0x00000024 | MRM(REG(RD), REG(RD), TIxx))                     \
+        EMITW(0x0000023A | MSM(TMxx,    REG(RD), 0x00))                     \
+        EMITW(0x0000002D | MRM(REG(RD), REG(RD), TMxx))                     \
+        EMITW(0x0000043A | MSM(TMxx,    REG(RD), 0x00))                     \
+        EMITW(0x0000002D | MRM(REG(RD), REG(RD), TMxx))                     \
+        EMITW(0x0000003E | MSM(TMxx,    REG(RD), 0x00))                     \
+        EMITW(0x0000002D | MRM(REG(RD), REG(RD), TMxx))                     \
+        EMITW(0x3000007F | MTM(REG(RD), REG(RD), 0x00))
+
+#define cntzx_rx(im) /* not portable, do not use outside */                 \
+        G32(TIxx, im)                                                       \
+        EMITW(0x0000003C | MSM(TDxx,    TIxx,    0x00))                     \
+        EMITW(0x00000025 | MRM(TIxx,    TIxx,    TDxx))
+
+#define cntzx_ld(RD, MS, DS)                                                \
+        movzx_ld(W(RD), W(MS), W(DS))                                       \
+        cntzx_rr(W(RD), W(RD))
+
+#define clzzx_rr(RD, RS)                                                    \
+        clzzx_rx(REG(RD), REG(RS))
+
+#if (RT_BASE_COMPAT_REV < 6) /* pre-r6 */
+
+#define clzzx_rx(rd, rs) /* not portable, do not use outside */             \
+        EMITW(0x70000024 | MRM((rd),    (rs),    (rd)))
+
+#else /* RT_BASE_COMPAT_REV >= 6 : r6 */
+
+#define clzzx_rx(rd, rs) /* not portable, do not use outside */             \
+        EMITW(0x00000052 | MRM((rd),    (rs),    0x00))
+
+#endif /* RT_BASE_COMPAT_REV >= 6 : r6 */
+
+#define clzzx_ld(RD, MS, DS)                                                \
+        movzx_ld(W(RD), W(MS), W(DS))                                       \
+        clzzx_rr(W(RD), W(RD))
+
+#define ctzzx_rr(RD, RS)   /* ctz(S) = 64 - clz(~S & (S - 1)) */            \
+        EMITW(0x6400FFFF | MTM(TMxx,    REG(RS), 0x00))                     \
+        EMITW(0x00000027 | MRM(TIxx,    REG(RS), TZxx))                     \
+        EMITW(0x00000024 | MRM(TMxx,    TMxx,    TIxx))                     \
+        clzzx_rx(REG(RD), TMxx)                                             \
+        EMITW(0x24000040 | MTM(TIxx,    TZxx,    0x00))                     \
+        EMITW(0x0000002F | MRM(REG(RD), TIxx,    REG(RD)))
+
+#define ctzzx_ld(RD, MS, DS)                                                \
+        movzx_ld(W(RD), W(MS), W(DS))                                       \
+        ctzzx_rr(W(RD), W(RD))
+
+/* bsw (D = S with the order of bytes reversed), byte-swap
+ * set-flags: no */
+
+#define bswzx_rr(RD, RS)                                                    \
+        EMITW(0x7C0000A4 | MRM(REG(RD), 0x00,    REG(RS)))                  \
+        EMITW(0x7C000164 | MRM(REG(RD), 0x00,    REG(RD)))
+
+#define bswzx_ld(RD, MS, DS)                                                \
+        movzx_ld(W(RD), W(MS), W(DS))                                       \
+        bswzx_rr(W(RD), W(RD))
+
 /* arj (G = G op S, if cc G then jump lb)
  * set-flags: undefined
  * refer to individual instruction descriptions
@@ -124,6 +124,16 @@
 
 #if (RT_128X1 != 0)
 
+/* configuration for word order within 64-bit scalar load/store */
+
+#if RT_ENDIAN == 1
+#define SDF(x)  x
+#define SDX(x)
+#else /* RT_ENDIAN */
+#define SDF(x)
+#define SDX(x)  x
+#endif /* RT_ENDIAN */
+
 /******************************************************************************/
 /********************************   EXTERNAL   ********************************/
 /******************************************************************************/
@@ -153,6 +163,13 @@
         AUW(SIB(MD),  EMPTY,  EMPTY,    MOD(MD), VAL(DD), A2(DD), EMPTY2)   \
         EMITW(0x78000027 | MPM(REG(XS), MOD(MD), VAL(DD), B4(DD), P2(DD)))
 
+/* bcs (D = [M]) broadcast scalar element from memory into all SIMD elements */
+
+#define bcsjx_ld(XD, MS, DS)                                                \
+        AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), A1(DS), EMPTY2)   \
+        EMITW(0xDC000000 | MDM(TMxx,    MOD(MS), VAL(DS), B3(DS), P1(DS)))  \
+        EMITW(0x7B03001E | MXM(REG(XD), TMxx,    0x00))
+
 /* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
  * uses Xmm0 implicitly as a mask register, destroys Xmm0, 0-masked XS elems */
 
@@ -170,6 +187,101 @@
         EMITW(0x7880001E | MXM(TmmM,    REG(XS), Tmm0))                     \
         EMITW(0x78000027 | MPM(TmmM,    MOD(MG), VAL(DG), B4(DG), P2(DG)))
 
+/* hrd (D = S op S op ..) reduce all elements of S with "op" into each of D
+ * in log2 steps via in-register permutes, TmmM is used as a temporary */
+
+#define hrdjs_rx(XD, XS, op) /* not portable, do not use outside */         \
+        EMITW(0x7A4E0002 | MXM(TmmM,    REG(XS), 0x00))                     \
+        EMITW(op | MXM(REG(XD), REG(XS), TmmM))
+
+/* shf (G = G[IS]), (D = S[IT]) shuffle elements within each 128-bit lane
+ * 1-bit fields of the immediate select 64-bit elements in each 128-bit lane */
+
+#define shfjx_ri(XG, IS)                                                    \
+        shfjx3ri(W(XG), W(XG), W(IS))
+
+#define shfjx3ri(XD, XS, IT)                                                \
+        EMITW(0x7A000002 | MXM(REG(XD), REG(XS), 0x00) |                    \
+                           (0x44 | (1 & VAL(IT) >> 0) * 0x0A |              \
+                                   (1 & VAL(IT) >> 1) * 0xA0) << 16)
+
+/* tbl (G = G[S]), (D = S[T]) permute elements across the SIMD register
+ * indices are in elements, taken modulo the number of elements in SIMD */
+
+#define tbljx_rr(XG, XS)                                                    \
+        tbljx3rr(W(XG), W(XG), W(XS))
+
+#define tbljx3rr(XD, XS, XT)                                                \
+        EMITW(0x78000000 | MXM(TmmM,    REG(XT), 0x00) | 0x01 << 16)        \
+        EMITW(0x78600015 | MXM(TmmM,    REG(XS), REG(XS)))                  \
+        EMITW(0x78BE0019 | MXM(REG(XD), TmmM,    0x00))
+
+/* scn (D[i] = S[0] op .. op S[i]) inclusive scan of S with "op" in log2
+ * steps, scz shifts in zeroes (add), scs repeats S[0] (min/max, idempotent),
+ * sce shifts D up by one element (exclusive scan), Xmm0 is used as a temp
+ * sldi.b slides a copy of D up by nb bytes filling in from TmmZ/TmmM */
+
+#define sczjx_rx(XD, XS, op) /* not portable, do not use outside */         \
+        movjx_rr(W(XD), W(XS))                                              \
+        scnjx_rs(W(XD), Xmm0, op, TmmZ, 0x08)
+
+#define scsjx_rx(XD, XS, op) /* not portable, do not use outside */         \
+        movjx_rr(W(XD), W(XS))                                              \
+        EMITW(0x78780019 | MXM(TmmM,    REG(XD), 0x00))                     \
+        scnjx_rs(W(XD), Xmm0, op, TmmM, 0x08)
+
+#define scejx_rx(XD) /* not portable, do not use outside */                 \
+        EMITW(0x78000019 | MXM(REG(XD), TmmZ,    0x08))
+
+#define scnjx_rs(XD, XT, op, fl, nb) /* not portable, do not use outside */ \
+        movjx_rr(W(XT), W(XD))                                              \
+        EMITW(0x78000019 | MXM(REG(XT), (fl),    (nb)))                     \
+        op(W(XD), W(XT))
+
+/* adi (D[i] = S[0] + .. + S[i]) inclusive prefix sum of elements of S
+ * uses Xmm0 implicitly as a temp register, destroys Xmm0, XD/XS != Xmm0 */
+
+#define adijs_rr(XD, XS)                                                    \
+        sczjx_rx(W(XD), W(XS), addjs_rr)
+
+#define adijx_rr(XD, XS)                                                    \
+        sczjx_rx(W(XD), W(XS), addjx_rr)
+
+/* ade (D[i] = S[0] + .. + S[i-1]) exclusive prefix sum of S, D[0] = 0
+ * uses Xmm0 implicitly as a temp register, destroys Xmm0, XD/XS != Xmm0 */
+
+#define adejs_rr(XD, XS)                                                    \
+        sczjx_rx(W(XD), W(XS), addjs_rr)                                    \
+        scejx_rx(W(XD))
+
+#define adejx_rr(XD, XS)                                                    \
+        sczjx_rx(W(XD), W(XS), addjx_rr)                                    \
+        scejx_rx(W(XD))
+
+/* mni (D[i] = min(S[0], .. , S[i])) inclusive prefix min of elements of S
+ * uses Xmm0 implicitly as a temp register, destroys Xmm0, XD/XS != Xmm0 */
+
+#define mnijs_rr(XD, XS)                                                    \
+        scsjx_rx(W(XD), W(XS), minjs_rr)
+
+#define mnijx_rr(XD, XS)                                                    \
+        scsjx_rx(W(XD), W(XS), minjx_rr)
+
+#define mnijn_rr(XD, XS)                                                    \
+        scsjx_rx(W(XD), W(XS), minjn_rr)
+
+/* mxi (D[i] = max(S[0], .. , S[i])) inclusive prefix max of elements of S
+ * uses Xmm0 implicitly as a temp register, destroys Xmm0, XD/XS != Xmm0 */
+
+#define mxijs_rr(XD, XS)                                                    \
+        scsjx_rx(W(XD), W(XS), maxjs_rr)
+
+#define mxijx_rr(XD, XS)                                                    \
+        scsjx_rx(W(XD), W(XS), maxjx_rr)
+
+#define mxijn_rr(XD, XS)                                                    \
+        scsjx_rx(W(XD), W(XS), maxjn_rr)
+
 /* and (G = G & S), (D = S & T) if (#D != #T) */
 
 #define andjx_rr(XG, XS)                                                    \
@@ -296,6 +408,10 @@
         /* adp, adh are defined in rtbase.h (first 15-regs only)
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  adhjs_rr
+#define adhjs_rr(XD, XS) /* horizontal reductive add, first 15-regs only */ \
+        hrdjs_rx(W(XD), W(XS), 0x7820001B)
+
 /* sub (G = G - S), (D = S - T) if (#D != #T) */
 
 #define subjs_rr(XG, XS)                                                    \
@@ -331,6 +447,10 @@
         /* mlp, mlh are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  mlhjs_rr
+#define mlhjs_rr(XD, XS) /* horizontal reductive mul */                     \
+        hrdjs_rx(W(XD), W(XS), 0x78A0001B)
+
 /* div (G = G / S), (D = S / T) if (#D != #T) and on ARMv7 if (#D != #S) */
 
 #define divjs_rr(XG, XS)                                                    \
@@ -445,6 +565,10 @@
         /* mnp, mnh are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  mnhjs_rr
+#define mnhjs_rr(XD, XS) /* horizontal reductive min */                     \
+        hrdjs_rx(W(XD), W(XS), 0x7B20001B)
+
 /* max (G = G > S ? G : S), (D = S > T ? S : T) if (#D != #T) */
 
 #define maxjs_rr(XG, XS)                                                    \
@@ -464,6 +588,10 @@
         /* mxp, mxh are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  mxhjs_rr
+#define mxhjs_rr(XD, XS) /* horizontal reductive max */                     \
+        hrdjs_rx(W(XD), W(XS), 0x7BA0001B)
+
 /* ceq (G = G == S ? -1 : 0), (D = S == T ? -1 : 0) if (#D != #T) */
 
 #define ceqjs_rr(XG, XS)                                                    \
@@ -728,6 +856,33 @@
         cvtjs_rr(W(XD), W(XS))                                              \
         FCTRL_LEAVE(mode)
 
+/* cvy (D = fp32-to-fp64 S), widens lower half of fp32 elements in S
+ * cvu (D = fp32-to-fp64 S), widens upper half of fp32 elements in S
+ * cvx (D = fp64-to-fp32 S), narrows to lower half of D, upper half is 0
+ * narrowing rounds as set in fp control register (in FCTRL blocks)
+ * _ld/_st access the lower half only */
+
+#define cvyis_rr(XD, XS)                                                    \
+        EMITW(0x7B33001E | MXM(REG(XD), REG(XS), 0x00))
+
+#define cvyis_ld(XD, MS, DS)                                                \
+        AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), A1(DS), EMPTY2)   \
+        EMITW(0xD4000000 | MDM(TmmM,    MOD(MS), VAL(DS), B3(DS), P1(DS)))  \
+    SDF(EMITW(0x7AB10002 | MXM(TmmM,    TmmM,    0x00)))                    \
+        EMITW(0x7B33001E | MXM(REG(XD), TmmM,    0x00))
+
+#define cvuis_rr(XD, XS)                                                    \
+        EMITW(0x7B31001E | MXM(REG(XD), REG(XS), 0x00))
+
+#define cvxjs_rr(XD, XS)                                                    \
+        EMITW(0x7A20001B | MXM(REG(XD), TmmZ,    REG(XS)))
+
+#define cvxjs_st(XS, MD, DD)                                                \
+        EMITW(0x7A20001B | MXM(TmmM,    TmmZ,    REG(XS)))                  \
+    SDF(EMITW(0x7AB10002 | MXM(TmmM,    TmmM,    0x00)))                    \
+        AUW(SIB(MD),  EMPTY,  EMPTY,    MOD(MD), VAL(DD), A1(DD), EMPTY2)   \
+        EMITW(0xF4000000 | MDM(TmmM,    MOD(MD), VAL(DD), B3(DD), P1(DD)))
+
 /************   packed double-precision integer arithmetic/shifts   ***********/
 
 /* add (G = G + S), (D = S + T) if (#D != #T) */
@@ -778,6 +933,30 @@
         EMITW(0x78000023 | MPM(TmmM,    MOD(MT), VAL(DT), B4(DT), P2(DT)))  \
         EMITW(0x78600012 | MXM(REG(XD), REG(XS), TmmM))
 
+/* muw (G = G * S), multiplies lower 32-bit halves of 64-bit elements into
+ * full 64-bit products, unsigned-[x] or signed-[n], upper halves are ignored
+ * mul-high of 64-bit elements has no native form and uses BASE in rtconf.h */
+
+#define muwjx_rr(XG, XS)                                                    \
+        EMITW(0x7B400014 | MXM(TmmM,    TmmZ,    REG(XS)))                  \
+        EMITW(0x78E00013 | MXM(REG(XG), REG(XG), TmmM))
+
+#define muwjx_ld(XG, MS, DS)                                                \
+        AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), A2(DS), EMPTY2)   \
+        EMITW(0x78000023 | MPM(TmmM,    MOD(MS), VAL(DS), B4(DS), P2(DS)))  \
+        EMITW(0x7B400014 | MXM(TmmM,    TmmZ,    TmmM))                     \
+        EMITW(0x78E00013 | MXM(REG(XG), REG(XG), TmmM))
+
+#define muwjn_rr(XG, XS)                                                    \
+        EMITW(0x7B400014 | MXM(TmmM,    TmmZ,    REG(XS)))                  \
+        EMITW(0x78600013 | MXM(REG(XG), REG(XG), TmmM))
+
+#define muwjn_ld(XG, MS, DS)                                                \
+        AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), A2(DS), EMPTY2)   \
+        EMITW(0x78000023 | MPM(TmmM,    MOD(MS), VAL(DS), B4(DS), P2(DS)))  \
+        EMITW(0x7B400014 | MXM(TmmM,    TmmZ,    TmmM))                     \
+        EMITW(0x78600013 | MXM(REG(XG), REG(XG), TmmM))
+
 /* shl (G = G << S), (D = S << T) if (#D != #T) - plain, unsigned
  * for maximum compatibility: shift count must be modulo elem-size */
 
@@ -886,6 +1065,76 @@
         EMITW(0x78000023 | MPM(TmmM,    MOD(MT), VAL(DT), B4(DT), P2(DT)))  \
         EMITW(0x78E0000D | MXM(REG(XD), REG(XS), TmmM))
 
+/* cnt (D = number of bits set in each element of S), population count */
+
+#define cntjx_rr(XD, XS)                                                    \
+        EMITW(0x7B07001E | MXM(REG(XD), REG(XS), 0x00))
+
+#define cntjx_ld(XD, MS, DS)                                                \
+        AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), A2(DS), EMPTY2)   \
+        EMITW(0x78000023 | MPM(TmmM,    MOD(MS), VAL(DS), B4(DS), P2(DS)))  \
+        EMITW(0x7B07001E | MXM(REG(XD), TmmM,    0x00))
+
+/* clz (D = number of leading zeroes in each element of S), 64 if 0 */
+
+#define clzjx_rr(XD, XS)                                                    \
+        EMITW(0x7B0F001E | MXM(REG(XD), REG(XS), 0x00))
+
+#define clzjx_ld(XD, MS, DS)                                                \
+        AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), A2(DS), EMPTY2)   \
+        EMITW(0x78000023 | MPM(TmmM,    MOD(MS), VAL(DS), B4(DS), P2(DS)))  \
+        EMITW(0x7B0F001E | MXM(REG(XD), TmmM,    0x00))
+
+/* ctz (D = number of trailing zeroes in each element of S), 64 if 0 */
+
+#define ctzjx_rr(XD, XS)                                                    \
+        EMITW(0x78E10006 | MXM(TmmM,    REG(XS), 0x00))                     \
+        EMITW(0x7840001E | MXM(REG(XD), REG(XS), REG(XS)))                  \
+        EMITW(0x7800001E | MXM(REG(XD), REG(XD), TmmM))                     \
+        EMITW(0x7B07001E | MXM(REG(XD), REG(XD), 0x00))
+
+#define ctzjx_ld(XD, MS, DS)                                                \
+        movjx_ld(W(XD), W(MS), W(DS))                                       \
+        ctzjx_rr(W(XD), W(XD))
+
+/* bsw (D = S with the order of bytes reversed in each element) */
+
+#define bswjx_rr(XD, XS)                                                    \
+        EMITW(0x781B0002 | MXM(REG(XD), REG(XS), 0x00))                     \
+        EMITW(0x7AB10002 | MXM(REG(XD), REG(XD), 0x00))
+
+#define bswjx_ld(XD, MS, DS)                                                \
+        movjx_ld(W(XD), W(MS), W(DS))                                       \
+        bswjx_rr(W(XD), W(XD))
+
+/* cvy (D = S), zero-[x] or sign-[n] extends lower half of 32-bit elements
+ * cvu (D = S), zero-[x] or sign-[n] extends upper half of 32-bit elements
+ * cvx (D = S), narrows signed 64-bit elements to lower half of D, upper is 0
+ * with unsigned-[x] or signed-[n] saturation into 32-bit elements */
+
+#define cvyix_rr(XD, XS)                                                    \
+        EMITW(0x7AC00014 | MXM(REG(XD), TmmZ,    REG(XS)))
+
+#define cvyin_rr(XD, XS)                                                    \
+        EMITW(0x78DF0009 | MXM(TmmM,    REG(XS), 0x00))                     \
+        EMITW(0x7AC00014 | MXM(REG(XD), TmmM,    REG(XS)))
+
+#define cvuix_rr(XD, XS)                                                    \
+        EMITW(0x7A400014 | MXM(REG(XD), TmmZ,    REG(XS)))
+
+#define cvuin_rr(XD, XS)                                                    \
+        EMITW(0x78DF0009 | MXM(TmmM,    REG(XS), 0x00))                     \
+        EMITW(0x7A400014 | MXM(REG(XD), TmmM,    REG(XS)))
+
+#define cvxjx_rr(XD, XS)                                                    \
+        EMITW(0x7960000E | MXM(TmmM,    REG(XS), TmmZ))                     \
+        EMITW(0x789F000A | MXM(TmmM,    TmmM,    0x00))                     \
+        EMITW(0x79400014 | MXM(REG(XD), TmmZ,    TmmM))
+
+#define cvxjn_rr(XD, XS)                                                    \
+        EMITW(0x781F000A | MXM(TmmM,    REG(XS), 0x00))                     \
+        EMITW(0x79400014 | MXM(REG(XD), TmmZ,    TmmM))
+
 /****************   packed double-precision integer compare   *****************/
 
 /* min (G = G < S ? G : S), (D = S < T ? S : T) if (#D != #T), unsigned */
@@ -179,6 +179,15 @@
         EMITW(0x7880001E | MXM(TmmM,    RYG(XS), Tmm0+16))                  \
         EMITW(0x78000027 | MPM(TmmM,    MOD(MG), VYL(DG), B4(DG), L2(DG)))
 
+/* hrd (D = S op S op ..) reduce all elements of S with "op" into each of D
+ * combining halves first, then in log2 steps via in-register permutes */
+
+#define hrdds_rx(XD, XS, op) /* not portable, do not use outside */         \
+        EMITW(op | MXM(TmmM,    REG(XS), RYG(XS)))                          \
+        EMITW(0x7A4E0002 | MXM(REG(XD), TmmM,    0x00))                     \
+        EMITW(op | MXM(REG(XD), REG(XD), TmmM))                             \
+        EMITW(0x78BE0019 | MXM(RYG(XD), REG(XD), 0x00))
+
 /* and (G = G & S), (D = S & T) if (#D != #T) */
 
 #define anddx_rr(XG, XS)                                                    \
@@ -320,6 +329,10 @@
         /* adp, adh are defined in rtbase.h (first 15-regs only)
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  adhds_rr
+#define adhds_rr(XD, XS) /* horizontal reductive add, first 15-regs only */ \
+        hrdds_rx(W(XD), W(XS), 0x7820001B)
+
 /* sub (G = G - S), (D = S - T) if (#D != #T) */
 
 #define subds_rr(XG, XS)                                                    \
@@ -361,6 +374,10 @@
         /* mlp, mlh are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  mlhds_rr
+#define mlhds_rr(XD, XS) /* horizontal reductive mul */                     \
+        hrdds_rx(W(XD), W(XS), 0x78A0001B)
+
 /* div (G = G / S), (D = S / T) if (#D != #T) and on ARMv7 if (#D != #S) */
 
 #define divds_rr(XG, XS)                                                    \
@@ -492,6 +509,10 @@
         /* mnp, mnh are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  mnhds_rr
+#define mnhds_rr(XD, XS) /* horizontal reductive min */                     \
+        hrdds_rx(W(XD), W(XS), 0x7B20001B)
+
 /* max (G = G > S ? G : S), (D = S > T ? S : T) if (#D != #T) */
 
 #define maxds_rr(XG, XS)                                                    \
@@ -514,6 +535,10 @@
         /* mxp, mxh are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  mxhds_rr
+#define mxhds_rr(XD, XS) /* horizontal reductive max */                     \
+        hrdds_rx(W(XD), W(XS), 0x7BA0001B)
+
 /* ceq (G = G == S ? -1 : 0), (D = S == T ? -1 : 0) if (#D != #T) */
 
 #define ceqds_rr(XG, XS)                                                    \
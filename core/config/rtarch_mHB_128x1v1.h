@@ -363,6 +363,16 @@
         EMITW(0x78000023 | MPM(TmmM,    MOD(MT), VAL(DT), B4(DT), P2(DT)))  \
         EMITW(0x78200012 | MXM(REG(XD), REG(XS), TmmM))
 
+/* dph (G = G + S * T) if (#G != #S && #G != #T), 16-bit pairs into 32-bit */
+
+#define dphix_rr(XG, XS, XT)                                                \
+        EMITW(0x79400013 | MXM(REG(XG), REG(XS), REG(XT)))
+
+#define dphix_ld(XG, XS, MT, DT)                                            \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A2(DT), EMPTY2)   \
+        EMITW(0x78000023 | MPM(TmmM,    MOD(MT), VAL(DT), B4(DT), P2(DT)))  \
+        EMITW(0x79400013 | MXM(REG(XG), REG(XS), TmmM))
+
 /* shl (G = G << S), (D = S << T) if (#D != #T) - plain, unsigned
  * for maximum compatibility: shift count must be modulo elem-size */
 
@@ -471,6 +481,15 @@
         EMITW(0x78000023 | MPM(TmmM,    MOD(MT), VAL(DT), B4(DT), P2(DT)))  \
         EMITW(0x78A0000D | MXM(REG(XD), REG(XS), TmmM))
 
+/* bsw (D = S with the order of bytes reversed in each element) */
+
+#define bswgx_rr(XD, XS)                                                    \
+        EMITW(0x78B10002 | MXM(REG(XD), REG(XS), 0x00))
+
+#define bswgx_ld(XD, MS, DS)                                                \
+        movgx_ld(W(XD), W(MS), W(DS))                                       \
+        bswgx_rr(W(XD), W(XD))
+
 /*****************   packed half-precision integer compare   ******************/
 
 /* min (G = G < S ? G : S), (D = S < T ? S : T) if (#D != #T), unsigned */
@@ -734,6 +753,30 @@
         EMITW(0x7880001E | MXM(TmmM,    REG(XS), Tmm0))                     \
         EMITW(0x78000027 | MPM(TmmM,    MOD(MG), VAL(DG), B4(DG), P2(DG)))
 
+/* tbl (G = G[S]), (D = S[T]) if (#D != #T) look up bytes within 128-bit lanes
+ * indices 0-15 pick bytes in the same lane, 0x80-0xFF produce zero bytes */
+
+#define tblgb_rr(XG, XS)                                                    \
+        tblgb3rr(W(XG), W(XG), W(XS))
+
+#define tblgb_ld(XG, MS, DS)                                                \
+        tblgb3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define tblgb3rr(XD, XS, XT)                                                \
+        EMITW(0x78000000 | MXM(TmmM,    REG(XT), 0x00) | 0x8F << 16)        \
+        tblgb_rx(REG(XD), REG(XS))
+
+#define tblgb3ld(XD, XS, MT, DT)                                            \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A2(DT), EMPTY2)   \
+        EMITW(0x78000023 | MPM(TmmM,    MOD(MT), VAL(DT), B4(DT), P2(DT)))  \
+        EMITW(0x78000000 | MXM(TmmM,    TmmM,    0x00) | 0x8F << 16)        \
+        tblgb_rx(REG(XD), REG(XS))
+
+#define tblgb_rx(XD, XS) /* not portable, do not use outside */             \
+        EMITW(0x7B000000 | MXM(TmmM,    TmmM,    0x00) | RT_ENDIAN*7 << 16) \
+        EMITW(0x78000015 | MXM(TmmM,    (XS),    (XS)))                     \
+        EMITW(0x78BE0019 | MXM((XD),    TmmM,    0x00))
+
 /* move/logic instructions are sizeless and provided in 16-bit subset above */
 
 /*************   packed byte-precision integer arithmetic/shifts   ************/
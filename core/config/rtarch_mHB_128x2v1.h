@@ -842,6 +842,35 @@
         EMITW(0x7880001E | MXM(TmmM,    RYG(XS), Tmm0+16))                  \
         EMITW(0x78000027 | MPM(TmmM,    MOD(MG), VYL(DG), B4(DG), L2(DG)))
 
+/* tbl (G = G[S]), (D = S[T]) if (#D != #T) look up bytes within 128-bit lanes
+ * indices 0-15 pick bytes in the same lane, 0x80-0xFF produce zero bytes */
+
+#define tblab_rr(XG, XS)                                                    \
+        tblab3rr(W(XG), W(XG), W(XS))
+
+#define tblab_ld(XG, MS, DS)                                                \
+        tblab3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define tblab3rr(XD, XS, XT)                                                \
+        EMITW(0x78000000 | MXM(TmmM,    REG(XT), 0x00) | 0x8F << 16)        \
+        tblab_rx(REG(XD), REG(XS))                                          \
+        EMITW(0x78000000 | MXM(TmmM,    RYG(XT), 0x00) | 0x8F << 16)        \
+        tblab_rx(RYG(XD), RYG(XS))
+
+#define tblab3ld(XD, XS, MT, DT)                                            \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A2(DT), EMPTY2)   \
+        EMITW(0x78000023 | MPM(TmmM,    MOD(MT), VAL(DT), B4(DT), L2(DT)))  \
+        EMITW(0x78000000 | MXM(TmmM,    TmmM,    0x00) | 0x8F << 16)        \
+        tblab_rx(REG(XD), REG(XS))                                          \
+        EMITW(0x78000023 | MPM(TmmM,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
+        EMITW(0x78000000 | MXM(TmmM,    TmmM,    0x00) | 0x8F << 16)        \
+        tblab_rx(RYG(XD), RYG(XS))
+
+#define tblab_rx(XD, XS) /* not portable, do not use outside */             \
+        EMITW(0x7B000000 | MXM(TmmM,    TmmM,    0x00) | RT_ENDIAN*7 << 16) \
+        EMITW(0x78000015 | MXM(TmmM,    (XS),    (XS)))                     \
+        EMITW(0x78BE0019 | MXM((XD),    TmmM,    0x00))
+
 /* move/logic instructions are sizeless and provided in 16-bit subset above */
 
 /*************   packed byte-precision integer arithmetic/shifts   ************/
@@ -2068,6 +2068,77 @@
 
 #endif /* RT_BASE_COMPAT_REM != 0 */
 
+/* cnt (D = number of bits set in S), population count
+ * clz (D = number of leading zeroes in S), 32 if S is 0
+ * ctz (D = number of trailing zeroes in S), 32 if S is 0
+ * set-flags: undefined */
+
+#if RT_BASE_COMPAT_REM < 9 /* 0-8 - generic, 9 - POWER9 (ISA 3.0) */
+
+#define cntwx_rr(RD, RS)                                                    \
+        EMITW(0x5400007E | MSM(TMxx,    REG(RS), 0x1F))                     \
+        G32(TIxx, 0x55555555)                                               \
+        EMITW(0x7C000038 | MSM(TMxx,    TMxx,    TIxx))                     \
+        EMITW(0x7C000050 | MRM(REG(RD), REG(RS), TMxx))                     \
+        G32(TIxx, 0x33333333)                                               \
+        EMITW(0x540000BE | MSM(TMxx,    REG(RD), 0x1E))                     \
+        EMITW(0x7C000038 | MSM(TMxx,    TMxx,    TIxx))                     \
+        EMITW(0x7C000038 | MSM(REG(RD), REG(RD), TIxx))                     \
+        EMITW(0x7C000214 | MRM(REG(RD), REG(RD), TMxx))                     \
+        EMITW(0x5400013E | MSM(TMxx,    REG(RD), 0x1C))                     \
+        EMITW(0x7C000214 | MRM(REG(RD), REG(RD), TMxx))                     \
+        G32(TIxx, 0x0F0F0F0F)                                               \
+        EMITW(0x7C000038 | MSM(REG(RD), REG(RD), TIxx))                     \
+        EMITW(0x5400023E | MSM(TMxx,    REG(RD), 0x18))                     \
+        EMITW(0x7C000214 | MRM(REG(RD), REG(RD), TMxx))                     \
+        EMITW(0x5400043E | MSM(TMxx,    REG(RD), 0x10))                     \
+        EMITW(0x7C000214 | MRM(REG(RD), REG(RD), TMxx))                     \
+        EMITW(0x540006BE | MSM(REG(RD), REG(RD), 0x00))
+
+#define ctzwx_rr(RD, RS)   /* ctz(S) = 32 - clz(~S & (S - 1)) */            \
+        EMITW(0x3800FFFF | MTM(TMxx,    REG(RS), 0x00))                     \
+        EMITW(0x7C000078 | MSM(TMxx,    TMxx,    REG(RS)))                  \
+        EMITW(0x7C000034 | MSM(REG(RD), TMxx,    0x00))                     \
+        EMITW(0x20000020 | MTM(REG(RD), REG(RD), 0x00))
+
+#else /* RT_BASE_COMPAT_REM >= 9 */
+
+#define cntwx_rr(RD, RS)                                                    \
+        EMITW(0x7C0002F4 | MSM(REG(RD), REG(RS), 0x00))
+
+#define ctzwx_rr(RD, RS)                                                    \
+        EMITW(0x7C000434 | MSM(REG(RD), REG(RS), 0x00))
+
+#endif /* RT_BASE_COMPAT_REM >= 9 */
+
+#define cntwx_ld(RD, MS, DS)                                                \
+        movwx_ld(W(RD), W(MS), W(DS))                                       \
+        cntwx_rr(W(RD), W(RD))
+
+#define clzwx_rr(RD, RS)                                                    \
+        EMITW(0x7C000034 | MSM(REG(RD), REG(RS), 0x00))
+
+#define clzwx_ld(RD, MS, DS)                                                \
+        movwx_ld(W(RD), W(MS), W(DS))                                       \
+        clzwx_rr(W(RD), W(RD))
+
+#define ctzwx_ld(RD, MS, DS)                                                \
+        movwx_ld(W(RD), W(MS), W(DS))                                       \
+        ctzwx_rr(W(RD), W(RD))
+
+/* bsw (D = S with the order of bytes reversed), byte-swap
+ * set-flags: no */
+
+#define bswwx_rr(RD, RS)                                                    \
+        EMITW(0x5400003E | MSM(TMxx,    REG(RS), 0x08))                     \
+        EMITW(0x5000000E | MSM(TMxx,    REG(RS), 0x18))                     \
+        EMITW(0x5000042E | MSM(TMxx,    REG(RS), 0x18))                     \
+        EMITW(0x7C000378 | MSM(REG(RD), TMxx,    TMxx))
+
+#define bswwx_ld(RD, MS, DS)                                                \
+        movwx_ld(W(RD), W(MS), W(DS))                                       \
+        bswwx_rr(W(RD), W(RD))
+
 /* arj (G = G op S, if cc G then jump lb)
  * set-flags: undefined
  * refer to individual instruction descriptions
@@ -2298,6 +2369,48 @@
         AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C3(DS), EMPTY2)   \
         EMITW(0x7C000214 | MRM(REG(RD), MOD(MS), TDxx))
 
+/* pf0, pf1, pf2, pfn (prefetch [S] into cache, T0/T1/T2-hints, NTA-hint)
+ * T0 - all cache levels, T1 - L2 and up, T2 - L3 and up (if available),
+ * NTA - non-temporal (streaming), hints are advisory, never fault on [S]
+ * set-flags: no */
+
+#define pf0xx_ld(MS, DS)                                                    \
+        AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C3(DS), EMPTY2)   \
+        EMITW(0x7C00022C | MRM(0x00,    MOD(MS), TDxx))
+
+#define pf1xx_ld(MS, DS)                                                    \
+        AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C3(DS), EMPTY2)   \
+        EMITW(0x7C00022C | MRM(0x00,    MOD(MS), TDxx))
+
+#define pf2xx_ld(MS, DS)                                                    \
+        AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C3(DS), EMPTY2)   \
+        EMITW(0x7C00022C | MRM(0x00,    MOD(MS), TDxx))
+
+#define pfnxx_ld(MS, DS)                                                    \
+        AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C3(DS), EMPTY2)   \
+        EMITW(0x7C00022C | MRM(0x10,    MOD(MS), TDxx))
+
+/* sfn (fence for stores), orders all prior stores before any later stores
+ * place after non-temporal stores (stn) before [D] is read by other threads
+ * set-flags: no */
+
+#define sfnce_xx()                                                          \
+        EMITW(0x7C2004AC)
+
+/* zcl (zero 128-byte block at [D]), [D] must be aligned to 128 bytes
+ * four dcbz 32 bytes apart (no read-for-ownership), fit 32/128-byte lines
+ * set-flags: no */
+
+#define zclxx_st(MD, DD)                                                    \
+        AUW(SIB(MD),  EMPTY,  EMPTY,    MOD(MD), VAL(DD), C3(DD), EMPTY2)   \
+        EMITW(0x7C0007EC | MRM(0x00,    MOD(MD), TDxx))                     \
+        EMITW(0x38000020 | MTM(TDxx,    TDxx,    0x00))                     \
+        EMITW(0x7C0007EC | MRM(0x00,    MOD(MD), TDxx))                     \
+        EMITW(0x38000020 | MTM(TDxx,    TDxx,    0x00))                     \
+        EMITW(0x7C0007EC | MRM(0x00,    MOD(MD), TDxx))                     \
+        EMITW(0x38000020 | MTM(TDxx,    TDxx,    0x00))                     \
+        EMITW(0x7C0007EC | MRM(0x00,    MOD(MD), TDxx))
+
 /************************* pointer-sized instructions *************************/
 
 /* label (D = Reax = adr lb)
@@ -262,6 +262,18 @@
         EMITW(0x38000000 | MPM(TPxx,    REG(MD), VAL(DD), B2(DD), P2(DD)))  \
         EMITW(0x7C000719 | MXM(REG(XS), Teax & M(MOD(MD) == TPxx), TPxx))
 
+/* bcs (D = [M]) broadcast scalar element from memory into all SIMD elements */
+
+#if (RT_SIMD_COMPAT_PW8 == 1)
+
+#define bcsix_ld(XD, MS, DS)                                                \
+        AUW(EMPTY,    EMPTY,  EMPTY,    MOD(MS), VAL(DS), C2(DS), EMPTY2)   \
+        EMITW(0x38000000 | MPM(TPxx,    REG(MS), VAL(DS), B2(DS), P2(DS)))  \
+        EMITW(0x7C000019 | MXM(REG(XD), Teax & M(MOD(MS) == TPxx), TPxx))   \
+        EMITW(0xF0000293 | MXM(REG(XD), 0x01,    REG(XD)))
+
+#endif /* RT_SIMD_COMPAT_PW8 == 1 */
+
 /* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
  * uses Xmm0 implicitly as a mask register, destroys Xmm0, 0-masked XS elems */
 
@@ -281,6 +293,117 @@
         EMITW(0xF000003F | MXM(TmmM,    TmmM,    REG(XS)))                  \
         EMITW(0x7C000719 | MXM(TmmM,    Teax & M(MOD(MG) == TPxx), TPxx))
 
+/* hrd (D = S op S op ..) reduce all elements of S with "op" into each of D
+ * in log2 steps via in-register permutes, TmmM is used as a temporary */
+
+#define hrdis_rx(XD, XS, op) /* not portable, do not use outside */         \
+        EMITW(0xF0000217 | MXM(TmmM,    REG(XS), REG(XS)))                  \
+        EMITW(op | MXM(REG(XD), REG(XS), TmmM))                             \
+        EMITW(0xF0000117 | MXM(TmmM,    REG(XD), REG(XD)))                  \
+        EMITW(op | MXM(REG(XD), REG(XD), TmmM))
+
+/* tbl (G = G[S]), (D = S[T]) permute elements across the SIMD register
+ * indices are in elements, taken modulo the number of elements in SIMD */
+
+#define tblix_rr(XG, XS)                                                    \
+        tblix3rr(W(XG), W(XG), W(XS))
+
+#define tblix3rr(XD, XS, XT)                                                \
+        EMITW(0x7C00000C | MXM(TmmQ,    0x00,    TZxx))                     \
+        EMITW(0x1000038C | MXM(TmmM,    0x1A,    0x00))                     \
+        EMITW(0x10000284 | MXM(TmmQ,    TmmQ,    TmmM))                     \
+        EMITW(0x10000480 | MXM(TmmM,    REG(XT), TmmQ))                     \
+        EMITW(0x1000038C | MXM(TmmQ,    0x1E,    0x00))                     \
+        EMITW(0x10000184 | MXM(TmmM,    TmmM,    TmmQ))                     \
+        EMITW(0x100003EC | MXM(TmmQ,    TmmM,    TmmM))                     \
+        EMITW(0x10000484 | MXM(TmmM,    TmmM,    TmmQ))                     \
+        EMITW(0x100003AC | MXM(TmmQ,    TmmM,    TmmM))                     \
+        EMITW(0x10000484 | MXM(TmmM,    TmmM,    TmmQ))                     \
+        EMITW(0x1000030C | MXM(TmmQ,    0x04,    0x00))                     \
+        EMITW(0x10000204 | MXM(TmmM,    TmmM,    TmmQ))                     \
+        EMITW(0x7C00000C | MXM(TmmQ,    0x00,    TZxx))                     \
+        EMITW(0x10000000 | MXM(TmmM,    TmmM,    TmmQ))                     \
+        EMITW(0x1000002B | MXM(REG(XD), REG(XS), REG(XS)) | TmmM << 6)
+
+/* aln (G = [S:G] >> IT) concatenate S and G, shift right by IT elements
+ * keeping the lower half, bc0 (D = S[0]) broadcast element 0 (not portable) */
+
+#define alnix_ri(XG, XS, IT) /* not portable, do not use outside */         \
+        EMITW(0x1000002C | MXM(REG(XG), REG(XG), REG(XS)) |                 \
+                           (0x03 & VAL(IT)) << 8)
+
+#define bc0ix_rr(XD, XS) /* not portable, do not use outside */             \
+        EMITW(0x1000028C | MXM(REG(XD), 0x00,    REG(XS)))
+
+/* scn (D[i] = S[0] op .. op S[i]) inclusive scan of S with "op" in log2
+ * steps, scz shifts in zeroes (add), scs repeats S[0] (min/max, idempotent),
+ * sce shifts D up by one element (exclusive scan), Xmm0 is used as a temp */
+
+#define sczix_rx(XD, XS, op) /* not portable, do not use outside */         \
+        xorix_rr(Xmm0, Xmm0)                                                \
+        alnix_ri(Xmm0, W(XS), IB(3))                                        \
+        op(Xmm0, W(XS))                                                     \
+        xorix_rr(W(XD), W(XD))                                              \
+        alnix_ri(W(XD), Xmm0, IB(2))                                        \
+        op(W(XD), Xmm0)
+
+#define scsix_rx(XD, XS, op) /* not portable, do not use outside */         \
+        bc0ix_rr(Xmm0, W(XS))                                               \
+        alnix_ri(Xmm0, W(XS), IB(3))                                        \
+        op(Xmm0, W(XS))                                                     \
+        bc0ix_rr(W(XD), Xmm0)                                               \
+        alnix_ri(W(XD), Xmm0, IB(2))                                        \
+        op(W(XD), Xmm0)
+
+#define sceix_rx(XD) /* not portable, do not use outside */                 \
+        xorix_rr(Xmm0, Xmm0)                                                \
+        alnix_ri(Xmm0, W(XD), IB(3))                                        \
+        movix_rr(W(XD), Xmm0)
+
+/* adi (D[i] = S[0] + .. + S[i]) inclusive prefix sum of elements of S
+ * uses Xmm0 implicitly as a temp register, destroys Xmm0, XD/XS != Xmm0 */
+
+#define adiis_rr(XD, XS)                                                    \
+        sczix_rx(W(XD), W(XS), addis_rr)
+
+#define adiix_rr(XD, XS)                                                    \
+        sczix_rx(W(XD), W(XS), addix_rr)
+
+/* ade (D[i] = S[0] + .. + S[i-1]) exclusive prefix sum of S, D[0] = 0
+ * uses Xmm0 implicitly as a temp register, destroys Xmm0, XD/XS != Xmm0 */
+
+#define adeis_rr(XD, XS)                                                    \
+        sczix_rx(W(XD), W(XS), addis_rr)                                    \
+        sceix_rx(W(XD))
+
+#define adeix_rr(XD, XS)                                                    \
+        sczix_rx(W(XD), W(XS), addix_rr)                                    \
+        sceix_rx(W(XD))
+
+/* mni (D[i] = min(S[0], .. , S[i])) inclusive prefix min of elements of S
+ * uses Xmm0 implicitly as a temp register, destroys Xmm0, XD/XS != Xmm0 */
+
+#define mniis_rr(XD, XS)                                                    \
+        scsix_rx(W(XD), W(XS), minis_rr)
+
+#define mniix_rr(XD, XS)                                                    \
+        scsix_rx(W(XD), W(XS), minix_rr)
+
+#define mniin_rr(XD, XS)                                                    \
+        scsix_rx(W(XD), W(XS), minin_rr)
+
+/* mxi (D[i] = max(S[0], .. , S[i])) inclusive prefix max of elements of S
+ * uses Xmm0 implicitly as a temp register, destroys Xmm0, XD/XS != Xmm0 */
+
+#define mxiis_rr(XD, XS)                                                    \
+        scsix_rx(W(XD), W(XS), maxis_rr)
+
+#define mxiix_rr(XD, XS)                                                    \
+        scsix_rx(W(XD), W(XS), maxix_rr)
+
+#define mxiin_rr(XD, XS)                                                    \
+        scsix_rx(W(XD), W(XS), maxin_rr)
+
 /* and (G = G & S), (D = S & T) if (#D != #T) */
 
 #define andix_rr(XG, XS)                                                    \
@@ -426,6 +549,10 @@
         /* adp, adh are defined in rtbase.h (first 15-regs only)
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  adhis_rr
+#define adhis_rr(XD, XS) /* horizontal reductive add, first 15-regs only */ \
+        hrdis_rx(W(XD), W(XS), 0xF0000207)
+
 /* sub (G = G - S), (D = S - T) if (#D != #T) */
 
 #define subis_rr(XG, XS)                                                    \
@@ -463,6 +590,10 @@
         /* mlp, mlh are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  mlhis_rr
+#define mlhis_rr(XD, XS) /* horizontal reductive mul */                     \
+        hrdis_rx(W(XD), W(XS), 0xF0000287)
+
 /* div (G = G / S), (D = S / T) if (#D != #T) and on ARMv7 if (#D != #S) */
 
 #define divis_rr(XG, XS)                                                    \
@@ -588,6 +719,10 @@
         /* mnp, mnh are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  mnhis_rr
+#define mnhis_rr(XD, XS) /* horizontal reductive min */                     \
+        hrdis_rx(W(XD), W(XS), 0xF0000647)
+
 /* max (G = G > S ? G : S), (D = S > T ? S : T) if (#D != #T) */
 
 #define maxis_rr(XG, XS)                                                    \
@@ -608,6 +743,10 @@
         /* mxp, mxh are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  mxhis_rr
+#define mxhis_rr(XD, XS) /* horizontal reductive max */                     \
+        hrdis_rx(W(XD), W(XS), 0xF0000607)
+
 /* ceq (G = G == S ? -1 : 0), (D = S == T ? -1 : 0) if (#D != #T) */
 
 #define ceqis_rr(XG, XS)                                                    \
@@ -985,6 +1124,37 @@
         EMITW(0x7C000619 | MXM(TmmM,    Teax & M(MOD(MT) == TPxx), TPxx))   \
         EMITW(0x10000089 | MXM(REG(XD), REG(XS), TmmM))
 
+/* muh (G = G * S), keeps upper half of the full-width product of elements
+ * unsigned-[x] or signed-[n], lower half is returned by mul
+ * even and odd elements are multiplied into 64-bit products with vmule/vmulo,
+ * then vmrgew gathers their upper halves back into 32-bit elements */
+
+#define muhix_rr(XG, XS)                                                    \
+        EMITW(0x10000288 | MXM(TmmM,    REG(XG), REG(XS)))                  \
+        EMITW(0x10000088 | MXM(REG(XG), REG(XG), REG(XS)))                  \
+        EMITW(0x1000078C | MXM(REG(XG), TmmM,    REG(XG)))
+
+#define muhix_ld(XG, MS, DS)                                                \
+        AUW(EMPTY,    EMPTY,  EMPTY,    MOD(MS), VAL(DS), C2(DS), EMPTY2)   \
+        EMITW(0x38000000 | MPM(TPxx,    REG(MS), VAL(DS), B2(DS), P2(DS)))  \
+        EMITW(0x7C000619 | MXM(TmmM,    Teax & M(MOD(MS) == TPxx), TPxx))   \
+        EMITW(0x10000288 | MXM(TmmQ,    REG(XG), TmmM))                     \
+        EMITW(0x10000088 | MXM(REG(XG), REG(XG), TmmM))                     \
+        EMITW(0x1000078C | MXM(REG(XG), TmmQ,    REG(XG)))
+
+#define muhin_rr(XG, XS)                                                    \
+        EMITW(0x10000388 | MXM(TmmM,    REG(XG), REG(XS)))                  \
+        EMITW(0x10000188 | MXM(REG(XG), REG(XG), REG(XS)))                  \
+        EMITW(0x1000078C | MXM(REG(XG), TmmM,    REG(XG)))
+
+#define muhin_ld(XG, MS, DS)                                                \
+        AUW(EMPTY,    EMPTY,  EMPTY,    MOD(MS), VAL(DS), C2(DS), EMPTY2)   \
+        EMITW(0x38000000 | MPM(TPxx,    REG(MS), VAL(DS), B2(DS), P2(DS)))  \
+        EMITW(0x7C000619 | MXM(TmmM,    Teax & M(MOD(MS) == TPxx), TPxx))   \
+        EMITW(0x10000388 | MXM(TmmQ,    REG(XG), TmmM))                     \
+        EMITW(0x10000188 | MXM(REG(XG), REG(XG), TmmM))                     \
+        EMITW(0x1000078C | MXM(REG(XG), TmmQ,    REG(XG)))
+
 #endif /* RT_SIMD_COMPAT_PW8 == 1 */
 
 /* shl (G = G << S), (D = S << T) if (#D != #T) - plain, unsigned
@@ -1101,6 +1271,50 @@
         EMITW(0x7C000619 | MXM(TmmM,    Teax & M(MOD(MT) == TPxx), TPxx))   \
         EMITW(0x10000384 | MXM(REG(XD), REG(XS), TmmM))
 
+#if (RT_SIMD_COMPAT_PW8 == 1)
+
+/* cnt (D = number of bits set in each element of S), population count */
+
+#define cntix_rr(XD, XS)                                                    \
+        EMITW(0x10000783 | MXM(REG(XD), 0x00,    REG(XS)))
+
+#define cntix_ld(XD, MS, DS)                                                \
+        AUW(EMPTY,    EMPTY,  EMPTY,    MOD(MS), VAL(DS), C2(DS), EMPTY2)   \
+        EMITW(0x38000000 | MPM(TPxx,    REG(MS), VAL(DS), B2(DS), P2(DS)))  \
+        EMITW(0x7C000619 | MXM(TmmM,    Teax & M(MOD(MS) == TPxx), TPxx))   \
+        EMITW(0x10000783 | MXM(REG(XD), 0x00,    TmmM))
+
+/* clz (D = number of leading zeroes in each element of S), 32 if 0 */
+
+#define clzix_rr(XD, XS)                                                    \
+        EMITW(0x10000782 | MXM(REG(XD), 0x00,    REG(XS)))
+
+#define clzix_ld(XD, MS, DS)                                                \
+        AUW(EMPTY,    EMPTY,  EMPTY,    MOD(MS), VAL(DS), C2(DS), EMPTY2)   \
+        EMITW(0x38000000 | MPM(TPxx,    REG(MS), VAL(DS), B2(DS), P2(DS)))  \
+        EMITW(0x7C000619 | MXM(TmmM,    Teax & M(MOD(MS) == TPxx), TPxx))   \
+        EMITW(0x10000782 | MXM(REG(XD), 0x00,    TmmM))
+
+/* ctz (D = number of trailing zeroes in each element of S), 32 if 0
+ * computed as cnt of (S - 1) & ~S, vctzw is only available on POWER9 */
+
+#define ctzix_rr(XD, XS)                                                    \
+        EMITW(0x101F038C | MXM(TmmQ,    0x00,    0x00))                     \
+        EMITW(0x10000080 | MXM(TmmM,    REG(XS), TmmQ))                     \
+        EMITW(0x10000444 | MXM(TmmM,    TmmM,    REG(XS)))                  \
+        EMITW(0x10000783 | MXM(REG(XD), 0x00,    TmmM))
+
+#define ctzix_ld(XD, MS, DS)                                                \
+        AUW(EMPTY,    EMPTY,  EMPTY,    MOD(MS), VAL(DS), C2(DS), EMPTY2)   \
+        EMITW(0x38000000 | MPM(TPxx,    REG(MS), VAL(DS), B2(DS), P2(DS)))  \
+        EMITW(0x7C000619 | MXM(TmmM,    Teax & M(MOD(MS) == TPxx), TPxx))   \
+        EMITW(0x101F038C | MXM(TmmQ,    0x00,    0x00))                     \
+        EMITW(0x10000080 | MXM(TmmQ,    TmmM,    TmmQ))                     \
+        EMITW(0x10000444 | MXM(TmmQ,    TmmQ,    TmmM))                     \
+        EMITW(0x10000783 | MXM(REG(XD), 0x00,    TmmQ))
+
+#endif /* RT_SIMD_COMPAT_PW8 == 1 */
+
 /****************   packed single-precision integer compare   *****************/
 
 /* min (G = G < S ? G : S), (D = S < T ? S : T) if (#D != #T), unsigned */
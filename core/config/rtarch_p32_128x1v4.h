@@ -271,6 +271,129 @@
         EMITW(0x1000002A | MXM(TmmM,    TmmM,    REG(XS)))                  \
         EMITW(0x7C0001CE | MXM(TmmM,    Teax & M(MOD(MG) == TPxx), TPxx))
 
+/* hrd (D = S op S op ..) reduce all elements of S with "op" into each of D
+ * in log2 steps via in-register permutes, TmmM is used as a temporary */
+
+#define hrdis_rx(XD, XS, op) /* not portable, do not use outside */         \
+        EMITW(0x1000022C | MXM(TmmM,    REG(XS), REG(XS)))                  \
+        EMITW(op | MXM(REG(XD), REG(XS), TmmM))                             \
+        EMITW(0x1000012C | MXM(TmmM,    REG(XD), REG(XD)))                  \
+        EMITW(op | MXM(REG(XD), REG(XD), TmmM))
+
+/* tbl (G = G[S]), (D = S[T]) permute elements across the SIMD register
+ * indices are in elements, taken modulo the number of elements in SIMD */
+
+#define tblix_rr(XG, XS)                                                    \
+        tblix3rr(W(XG), W(XG), W(XS))
+
+#define tblix3rr(XD, XS, XT)                                                \
+        EMITW(0x7C00000C | MXM(TmmQ,    0x00,    TZxx))                     \
+        EMITW(0x1000038C | MXM(TmmM,    0x1A,    0x00))                     \
+        EMITW(0x10000284 | MXM(TmmQ,    TmmQ,    TmmM))                     \
+        EMITW(0x1000038C | MXM(TmmM,    SPLT,    0x00))                     \
+        EMITW(0x100004C4 | MXM(TmmM,    TmmM,    REG(XT)))                  \
+        EMITW(0x10000480 | MXM(TmmM,    TmmM,    TmmQ))                     \
+        EMITW(0x1000038C | MXM(TmmQ,    0x1E,    0x00))                     \
+        EMITW(0x10000184 | MXM(TmmM,    TmmM,    TmmQ))                     \
+        EMITW(0x100003EC | MXM(TmmQ,    TmmM,    TmmM))                     \
+        EMITW(0x10000484 | MXM(TmmM,    TmmM,    TmmQ))                     \
+        EMITW(0x100003AC | MXM(TmmQ,    TmmM,    TmmM))                     \
+        EMITW(0x10000484 | MXM(TmmM,    TmmM,    TmmQ))                     \
+        EMITW(0x1000030C | MXM(TmmQ,    0x04,    0x00))                     \
+        EMITW(0x10000204 | MXM(TmmM,    TmmM,    TmmQ))                     \
+        EMITW(0x7C00000C | MXM(TmmQ,    0x00,    TZxx))                     \
+        EMITW(0x10000000 | MXM(TmmM,    TmmM,    TmmQ))                     \
+        EMITW(0x1000002B | MXM(REG(XD), REG(XS), REG(XS)) | TmmM << 6)
+
+/* aln (G = [S:G] >> IT) concatenate S and G, shift right by IT elements
+ * keeping the lower half, bc0 (D = S[0]) broadcast element 0 (not portable) */
+
+#if RT_ENDIAN == 0
+
+#define alnix_ri(XG, XS, IT) /* not portable, do not use outside */         \
+        EMITW(0x1000002C | MXM(REG(XG), REG(XS), REG(XG)) |                 \
+                           (0x03 &-VAL(IT)) << 8)
+
+#else /* RT_ENDIAN */
+
+#define alnix_ri(XG, XS, IT) /* not portable, do not use outside */         \
+        EMITW(0x1000002C | MXM(REG(XG), REG(XG), REG(XS)) |                 \
+                           (0x03 & VAL(IT)) << 8)
+
+#endif /* RT_ENDIAN */
+
+#define bc0ix_rr(XD, XS) /* not portable, do not use outside */             \
+        EMITW(0x1000028C | MXM(REG(XD), SPLT,    REG(XS)))
+
+/* scn (D[i] = S[0] op .. op S[i]) inclusive scan of S with "op" in log2
+ * steps, scz shifts in zeroes (add), scs repeats S[0] (min/max, idempotent),
+ * sce shifts D up by one element (exclusive scan), Xmm0 is used as a temp */
+
+#define sczix_rx(XD, XS, op) /* not portable, do not use outside */         \
+        xorix_rr(Xmm0, Xmm0)                                                \
+        alnix_ri(Xmm0, W(XS), IB(3))                                        \
+        op(Xmm0, W(XS))                                                     \
+        xorix_rr(W(XD), W(XD))                                              \
+        alnix_ri(W(XD), Xmm0, IB(2))                                        \
+        op(W(XD), Xmm0)
+
+#define scsix_rx(XD, XS, op) /* not portable, do not use outside */         \
+        bc0ix_rr(Xmm0, W(XS))                                               \
+        alnix_ri(Xmm0, W(XS), IB(3))                                        \
+        op(Xmm0, W(XS))                                                     \
+        bc0ix_rr(W(XD), Xmm0)                                               \
+        alnix_ri(W(XD), Xmm0, IB(2))                                        \
+        op(W(XD), Xmm0)
+
+#define sceix_rx(XD) /* not portable, do not use outside */                 \
+        xorix_rr(Xmm0, Xmm0)                                                \
+        alnix_ri(Xmm0, W(XD), IB(3))                                        \
+        movix_rr(W(XD), Xmm0)
+
+/* adi (D[i] = S[0] + .. + S[i]) inclusive prefix sum of elements of S
+ * uses Xmm0 implicitly as a temp register, destroys Xmm0, XD/XS != Xmm0 */
+
+#define adiis_rr(XD, XS)                                                    \
+        sczix_rx(W(XD), W(XS), addis_rr)
+
+#define adiix_rr(XD, XS)                                                    \
+        sczix_rx(W(XD), W(XS), addix_rr)
+
+/* ade (D[i] = S[0] + .. + S[i-1]) exclusive prefix sum of S, D[0] = 0
+ * uses Xmm0 implicitly as a temp register, destroys Xmm0, XD/XS != Xmm0 */
+
+#define adeis_rr(XD, XS)                                                    \
+        sczix_rx(W(XD), W(XS), addis_rr)                                    \
+        sceix_rx(W(XD))
+
+#define adeix_rr(XD, XS)                                                    \
+        sczix_rx(W(XD), W(XS), addix_rr)                                    \
+        sceix_rx(W(XD))
+
+/* mni (D[i] = min(S[0], .. , S[i])) inclusive prefix min of elements of S
+ * uses Xmm0 implicitly as a temp register, destroys Xmm0, XD/XS != Xmm0 */
+
+#define mniis_rr(XD, XS)                                                    \
+        scsix_rx(W(XD), W(XS), minis_rr)
+
+#define mniix_rr(XD, XS)                                                    \
+        scsix_rx(W(XD), W(XS), minix_rr)
+
+#define mniin_rr(XD, XS)                                                    \
+        scsix_rx(W(XD), W(XS), minin_rr)
+
+/* mxi (D[i] = max(S[0], .. , S[i])) inclusive prefix max of elements of S
+ * uses Xmm0 implicitly as a temp register, destroys Xmm0, XD/XS != Xmm0 */
+
+#define mxiis_rr(XD, XS)                                                    \
+        scsix_rx(W(XD), W(XS), maxis_rr)
+
+#define mxiix_rr(XD, XS)                                                    \
+        scsix_rx(W(XD), W(XS), maxix_rr)
+
+#define mxiin_rr(XD, XS)                                                    \
+        scsix_rx(W(XD), W(XS), maxin_rr)
+
 /* and (G = G & S), (D = S & T) if (#D != #T) */
 
 #define andix_rr(XG, XS)                                                    \
@@ -395,6 +518,10 @@
         /* adp, adh are defined in rtbase.h (first 15-regs only)
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  adhis_rr
+#define adhis_rr(XD, XS) /* horizontal reductive add, first 15-regs only */ \
+        hrdis_rx(W(XD), W(XS), 0x1000000A)
+
 /* sub (G = G - S), (D = S - T) if (#D != #T) */
 
 #define subis_rr(XG, XS)                                                    \
@@ -432,6 +559,13 @@
         /* mlp, mlh are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  mlhis_rr
+#define mlhis_rr(XD, XS) /* horizontal reductive mul */                     \
+        EMITW(0x1000022C | MXM(TmmM,    REG(XS), REG(XS)))                  \
+        EMITW(0x1000002E | MXM(REG(XD), REG(XS), TmmS) | TmmM << 6)         \
+        EMITW(0x1000012C | MXM(TmmM,    REG(XD), REG(XD)))                  \
+        EMITW(0x1000002E | MXM(REG(XD), REG(XD), TmmS) | TmmM << 6)
+
 /* div (G = G / S), (D = S / T) if (#D != #T) and on ARMv7 if (#D != #S) */
 
 #define divis_rr(XG, XS)                                                    \
@@ -704,6 +838,10 @@
         minrs2ld(W(XD), Mebp, inf_SCR02(0x0C))                              \
         movrs2st(W(XD), Mebp, inf_SCR01(0x0C))
 
+#undef  mnhis_rr
+#define mnhis_rr(XD, XS) /* horizontal reductive min */                     \
+        hrdis_rx(W(XD), W(XS), 0x1000044A)
+
 #define movrs2ld(XD, MS, DS) /* not portable, do not use outside */         \
         AUW(EMPTY,    EMPTY,  EMPTY,    MOD(MS), VAL(DS), C2(DS), EMPTY2)   \
         EMITW(0x38000000 | MPM(TPxx,    REG(MS), VAL(DS), B2(DS), P2(DS)))  \
@@ -752,6 +890,10 @@
         maxrs2ld(W(XD), Mebp, inf_SCR02(0x0C))                              \
         movrs2st(W(XD), Mebp, inf_SCR01(0x0C))
 
+#undef  mxhis_rr
+#define mxhis_rr(XD, XS) /* horizontal reductive max */                     \
+        hrdis_rx(W(XD), W(XS), 0x1000040A)
+
 #define movrs2st(XS, MD, DD) /* not portable, do not use outside */         \
         AUW(EMPTY,    EMPTY,  EMPTY,    MOD(MD), VAL(DD), C2(DD), EMPTY2)   \
         EMITW(0x38000000 | MPM(TPxx,    REG(MD), VAL(DD), B2(DD), P2(DD)))  \
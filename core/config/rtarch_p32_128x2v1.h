@@ -190,6 +190,17 @@
         EMITW(0xF000043F | MXM(TmmM,    TmmM,    RYG(XS)))                  \
         EMITW(0x7C000719 | MXM(TmmM,    T1xx,    TPxx))
 
+/* hrd (D = S op S op ..) reduce all elements of S with "op" into each of D
+ * combining halves first, then in log2 steps via in-register permutes */
+
+#define hrdcs_rx(XD, XS, op) /* not portable, do not use outside */         \
+        EMITW(op | MXM(TmmM,    REG(XS), RYG(XS)))                          \
+        EMITW(0xF0000217 | MXM(REG(XD), TmmM,    TmmM))                     \
+        EMITW(op | MXM(TmmM,    TmmM,    REG(XD)))                          \
+        EMITW(0xF0000117 | MXM(REG(XD), TmmM,    TmmM))                     \
+        EMITW(op | MXM(REG(XD), REG(XD), TmmM))                             \
+        EMITW(0xF0000497 | MXM(RYG(XD), REG(XD), REG(XD)))
+
 /* and (G = G & S), (D = S & T) if (#D != #T) */
 
 #define andcx_rr(XG, XS)                                                    \
@@ -355,6 +366,10 @@
         /* adp, adh are defined in rtbase.h (first 15-regs only)
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  adhcs_rr
+#define adhcs_rr(XD, XS) /* horizontal reductive add, first 15-regs only */ \
+        hrdcs_rx(W(XD), W(XS), 0xF0000207)
+
 /* sub (G = G - S), (D = S - T) if (#D != #T) */
 
 #define subcs_rr(XG, XS)                                                    \
@@ -398,6 +413,10 @@
         /* mlp, mlh are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  mlhcs_rr
+#define mlhcs_rr(XD, XS) /* horizontal reductive mul */                     \
+        hrdcs_rx(W(XD), W(XS), 0xF0000287)
+
 /* div (G = G / S), (D = S / T) if (#D != #T) and on ARMv7 if (#D != #S) */
 
 #define divcs_rr(XG, XS)                                                    \
@@ -546,6 +565,10 @@
         /* mnp, mnh are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  mnhcs_rr
+#define mnhcs_rr(XD, XS) /* horizontal reductive min */                     \
+        hrdcs_rx(W(XD), W(XS), 0xF0000647)
+
 /* max (G = G > S ? G : S), (D = S > T ? S : T) if (#D != #T) */
 
 #define maxcs_rr(XG, XS)                                                    \
@@ -569,6 +592,10 @@
         /* mxp, mxh are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  mxhcs_rr
+#define mxhcs_rr(XD, XS) /* horizontal reductive max */                     \
+        hrdcs_rx(W(XD), W(XS), 0xF0000607)
+
 /* ceq (G = G == S ? -1 : 0), (D = S == T ? -1 : 0) if (#D != #T) */
 
 #define ceqcs_rr(XG, XS)                                                    \
@@ -191,6 +191,17 @@
         EMITW(0x1000042A | MXM(TmmM,    TmmM,    RYG(XS)))                  \
         EMITW(0x7C0001CE | MXM(TmmM,    T1xx,    TPxx))
 
+/* hrd (D = S op S op ..) reduce all elements of S with "op" into each of D
+ * combining halves first, then in log2 steps via in-register permutes */
+
+#define hrdcs_rx(XD, XS, op) /* not portable, do not use outside */         \
+        EMITW(op | MXM(TmmM,    REG(XS), RYG(XS)))                          \
+        EMITW(0x1000022C | MXM(REG(XD), TmmM,    TmmM))                     \
+        EMITW(op | MXM(TmmM,    TmmM,    REG(XD)))                          \
+        EMITW(0x1000012C | MXM(REG(XD), TmmM,    TmmM))                     \
+        EMITW(op | MXM(REG(XD), REG(XD), TmmM))                             \
+        EMITW(0x10000484 | MXM(RYG(XD), REG(XD), REG(XD)))
+
 /* and (G = G & S), (D = S & T) if (#D != #T) */
 
 #define andcx_rr(XG, XS)                                                    \
@@ -332,6 +343,10 @@
         /* adp, adh are defined in rtbase.h (first 15-regs only)
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  adhcs_rr
+#define adhcs_rr(XD, XS) /* horizontal reductive add, first 15-regs only */ \
+        hrdcs_rx(W(XD), W(XS), 0x1000000A)
+
 /* sub (G = G - S), (D = S - T) if (#D != #T) */
 
 #define subcs_rr(XG, XS)                                                    \
@@ -375,6 +390,15 @@
         /* mlp, mlh are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  mlhcs_rr
+#define mlhcs_rr(XD, XS) /* horizontal reductive mul */                     \
+        EMITW(0x1000002E | MXM(TmmM,    REG(XS), TmmS) | RYG(XS) << 6)      \
+        EMITW(0x1000022C | MXM(REG(XD), TmmM,    TmmM))                     \
+        EMITW(0x1000002E | MXM(TmmM,    TmmM,    TmmS) | REG(XD) << 6)      \
+        EMITW(0x1000012C | MXM(REG(XD), TmmM,    TmmM))                     \
+        EMITW(0x1000002E | MXM(REG(XD), REG(XD), TmmS) | TmmM << 6)         \
+        EMITW(0x10000484 | MXM(RYG(XD), REG(XD), REG(XD)))
+
 /* div (G = G / S), (D = S / T) if (#D != #T) and on ARMv7 if (#D != #S) */
 
 #define divcs_rr(XG, XS)                                                    \
@@ -750,6 +774,10 @@
         minrs2ld(W(XD), Mebp, inf_SCR02(0x1C))                              \
         movrs2st(W(XD), Mebp, inf_SCR01(0x1C))
 
+#undef  mnhcs_rr
+#define mnhcs_rr(XD, XS) /* horizontal reductive min */                     \
+        hrdcs_rx(W(XD), W(XS), 0x1000044A)
+
 /* max (G = G > S ? G : S), (D = S > T ? S : T) if (#D != #T) */
 
 #define maxcs_rr(XG, XS)                                                    \
@@ -800,6 +828,10 @@
         maxrs2ld(W(XD), Mebp, inf_SCR02(0x1C))                              \
         movrs2st(W(XD), Mebp, inf_SCR01(0x1C))
 
+#undef  mxhcs_rr
+#define mxhcs_rr(XD, XS) /* horizontal reductive max */                     \
+        hrdcs_rx(W(XD), W(XS), 0x1000040A)
+
 /* ceq (G = G == S ? -1 : 0), (D = S == T ? -1 : 0) if (#D != #T) */
 
 #define ceqcs_rr(XG, XS)                                                    \
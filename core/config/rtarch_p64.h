@@ -1280,6 +1280,88 @@
 
 #endif /* RT_BASE_COMPAT_REM != 0 */
 
+/* cnt (D = number of bits set in S), population count
+ * clz (D = number of leading zeroes in S), 64 if S is 0
+ * ctz (D = number of trailing zeroes in S), 64 if S is 0
+ * set-flags: undefined */
+
+#if RT_BASE_COMPAT_REM < 9 /* 0-8 - generic, 9 - POWER9 (ISA 3.0) */
+
+#define cntzx_rr(RD, RS)                                                    \
+        EMITW(0x78000042 | MSM(TMxx,    REG(RS), 0x1F))                     \
+        cntzx_rx(0x55555555)                                                \
+        EMITW(0x7C000038 | MSM(TMxx,    TMxx,    TIxx))                     \
+        EMITW(0x7C000050 | MRM(REG(RD), REG(RS), TMxx))                     \
+        cntzx_rx(0x33333333)                                                \
+        EMITW(0x78000082 | MSM(TMxx,    REG(RD), 0x1E))                     \
+        EMITW(0x7C000038 | MSM(TMxx,    TMxx,    TIxx))                     \
+        EMITW(0x7C000038 | MSM(REG(RD), REG(RD), TIxx))                     \
+        EMITW(0x7C000214 | MRM(REG(RD), REG(RD), TMxx))                     \
+        EMITW(0x78000102 | MSM(TMxx,    REG(RD), 0x1C))                     \
+        EMITW(0x7C000214 | MRM(REG(RD), REG(RD), TMxx))                     \
+        cntzx_rx(0x0F0F0F0F)                                                \
+        EMITW(0x7C000038 | MSM(REG(RD), REG(RD), TIxx))                     \
+        EMITW(0x78000202 | MSM(TMxx,    REG(RD), 0x18))                     \
+        EMITW(0x7C000214 | MRM(REG(RD), REG(RD), TMxx))                     \
+        EMITW(0x78000402 | MSM(TMxx,    REG(RD), 0x10))                     \
+        EMITW(0x7C000214 | MRM(REG(RD), REG(RD), TMxx))                     \
+        EMITW(0x78000022 | MSM(TMxx,    REG(RD), 0x00))                     \
+        EMITW(0x7C000214 | MRM(REG(RD), REG(RD), TMxx))                     \
+        EMITW(0x78000660 | MSM(REG(RD), REG(RD), 0x00))
+
+#define cntzx_rx(im) /* not portable, do not use outside */                 \
+        G32(TIxx, im)                                                       \
+        EMITW(0x7800000E | MSM(TIxx,    TIxx,    0x00))
+
+#define ctzzx_rr(RD, RS)   /* ctz(S) = 64 - clz(~S & (S - 1)) */            \
+        EMITW(0x3800FFFF | MTM(TMxx,    REG(RS), 0x00))                     \
+        EMITW(0x7C000078 | MSM(TMxx,    TMxx,    REG(RS)))                  \
+        EMITW(0x7C000074 | MSM(REG(RD), TMxx,    0x00))                     \
+        EMITW(0x20000040 | MTM(REG(RD), REG(RD), 0x00))
+
+#else /* RT_BASE_COMPAT_REM >= 9 */
+
+#define cntzx_rr(RD, RS)                                                    \
+        EMITW(0x7C0003F4 | MSM(REG(RD), REG(RS), 0x00))
+
+#define ctzzx_rr(RD, RS)                                                    \
+        EMITW(0x7C000474 | MSM(REG(RD), REG(RS), 0x00))
+
+#endif /* RT_BASE_COMPAT_REM >= 9 */
+
+#define cntzx_ld(RD, MS, DS)                                                \
+        movzx_ld(W(RD), W(MS), W(DS))                                       \
+        cntzx_rr(W(RD), W(RD))
+
+#define clzzx_rr(RD, RS)                                                    \
+        EMITW(0x7C000074 | MSM(REG(RD), REG(RS), 0x00))
+
+#define clzzx_ld(RD, MS, DS)                                                \
+        movzx_ld(W(RD), W(MS), W(DS))                                       \
+        clzzx_rr(W(RD), W(RD))
+
+#define ctzzx_ld(RD, MS, DS)                                                \
+        movzx_ld(W(RD), W(MS), W(DS))                                       \
+        ctzzx_rr(W(RD), W(RD))
+
+/* bsw (D = S with the order of bytes reversed), byte-swap
+ * set-flags: no */
+
+#define bswzx_rr(RD, RS)                                                    \
+        EMITW(0x5400003E | MSM(TMxx,    REG(RS), 0x08))                     \
+        EMITW(0x5000000E | MSM(TMxx,    REG(RS), 0x18))                     \
+        EMITW(0x5000042E | MSM(TMxx,    REG(RS), 0x18))                     \
+        EMITW(0x78000022 | MSM(TIxx,    REG(RS), 0x00))                     \
+        EMITW(0x5400003E | MSM(TDxx,    TIxx,    0x08))                     \
+        EMITW(0x5000000E | MSM(TDxx,    TIxx,    0x18))                     \
+        EMITW(0x5000042E | MSM(TDxx,    TIxx,    0x18))                     \
+        EMITW(0x7800000E | MSM(TDxx,    TMxx,    0x00))                     \
+        EMITW(0x7C000378 | MSM(REG(RD), TDxx,    TDxx))
+
+#define bswzx_ld(RD, MS, DS)                                                \
+        movzx_ld(W(RD), W(MS), W(DS))                                       \
+        bswzx_rr(W(RD), W(RD))
+
 /* arj (G = G op S, if cc G then jump lb)
  * set-flags: undefined
  * refer to individual instruction descriptions
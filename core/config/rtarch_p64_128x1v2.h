@@ -186,6 +186,12 @@
     SHF(EMITW(0x00000000 | MPM(TmmM,    MOD(MD), VAL(DD), B2(DD), O2(DD)))) \
     SHX(EMITW(0x00000000 | MPM(REG(XS), MOD(MD), VAL(DD), B2(DD), O2(DD))))
 
+/* bcs (D = [M]) broadcast scalar element from memory into all SIMD elements */
+
+#define bcsjx_ld(XD, MS, DS)                                                \
+        AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C3(DS), EMPTY2)   \
+        EMITW(0x7C000299 | MPM(REG(XD), MOD(MS), VAL(DS), B2(DS), E2(DS)))
+
 /* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
  * uses Xmm0 implicitly as a mask register, destroys Xmm0, 0-masked XS elems */
 
@@ -206,6 +212,91 @@
     SHF(EMITW(0xF0000257 | MXM(TmmM,    TmmM,    TmmM)))                    \
         EMITW(0x00000000 | MPM(TmmM,    MOD(MG), VAL(DG), B2(DG), O2(DG)))
 
+/* hrd (D = S op S op ..) reduce all elements of S with "op" into each of D
+ * in log2 steps via in-register permutes, TmmM is used as a temporary */
+
+#define hrdjs_rx(XD, XS, op) /* not portable, do not use outside */         \
+        EMITW(0xF0000257 | MXM(TmmM,    REG(XS), REG(XS)))                  \
+        EMITW(op | MXM(REG(XD), REG(XS), TmmM))
+
+/* aln (G = [S:G] >> IT) concatenate S and G, shift right by IT elements
+ * keeping the lower half, bc0 (D = S[0]) broadcast element 0 (not portable) */
+
+#define alnjx_ri(XG, XS, IT) /* not portable, do not use outside */         \
+    SBF(EMITW(0x1000002C | MXM(REG(XG), REG(XS), REG(XG)) |                 \
+                           (0x01 &-VAL(IT)) << 9))                          \
+    SBX(EMITW(0x1000002C | MXM(REG(XG), REG(XG), REG(XS)) |                 \
+                           (0x01 & VAL(IT)) << 9))
+
+#define bc0jx_rr(XD, XS) /* not portable, do not use outside */             \
+    SBF(EMITW(0xF0000357 | MXM(REG(XD), REG(XS), REG(XS))))                 \
+    SBX(EMITW(0xF0000057 | MXM(REG(XD), REG(XS), REG(XS))))
+
+/* scn (D[i] = S[0] op .. op S[i]) inclusive scan of S with "op" in log2
+ * steps, scz shifts in zeroes (add), scs repeats S[0] (min/max, idempotent),
+ * sce shifts D up by one element (exclusive scan), Xmm0 is used as a temp */
+
+#define sczjx_rx(XD, XS, op) /* not portable, do not use outside */         \
+        xorjx_rr(Xmm0, Xmm0)                                                \
+        alnjx_ri(Xmm0, W(XS), IB(1))                                        \
+        op(Xmm0, W(XS))                                                     \
+        movjx_rr(W(XD), Xmm0)
+
+#define scsjx_rx(XD, XS, op) /* not portable, do not use outside */         \
+        bc0jx_rr(Xmm0, W(XS))                                               \
+        alnjx_ri(Xmm0, W(XS), IB(1))                                        \
+        op(Xmm0, W(XS))                                                     \
+        movjx_rr(W(XD), Xmm0)
+
+#define scejx_rx(XD) /* not portable, do not use outside */                 \
+        xorjx_rr(Xmm0, Xmm0)                                                \
+        alnjx_ri(Xmm0, W(XD), IB(1))                                        \
+        movjx_rr(W(XD), Xmm0)
+
+/* adi (D[i] = S[0] + .. + S[i]) inclusive prefix sum of elements of S
+ * uses Xmm0 implicitly as a temp register, destroys Xmm0, XD/XS != Xmm0 */
+
+#define adijs_rr(XD, XS)                                                    \
+        sczjx_rx(W(XD), W(XS), addjs_rr)
+
+#define adijx_rr(XD, XS)                                                    \
+        sczjx_rx(W(XD), W(XS), addjx_rr)
+
+/* ade (D[i] = S[0] + .. + S[i-1]) exclusive prefix sum of S, D[0] = 0
+ * uses Xmm0 implicitly as a temp register, destroys Xmm0, XD/XS != Xmm0 */
+
+#define adejs_rr(XD, XS)                                                    \
+        sczjx_rx(W(XD), W(XS), addjs_rr)                                    \
+        scejx_rx(W(XD))
+
+#define adejx_rr(XD, XS)                                                    \
+        sczjx_rx(W(XD), W(XS), addjx_rr)                                    \
+        scejx_rx(W(XD))
+
+/* mni (D[i] = min(S[0], .. , S[i])) inclusive prefix min of elements of S
+ * uses Xmm0 implicitly as a temp register, destroys Xmm0, XD/XS != Xmm0 */
+
+#define mnijs_rr(XD, XS)                                                    \
+        scsjx_rx(W(XD), W(XS), minjs_rr)
+
+#define mnijx_rr(XD, XS)                                                    \
+        scsjx_rx(W(XD), W(XS), minjx_rr)
+
+#define mnijn_rr(XD, XS)                                                    \
+        scsjx_rx(W(XD), W(XS), minjn_rr)
+
+/* mxi (D[i] = max(S[0], .. , S[i])) inclusive prefix max of elements of S
+ * uses Xmm0 implicitly as a temp register, destroys Xmm0, XD/XS != Xmm0 */
+
+#define mxijs_rr(XD, XS)                                                    \
+        scsjx_rx(W(XD), W(XS), maxjs_rr)
+
+#define mxijx_rr(XD, XS)                                                    \
+        scsjx_rx(W(XD), W(XS), maxjx_rr)
+
+#define mxijn_rr(XD, XS)                                                    \
+        scsjx_rx(W(XD), W(XS), maxjn_rr)
+
 /* and (G = G & S), (D = S & T) if (#D != #T) */
 
 #define andjx_rr(XG, XS)                                                    \
@@ -329,6 +420,10 @@
         /* adp, adh are defined in rtbase.h (first 15-regs only)
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  adhjs_rr
+#define adhjs_rr(XD, XS) /* horizontal reductive add, first 15-regs only */ \
+        hrdjs_rx(W(XD), W(XS), 0xF0000307)
+
 /* sub (G = G - S), (D = S - T) if (#D != #T) */
 
 #define subjs_rr(XG, XS)                                                    \
@@ -366,6 +461,10 @@
         /* mlp, mlh are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  mlhjs_rr
+#define mlhjs_rr(XD, XS) /* horizontal reductive mul */                     \
+        hrdjs_rx(W(XD), W(XS), 0xF0000387)
+
 /* div (G = G / S), (D = S / T) if (#D != #T) and on ARMv7 if (#D != #S) */
 
 #define divjs_rr(XG, XS)                                                    \
@@ -490,6 +589,10 @@
         /* mnp, mnh are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  mnhjs_rr
+#define mnhjs_rr(XD, XS) /* horizontal reductive min */                     \
+        hrdjs_rx(W(XD), W(XS), 0xF0000747)
+
 /* max (G = G > S ? G : S), (D = S > T ? S : T) if (#D != #T) */
 
 #define maxjs_rr(XG, XS)                                                    \
@@ -510,6 +613,10 @@
         /* mxp, mxh are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  mxhjs_rr
+#define mxhjs_rr(XD, XS) /* horizontal reductive max */                     \
+        hrdjs_rx(W(XD), W(XS), 0xF0000707)
+
 /* ceq (G = G == S ? -1 : 0), (D = S == T ? -1 : 0) if (#D != #T) */
 
 #define ceqjs_rr(XG, XS)                                                    \
@@ -786,6 +893,48 @@
         rnrjs_rr(W(XD), W(XS), mode)                                        \
         cvzjs_rr(W(XD), W(XD))
 
+/* cvy (D = fp32-to-fp64 S), widens lower half of fp32 elements in S
+ * cvu (D = fp32-to-fp64 S), widens upper half of fp32 elements in S
+ * cvx (D = fp64-to-fp32 S), narrows to lower half of D, upper half is 0
+ * narrowing rounds as set in fp control register (in FCTRL blocks)
+ * _ld/_st access the lower half only */
+
+#define cvyis_rr(XD, XS)                                                    \
+    SDF(EMITW(0xF0000197 | MXM(TmmM,    REG(XS), REG(XS))))                 \
+    SDX(EMITW(0xF0000097 | MXM(TmmM,    REG(XS), REG(XS))))                 \
+        EMITW(0xF0000727 | MXM(REG(XD), 0x00,    TmmM))                     \
+    SHF(EMITW(0xF0000257 | MXM(REG(XD), REG(XD), REG(XD))))
+
+#define cvyis_ld(XD, MS, DS)                                                \
+        AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C1(DS), EMPTY2)   \
+        EMITW(0x00000000 | MPM(TmmM,    MOD(MS), VAL(DS), B1(DS), K1(DS)))  \
+        EMITW(0xF0000097 | MXM(TmmM,    TmmM,    TmmM))                     \
+        EMITW(0xF0000727 | MXM(REG(XD), 0x00,    TmmM))                     \
+    SHF(EMITW(0xF0000257 | MXM(REG(XD), REG(XD), REG(XD))))
+
+#define cvuis_rr(XD, XS)                                                    \
+    SDF(EMITW(0xF0000097 | MXM(TmmM,    REG(XS), REG(XS))))                 \
+    SDX(EMITW(0xF0000197 | MXM(TmmM,    REG(XS), REG(XS))))                 \
+        EMITW(0xF0000727 | MXM(REG(XD), 0x00,    TmmM))                     \
+    SHF(EMITW(0xF0000257 | MXM(REG(XD), REG(XD), REG(XD))))
+
+#define cvxjs_rr(XD, XS)                                                    \
+        EMITW(0xF0000627 | MXM(TmmM,    0x00,    REG(XS)))                  \
+        EMITW(0xF0000217 | MXM(TmmQ,    TmmM,    TmmM))                     \
+    SHF(EMITW(0xF0000197 | MXM(TmmM,    TmmM,    TmmQ)))                    \
+    SHX(EMITW(0xF0000097 | MXM(TmmM,    TmmM,    TmmQ)))                    \
+        EMITW(0xF00004D7 | MXM(TmmQ,    TmmQ,    TmmQ))                     \
+    SDF(EMITW(0xF0000057 | MXM(REG(XD), TmmQ,    TmmM)))                    \
+    SDX(EMITW(0xF0000057 | MXM(REG(XD), TmmM,    TmmQ)))
+
+#define cvxjs_st(XS, MD, DD)                                                \
+        EMITW(0xF0000627 | MXM(TmmM,    0x00,    REG(XS)))                  \
+        EMITW(0xF0000217 | MXM(TmmQ,    TmmM,    TmmM))                     \
+    SHF(EMITW(0xF0000197 | MXM(TmmM,    TmmM,    TmmQ)))                    \
+    SHX(EMITW(0xF0000097 | MXM(TmmM,    TmmM,    TmmQ)))                    \
+        AUW(SIB(MD),  EMPTY,  EMPTY,    MOD(MD), VAL(DD), C1(DD), EMPTY2)   \
+        EMITW(0x00000000 | MPM(TmmM,    MOD(MD), VAL(DD), B1(DD), V1(DD)))
+
 /************   packed double-precision integer arithmetic/shifts   ***********/
 
 /* add (G = G + S), (D = S + T) if (#D != #T) */
@@ -857,6 +1006,28 @@
         stack_ld(Recx)                                                      \
         movjx_ld(W(XD), Mebp, inf_SCR01(0))
 
+/* muw (G = G * S), multiplies lower 32-bit halves of 64-bit elements into
+ * full 64-bit products, unsigned-[x] or signed-[n], upper halves are ignored
+ * mul-high of 64-bit elements has no native form and uses BASE in rtconf.h */
+
+#define muwjx_rr(XG, XS)                                                    \
+        EMITW(0x10000088 | MXM(REG(XG), REG(XG), REG(XS)))
+
+#define muwjx_ld(XG, MS, DS)                                                \
+        AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C2(DS), EMPTY2)   \
+        EMITW(0x00000000 | MPM(TmmM,    MOD(MS), VAL(DS), B2(DS), P2(DS)))  \
+    SHF(EMITW(0xF0000257 | MXM(TmmM,    TmmM,    TmmM)))                    \
+        EMITW(0x10000088 | MXM(REG(XG), REG(XG), TmmM))
+
+#define muwjn_rr(XG, XS)                                                    \
+        EMITW(0x10000188 | MXM(REG(XG), REG(XG), REG(XS)))
+
+#define muwjn_ld(XG, MS, DS)                                                \
+        AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C2(DS), EMPTY2)   \
+        EMITW(0x00000000 | MPM(TmmM,    MOD(MS), VAL(DS), B2(DS), P2(DS)))  \
+    SHF(EMITW(0xF0000257 | MXM(TmmM,    TmmM,    TmmM)))                    \
+        EMITW(0x10000188 | MXM(REG(XG), REG(XG), TmmM))
+
 /* shl (G = G << S), (D = S << T) if (#D != #T) - plain, unsigned
  * for maximum compatibility: shift count must be modulo elem-size */
 
@@ -965,6 +1136,81 @@
     SHF(EMITW(0xF0000257 | MXM(TmmM,    TmmM,    TmmM)))                    \
         EMITW(0x100003C4 | MXM(REG(XD), REG(XS), TmmM))
 
+/* cvy (D = S), zero-[x] or sign-[n] extends lower half of 32-bit elements
+ * cvu (D = S), zero-[x] or sign-[n] extends upper half of 32-bit elements
+ * cvx (D = S), narrows signed 64-bit elements to lower half of D, upper is 0
+ * with unsigned-[x] or signed-[n] saturation into 32-bit elements
+ * 32-bit elements are reversed on little-endian, 64-bit ones if SBF */
+
+#define cvyix_rr(XD, XS)                                                    \
+        EMITW(0x100004C4 | MXM(TmmQ,    TmmQ,    TmmQ))                     \
+    SDF(EMITW(0x1000018C | MXM(REG(XD), TmmQ,    REG(XS))))                 \
+    SDX(EMITW(0x1000008C | MXM(REG(XD), TmmQ,    REG(XS))))                 \
+    SHF(EMITW(0xF0000257 | MXM(REG(XD), REG(XD), REG(XD))))
+
+#define cvyin_rr(XD, XS)                                                    \
+    SDF(EMITW(0x100006CE | MXM(REG(XD), 0x00,    REG(XS))))                 \
+    SDX(EMITW(0x1000064E | MXM(REG(XD), 0x00,    REG(XS))))                 \
+    SHF(EMITW(0xF0000257 | MXM(REG(XD), REG(XD), REG(XD))))
+
+#define cvuix_rr(XD, XS)                                                    \
+        EMITW(0x100004C4 | MXM(TmmQ,    TmmQ,    TmmQ))                     \
+    SDF(EMITW(0x1000008C | MXM(REG(XD), TmmQ,    REG(XS))))                 \
+    SDX(EMITW(0x1000018C | MXM(REG(XD), TmmQ,    REG(XS))))                 \
+    SHF(EMITW(0xF0000257 | MXM(REG(XD), REG(XD), REG(XD))))
+
+#define cvuin_rr(XD, XS)                                                    \
+    SDF(EMITW(0x1000064E | MXM(REG(XD), 0x00,    REG(XS))))                 \
+    SDX(EMITW(0x100006CE | MXM(REG(XD), 0x00,    REG(XS))))                 \
+    SHF(EMITW(0xF0000257 | MXM(REG(XD), REG(XD), REG(XD))))
+
+#define cvxjx_rr(XD, XS)                                                    \
+        EMITW(0x100004C4 | MXM(TmmQ,    TmmQ,    TmmQ))                     \
+    SHF(EMITW(0xF0000257 | MXM(TmmM,    REG(XS), REG(XS))))                 \
+    SHF(EMITW(0x1000054E | MXM(REG(XD), TmmQ,    TmmM)))                    \
+    SBF(EMITW(0x1000054E | MXM(REG(XD), TmmQ,    REG(XS))))                 \
+    SDX(EMITW(0x1000054E | MXM(REG(XD), REG(XS), TmmQ)))
+
+#define cvxjn_rr(XD, XS)                                                    \
+        EMITW(0x100004C4 | MXM(TmmQ,    TmmQ,    TmmQ))                     \
+    SHF(EMITW(0xF0000257 | MXM(TmmM,    REG(XS), REG(XS))))                 \
+    SHF(EMITW(0x100005CE | MXM(REG(XD), TmmQ,    TmmM)))                    \
+    SBF(EMITW(0x100005CE | MXM(REG(XD), TmmQ,    REG(XS))))                 \
+    SDX(EMITW(0x100005CE | MXM(REG(XD), REG(XS), TmmQ)))
+
+/* cnt (D = number of bits set in each element of S), population count */
+
+#define cntjx_rr(XD, XS)                                                    \
+        EMITW(0x100007C3 | MXM(REG(XD), 0x00,    REG(XS)))
+
+#define cntjx_ld(XD, MS, DS)                                                \
+        AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C2(DS), EMPTY2)   \
+        EMITW(0x00000000 | MPM(TmmM,    MOD(MS), VAL(DS), B2(DS), P2(DS)))  \
+    SHF(EMITW(0xF0000257 | MXM(TmmM,    TmmM,    TmmM)))                    \
+        EMITW(0x100007C3 | MXM(REG(XD), 0x00,    TmmM))
+
+/* clz (D = number of leading zeroes in each element of S), 64 if 0 */
+
+#define clzjx_rr(XD, XS)                                                    \
+        EMITW(0x100007C2 | MXM(REG(XD), 0x00,    REG(XS)))
+
+#define clzjx_ld(XD, MS, DS)                                                \
+        AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C2(DS), EMPTY2)   \
+        EMITW(0x00000000 | MPM(TmmM,    MOD(MS), VAL(DS), B2(DS), P2(DS)))  \
+    SHF(EMITW(0xF0000257 | MXM(TmmM,    TmmM,    TmmM)))                    \
+        EMITW(0x100007C2 | MXM(REG(XD), 0x00,    TmmM))
+
+/* ctz (D = number of trailing zeroes in each element of S), 64 if 0 */
+
+#define ctzjx_rr(XD, XS)                                                    \
+        EMITW(0x101F0602 | MXM(REG(XD), 0x00,    REG(XS)))
+
+#define ctzjx_ld(XD, MS, DS)                                                \
+        AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C2(DS), EMPTY2)   \
+        EMITW(0x00000000 | MPM(TmmM,    MOD(MS), VAL(DS), B2(DS), P2(DS)))  \
+    SHF(EMITW(0xF0000257 | MXM(TmmM,    TmmM,    TmmM)))                    \
+        EMITW(0x101F0602 | MXM(REG(XD), 0x00,    TmmM))
+
 /****************   packed double-precision integer compare   *****************/
 
 /* min (G = G < S ? G : S), (D = S < T ? S : T) if (#D != #T), unsigned */
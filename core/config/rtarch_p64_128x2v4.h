@@ -182,6 +182,15 @@
         EMITW(0xF0000035 | MXM(TmmM,    TmmM,    REG(XS)))                  \
         EMITW(0x7C000799 | MXM(TmmM,    T1xx,    TPxx))
 
+/* hrd (D = S op S op ..) reduce all elements of S with "op" into each of D
+ * combining halves first, then in log2 steps via in-register permutes */
+
+#define hrdds_rx(XD, XS, op) /* not portable, do not use outside */         \
+        EMITW(op | 0x05 | MXM(TmmM,    REG(XS), REG(XS)))                   \
+        EMITW(0xF0000257 | MXM(REG(XD), TmmM,    TmmM))                     \
+        EMITW(op | 0x07 | MXM(REG(XD), REG(XD), TmmM))                      \
+        EMITW(0xF0000496 | MXM(REG(XD), REG(XD), REG(XD)))
+
 /* and (G = G & S), (D = S & T) if (#D != #T) */
 
 #define anddx_rr(XG, XS)                                                    \
@@ -347,6 +356,10 @@
         /* adp, adh are defined in rtbase.h (first 15-regs only)
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  adhds_rr
+#define adhds_rr(XD, XS) /* horizontal reductive add, first 15-regs only */ \
+        hrdds_rx(W(XD), W(XS), 0xF0000300)
+
 /* sub (G = G - S), (D = S - T) if (#D != #T) */
 
 #define subds_rr(XG, XS)                                                    \
@@ -390,6 +403,10 @@
         /* mlp, mlh are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  mlhds_rr
+#define mlhds_rr(XD, XS) /* horizontal reductive mul */                     \
+        hrdds_rx(W(XD), W(XS), 0xF0000380)
+
 /* div (G = G / S), (D = S / T) if (#D != #T) and on ARMv7 if (#D != #S) */
 
 #define divds_rr(XG, XS)                                                    \
@@ -529,6 +546,10 @@
         /* mnp, mnh are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  mnhds_rr
+#define mnhds_rr(XD, XS) /* horizontal reductive min */                     \
+        hrdds_rx(W(XD), W(XS), 0xF0000740)
+
 /* max (G = G > S ? G : S), (D = S > T ? S : T) if (#D != #T) */
 
 #define maxds_rr(XG, XS)                                                    \
@@ -552,6 +573,10 @@
         /* mxp, mxh are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  mxhds_rr
+#define mxhds_rr(XD, XS) /* horizontal reductive max */                     \
+        hrdds_rx(W(XD), W(XS), 0xF0000700)
+
 /* ceq (G = G == S ? -1 : 0), (D = S == T ? -1 : 0) if (#D != #T) */
 
 #define ceqds_rr(XG, XS)                                                    \
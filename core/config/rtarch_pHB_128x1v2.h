@@ -361,6 +361,16 @@
         EMITW(0x100004C4 | MXM(TmmQ,    TmmQ,    TmmQ))                     \
         EMITW(0x10000022 | MXM(REG(XD), REG(XS), TmmM) | TmmQ << 6)
 
+/* dph (G = G + S * T) if (#G != #S && #G != #T), 16-bit pairs into 32-bit */
+
+#define dphix_rr(XG, XS, XT)                                                \
+        EMITW(0x10000028 | MXM(REG(XG), REG(XS), REG(XT)) | REG(XG) << 6)
+
+#define dphix_ld(XG, XS, MT, DT)                                            \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x00000000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x10000028 | MXM(REG(XG), REG(XS), TmmM) | REG(XG) << 6)
+
 /* shl (G = G << S), (D = S << T) if (#D != #T) - plain, unsigned
  * for maximum compatibility: shift count must be modulo elem-size */
 
@@ -744,6 +754,31 @@
         EMITW(0xF000003F | MXM(TmmM,    TmmM,    REG(XS)))                  \
         EMITW(0x00000000 | MPM(TmmM,    MOD(MG), VAL(DG), B2(DG), O2(DG)))
 
+/* tbl (G = G[S]), (D = S[T]) if (#D != #T) look up bytes within 128-bit lanes
+ * indices 0-15 pick bytes in the same lane, 0x80-0xFF produce zero bytes */
+
+#define tblgb_rr(XG, XS)                                                    \
+        tblgb3rr(W(XG), W(XG), W(XS))
+
+#define tblgb_ld(XG, MS, DS)                                                \
+        tblgb3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define tblgb3rr(XD, XS, XT)                                                \
+        tblgb_rx(W(XD), W(XS), REG(XT))
+
+#define tblgb3ld(XD, XS, MT, DT)                                            \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x00000000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
+        tblgb_rx(W(XD), W(XS), TmmM)
+
+#define tblgb_rx(XD, XS, rt) /* not portable, do not use outside */         \
+        EMITW(0x1000030C | MXM(TmmQ,    SP08,    0x00))                     \
+        EMITW(0x100004C4 | MXM(TmmM,    (rt),    TmmQ))                     \
+        EMITW(0x1000030C | MXM(TmmQ,    0x07,    0x00))                     \
+        EMITW(0x10000304 | MXM(TmmQ,    TmmM,    TmmQ))                     \
+        EMITW(0x1000002B | MXM(REG(XD), REG(XS), REG(XS)) | TmmM << 6)      \
+        EMITW(0x10000444 | MXM(REG(XD), REG(XD), TmmQ))
+
 /* move/logic instructions are sizeless and provided in 16-bit subset above */
 
 /*************   packed byte-precision integer arithmetic/shifts   ************/
@@ -916,6 +951,17 @@
         stack_ld(Recx)                                                      \
         movgx_ld(W(XD), Mebp, inf_SCR01(0))
 
+/* dpb (G = G + S * T) if (#G != #S && #G != #T), 8-bit quads into 32-bit
+ * signed bytes of T go to VRA, unsigned bytes of S go to VRB (vmsummbm) */
+
+#define dpbix_rr(XG, XS, XT)                                                \
+        EMITW(0x10000025 | MXM(REG(XG), REG(XT), REG(XS)) | REG(XG) << 6)
+
+#define dpbix_ld(XG, XS, MT, DT)                                            \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x00000000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x10000025 | MXM(REG(XG), TmmM,    REG(XS)) | REG(XG) << 6)
+
 /* shl (G = G << S), (D = S << T) if (#D != #T) - plain, unsigned
  * for maximum compatibility: shift count must be modulo elem-size */
 
@@ -378,6 +378,17 @@
         EMITW(0x100004C4 | MXM(TmmZ,    TmmZ,    TmmZ))                     \
         EMITW(0x10000022 | MXM(REG(XD), REG(XS), TmmM) | TmmZ << 6)
 
+/* dph (G = G + S * T) if (#G != #S && #G != #T), 16-bit pairs into 32-bit */
+
+#define dphix_rr(XG, XS, XT)                                                \
+        EMITW(0x10000028 | MXM(REG(XG), REG(XS), REG(XT)) | REG(XG) << 6)
+
+#define dphix_ld(XG, XS, MT, DT)                                            \
+        AUW(EMPTY,    EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x38000000 | MPM(TPxx,    REG(MT), VAL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x7C0000CE | MXM(TmmM,    Teax & M(MOD(MT) == TPxx), TPxx))   \
+        EMITW(0x10000028 | MXM(REG(XG), REG(XS), TmmM) | REG(XG) << 6)
+
 /* shl (G = G << S), (D = S << T) if (#D != #T) - plain, unsigned
  * for maximum compatibility: shift count must be modulo elem-size */
 
@@ -783,6 +794,32 @@
         EMITW(0x1000002A | MXM(TmmM,    TmmM,    REG(XS)))                  \
         EMITW(0x7C0001CE | MXM(TmmM,    Teax & M(MOD(MG) == TPxx), TPxx))
 
+/* tbl (G = G[S]), (D = S[T]) if (#D != #T) look up bytes within 128-bit lanes
+ * indices 0-15 pick bytes in the same lane, 0x80-0xFF produce zero bytes */
+
+#define tblgb_rr(XG, XS)                                                    \
+        tblgb3rr(W(XG), W(XG), W(XS))
+
+#define tblgb_ld(XG, MS, DS)                                                \
+        tblgb3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define tblgb3rr(XD, XS, XT)                                                \
+        tblgb_rx(W(XD), W(XS), REG(XT))
+
+#define tblgb3ld(XD, XS, MT, DT)                                            \
+        AUW(EMPTY,    EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x38000000 | MPM(TPxx,    REG(MT), VAL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x7C0000CE | MXM(TmmM,    Teax & M(MOD(MT) == TPxx), TPxx))   \
+        tblgb_rx(W(XD), W(XS), TmmM)
+
+#define tblgb_rx(XD, XS, rt) /* not portable, do not use outside */         \
+        EMITW(0x1000030C | MXM(TmmQ,    SP08,    0x00))                     \
+        EMITW(0x100004C4 | MXM(TmmM,    (rt),    TmmQ))                     \
+        EMITW(0x1000030C | MXM(TmmQ,    0x07,    0x00))                     \
+        EMITW(0x10000304 | MXM(TmmQ,    TmmM,    TmmQ))                     \
+        EMITW(0x1000002B | MXM(REG(XD), REG(XS), REG(XS)) | TmmM << 6)      \
+        EMITW(0x10000444 | MXM(REG(XD), REG(XD), TmmQ))
+
 /* move/logic instructions are sizeless and provided in 16-bit subset above */
 
 /*************   packed byte-precision integer arithmetic/shifts   ************/
@@ -961,6 +998,18 @@
         stack_ld(Recx)                                                      \
         movgx_ld(W(XD), Mebp, inf_SCR01(0))
 
+/* dpb (G = G + S * T) if (#G != #S && #G != #T), 8-bit quads into 32-bit
+ * signed bytes of T go to VRA, unsigned bytes of S go to VRB (vmsummbm) */
+
+#define dpbix_rr(XG, XS, XT)                                                \
+        EMITW(0x10000025 | MXM(REG(XG), REG(XT), REG(XS)) | REG(XG) << 6)
+
+#define dpbix_ld(XG, XS, MT, DT)                                            \
+        AUW(EMPTY,    EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x38000000 | MPM(TPxx,    REG(MT), VAL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x7C0000CE | MXM(TmmM,    Teax & M(MOD(MT) == TPxx), TPxx))   \
+        EMITW(0x10000025 | MXM(REG(XG), TmmM,    REG(XS)) | REG(XG) << 6)
+
 /* shl (G = G << S), (D = S << T) if (#D != #T) - plain, unsigned
  * for maximum compatibility: shift count must be modulo elem-size */
 
@@ -51,6 +51,8 @@
  * stack_ld - applies [mov] to full register from stack (pop)
  * stack_sa - applies [mov] to stack from all full registers
  * stack_la - applies [mov] to all full registers from stack
+ * stack_sr - applies [mov] to stack from full registers in mask
+ * stack_lr - applies [mov] to full registers in mask from stack
  *
  * cmdw*_** - applies [cmd] to 32-bit BASE register/memory/immediate args
  * cmdx*_** - applies [cmd] to A-size BASE register/memory/immediate args
@@ -206,6 +208,18 @@
         EMITB(0x00 | (1 - (rxg)) << 7 | 1 << 6 | (1 - (rxm)) << 5 | (aux))  \
         EMITB(0x80 | (len) << 2 | (0x0F - (ren)) << 3 | (pfx))
 
+/* 3-byte VEX prefix with SIMD index in VSIB (W0) */
+#define VSX(rxg, rxi, rxm, ren, len, pfx, aux)                              \
+        EMITB(0xC4)                                                         \
+        EMITB(0x00 | (1-(rxg))<<7 | (1-(rxi))<<6 | (1-(rxm))<<5 | (aux))    \
+        EMITB(0x00 | (len) << 2 | (0x0F - (ren)) << 3 | (pfx))
+
+/* 3-byte VEX prefix with SIMD index in VSIB (W1) */
+#define VSW(rxg, rxi, rxm, ren, len, pfx, aux)                              \
+        EMITB(0xC4)                                                         \
+        EMITB(0x00 | (1-(rxg))<<7 | (1-(rxi))<<6 | (1-(rxm))<<5 | (aux))    \
+        EMITB(0x80 | (len) << 2 | (0x0F - (ren)) << 3 | (pfx))
+
 /* 4-byte EVEX prefix with full customization (W0, K0) */
 #define EVX(rxg, rxm, ren, len, pfx, aux)                                   \
         EMITB(0x62)                                                         \
@@ -300,6 +314,7 @@
 #define REJ(reg, mod, sib)  (((reg) & 0x07)+24) /* 4th 8-reg-bank, 5-bits */
 #define REN(reg, mod, sib)  (reg) /* 3rd operand, full-reg-bank, 4/5-bits */
 #define REM(reg, mod, sib)  (((reg) & 0x0F)+16) /* 2nd 16-reg-bank 5-bits */
+#define RMK(reg, mod, sib)  (1 << (reg)) /* register bit in save/load mask */
 #define MOD(reg, mod, sib)  mod
 #define SIB(reg, mod, sib)  sib
 
@@ -318,6 +333,11 @@
 #define X(reg, mod, sib)  (reg+16), mod, sib
 #define Z(reg, mod, sib)  (reg+24), mod, sib
 
+/* temporary SIMD register (one of Xmm0-Xmm3) which differs from both XD/XS,
+ * its bit 0 is the inverse of XD's bit 0, bit 1 - the inverse of XS's bit 1 */
+
+#define TmmX(XD, XS)  ((~REN(XD) & 1) | (~REN(XS) & 2)), 0x03, EMPTY
+
 /******************************************************************************/
 /********************************   EXTERNAL   ********************************/
 /******************************************************************************/
@@ -1647,6 +1667,114 @@
 #define remwn_xm(MS, DS)    /* to be placed immediately after divwn_xm */   \
                                      /* to produce remainder Redx<-rem */
 
+/* cnt (D = number of bits set in S), population count
+ * clz (D = number of leading zeroes in S), 32 if S is 0
+ * ctz (D = number of trailing zeroes in S), 32 if S is 0
+ * set-flags: undefined */
+
+#if RT_BASE_COMPAT_BMI < 2 /* 0 - generic, 1 - 3-op-VEX, 2 - BMI1+BMI2 */
+
+#define cntwx_rr(RD, RS)                                                    \
+        movwx_rr(W(RD), W(RS))                                              \
+        REX(0,             1) EMITB(0xBF)  /* <- r15d = 0xAAAAAAAA */       \
+        EMITW(0xAAAAAAAA)                                                   \
+        REX(RXB(RD),       1) EMITB(0x21)  /* <- r15d &= RD */              \
+        MRM(REG(RD),    0x03,    0x07)                                      \
+        REX(0,             1) EMITB(0xD1)  /* <- r15d >>= 1 */              \
+        MRM(0x05,       0x03,    0x07)                                      \
+        REX(1,       RXB(RD)) EMITB(0x29)  /* <- RD -= r15d */              \
+        MRM(0x07,    MOD(RD), REG(RD))                                      \
+        REX(0,             1) EMITB(0xBF)  /* <- r15d = 0xCCCCCCCC */       \
+        EMITW(0xCCCCCCCC)                                                   \
+        REX(RXB(RD),       1) EMITB(0x21)  /* <- r15d &= RD */              \
+        MRM(REG(RD),    0x03,    0x07)                                      \
+        REX(1,       RXB(RD)) EMITB(0x29)  /* <- RD -= r15d */              \
+        MRM(0x07,    MOD(RD), REG(RD))                                      \
+        REX(0,             1) EMITB(0xC1)  /* <- r15d >>= 2 */              \
+        MRM(0x05,       0x03,    0x07)                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0x02))                                  \
+        REX(1,       RXB(RD)) EMITB(0x01)  /* <- RD += r15d */              \
+        MRM(0x07,    MOD(RD), REG(RD))                                      \
+        REX(RXB(RD),       1) EMITB(0x89)  /* <- r15d = RD */               \
+        MRM(REG(RD),    0x03,    0x07)                                      \
+        REX(0,             1) EMITB(0xC1)  /* <- r15d >>= 4 */              \
+        MRM(0x05,       0x03,    0x07)                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0x04))                                  \
+        REX(1,       RXB(RD)) EMITB(0x01)  /* <- RD += r15d */              \
+        MRM(0x07,    MOD(RD), REG(RD))                                      \
+        andwx_ri(W(RD), IV(0x0F0F0F0F))                                     \
+        mulwx_ri(W(RD), IV(0x01010101))                                     \
+        shrwx_ri(W(RD), IB(24))
+
+#define clzwx_rr(RD, RS)                                                    \
+        REX(1,       RXB(RS)) EMITB(0x0F) EMITB(0xBD)  /* <- bsr r15d */    \
+        MRM(0x07,    MOD(RS), REG(RS))                                      \
+        movwx_ri(W(RD), IB(63))                                             \
+        REX(RXB(RD),       1) EMITB(0x0F) EMITB(0x45)  /* <- cmovnz */      \
+        MRM(REG(RD),    0x03,    0x07)                                      \
+        xorwx_ri(W(RD), IB(31))
+
+#define ctzwx_rr(RD, RS)                                                    \
+        REX(1,       RXB(RS)) EMITB(0x0F) EMITB(0xBC)  /* <- bsf r15d */    \
+        MRM(0x07,    MOD(RS), REG(RS))                                      \
+        movwx_ri(W(RD), IB(32))                                             \
+        REX(RXB(RD),       1) EMITB(0x0F) EMITB(0x45)  /* <- cmovnz */      \
+        MRM(REG(RD),    0x03,    0x07)
+
+#define cntwx_ld(RD, MS, DS)                                                \
+        movwx_ld(W(RD), W(MS), W(DS))                                       \
+        cntwx_rr(W(RD), W(RD))
+
+#define clzwx_ld(RD, MS, DS)                                                \
+        movwx_ld(W(RD), W(MS), W(DS))                                       \
+        clzwx_rr(W(RD), W(RD))
+
+#define ctzwx_ld(RD, MS, DS)                                                \
+        movwx_ld(W(RD), W(MS), W(DS))                                       \
+        ctzwx_rr(W(RD), W(RD))
+
+#else /* RT_BASE_COMPAT_BMI >= 2 */
+
+#define cntwx_rr(RD, RS)                                                    \
+        EMITB(0xF3) REX(RXB(RD), RXB(RS)) EMITB(0x0F) EMITB(0xB8)           \
+        MRM(REG(RD), MOD(RS), REG(RS))
+
+#define cntwx_ld(RD, MS, DS)                                                \
+    ADR EMITB(0xF3) REX(RXB(RD), RXB(MS)) EMITB(0x0F) EMITB(0xB8)           \
+        MRM(REG(RD), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#define clzwx_rr(RD, RS)                                                    \
+        EMITB(0xF3) REX(RXB(RD), RXB(RS)) EMITB(0x0F) EMITB(0xBD)           \
+        MRM(REG(RD), MOD(RS), REG(RS))
+
+#define clzwx_ld(RD, MS, DS)                                                \
+    ADR EMITB(0xF3) REX(RXB(RD), RXB(MS)) EMITB(0x0F) EMITB(0xBD)           \
+        MRM(REG(RD), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#define ctzwx_rr(RD, RS)                                                    \
+        EMITB(0xF3) REX(RXB(RD), RXB(RS)) EMITB(0x0F) EMITB(0xBC)           \
+        MRM(REG(RD), MOD(RS), REG(RS))
+
+#define ctzwx_ld(RD, MS, DS)                                                \
+    ADR EMITB(0xF3) REX(RXB(RD), RXB(MS)) EMITB(0x0F) EMITB(0xBC)           \
+        MRM(REG(RD), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#endif /* RT_BASE_COMPAT_BMI >= 2 */
+
+/* bsw (D = S with the order of bytes reversed), byte-swap
+ * set-flags: no */
+
+#define bswwx_rr(RD, RS)                                                    \
+        movwx_rr(W(RD), W(RS))                                              \
+        REX(0,       RXB(RD)) EMITB(0x0F) EMITB(0xC8 | REG(RD))
+
+#define bswwx_ld(RD, MS, DS)                                                \
+        movwx_ld(W(RD), W(MS), W(DS))                                       \
+        REX(0,       RXB(RD)) EMITB(0x0F) EMITB(0xC8 | REG(RD))
+
 /* arj (G = G op S, if cc G then jump lb)
  * set-flags: undefined
  * refer to individual instruction descriptions
@@ -1983,6 +2111,59 @@
         MRM(REG(RD), MOD(MS), REG(MS))                                      \
         AUX(SIB(MS), CMD(DS), EMPTY)
 
+/* pf0, pf1, pf2, pfn (prefetch [S] into cache, T0/T1/T2-hints, NTA-hint)
+ * T0 - all cache levels, T1 - L2 and up, T2 - L3 and up (if available),
+ * NTA - non-temporal (streaming), hints are advisory, never fault on [S]
+ * set-flags: no */
+
+#define pf0xx_ld(MS, DS)                                                    \
+    ADR REX(0,       RXB(MS)) EMITB(0x0F) EMITB(0x18)                       \
+        MRM(0x01,    MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#define pf1xx_ld(MS, DS)                                                    \
+    ADR REX(0,       RXB(MS)) EMITB(0x0F) EMITB(0x18)                       \
+        MRM(0x02,    MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#define pf2xx_ld(MS, DS)                                                    \
+    ADR REX(0,       RXB(MS)) EMITB(0x0F) EMITB(0x18)                       \
+        MRM(0x03,    MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#define pfnxx_ld(MS, DS)                                                    \
+    ADR REX(0,       RXB(MS)) EMITB(0x0F) EMITB(0x18)                       \
+        MRM(0x00,    MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+/* sfn (fence for stores), orders all prior stores before any later stores
+ * place after non-temporal stores (stn) before [D] is read by other threads
+ * set-flags: no */
+
+#define sfnce_xx()                                                          \
+        EMITB(0x0F) EMITB(0xAE) EMITB(0xF8)
+
+/* zcl (zero 128-byte block at [D]), [D] must be aligned to 128 bytes
+ * no cache-line zeroing in ISA, 16 regular 64-bit stores of immediate 0
+ * set-flags: no */
+
+#define zclxx_st(MD, DD)                                                    \
+        zclxx_r4(W(MD), W(DD), 0x00)                                        \
+        zclxx_r4(W(MD), W(DD), 0x20)                                        \
+        zclxx_r4(W(MD), W(DD), 0x40)                                        \
+        zclxx_r4(W(MD), W(DD), 0x60)
+
+#define zclxx_r4(MD, DD, dp) /* not portable, do not use outside */         \
+        zclxx_rx(W(MD), W(DD), dp+0x00)                                     \
+        zclxx_rx(W(MD), W(DD), dp+0x08)                                     \
+        zclxx_rx(W(MD), W(DD), dp+0x10)                                     \
+        zclxx_rx(W(MD), W(DD), dp+0x18)
+
+#define zclxx_rx(MD, DD, dp) /* not portable, do not use outside */         \
+    ADR REW(0,       RXB(MD)) EMITB(0xC7)                                   \
+        MRM(0x00,       0x02, REG(MD))                                      \
+        AUX(SIB(MD), EMITW(VAL(DD)+(dp)), EMITW(0x00000000))
+
 /************************* pointer-sized instructions *************************/
 
 /* label (D = Reax = adr lb)
@@ -2021,6 +2202,8 @@
 
 #endif /* defined (RT_X32, RT_X64) */
 
+#if RT_RUNTIME == 0
+
 #define jmpxx_lb(lb)              /* label-targeted unconditional jump */   \
         ASM_BEG ASM_OP1(jmp, lb) ASM_END
 
@@ -2063,6 +2246,52 @@
 #define LBL(lb)                                          /* code label */   \
         ASM_BEG ASM_OP0(lb:) ASM_END
 
+#else /* RT_RUNTIME */
+
+#define jmpxx_lb(lb)              /* label-targeted unconditional jump */   \
+        code_jump(__Code__, 0xEB, #lb);
+
+#define jezxx_lb(lb)               /* setting-flags-arithmetic -> jump */   \
+        code_jump(__Code__, 0x74, #lb);
+
+#define jnzxx_lb(lb)               /* setting-flags-arithmetic -> jump */   \
+        code_jump(__Code__, 0x75, #lb);
+
+#define jeqxx_lb(lb)                                /* compare -> jump */   \
+        code_jump(__Code__, 0x74, #lb);
+
+#define jnexx_lb(lb)                                /* compare -> jump */   \
+        code_jump(__Code__, 0x75, #lb);
+
+#define jltxx_lb(lb)                                /* compare -> jump */   \
+        code_jump(__Code__, 0x72, #lb);
+
+#define jlexx_lb(lb)                                /* compare -> jump */   \
+        code_jump(__Code__, 0x76, #lb);
+
+#define jgtxx_lb(lb)                                /* compare -> jump */   \
+        code_jump(__Code__, 0x77, #lb);
+
+#define jgexx_lb(lb)                                /* compare -> jump */   \
+        code_jump(__Code__, 0x73, #lb);
+
+#define jltxn_lb(lb)                                /* compare -> jump */   \
+        code_jump(__Code__, 0x7C, #lb);
+
+#define jlexn_lb(lb)                                /* compare -> jump */   \
+        code_jump(__Code__, 0x7E, #lb);
+
+#define jgtxn_lb(lb)                                /* compare -> jump */   \
+        code_jump(__Code__, 0x7F, #lb);
+
+#define jgexn_lb(lb)                                /* compare -> jump */   \
+        code_jump(__Code__, 0x7D, #lb);
+
+#define LBL(lb)                                          /* code label */   \
+        code_label(__Code__, #lb);
+
+#endif /* RT_RUNTIME */
+
 /************************* register-size instructions *************************/
 
 /* stack (push stack = S, D = pop stack)
@@ -2113,6 +2342,55 @@
         stack_ld(Recx)                                                      \
         stack_ld(Reax)
 
+#define stack_sr(BM) /* save [Reax, Rebp, RegF] and regs in BM mask */      \
+        stack_st(Reax)                                                      \
+        stack_xr(BM, stack_st, Recx)                                        \
+        stack_xr(BM, stack_st, Redx)                                        \
+        stack_xr(BM, stack_st, Rebx)                                        \
+        stack_st(Rebp)                                                      \
+        stack_xr(BM, stack_st, Resi)                                        \
+        stack_xr(BM, stack_st, Redi)                                        \
+        stack_xr(BM, stack_st, Reg8)                                        \
+        stack_xr(BM, stack_st, Reg9)                                        \
+        stack_xr(BM, stack_st, RegA)                                        \
+        stack_xr(BM, stack_st, RegB)                                        \
+        stack_xr(BM, stack_st, RegC)                                        \
+        stack_xr(BM, stack_st, RegD)                                        \
+        stack_xr(BM, stack_st, RegE)                                        \
+        REX(0,             1) EMITB(0xFF)     /* <- save r15 or [RegF] */   \
+        MRM(0x06,       0x03, 0x07)
+
+#define stack_lr(BM) /* load [RegF, Rebp, Reax] and regs in BM mask */      \
+        REX(0,             1) EMITB(0x8F)     /* <- load r15 or [RegF] */   \
+        MRM(0x00,       0x03, 0x07)                                         \
+        stack_xr(BM, stack_ld, RegE)                                        \
+        stack_xr(BM, stack_ld, RegD)                                        \
+        stack_xr(BM, stack_ld, RegC)                                        \
+        stack_xr(BM, stack_ld, RegB)                                        \
+        stack_xr(BM, stack_ld, RegA)                                        \
+        stack_xr(BM, stack_ld, Reg9)                                        \
+        stack_xr(BM, stack_ld, Reg8)                                        \
+        stack_xr(BM, stack_ld, Redi)                                        \
+        stack_xr(BM, stack_ld, Resi)                                        \
+        stack_ld(Rebp)                                                      \
+        stack_xr(BM, stack_ld, Rebx)                                        \
+        stack_xr(BM, stack_ld, Redx)                                        \
+        stack_xr(BM, stack_ld, Recx)                                        \
+        stack_ld(Reax)
+
+#define stack_xr(BM, op, RG) /* internal, applies op if RG is in BM mask */ \
+        ASM_IF((((BM) >> REN(RG)) & 1))                                     \
+        op(W(RG))                                                           \
+        ASM_ENDIF
+
+#define sregs_xr(SM, op, XS, SZ) /* internal, applies op if XS in SM */     \
+        ASM_IF((((SM) >> REN(XS)) & 1))                                     \
+        op(W(XS), Oeax, PLAIN)                                              \
+        ASM_ENDIF                                                           \
+        ASM_IF(((SM) >> (REN(XS) + 1)))    /* advance if more regs in SM */ \
+        addxx_ri(Reax, IB(SZ))                                              \
+        ASM_ENDIF
+
 /******************************************************************************/
 /**************************   extended double (x87)   *************************/
 /******************************************************************************/
@@ -202,6 +202,21 @@
         MRM(REG(XS), MOD(MD), REG(MD))                                      \
         AUX(SIB(MD), CMD(DD), EMPTY)
 
+/* stn (D = S) non-temporal store, bypasses caches on the way to memory
+ * weakly-ordered, place sfnce_xx before [D] is read by other threads */
+
+#define stnix_st(XS, MD, DD)                                                \
+    ADR EVX(RXB(XS), RXB(MD),    0x00, 0, 0, 1) EMITB(0x2B)                 \
+        MRM(REG(XS), MOD(MD), REG(MD))                                      \
+        AUX(SIB(MD), CMD(DD), EMPTY)
+
+/* bcs (D = [M]) broadcast scalar element from memory into all SIMD elements */
+
+#define bcsix_ld(XD, MS, DS)                                                \
+    ADR EVX(RXB(XD), RXB(MS),    0x00, 0, 1, 2) EMITB(0x18)                 \
+        MRM(REG(XD), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
 /* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
  * uses Xmm0 implicitly as a mask register, destroys Xmm0, 0-masked XS elems */
 
@@ -222,6 +237,119 @@
         MRM(REG(XS), MOD(MG), REG(MG))                                      \
         AUX(SIB(MG), CMD(DG), EMPTY)
 
+/* shf (G = G[IS]), (D = S[IT]) shuffle elements within each 128-bit lane
+ * 2-bit fields of the immediate select 32-bit elements in each 128-bit lane */
+
+#define shfix_ri(XG, IS)                                                    \
+        shfix3ri(W(XG), W(XG), W(IS))
+
+#define shfix3ri(XD, XS, IT)                                                \
+        EVX(RXB(XD), RXB(XS),    0x00, 0, 1, 3) EMITB(0x04)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(VAL(IT)))
+
+/* tbl (G = G[S]), (D = S[T]) permute elements across the SIMD register
+ * indices are in elements, taken modulo the number of elements in SIMD */
+
+#define tblix_rr(XG, XS)                                                    \
+        tblix3rr(W(XG), W(XG), W(XS))
+
+#define tblix3rr(XD, XS, XT)                                                \
+        EVX(RXB(XD), RXB(XT), REN(XS), 0, 1, 2) EMITB(0x0C)                 \
+        MRM(REG(XD), MOD(XT), REG(XT))
+
+/* hrd (D = S op S op ..) reduce all elements of S with "op" into each of D
+ * in log2 steps via in-register shuffles, temporary register is preserved */
+
+#define hrdis_rx(XD, XS, XT, op) /* not portable, do not use outside */     \
+        movix_st(W(XT), Mebp, inf_SCR02(0))                                 \
+        shfix3ri(W(XT), W(XS), IB(0x4E))                                    \
+        op(W(XT), W(XS))                                                    \
+        shfix3ri(W(XD), W(XT), IB(0xB1))                                    \
+        op(W(XD), W(XT))                                                    \
+        movix_ld(W(XT), Mebp, inf_SCR02(0))
+
+/* aln (G = [S:G] >> IT) concatenate S and G, shift right by IT elements
+ * keeping the lower half, bc0 (D = S[0]) broadcast element 0 (not portable) */
+
+#define alnix_ri(XG, XS, IT) /* not portable, do not use outside */         \
+        EVX(RXB(XG), RXB(XG), REN(XS), 0, 1, 3) EMITB(0x03)                 \
+        MRM(REG(XG), MOD(XG), REG(XG))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(VAL(IT)))
+
+#define bc0ix_rr(XD, XS) /* not portable, do not use outside */             \
+        EVX(RXB(XD), RXB(XS),    0x00, 0, 1, 2) EMITB(0x58)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))
+
+/* scn (D[i] = S[0] op .. op S[i]) inclusive scan of S with "op" in log2
+ * steps, scz shifts in zeroes (add), scs repeats S[0] (min/max, idempotent),
+ * sce shifts D up by one element (exclusive scan), Xmm0 is used as a temp */
+
+#define sczix_rx(XD, XS, op) /* not portable, do not use outside */         \
+        xorix_rr(Xmm0, Xmm0)                                                \
+        alnix_ri(Xmm0, W(XS), IB(3))                                        \
+        op(Xmm0, W(XS))                                                     \
+        xorix_rr(W(XD), W(XD))                                              \
+        alnix_ri(W(XD), Xmm0, IB(2))                                        \
+        op(W(XD), Xmm0)
+
+#define scsix_rx(XD, XS, op) /* not portable, do not use outside */         \
+        bc0ix_rr(Xmm0, W(XS))                                               \
+        alnix_ri(Xmm0, W(XS), IB(3))                                        \
+        op(Xmm0, W(XS))                                                     \
+        bc0ix_rr(W(XD), Xmm0)                                               \
+        alnix_ri(W(XD), Xmm0, IB(2))                                        \
+        op(W(XD), Xmm0)
+
+#define sceix_rx(XD) /* not portable, do not use outside */                 \
+        xorix_rr(Xmm0, Xmm0)                                                \
+        alnix_ri(Xmm0, W(XD), IB(3))                                        \
+        movix_rr(W(XD), Xmm0)
+
+/* adi (D[i] = S[0] + .. + S[i]) inclusive prefix sum of elements of S
+ * uses Xmm0 implicitly as a temp register, destroys Xmm0, XD/XS != Xmm0 */
+
+#define adiis_rr(XD, XS)                                                    \
+        sczix_rx(W(XD), W(XS), addis_rr)
+
+#define adiix_rr(XD, XS)                                                    \
+        sczix_rx(W(XD), W(XS), addix_rr)
+
+/* ade (D[i] = S[0] + .. + S[i-1]) exclusive prefix sum of S, D[0] = 0
+ * uses Xmm0 implicitly as a temp register, destroys Xmm0, XD/XS != Xmm0 */
+
+#define adeis_rr(XD, XS)                                                    \
+        sczix_rx(W(XD), W(XS), addis_rr)                                    \
+        sceix_rx(W(XD))
+
+#define adeix_rr(XD, XS)                                                    \
+        sczix_rx(W(XD), W(XS), addix_rr)                                    \
+        sceix_rx(W(XD))
+
+/* mni (D[i] = min(S[0], .. , S[i])) inclusive prefix min of elements of S
+ * uses Xmm0 implicitly as a temp register, destroys Xmm0, XD/XS != Xmm0 */
+
+#define mniis_rr(XD, XS)                                                    \
+        scsix_rx(W(XD), W(XS), minis_rr)
+
+#define mniix_rr(XD, XS)                                                    \
+        scsix_rx(W(XD), W(XS), minix_rr)
+
+#define mniin_rr(XD, XS)                                                    \
+        scsix_rx(W(XD), W(XS), minin_rr)
+
+/* mxi (D[i] = max(S[0], .. , S[i])) inclusive prefix max of elements of S
+ * uses Xmm0 implicitly as a temp register, destroys Xmm0, XD/XS != Xmm0 */
+
+#define mxiis_rr(XD, XS)                                                    \
+        scsix_rx(W(XD), W(XS), maxis_rr)
+
+#define mxiix_rr(XD, XS)                                                    \
+        scsix_rx(W(XD), W(XS), maxix_rr)
+
+#define mxiin_rr(XD, XS)                                                    \
+        scsix_rx(W(XD), W(XS), maxin_rr)
+
 /* and (G = G & S), (D = S & T) if (#D != #T) */
 
 #define andix_rr(XG, XS)                                                    \
@@ -346,6 +474,10 @@
         /* adp, adh are defined in rtbase.h (first 15-regs only)
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  adhis_rr
+#define adhis_rr(XD, XS) /* horizontal reductive add, first 15-regs only */ \
+        hrdis_rx(W(XD), W(XS), TmmX(W(XD), W(XS)), addis_rr)
+
 #undef  adpis3rr
 #define adpis3rr(XD, XS, XT)                                                \
         VEX(RXB(XD), RXB(XT), REN(XS), 0, 3, 1) EMITB(0x7C)                 \
@@ -394,6 +526,10 @@
         /* mlp, mlh are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  mlhis_rr
+#define mlhis_rr(XD, XS) /* horizontal reductive mul */                     \
+        hrdis_rx(W(XD), W(XS), TmmX(W(XD), W(XS)), mulis_rr)
+
 /* div (G = G / S), (D = S / T) if (#D != #T) and on ARMv7 if (#D != #S) */
 
 #define divis_rr(XG, XS)                                                    \
@@ -540,6 +676,10 @@
         /* mnp, mnh are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  mnhis_rr
+#define mnhis_rr(XD, XS) /* horizontal reductive min */                     \
+        hrdis_rx(W(XD), W(XS), TmmX(W(XD), W(XS)), minis_rr)
+
 /* max (G = G > S ? G : S), (D = S > T ? S : T) if (#D != #T) */
 
 #define maxis_rr(XG, XS)                                                    \
@@ -560,6 +700,10 @@
         /* mxp, mxh are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  mxhis_rr
+#define mxhis_rr(XD, XS) /* horizontal reductive max */                     \
+        hrdis_rx(W(XD), W(XS), TmmX(W(XD), W(XS)), maxis_rr)
+
 /* ceq (G = G == S ? -1 : 0), (D = S == T ? -1 : 0) if (#D != #T) */
 
 #define ceqis_rr(XG, XS)                                                    \
@@ -1015,6 +1159,38 @@
         MRM(REG(XD), MOD(MT), REG(MT))                                      \
         AUX(SIB(MT), CMD(DT), EMPTY)
 
+/* clz (D = number of leading zeroes in each element of S), 32 if 0 */
+
+#define clzix_rr(XD, XS)                                                    \
+        EVX(RXB(XD), RXB(XS),    0x00, 0, 1, 2) EMITB(0x44)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))
+
+#define clzix_ld(XD, MS, DS)                                                \
+    ADR EVX(RXB(XD), RXB(MS),    0x00, 0, 1, 2) EMITB(0x44)                 \
+        MRM(REG(XD), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+/* shh (D = S[IT]) shuffle 16-bit elements within 64-bit halves (not portable)
+ * 2-bit fields of the immediate select 16-bit elements in each 64-bit half */
+
+#define shhix3ri(XD, XS, IT) /* not portable, do not use outside */         \
+        EVX(RXB(XD), RXB(XS),    0x00, 0, 3, 1) EMITB(0x70)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(VAL(IT)))                               \
+        EVX(RXB(XD), RXB(XD),    0x00, 0, 2, 1) EMITB(0x70)                 \
+        MRM(REG(XD), MOD(XD), REG(XD))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(VAL(IT)))
+
+/* bsw (D = S with the order of bytes reversed in each element) */
+
+#define bswix_rr(XD, XS)                                                    \
+        shhix3ri(W(XD), W(XS), IB(0xB1))                                    \
+        bswgx3rx(W(XD), W(XD), TmmX(W(XD), W(XD)))
+
+#define bswix_ld(XD, MS, DS)                                                \
+        movix_ld(W(XD), W(MS), W(DS))                                       \
+        bswix_rr(W(XD), W(XD))
+
 /****************   packed single-precision integer compare   *****************/
 
 /* min (G = G < S ? G : S), (D = S < T ? S : T) if (#D != #T), unsigned */
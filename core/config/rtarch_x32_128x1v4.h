@@ -188,6 +188,24 @@
         MRM(REG(XS), MOD(MD), REG(MD))                                      \
         AUX(SIB(MD), CMD(DD), EMPTY)
 
+/* stn (D = S) non-temporal store, bypasses caches on the way to memory
+ * weakly-ordered, place sfnce_xx before [D] is read by other threads */
+
+#define stnix_st(XS, MD, DD)                                                \
+    ADR REX(RXB(XS), RXB(MD)) EMITB(0x0F) EMITB(0x2B)                       \
+        MRM(REG(XS), MOD(MD), REG(MD))                                      \
+        AUX(SIB(MD), CMD(DD), EMPTY)
+
+/* bcs (D = [M]) broadcast scalar element from memory into all SIMD elements */
+
+#define bcsix_ld(XD, MS, DS)                                                \
+ADR xF3 REX(RXB(XD), RXB(MS)) EMITB(0x0F) EMITB(0x10)                       \
+        MRM(REG(XD), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)                                        \
+        REX(RXB(XD), RXB(XD)) EMITB(0x0F) EMITB(0xC6)                       \
+        MRM(REG(XD), MOD(XD), REG(XD))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0x00))
+
 /* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
  * uses Xmm0 implicitly as a mask register, destroys Xmm0, 0-masked XS elems */
 
@@ -224,6 +242,101 @@ ADR ESC REX(RXB(XG), RXB(MS)) EMITB(0x0F) EMITB(0x38) EMITB(0x14)           \
         orrix_rr(Xmm0, W(XS))                                               \
         movix_st(Xmm0, W(MG), W(DG))
 
+/* shf (G = G[IS]), (D = S[IT]) shuffle elements within each 128-bit lane
+ * 2-bit fields of the immediate select 32-bit elements in each 128-bit lane */
+
+#define shfix_ri(XG, IS)                                                    \
+        shfix3ri(W(XG), W(XG), W(IS))
+
+#define shfix3ri(XD, XS, IT)                                                \
+    ESC REX(RXB(XD), RXB(XS)) EMITB(0x0F) EMITB(0x70)                       \
+        MRM(REG(XD), MOD(XS), REG(XS))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(VAL(IT)))
+
+/* hrd (D = S op S op ..) reduce all elements of S with "op" into each of D
+ * in log2 steps via in-register shuffles, temporary register is preserved */
+
+#define hrdis_rx(XD, XS, XT, op) /* not portable, do not use outside */     \
+        movix_st(W(XT), Mebp, inf_SCR02(0))                                 \
+        shfix3ri(W(XT), W(XS), IB(0x4E))                                    \
+        op(W(XT), W(XS))                                                    \
+        shfix3ri(W(XD), W(XT), IB(0xB1))                                    \
+        op(W(XD), W(XT))                                                    \
+        movix_ld(W(XT), Mebp, inf_SCR02(0))
+
+/* shb (G = G << IS) shift 128-bit lanes of G left by IS bytes (not portable)
+ * lower IS bytes of each lane are filled with zeroes */
+
+#define shbix_ri(XG, IS) /* not portable, do not use outside */             \
+    ESC REX(0,       RXB(XG)) EMITB(0x0F) EMITB(0x73)                       \
+        MRM(0x07,    MOD(XG), REG(XG))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(VAL(IS)))
+
+/* scn (D[i] = S[0] op .. op S[i]) inclusive scan of S with "op" in log2
+ * steps, scz shifts in zeroes (add), scs repeats S[0] (min/max, idempotent),
+ * sce shifts D up by one element (exclusive scan), Xmm0 is used as a temp */
+
+#define sczix_rx(XD, XS, op) /* not portable, do not use outside */         \
+        movix_rr(Xmm0, W(XS))                                               \
+        shbix_ri(Xmm0, IB(4))                                               \
+        op(Xmm0, W(XS))                                                     \
+        movix_rr(W(XD), Xmm0)                                               \
+        shbix_ri(W(XD), IB(8))                                              \
+        op(W(XD), Xmm0)
+
+#define scsix_rx(XD, XS, op) /* not portable, do not use outside */         \
+        shfix3ri(Xmm0, W(XS), IB(0x90))                                     \
+        op(Xmm0, W(XS))                                                     \
+        shfix3ri(W(XD), Xmm0, IB(0x44))                                     \
+        op(W(XD), Xmm0)
+
+#define sceix_rx(XD) /* not portable, do not use outside */                 \
+        shbix_ri(W(XD), IB(4))
+
+/* adi (D[i] = S[0] + .. + S[i]) inclusive prefix sum of elements of S
+ * uses Xmm0 implicitly as a temp register, destroys Xmm0, XD/XS != Xmm0 */
+
+#define adiis_rr(XD, XS)                                                    \
+        sczix_rx(W(XD), W(XS), addis_rr)
+
+#define adiix_rr(XD, XS)                                                    \
+        sczix_rx(W(XD), W(XS), addix_rr)
+
+/* ade (D[i] = S[0] + .. + S[i-1]) exclusive prefix sum of S, D[0] = 0
+ * uses Xmm0 implicitly as a temp register, destroys Xmm0, XD/XS != Xmm0 */
+
+#define adeis_rr(XD, XS)                                                    \
+        sczix_rx(W(XD), W(XS), addis_rr)                                    \
+        sceix_rx(W(XD))
+
+#define adeix_rr(XD, XS)                                                    \
+        sczix_rx(W(XD), W(XS), addix_rr)                                    \
+        sceix_rx(W(XD))
+
+/* mni (D[i] = min(S[0], .. , S[i])) inclusive prefix min of elements of S
+ * uses Xmm0 implicitly as a temp register, destroys Xmm0, XD/XS != Xmm0 */
+
+#define mniis_rr(XD, XS)                                                    \
+        scsix_rx(W(XD), W(XS), minis_rr)
+
+#define mniix_rr(XD, XS)                                                    \
+        scsix_rx(W(XD), W(XS), minix_rr)
+
+#define mniin_rr(XD, XS)                                                    \
+        scsix_rx(W(XD), W(XS), minin_rr)
+
+/* mxi (D[i] = max(S[0], .. , S[i])) inclusive prefix max of elements of S
+ * uses Xmm0 implicitly as a temp register, destroys Xmm0, XD/XS != Xmm0 */
+
+#define mxiis_rr(XD, XS)                                                    \
+        scsix_rx(W(XD), W(XS), maxis_rr)
+
+#define mxiix_rr(XD, XS)                                                    \
+        scsix_rx(W(XD), W(XS), maxix_rr)
+
+#define mxiin_rr(XD, XS)                                                    \
+        scsix_rx(W(XD), W(XS), maxin_rr)
+
 /* and (G = G & S), (D = S & T) if (#D != #T) */
 
 #define andix_rr(XG, XS)                                                    \
@@ -360,6 +473,10 @@ ADR ESC REX(RXB(XG), RXB(MS)) EMITB(0x0F) EMITB(0x38) EMITB(0x14)           \
         /* adp, adh are defined in rtbase.h (first 15-regs only)
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  adhis_rr
+#define adhis_rr(XD, XS) /* horizontal reductive add, first 15-regs only */ \
+        hrdis_rx(W(XD), W(XS), TmmX(W(XD), W(XS)), addis_rr)
+
 #if (RT_SIMD_COMPAT_SSE >= 4)
 
 #undef  adpis_rr
@@ -426,6 +543,10 @@ ADR xF2 REX(RXB(XG), RXB(MS)) EMITB(0x0F) EMITB(0x7C)                       \
         /* mlp, mlh are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  mlhis_rr
+#define mlhis_rr(XD, XS) /* horizontal reductive mul */                     \
+        hrdis_rx(W(XD), W(XS), TmmX(W(XD), W(XS)), mulis_rr)
+
 /* div (G = G / S), (D = S / T) if (#D != #T) and on ARMv7 if (#D != #S) */
 
 #define divis_rr(XG, XS)                                                    \
@@ -706,6 +827,10 @@ ADR xF2 REX(RXB(XG), RXB(MS)) EMITB(0x0F) EMITB(0x7C)                       \
         /* mnp, mnh are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  mnhis_rr
+#define mnhis_rr(XD, XS) /* horizontal reductive min */                     \
+        hrdis_rx(W(XD), W(XS), TmmX(W(XD), W(XS)), minis_rr)
+
 /* max (G = G > S ? G : S), (D = S > T ? S : T) if (#D != #T) */
 
 #define maxis_rr(XG, XS)                                                    \
@@ -728,6 +853,10 @@ ADR xF2 REX(RXB(XG), RXB(MS)) EMITB(0x0F) EMITB(0x7C)                       \
         /* mxp, mxh are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  mxhis_rr
+#define mxhis_rr(XD, XS) /* horizontal reductive max */                     \
+        hrdis_rx(W(XD), W(XS), TmmX(W(XD), W(XS)), maxis_rr)
+
 /* ceq (G = G == S ? -1 : 0), (D = S == T ? -1 : 0) if (#D != #T) */
 
 #define ceqis_rr(XG, XS)                                                    \
@@ -1221,6 +1350,117 @@ ADR ESC REX(RXB(XG), RXB(MS)) EMITB(0x0F) EMITB(0x38) EMITB(0x40)           \
 
 #endif /* RT_SIMD_COMPAT_SSE >= 4 */
 
+/* muh (G = G * S), keeps upper half of the full-width product of elements
+ * unsigned-[x] or signed-[n], lower half is returned by mul
+ * odd and even elements are multiplied into 64-bit products separately,
+ * then upper halves of both are gathered back into 32-bit elements */
+
+#define muhix_rr(XG, XS)                                                    \
+        movix_st(W(XG), Mebp, inf_SCR01(0))                                 \
+        shfix3ri(W(XG), W(XG), IB(0xF5))                                    \
+        movix_st(W(XG), Mebp, inf_SCR02(0))                                 \
+        shfix3ri(W(XG), W(XS), IB(0xF5))                                    \
+        mueix_ld(W(XG), Mebp, inf_SCR02(0))                                 \
+        movix_st(W(XG), Mebp, inf_SCR02(0))                                 \
+        movix_ld(W(XG), Mebp, inf_SCR01(0))                                 \
+        mueix_rr(W(XG), W(XS))                                              \
+        muhix_rx(W(XG), Mebp, inf_SCR02(0))
+
+#define muhix_ld(XG, MS, DS)                                                \
+        movix_st(W(XG), Mebp, inf_SCR01(0))                                 \
+        shfix3ri(W(XG), W(XG), IB(0xF5))                                    \
+        movix_st(W(XG), Mebp, inf_SCR02(0))                                 \
+        movix_ld(W(XG), W(MS), W(DS))                                       \
+        shfix3ri(W(XG), W(XG), IB(0xF5))                                    \
+        mueix_ld(W(XG), Mebp, inf_SCR02(0))                                 \
+        movix_st(W(XG), Mebp, inf_SCR02(0))                                 \
+        movix_ld(W(XG), Mebp, inf_SCR01(0))                                 \
+        mueix_ld(W(XG), W(MS), W(DS))                                       \
+        muhix_rx(W(XG), Mebp, inf_SCR02(0))
+
+#define muhix_rx(XG, MS, DS) /* not portable, do not use outside */         \
+ADR REX(RXB(XG), RXB(MS)) EMITB(0x0F) EMITB(0xC6)                           \
+        MRM(REG(XG), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMITB(0xDD))                                  \
+        shfix3ri(W(XG), W(XG), IB(0xD8))
+
+#define mueix_rr(XG, XS) /* not portable, do not use outside */             \
+    ESC REX(RXB(XG), RXB(XS)) EMITB(0x0F) EMITB(0xF4)                       \
+        MRM(REG(XG), MOD(XS), REG(XS))
+
+#define mueix_ld(XG, MS, DS) /* not portable, do not use outside */         \
+ADR ESC REX(RXB(XG), RXB(MS)) EMITB(0x0F) EMITB(0xF4)                       \
+        MRM(REG(XG), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#if (RT_SIMD_COMPAT_SSE < 4)
+
+#define muhin_rr(XG, XS)                                                    \
+        movix_st(W(XG), Mebp, inf_SCR01(0))                                 \
+        movix_st(W(XS), Mebp, inf_SCR02(0))                                 \
+        muhin_rx(W(XG))
+
+#define muhin_ld(XG, MS, DS)                                                \
+        movix_st(W(XG), Mebp, inf_SCR01(0))                                 \
+        movix_ld(W(XG), W(MS), W(DS))                                       \
+        movix_st(W(XG), Mebp, inf_SCR02(0))                                 \
+        muhin_rx(W(XG))
+
+#define muhin_rx(XD) /* not portable, do not use outside */                 \
+        stack_st(Reax)                                                      \
+        stack_st(Redx)                                                      \
+        movwx_ld(Reax,  Mebp, inf_SCR01(0x00))                              \
+        mulwn_xm(Mebp,  inf_SCR02(0x00))                                    \
+        movwx_st(Redx,  Mebp, inf_SCR01(0x00))                              \
+        movwx_ld(Reax,  Mebp, inf_SCR01(0x04))                              \
+        mulwn_xm(Mebp,  inf_SCR02(0x04))                                    \
+        movwx_st(Redx,  Mebp, inf_SCR01(0x04))                              \
+        movwx_ld(Reax,  Mebp, inf_SCR01(0x08))                              \
+        mulwn_xm(Mebp,  inf_SCR02(0x08))                                    \
+        movwx_st(Redx,  Mebp, inf_SCR01(0x08))                              \
+        movwx_ld(Reax,  Mebp, inf_SCR01(0x0C))                              \
+        mulwn_xm(Mebp,  inf_SCR02(0x0C))                                    \
+        movwx_st(Redx,  Mebp, inf_SCR01(0x0C))                              \
+        stack_ld(Redx)                                                      \
+        stack_ld(Reax)                                                      \
+        movix_ld(W(XD), Mebp, inf_SCR01(0))
+
+#else /* RT_SIMD_COMPAT_SSE >= 4 */
+
+#define muhin_rr(XG, XS)                                                    \
+        movix_st(W(XG), Mebp, inf_SCR01(0))                                 \
+        shfix3ri(W(XG), W(XG), IB(0xF5))                                    \
+        movix_st(W(XG), Mebp, inf_SCR02(0))                                 \
+        shfix3ri(W(XG), W(XS), IB(0xF5))                                    \
+        muein_ld(W(XG), Mebp, inf_SCR02(0))                                 \
+        movix_st(W(XG), Mebp, inf_SCR02(0))                                 \
+        movix_ld(W(XG), Mebp, inf_SCR01(0))                                 \
+        muein_rr(W(XG), W(XS))                                              \
+        muhix_rx(W(XG), Mebp, inf_SCR02(0))
+
+#define muhin_ld(XG, MS, DS)                                                \
+        movix_st(W(XG), Mebp, inf_SCR01(0))                                 \
+        shfix3ri(W(XG), W(XG), IB(0xF5))                                    \
+        movix_st(W(XG), Mebp, inf_SCR02(0))                                 \
+        movix_ld(W(XG), W(MS), W(DS))                                       \
+        shfix3ri(W(XG), W(XG), IB(0xF5))                                    \
+        muein_ld(W(XG), Mebp, inf_SCR02(0))                                 \
+        movix_st(W(XG), Mebp, inf_SCR02(0))                                 \
+        movix_ld(W(XG), Mebp, inf_SCR01(0))                                 \
+        muein_ld(W(XG), W(MS), W(DS))                                       \
+        muhix_rx(W(XG), Mebp, inf_SCR02(0))
+
+#define muein_rr(XG, XS) /* not portable, do not use outside */             \
+    ESC REX(RXB(XG), RXB(XS)) EMITB(0x0F) EMITB(0x38) EMITB(0x28)           \
+        MRM(REG(XG), MOD(XS), REG(XS))
+
+#define muein_ld(XG, MS, DS) /* not portable, do not use outside */         \
+ADR ESC REX(RXB(XG), RXB(MS)) EMITB(0x0F) EMITB(0x38) EMITB(0x28)           \
+        MRM(REG(XG), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#endif /* RT_SIMD_COMPAT_SSE >= 4 */
+
 /* shl (G = G << S), (D = S << T) if (#D != #T) - plain, unsigned
  * for maximum compatibility: shift count must be modulo elem-size */
 
@@ -1383,6 +1623,27 @@ ADR ESC REX(RXB(XG), RXB(MS)) EMITB(0x0F) EMITB(0xE2)                       \
         stack_ld(Recx)                                                      \
         movix_ld(W(XD), Mebp, inf_SCR01(0))
 
+/* shh (D = S[IT]) shuffle 16-bit elements within 64-bit halves (not portable)
+ * 2-bit fields of the immediate select 16-bit elements in each 64-bit half */
+
+#define shhix3ri(XD, XS, IT) /* not portable, do not use outside */         \
+    xF2 REX(RXB(XD), RXB(XS)) EMITB(0x0F) EMITB(0x70)                       \
+        MRM(REG(XD), MOD(XS), REG(XS))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(VAL(IT)))                               \
+    xF3 REX(RXB(XD), RXB(XD)) EMITB(0x0F) EMITB(0x70)                       \
+        MRM(REG(XD), MOD(XD), REG(XD))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(VAL(IT)))
+
+/* bsw (D = S with the order of bytes reversed in each element) */
+
+#define bswix_rr(XD, XS)                                                    \
+        shhix3ri(W(XD), W(XS), IB(0xB1))                                    \
+        bswgx3rx(W(XD), W(XD), TmmX(W(XD), W(XD)))
+
+#define bswix_ld(XD, MS, DS)                                                \
+        movix_ld(W(XD), W(MS), W(DS))                                       \
+        bswix_rr(W(XD), W(XD))
+
 /****************   packed single-precision integer compare   *****************/
 
 #if (RT_SIMD_COMPAT_SSE < 4)
@@ -171,6 +171,17 @@
         MRM(REG(XS),    0x02, REG(MD))                                      \
         AUX(SIB(MD), EMITW(VYL(DD)), EMPTY)
 
+/* stn (D = S) non-temporal store, bypasses caches on the way to memory
+ * weakly-ordered, place sfnce_xx before [D] is read by other threads */
+
+#define stncx_st(XS, MD, DD)                                                \
+    ADR REX(0,       RXB(MD)) EMITB(0x0F) EMITB(0x2B)                       \
+        MRM(REG(XS),    0x02, REG(MD))                                      \
+        AUX(SIB(MD), EMITW(VAL(DD)), EMPTY)                                 \
+    ADR REX(1,       RXB(MD)) EMITB(0x0F) EMITB(0x2B)                       \
+        MRM(REG(XS),    0x02, REG(MD))                                      \
+        AUX(SIB(MD), EMITW(VYL(DD)), EMPTY)
+
 /* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
  * uses Xmm0 implicitly as a mask register, destroys Xmm0, 0-masked XS elems */
 
@@ -2290,6 +2301,30 @@ ADR ESC REX(1,       RXB(MS)) EMITB(0x0F) EMITB(0x66)                       \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
         movcx_ld(Xmm7, Oeax, PLAIN)
 
+#undef  sregs_sr
+#define sregs_sr(SM) /* save SIMD regs in SM mask, destroys Reax */         \
+        movxx_ld(Reax, Mebp, inf_REGS)                                      \
+        sregs_xr(SM, movcx_st, Xmm0, RT_SIMD_WIDTH32_256*4)                 \
+        sregs_xr(SM, movcx_st, Xmm1, RT_SIMD_WIDTH32_256*4)                 \
+        sregs_xr(SM, movcx_st, Xmm2, RT_SIMD_WIDTH32_256*4)                 \
+        sregs_xr(SM, movcx_st, Xmm3, RT_SIMD_WIDTH32_256*4)                 \
+        sregs_xr(SM, movcx_st, Xmm4, RT_SIMD_WIDTH32_256*4)                 \
+        sregs_xr(SM, movcx_st, Xmm5, RT_SIMD_WIDTH32_256*4)                 \
+        sregs_xr(SM, movcx_st, Xmm6, RT_SIMD_WIDTH32_256*4)                 \
+        sregs_xr(SM, movcx_st, Xmm7, RT_SIMD_WIDTH32_256*4)
+
+#undef  sregs_lr
+#define sregs_lr(SM) /* load SIMD regs in SM mask, destroys Reax */         \
+        movxx_ld(Reax, Mebp, inf_REGS)                                      \
+        sregs_xr(SM, movcx_ld, Xmm0, RT_SIMD_WIDTH32_256*4)                 \
+        sregs_xr(SM, movcx_ld, Xmm1, RT_SIMD_WIDTH32_256*4)                 \
+        sregs_xr(SM, movcx_ld, Xmm2, RT_SIMD_WIDTH32_256*4)                 \
+        sregs_xr(SM, movcx_ld, Xmm3, RT_SIMD_WIDTH32_256*4)                 \
+        sregs_xr(SM, movcx_ld, Xmm4, RT_SIMD_WIDTH32_256*4)                 \
+        sregs_xr(SM, movcx_ld, Xmm5, RT_SIMD_WIDTH32_256*4)                 \
+        sregs_xr(SM, movcx_ld, Xmm6, RT_SIMD_WIDTH32_256*4)                 \
+        sregs_xr(SM, movcx_ld, Xmm7, RT_SIMD_WIDTH32_256*4)
+
 #endif /* RT_128X2 */
 
 #endif /* RT_SIMD_CODE */
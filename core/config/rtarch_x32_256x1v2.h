@@ -163,6 +163,21 @@
         MRM(REG(XS), MOD(MD), REG(MD))                                      \
         AUX(SIB(MD), CMD(DD), EMPTY)
 
+/* stn (D = S) non-temporal store, bypasses caches on the way to memory
+ * weakly-ordered, place sfnce_xx before [D] is read by other threads */
+
+#define stncx_st(XS, MD, DD)                                                \
+    ADR VEX(RXB(XS), RXB(MD),    0x00, 1, 0, 1) EMITB(0x2B)                 \
+        MRM(REG(XS), MOD(MD), REG(MD))                                      \
+        AUX(SIB(MD), CMD(DD), EMPTY)
+
+/* bcs (D = [M]) broadcast scalar element from memory into all SIMD elements */
+
+#define bcscx_ld(XD, MS, DS)                                                \
+    ADR VEX(RXB(XD), RXB(MS),    0x00, 1, 1, 2) EMITB(0x18)                 \
+        MRM(REG(XD), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
 /* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
  * uses Xmm0 implicitly as a mask register, destroys Xmm0, 0-masked XS elems */
 
@@ -181,6 +196,223 @@
         MRM(REG(XS), MOD(MG), REG(MG))                                      \
         AUX(SIB(MG), CMD(DG), EMPTY)
 
+/* mtl (D = S) move the first RS lanes only (loop tails), 0 <= RS <= 8 here
+ * load zeroes the remaining lanes of XD, store keeps memory past RS lanes,
+ * uses Xmm0 implicitly as a temp mask register, destroys Xmm0, XD/XS != Xmm0 */
+
+#define mtlcx_ld(XD, RS, MS, DS)                                            \
+        mtlcx_xm(W(RS), Kebp, 8)                                            \
+    ADR VEX(RXB(XD), RXB(MS),    0x00, 1, 1, 2) EMITB(0x2C)                 \
+        MRM(REG(XD), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#define mtlcx_st(XS, RS, MD, DD)                                            \
+        mtlcx_xm(W(RS), Kebp, 8)                                            \
+    ADR VEX(RXB(XS), RXB(MD),    0x00, 1, 1, 2) EMITB(0x2E)                 \
+        MRM(REG(XS), MOD(MD), REG(MD))                                      \
+        AUX(SIB(MD), CMD(DD), EMPTY)
+
+/* loads Xmm0 mask from a sliding window of ones/zeros below inf_SCR02,
+ * MX selects element size via the index scale (Kebp or Lebp), NX - lanes */
+
+#define mtlcx_xm(RS, MX, NX) /* not portable, do not use outside */         \
+        movcx_ld(Xmm0, Mebp, inf_GPC07)                                     \
+        movcx_st(Xmm0, Mebp, inf_SCR01(Q*0x10-0x20))                        \
+        xorcx_rr(Xmm0, Xmm0)                                                \
+        movcx_st(Xmm0, Mebp, inf_SCR02(0))                                  \
+        stack_st(Reax)                                                      \
+        movxx_rr(Reax, W(RS))                                               \
+        negxx_rx(Reax)                                                      \
+        addxx_ri(Reax, IB(NX))                                              \
+        mtlcx_mx(Xmm0, W(MX), inf_SCR01(Q*0x10-0x20))                       \
+        stack_ld(Reax)
+
+#define mtlcx_mx(XD, MS, DS) /* not portable, do not use outside */         \
+    ADR VEX(RXB(XD), RXB(MS),    0x00, 1, 0, 1) EMITB(0x10)                 \
+        MRM(REG(XD), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#if (RT_256X1 >= 2)
+
+/* gat (D = [M + S]) gather elements at per-lane indices S from M/DS,
+ * indices are in elements within [0, 2^31) (VSIB sign-extends 32-bit ones),
+ * M*** or Oeax, but not indexed modes (I***, ...), XD/XS differ,
+ * uses XmmF as a temp mask register outside of 15-regs compat set,
+ * otherwise one of Xmm0/Xmm1/Xmm2 (other than XD/XS) preserved via SCR02 */
+
+#if (RT_SIMD_COMPAT_XMM > 0)
+
+#define gatcx_ld(XD, XS, MS, DS)                                            \
+        ceqcx_rr(XmmF, XmmF)                                                \
+        gatcx_xx(W(XD), W(XS), W(MS), W(DS), XmmF)
+
+#else  /* RT_SIMD_COMPAT_XMM == 0 */
+
+#define gatcx_ld(XD, XS, MS, DS)                                            \
+        movcx_st(gatcx_xm(W(XD), W(XS)), Mebp, inf_SCR02(0))                \
+        ceqcx_rr(gatcx_xm(W(XD), W(XS)), gatcx_xm(W(XD), W(XS)))            \
+        gatcx_xx(W(XD), W(XS), W(MS), W(DS), gatcx_xm(W(XD), W(XS)))        \
+        movcx_ld(gatcx_xm(W(XD), W(XS)), Mebp, inf_SCR02(0))
+
+#endif /* RT_SIMD_COMPAT_XMM == 0 */
+
+#define gatcx_xx(XD, XS, MS, DS, XM) /* not portable, do not use outside */ \
+    ADR VSX(RXB(XD), RXB(XS), RXB(MS), REN(XM), 1, 1, 2) EMITB(0x92)        \
+        MRM(REG(XD), MOD(MS),    0x04)                                      \
+        AUX(EMITB(0x80 | REG(XS) << 3 | REG(MS)), CMD(DS), EMPTY)
+
+/* selects the lowest of Xmm0/Xmm1/Xmm2 distinct from both XD and XS,
+ * via register bitmask (no conditional operator in assembler expressions) */
+
+#define gatcx_xm(XD, XS) /* not portable, do not use outside */             \
+        ((((1 << REN(XD)) | (1 << REN(XS))) & 1) +                          \
+         (((1 << REN(XD)) | (1 << REN(XS))) &                               \
+          ((1 << REN(XD)) | (1 << REN(XS))) >> 1 & 1)), 0x03, EMPTY
+
+#endif /* RT_256X1 >= 2, AVX2 */
+
+/* shf (G = G[IS]), (D = S[IT]) shuffle elements within each 128-bit lane
+ * 2-bit fields of the immediate select 32-bit elements in each 128-bit lane */
+
+#define shfcx_ri(XG, IS)                                                    \
+        shfcx3ri(W(XG), W(XG), W(IS))
+
+#define shfcx3ri(XD, XS, IT)                                                \
+        VEX(RXB(XD), RXB(XS),    0x00, 1, 1, 3) EMITB(0x04)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(VAL(IT)))
+
+/* sw2 (D = S[1, 0]) swap 128-bit halves of S (not portable) */
+
+#define sw2cx_rr(XD, XS) /* not portable, do not use outside */             \
+        VEX(RXB(XD), RXB(XS), REN(XS), 1, 1, 3) EMITB(0x06)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0x01))
+
+/* hrd (D = S op S op ..) reduce all elements of S with "op" into each of D
+ * in log2 steps via in-register shuffles, temporary register is preserved */
+
+#define hrdcs_rx(XD, XS, XT, op) /* not portable, do not use outside */     \
+        movcx_st(W(XT), Mebp, inf_SCR02(0))                                 \
+        sw2cx_rr(W(XT), W(XS))                                              \
+        op(W(XT), W(XS))                                                    \
+        shfcx3ri(W(XD), W(XT), IB(0x4E))                                    \
+        op(W(XD), W(XT))                                                    \
+        shfcx3ri(W(XT), W(XD), IB(0xB1))                                    \
+        op(W(XD), W(XT))                                                    \
+        movcx_ld(W(XT), Mebp, inf_SCR02(0))
+
+#if (RT_256X1 >= 2)
+
+/* shb (G = G << IS) shift 128-bit lanes of G left by IS bytes (not portable)
+ * lower IS bytes of each lane are filled with zeroes */
+
+#define shbcx_ri(XG, IS) /* not portable, do not use outside */             \
+        VEX(0,       RXB(XG), REN(XG), 1, 1, 1) EMITB(0x73)                 \
+        MRM(0x07,    MOD(XG), REG(XG))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(VAL(IS)))
+
+/* pr2 (G = [S, G][IT]) select 128-bit lanes of S and G into G (not portable)
+ * 4-bit fields of the immediate pick lanes (S: 0, 1, G: 2, 3, zero: 8) */
+
+#define pr2cx_ri(XG, XS, IT) /* not portable, do not use outside */         \
+        VEX(RXB(XG), RXB(XG), REN(XS), 1, 1, 3) EMITB(0x06)                 \
+        MRM(REG(XG), MOD(XG), REG(XG))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(VAL(IT)))
+
+/* alb (G = [S:G] >> IT) concatenate 128-bit lanes of S and G (not portable)
+ * and shift each right by IT bytes keeping the lower 128-bit lane halves */
+
+#define albcx_ri(XG, XS, IT) /* not portable, do not use outside */         \
+        VEX(RXB(XG), RXB(XG), REN(XS), 1, 1, 3) EMITB(0x0F)                 \
+        MRM(REG(XG), MOD(XG), REG(XG))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(VAL(IT)))
+
+/* scn (D[i] = S[0] op .. op S[i]) inclusive scan of S with "op" in log2
+ * steps, scz shifts in zeroes (add), scs repeats S[0] (min/max, idempotent),
+ * sce shifts D up by one element (exclusive scan), Xmm0 is used as a temp */
+
+#define sczcx_rx(XD, XS, op) /* not portable, do not use outside */         \
+        movcx_rr(Xmm0, W(XS))                                               \
+        shbcx_ri(Xmm0, IB(4))                                               \
+        op(Xmm0, W(XS))                                                     \
+        movcx_rr(W(XD), Xmm0)                                               \
+        shbcx_ri(W(XD), IB(8))                                              \
+        op(W(XD), Xmm0)                                                     \
+        shfcx3ri(Xmm0, W(XD), IB(0xFF))                                     \
+        pr2cx_ri(Xmm0, W(XD), IB(0x28))                                     \
+        op(W(XD), Xmm0)
+
+#define scscx_rx(XD, XS, op) /* not portable, do not use outside */         \
+        shfcx3ri(Xmm0, W(XS), IB(0x90))                                     \
+        op(Xmm0, W(XS))                                                     \
+        shfcx3ri(W(XD), Xmm0, IB(0x44))                                     \
+        op(W(XD), Xmm0)                                                     \
+        shfcx3ri(Xmm0, W(XD), IB(0xFF))                                     \
+        pr2cx_ri(Xmm0, W(XD), IB(0x20))                                     \
+        op(W(XD), Xmm0)
+
+#define scecx_rx(XD) /* not portable, do not use outside */                 \
+        pr2cx_ri(Xmm0, W(XD), IB(0x08))                                     \
+        albcx_ri(Xmm0, W(XD), IB(12))                                       \
+        movcx_rr(W(XD), Xmm0)
+
+/* adi (D[i] = S[0] + .. + S[i]) inclusive prefix sum of elements of S
+ * uses Xmm0 implicitly as a temp register, destroys Xmm0, XD/XS != Xmm0 */
+
+#define adics_rr(XD, XS)                                                    \
+        sczcx_rx(W(XD), W(XS), addcs_rr)
+
+#define adicx_rr(XD, XS)                                                    \
+        sczcx_rx(W(XD), W(XS), addcx_rr)
+
+/* ade (D[i] = S[0] + .. + S[i-1]) exclusive prefix sum of S, D[0] = 0
+ * uses Xmm0 implicitly as a temp register, destroys Xmm0, XD/XS != Xmm0 */
+
+#define adecs_rr(XD, XS)                                                    \
+        sczcx_rx(W(XD), W(XS), addcs_rr)                                    \
+        scecx_rx(W(XD))
+
+#define adecx_rr(XD, XS)                                                    \
+        sczcx_rx(W(XD), W(XS), addcx_rr)                                    \
+        scecx_rx(W(XD))
+
+/* mni (D[i] = min(S[0], .. , S[i])) inclusive prefix min of elements of S
+ * uses Xmm0 implicitly as a temp register, destroys Xmm0, XD/XS != Xmm0 */
+
+#define mnics_rr(XD, XS)                                                    \
+        scscx_rx(W(XD), W(XS), mincs_rr)
+
+#define mnicx_rr(XD, XS)                                                    \
+        scscx_rx(W(XD), W(XS), mincx_rr)
+
+#define mnicn_rr(XD, XS)                                                    \
+        scscx_rx(W(XD), W(XS), mincn_rr)
+
+/* mxi (D[i] = max(S[0], .. , S[i])) inclusive prefix max of elements of S
+ * uses Xmm0 implicitly as a temp register, destroys Xmm0, XD/XS != Xmm0 */
+
+#define mxics_rr(XD, XS)                                                    \
+        scscx_rx(W(XD), W(XS), maxcs_rr)
+
+#define mxicx_rr(XD, XS)                                                    \
+        scscx_rx(W(XD), W(XS), maxcx_rr)
+
+#define mxicn_rr(XD, XS)                                                    \
+        scscx_rx(W(XD), W(XS), maxcn_rr)
+
+/* tbl (G = G[S]), (D = S[T]) permute elements across the SIMD register
+ * indices are in elements, taken modulo the number of elements in SIMD */
+
+#define tblcx_rr(XG, XS)                                                    \
+        tblcx3rr(W(XG), W(XG), W(XS))
+
+#define tblcx3rr(XD, XS, XT)                                                \
+        VEX(RXB(XD), RXB(XS), REN(XT), 1, 1, 2) EMITB(0x16)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))
+
+#endif /* RT_256X1 >= 2, AVX2 */
+
 /* and (G = G & S), (D = S & T) if (#D != #T) */
 
 #define andcx_rr(XG, XS)                                                    \
@@ -305,6 +537,10 @@
         /* adp, adh are defined in rtbase.h (first 15-regs only)
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  adhcs_rr
+#define adhcs_rr(XD, XS) /* horizontal reductive add, first 15-regs only */ \
+        hrdcs_rx(W(XD), W(XS), TmmX(W(XD), W(XS)), addcs_rr)
+
 /* sub (G = G - S), (D = S - T) if (#D != #T) */
 
 #define subcs_rr(XG, XS)                                                    \
@@ -342,6 +578,10 @@
         /* mlp, mlh are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  mlhcs_rr
+#define mlhcs_rr(XD, XS) /* horizontal reductive mul */                     \
+        hrdcs_rx(W(XD), W(XS), TmmX(W(XD), W(XS)), mulcs_rr)
+
 /* div (G = G / S), (D = S / T) if (#D != #T) and on ARMv7 if (#D != #S) */
 
 #define divcs_rr(XG, XS)                                                    \
@@ -423,19 +663,6 @@
         MRM(REG(XD), MOD(XS), REG(XS))                                      \
         AUX(EMPTY,   EMPTY,   EMITB(VAL(IT)))
 
-#define cvycs_rr(XD, XS)     /* not portable, do not use outside */         \
-        VEX(RXB(XD), RXB(XS),    0x00, 1, 0, 1) EMITB(0x5A)                 \
-        MRM(REG(XD), MOD(XS), REG(XS))
-
-#define cvycs_ld(XD, MS, DS) /* not portable, do not use outside */         \
-    ADR VEX(RXB(XD), RXB(MS),    0x00, 1, 0, 1) EMITB(0x5A)                 \
-        MRM(REG(XD), MOD(MS), REG(MS))                                      \
-        AUX(SIB(MS), EMITW(VAL(DS)), EMPTY)
-
-#define cvxds_rr(XD, XS)     /* not portable, do not use outside */         \
-        VEX(RXB(XD), RXB(XS),    0x00, 1, 1, 1) EMITB(0x5A)                 \
-        MRM(REG(XD), MOD(XS), REG(XS))
-
 #if RT_SIMD_COMPAT_FMA == 0
 
 /* fma (G = G + S * T) if (#G != #S && #G != #T)
@@ -634,6 +861,10 @@
         /* mnp, mnh are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  mnhcs_rr
+#define mnhcs_rr(XD, XS) /* horizontal reductive min */                     \
+        hrdcs_rx(W(XD), W(XS), TmmX(W(XD), W(XS)), mincs_rr)
+
 /* max (G = G > S ? G : S), (D = S > T ? S : T) if (#D != #T) */
 
 #define maxcs_rr(XG, XS)                                                    \
@@ -654,6 +885,10 @@
         /* mxp, mxh are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  mxhcs_rr
+#define mxhcs_rr(XD, XS) /* horizontal reductive max */                     \
+        hrdcs_rx(W(XD), W(XS), TmmX(W(XD), W(XS)), maxcs_rr)
+
 /* ceq (G = G == S ? -1 : 0), (D = S == T ? -1 : 0) if (#D != #T) */
 
 #define ceqcs_rr(XG, XS)                                                    \
@@ -929,6 +1164,34 @@
         rnrcs_rr(W(XD), W(XS), mode)                                        \
         cvzcs_rr(W(XD), W(XD))
 
+/* cvy (D = fp16-to-fp32 S), widens lower half of fp16 elements in S
+ * cvx (D = fp32-to-fp16 S), narrows to lower half of D, upper half is 0
+ * narrowing rounds to nearest-even, _ld/_st access the lower half only
+ * fp16 conversion instructions (F16C) are assumed present with AVX2 */
+
+#if (RT_256X1 >= 2)
+
+#define cvyas_rr(XD, XS)                                                    \
+        VEX(RXB(XD), RXB(XS),    0x00, 1, 1, 2) EMITB(0x13)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))
+
+#define cvyas_ld(XD, MS, DS)                                                \
+    ADR VEX(RXB(XD), RXB(MS),    0x00, 1, 1, 2) EMITB(0x13)                 \
+        MRM(REG(XD), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#define cvxcs_rr(XD, XS)                                                    \
+        VEX(RXB(XS), RXB(XD),    0x00, 1, 1, 3) EMITB(0x1D)                 \
+        MRM(REG(XS), MOD(XD), REG(XD))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0x00))
+
+#define cvxcs_st(XS, MD, DD)                                                \
+    ADR VEX(RXB(XS), RXB(MD),    0x00, 1, 1, 3) EMITB(0x1D)                 \
+        MRM(REG(XS), MOD(MD), REG(MD))                                      \
+        AUX(SIB(MD), CMD(DD), EMITB(0x00))
+
+#endif /* RT_256X1 >= 2, AVX2 */
+
 /************   packed single-precision integer arithmetic/shifts   ***********/
 
 #if (RT_256X1 < 2)
@@ -1274,6 +1537,81 @@
         MRM(REG(XD), MOD(MT), REG(MT))                                      \
         AUX(SIB(MT), CMD(DT), EMPTY)
 
+/* muh (G = G * S), keeps upper half of the full-width product of elements
+ * unsigned-[x] or signed-[n], lower half is returned by mul
+ * odd and even elements are multiplied into 64-bit products separately,
+ * then upper halves of both are gathered back into 32-bit elements */
+
+#define muhcx_rr(XG, XS)                                                    \
+        movcx_st(W(XG), Mebp, inf_SCR01(0))                                 \
+        shfcx3ri(W(XG), W(XG), IB(0xF5))                                    \
+        movcx_st(W(XG), Mebp, inf_SCR02(0))                                 \
+        shfcx3ri(W(XG), W(XS), IB(0xF5))                                    \
+        muecx_ld(W(XG), Mebp, inf_SCR02(0))                                 \
+        movcx_st(W(XG), Mebp, inf_SCR02(0))                                 \
+        movcx_ld(W(XG), Mebp, inf_SCR01(0))                                 \
+        muecx_rr(W(XG), W(XS))                                              \
+        muhcx_rx(W(XG), Mebp, inf_SCR02(0))
+
+#define muhcx_ld(XG, MS, DS)                                                \
+        movcx_st(W(XG), Mebp, inf_SCR01(0))                                 \
+        shfcx3ri(W(XG), W(XG), IB(0xF5))                                    \
+        movcx_st(W(XG), Mebp, inf_SCR02(0))                                 \
+        movcx_ld(W(XG), W(MS), W(DS))                                       \
+        shfcx3ri(W(XG), W(XG), IB(0xF5))                                    \
+        muecx_ld(W(XG), Mebp, inf_SCR02(0))                                 \
+        movcx_st(W(XG), Mebp, inf_SCR02(0))                                 \
+        movcx_ld(W(XG), Mebp, inf_SCR01(0))                                 \
+        muecx_ld(W(XG), W(MS), W(DS))                                       \
+        muhcx_rx(W(XG), Mebp, inf_SCR02(0))
+
+#define muhcx_rx(XG, MS, DS) /* not portable, do not use outside */         \
+    ADR VEX(RXB(XG), RXB(MS), REN(XG), 1, 0, 1) EMITB(0xC6)                 \
+        MRM(REG(XG), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMITB(0xDD))                                  \
+        shfcx3ri(W(XG), W(XG), IB(0xD8))
+
+#define muecx_rr(XG, XS) /* not portable, do not use outside */             \
+        VEX(RXB(XG), RXB(XS), REN(XG), 1, 1, 1) EMITB(0xF4)                 \
+        MRM(REG(XG), MOD(XS), REG(XS))
+
+#define muecx_ld(XG, MS, DS) /* not portable, do not use outside */         \
+    ADR VEX(RXB(XG), RXB(MS), REN(XG), 1, 1, 1) EMITB(0xF4)                 \
+        MRM(REG(XG), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#define muhcn_rr(XG, XS)                                                    \
+        movcx_st(W(XG), Mebp, inf_SCR01(0))                                 \
+        shfcx3ri(W(XG), W(XG), IB(0xF5))                                    \
+        movcx_st(W(XG), Mebp, inf_SCR02(0))                                 \
+        shfcx3ri(W(XG), W(XS), IB(0xF5))                                    \
+        muecn_ld(W(XG), Mebp, inf_SCR02(0))                                 \
+        movcx_st(W(XG), Mebp, inf_SCR02(0))                                 \
+        movcx_ld(W(XG), Mebp, inf_SCR01(0))                                 \
+        muecn_rr(W(XG), W(XS))                                              \
+        muhcx_rx(W(XG), Mebp, inf_SCR02(0))
+
+#define muhcn_ld(XG, MS, DS)                                                \
+        movcx_st(W(XG), Mebp, inf_SCR01(0))                                 \
+        shfcx3ri(W(XG), W(XG), IB(0xF5))                                    \
+        movcx_st(W(XG), Mebp, inf_SCR02(0))                                 \
+        movcx_ld(W(XG), W(MS), W(DS))                                       \
+        shfcx3ri(W(XG), W(XG), IB(0xF5))                                    \
+        muecn_ld(W(XG), Mebp, inf_SCR02(0))                                 \
+        movcx_st(W(XG), Mebp, inf_SCR02(0))                                 \
+        movcx_ld(W(XG), Mebp, inf_SCR01(0))                                 \
+        muecn_ld(W(XG), W(MS), W(DS))                                       \
+        muhcx_rx(W(XG), Mebp, inf_SCR02(0))
+
+#define muecn_rr(XG, XS) /* not portable, do not use outside */             \
+        VEX(RXB(XG), RXB(XS), REN(XG), 1, 1, 2) EMITB(0x28)                 \
+        MRM(REG(XG), MOD(XS), REG(XS))
+
+#define muecn_ld(XG, MS, DS) /* not portable, do not use outside */         \
+    ADR VEX(RXB(XG), RXB(MS), REN(XG), 1, 1, 2) EMITB(0x28)                 \
+        MRM(REG(XG), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
 /* shl (G = G << S), (D = S << T) if (#D != #T) - plain, unsigned
  * for maximum compatibility: shift count must be modulo elem-size */
 
@@ -1387,6 +1725,31 @@
 
 #endif /* RT_256X1 >= 2, AVX2 */
 
+#if (RT_256X1 >= 2)
+
+/* shh (D = S[IT]) shuffle 16-bit elements within 64-bit halves (not portable)
+ * 2-bit fields of the immediate select 16-bit elements in each 64-bit half */
+
+#define shhcx3ri(XD, XS, IT) /* not portable, do not use outside */         \
+        VEX(RXB(XD), RXB(XS),    0x00, 1, 3, 1) EMITB(0x70)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(VAL(IT)))                               \
+        VEX(RXB(XD), RXB(XD),    0x00, 1, 2, 1) EMITB(0x70)                 \
+        MRM(REG(XD), MOD(XD), REG(XD))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(VAL(IT)))
+
+/* bsw (D = S with the order of bytes reversed in each element) */
+
+#define bswcx_rr(XD, XS)                                                    \
+        shhcx3ri(W(XD), W(XS), IB(0xB1))                                    \
+        bswax3rx(W(XD), W(XD), TmmX(W(XD), W(XD)))
+
+#define bswcx_ld(XD, MS, DS)                                                \
+        movcx_ld(W(XD), W(MS), W(DS))                                       \
+        bswcx_rr(W(XD), W(XD))
+
+#endif /* RT_256X1 >= 2, AVX2 */
+
 /****************   packed single-precision integer compare   *****************/
 
 #if (RT_256X1 < 2)
@@ -1894,6 +2257,46 @@
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
         muvcx_ld(XmmF, Oeax, PLAIN)
 
+#undef  sregs_sr
+#define sregs_sr(SM) /* save SIMD regs in SM mask, destroys Reax */         \
+        movxx_ld(Reax, Mebp, inf_REGS)                                      \
+        sregs_xr(SM, muvcx_st, Xmm0, RT_SIMD_WIDTH32_256*4)                 \
+        sregs_xr(SM, muvcx_st, Xmm1, RT_SIMD_WIDTH32_256*4)                 \
+        sregs_xr(SM, muvcx_st, Xmm2, RT_SIMD_WIDTH32_256*4)                 \
+        sregs_xr(SM, muvcx_st, Xmm3, RT_SIMD_WIDTH32_256*4)                 \
+        sregs_xr(SM, muvcx_st, Xmm4, RT_SIMD_WIDTH32_256*4)                 \
+        sregs_xr(SM, muvcx_st, Xmm5, RT_SIMD_WIDTH32_256*4)                 \
+        sregs_xr(SM, muvcx_st, Xmm6, RT_SIMD_WIDTH32_256*4)                 \
+        sregs_xr(SM, muvcx_st, Xmm7, RT_SIMD_WIDTH32_256*4)                 \
+        sregs_xr(SM, muvcx_st, Xmm8, RT_SIMD_WIDTH32_256*4)                 \
+        sregs_xr(SM, muvcx_st, Xmm9, RT_SIMD_WIDTH32_256*4)                 \
+        sregs_xr(SM, muvcx_st, XmmA, RT_SIMD_WIDTH32_256*4)                 \
+        sregs_xr(SM, muvcx_st, XmmB, RT_SIMD_WIDTH32_256*4)                 \
+        sregs_xr(SM, muvcx_st, XmmC, RT_SIMD_WIDTH32_256*4)                 \
+        sregs_xr(SM, muvcx_st, XmmD, RT_SIMD_WIDTH32_256*4)                 \
+        sregs_xr(SM, muvcx_st, XmmE, RT_SIMD_WIDTH32_256*4)                 \
+        sregs_xr(SM, muvcx_st, XmmF, RT_SIMD_WIDTH32_256*4)
+
+#undef  sregs_lr
+#define sregs_lr(SM) /* load SIMD regs in SM mask, destroys Reax */         \
+        movxx_ld(Reax, Mebp, inf_REGS)                                      \
+        sregs_xr(SM, muvcx_ld, Xmm0, RT_SIMD_WIDTH32_256*4)                 \
+        sregs_xr(SM, muvcx_ld, Xmm1, RT_SIMD_WIDTH32_256*4)                 \
+        sregs_xr(SM, muvcx_ld, Xmm2, RT_SIMD_WIDTH32_256*4)                 \
+        sregs_xr(SM, muvcx_ld, Xmm3, RT_SIMD_WIDTH32_256*4)                 \
+        sregs_xr(SM, muvcx_ld, Xmm4, RT_SIMD_WIDTH32_256*4)                 \
+        sregs_xr(SM, muvcx_ld, Xmm5, RT_SIMD_WIDTH32_256*4)                 \
+        sregs_xr(SM, muvcx_ld, Xmm6, RT_SIMD_WIDTH32_256*4)                 \
+        sregs_xr(SM, muvcx_ld, Xmm7, RT_SIMD_WIDTH32_256*4)                 \
+        sregs_xr(SM, muvcx_ld, Xmm8, RT_SIMD_WIDTH32_256*4)                 \
+        sregs_xr(SM, muvcx_ld, Xmm9, RT_SIMD_WIDTH32_256*4)                 \
+        sregs_xr(SM, muvcx_ld, XmmA, RT_SIMD_WIDTH32_256*4)                 \
+        sregs_xr(SM, muvcx_ld, XmmB, RT_SIMD_WIDTH32_256*4)                 \
+        sregs_xr(SM, muvcx_ld, XmmC, RT_SIMD_WIDTH32_256*4)                 \
+        sregs_xr(SM, muvcx_ld, XmmD, RT_SIMD_WIDTH32_256*4)                 \
+        sregs_xr(SM, muvcx_ld, XmmE, RT_SIMD_WIDTH32_256*4)                 \
+        sregs_xr(SM, muvcx_ld, XmmF, RT_SIMD_WIDTH32_256*4)
+
 #endif /* RT_256X1 */
 
 #endif /* RT_SIMD_CODE */
@@ -171,6 +171,21 @@
         MRM(REG(XS), MOD(MD), REG(MD))                                      \
         AUX(SIB(MD), CMD(DD), EMPTY)
 
+/* stn (D = S) non-temporal store, bypasses caches on the way to memory
+ * weakly-ordered, place sfnce_xx before [D] is read by other threads */
+
+#define stncx_st(XS, MD, DD)                                                \
+    ADR EVX(RXB(XS), RXB(MD),    0x00, 1, 0, 1) EMITB(0x2B)                 \
+        MRM(REG(XS), MOD(MD), REG(MD))                                      \
+        AUX(SIB(MD), CMD(DD), EMPTY)
+
+/* bcs (D = [M]) broadcast scalar element from memory into all SIMD elements */
+
+#define bcscx_ld(XD, MS, DS)                                                \
+    ADR EVX(RXB(XD), RXB(MS),    0x00, 1, 1, 2) EMITB(0x18)                 \
+        MRM(REG(XD), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
 /* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
  * uses Xmm0 implicitly as a mask register, destroys Xmm0, 0-masked XS elems */
 
@@ -191,6 +206,136 @@
         MRM(REG(XS), MOD(MG), REG(MG))                                      \
         AUX(SIB(MG), CMD(DG), EMPTY)
 
+/* shf (G = G[IS]), (D = S[IT]) shuffle elements within each 128-bit lane
+ * 2-bit fields of the immediate select 32-bit elements in each 128-bit lane */
+
+#define shfcx_ri(XG, IS)                                                    \
+        shfcx3ri(W(XG), W(XG), W(IS))
+
+#define shfcx3ri(XD, XS, IT)                                                \
+        EVX(RXB(XD), RXB(XS),    0x00, 1, 1, 3) EMITB(0x04)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(VAL(IT)))
+
+/* tbl (G = G[S]), (D = S[T]) permute elements across the SIMD register
+ * indices are in elements, taken modulo the number of elements in SIMD */
+
+#define tblcx_rr(XG, XS)                                                    \
+        tblcx3rr(W(XG), W(XG), W(XS))
+
+#define tblcx3rr(XD, XS, XT)                                                \
+        EVX(RXB(XD), RXB(XS), REN(XT), 1, 1, 2) EMITB(0x16)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))
+
+/* sw2 (D = S[1, 0]) swap 128-bit halves of S (not portable) */
+
+#define sw2cx_rr(XD, XS) /* not portable, do not use outside */             \
+        EVX(RXB(XD), RXB(XS), REN(XS), 1, 1, 3) EMITB(0x23)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0x01))
+
+/* hrd (D = S op S op ..) reduce all elements of S with "op" into each of D
+ * in log2 steps via in-register shuffles, temporary register is preserved */
+
+#define hrdcs_rx(XD, XS, XT, op) /* not portable, do not use outside */     \
+        movcx_st(W(XT), Mebp, inf_SCR02(0))                                 \
+        sw2cx_rr(W(XT), W(XS))                                              \
+        op(W(XT), W(XS))                                                    \
+        shfcx3ri(W(XD), W(XT), IB(0x4E))                                    \
+        op(W(XD), W(XT))                                                    \
+        shfcx3ri(W(XT), W(XD), IB(0xB1))                                    \
+        op(W(XD), W(XT))                                                    \
+        movcx_ld(W(XT), Mebp, inf_SCR02(0))
+
+/* aln (G = [S:G] >> IT) concatenate S and G, shift right by IT elements
+ * keeping the lower half, bc0 (D = S[0]) broadcast element 0 (not portable) */
+
+#define alncx_ri(XG, XS, IT) /* not portable, do not use outside */         \
+        EVX(RXB(XG), RXB(XG), REN(XS), 1, 1, 3) EMITB(0x03)                 \
+        MRM(REG(XG), MOD(XG), REG(XG))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(VAL(IT)))
+
+#define bc0cx_rr(XD, XS) /* not portable, do not use outside */             \
+        EVX(RXB(XD), RXB(XS),    0x00, 1, 1, 2) EMITB(0x58)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))
+
+/* scn (D[i] = S[0] op .. op S[i]) inclusive scan of S with "op" in log2
+ * steps, scz shifts in zeroes (add), scs repeats S[0] (min/max, idempotent),
+ * sce shifts D up by one element (exclusive scan), Xmm0 is used as a temp */
+
+#define sczcx_rx(XD, XS, op) /* not portable, do not use outside */         \
+        xorcx_rr(Xmm0, Xmm0)                                                \
+        alncx_ri(Xmm0, W(XS), IB(7))                                        \
+        op(Xmm0, W(XS))                                                     \
+        xorcx_rr(W(XD), W(XD))                                              \
+        alncx_ri(W(XD), Xmm0, IB(6))                                        \
+        op(W(XD), Xmm0)                                                     \
+        xorcx_rr(Xmm0, Xmm0)                                                \
+        alncx_ri(Xmm0, W(XD), IB(4))                                        \
+        op(Xmm0, W(XD))                                                     \
+        movcx_rr(W(XD), Xmm0)
+
+#define scscx_rx(XD, XS, op) /* not portable, do not use outside */         \
+        bc0cx_rr(Xmm0, W(XS))                                               \
+        alncx_ri(Xmm0, W(XS), IB(7))                                        \
+        op(Xmm0, W(XS))                                                     \
+        bc0cx_rr(W(XD), Xmm0)                                               \
+        alncx_ri(W(XD), Xmm0, IB(6))                                        \
+        op(W(XD), Xmm0)                                                     \
+        bc0cx_rr(Xmm0, W(XD))                                               \
+        alncx_ri(Xmm0, W(XD), IB(4))                                        \
+        op(Xmm0, W(XD))                                                     \
+        movcx_rr(W(XD), Xmm0)
+
+#define scecx_rx(XD) /* not portable, do not use outside */                 \
+        xorcx_rr(Xmm0, Xmm0)                                                \
+        alncx_ri(Xmm0, W(XD), IB(7))                                        \
+        movcx_rr(W(XD), Xmm0)
+
+/* adi (D[i] = S[0] + .. + S[i]) inclusive prefix sum of elements of S
+ * uses Xmm0 implicitly as a temp register, destroys Xmm0, XD/XS != Xmm0 */
+
+#define adics_rr(XD, XS)                                                    \
+        sczcx_rx(W(XD), W(XS), addcs_rr)
+
+#define adicx_rr(XD, XS)                                                    \
+        sczcx_rx(W(XD), W(XS), addcx_rr)
+
+/* ade (D[i] = S[0] + .. + S[i-1]) exclusive prefix sum of S, D[0] = 0
+ * uses Xmm0 implicitly as a temp register, destroys Xmm0, XD/XS != Xmm0 */
+
+#define adecs_rr(XD, XS)                                                    \
+        sczcx_rx(W(XD), W(XS), addcs_rr)                                    \
+        scecx_rx(W(XD))
+
+#define adecx_rr(XD, XS)                                                    \
+        sczcx_rx(W(XD), W(XS), addcx_rr)                                    \
+        scecx_rx(W(XD))
+
+/* mni (D[i] = min(S[0], .. , S[i])) inclusive prefix min of elements of S
+ * uses Xmm0 implicitly as a temp register, destroys Xmm0, XD/XS != Xmm0 */
+
+#define mnics_rr(XD, XS)                                                    \
+        scscx_rx(W(XD), W(XS), mincs_rr)
+
+#define mnicx_rr(XD, XS)                                                    \
+        scscx_rx(W(XD), W(XS), mincx_rr)
+
+#define mnicn_rr(XD, XS)                                                    \
+        scscx_rx(W(XD), W(XS), mincn_rr)
+
+/* mxi (D[i] = max(S[0], .. , S[i])) inclusive prefix max of elements of S
+ * uses Xmm0 implicitly as a temp register, destroys Xmm0, XD/XS != Xmm0 */
+
+#define mxics_rr(XD, XS)                                                    \
+        scscx_rx(W(XD), W(XS), maxcs_rr)
+
+#define mxicx_rr(XD, XS)                                                    \
+        scscx_rx(W(XD), W(XS), maxcx_rr)
+
+#define mxicn_rr(XD, XS)                                                    \
+        scscx_rx(W(XD), W(XS), maxcn_rr)
+
 /* and (G = G & S), (D = S & T) if (#D != #T) */
 
 #define andcx_rr(XG, XS)                                                    \
@@ -315,6 +460,10 @@
         /* adp, adh are defined in rtbase.h (first 15-regs only)
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  adhcs_rr
+#define adhcs_rr(XD, XS) /* horizontal reductive add, first 15-regs only */ \
+        hrdcs_rx(W(XD), W(XS), TmmX(W(XD), W(XS)), addcs_rr)
+
 /* sub (G = G - S), (D = S - T) if (#D != #T) */
 
 #define subcs_rr(XG, XS)                                                    \
@@ -352,6 +501,10 @@
         /* mlp, mlh are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  mlhcs_rr
+#define mlhcs_rr(XD, XS) /* horizontal reductive mul */                     \
+        hrdcs_rx(W(XD), W(XS), TmmX(W(XD), W(XS)), mulcs_rr)
+
 /* div (G = G / S), (D = S / T) if (#D != #T) and on ARMv7 if (#D != #S) */
 
 #define divcs_rr(XG, XS)                                                    \
@@ -498,6 +651,10 @@
         /* mnp, mnh are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  mnhcs_rr
+#define mnhcs_rr(XD, XS) /* horizontal reductive min */                     \
+        hrdcs_rx(W(XD), W(XS), TmmX(W(XD), W(XS)), mincs_rr)
+
 /* max (G = G > S ? G : S), (D = S > T ? S : T) if (#D != #T) */
 
 #define maxcs_rr(XG, XS)                                                    \
@@ -518,6 +675,10 @@
         /* mxp, mxh are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  mxhcs_rr
+#define mxhcs_rr(XD, XS) /* horizontal reductive max */                     \
+        hrdcs_rx(W(XD), W(XS), TmmX(W(XD), W(XS)), maxcs_rr)
+
 /* ceq (G = G == S ? -1 : 0), (D = S == T ? -1 : 0) if (#D != #T) */
 
 #define ceqcs_rr(XG, XS)                                                    \
@@ -973,6 +1134,38 @@
         MRM(REG(XD), MOD(MT), REG(MT))                                      \
         AUX(SIB(MT), CMD(DT), EMPTY)
 
+/* clz (D = number of leading zeroes in each element of S), 32 if 0 */
+
+#define clzcx_rr(XD, XS)                                                    \
+        EVX(RXB(XD), RXB(XS),    0x00, 1, 1, 2) EMITB(0x44)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))
+
+#define clzcx_ld(XD, MS, DS)                                                \
+    ADR EVX(RXB(XD), RXB(MS),    0x00, 1, 1, 2) EMITB(0x44)                 \
+        MRM(REG(XD), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+/* shh (D = S[IT]) shuffle 16-bit elements within 64-bit halves (not portable)
+ * 2-bit fields of the immediate select 16-bit elements in each 64-bit half */
+
+#define shhcx3ri(XD, XS, IT) /* not portable, do not use outside */         \
+        EVX(RXB(XD), RXB(XS),    0x00, 1, 3, 1) EMITB(0x70)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(VAL(IT)))                               \
+        EVX(RXB(XD), RXB(XD),    0x00, 1, 2, 1) EMITB(0x70)                 \
+        MRM(REG(XD), MOD(XD), REG(XD))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(VAL(IT)))
+
+/* bsw (D = S with the order of bytes reversed in each element) */
+
+#define bswcx_rr(XD, XS)                                                    \
+        shhcx3ri(W(XD), W(XS), IB(0xB1))                                    \
+        bswax3rx(W(XD), W(XD), TmmX(W(XD), W(XD)))
+
+#define bswcx_ld(XD, MS, DS)                                                \
+        movcx_ld(W(XD), W(MS), W(DS))                                       \
+        bswcx_rr(W(XD), W(XD))
+
 /****************   packed single-precision integer compare   *****************/
 
 /* min (G = G < S ? G : S), (D = S < T ? S : T) if (#D != #T), unsigned */
@@ -1423,6 +1616,74 @@
         stack_ld(Recx)                                                      \
         stack_ld(Redx)
 
+#undef  sregs_sr
+#define sregs_sr(SM) /* save SIMD regs in SM mask, destroys Reax */         \
+        movxx_ld(Reax, Mebp, inf_REGS)                                      \
+        sregs_xr(SM, muvox_st, Xmm0, RT_SIMD_WIDTH32_512*4)                 \
+        sregs_xr(SM, muvox_st, Xmm1, RT_SIMD_WIDTH32_512*4)                 \
+        sregs_xr(SM, muvox_st, Xmm2, RT_SIMD_WIDTH32_512*4)                 \
+        sregs_xr(SM, muvox_st, Xmm3, RT_SIMD_WIDTH32_512*4)                 \
+        sregs_xr(SM, muvox_st, Xmm4, RT_SIMD_WIDTH32_512*4)                 \
+        sregs_xr(SM, muvox_st, Xmm5, RT_SIMD_WIDTH32_512*4)                 \
+        sregs_xr(SM, muvox_st, Xmm6, RT_SIMD_WIDTH32_512*4)                 \
+        sregs_xr(SM, muvox_st, Xmm7, RT_SIMD_WIDTH32_512*4)                 \
+        sregs_xr(SM, muvox_st, Xmm8, RT_SIMD_WIDTH32_512*4)                 \
+        sregs_xr(SM, muvox_st, Xmm9, RT_SIMD_WIDTH32_512*4)                 \
+        sregs_xr(SM, muvox_st, XmmA, RT_SIMD_WIDTH32_512*4)                 \
+        sregs_xr(SM, muvox_st, XmmB, RT_SIMD_WIDTH32_512*4)                 \
+        sregs_xr(SM, muvox_st, XmmC, RT_SIMD_WIDTH32_512*4)                 \
+        sregs_xr(SM, muvox_st, XmmD, RT_SIMD_WIDTH32_512*4)                 \
+        sregs_xr(SM, muvox_st, XmmE, RT_SIMD_WIDTH32_512*4)                 \
+        sregs_xr(SM, muvox_st, XmmF, RT_SIMD_WIDTH32_512*4)                 \
+        sregs_xr(SM, muvox_st, XmmG, RT_SIMD_WIDTH32_512*4)                 \
+        sregs_xr(SM, muvox_st, XmmH, RT_SIMD_WIDTH32_512*4)                 \
+        sregs_xr(SM, muvox_st, XmmI, RT_SIMD_WIDTH32_512*4)                 \
+        sregs_xr(SM, muvox_st, XmmJ, RT_SIMD_WIDTH32_512*4)                 \
+        sregs_xr(SM, muvox_st, XmmK, RT_SIMD_WIDTH32_512*4)                 \
+        sregs_xr(SM, muvox_st, XmmL, RT_SIMD_WIDTH32_512*4)                 \
+        sregs_xr(SM, muvox_st, XmmM, RT_SIMD_WIDTH32_512*4)                 \
+        sregs_xr(SM, muvox_st, XmmN, RT_SIMD_WIDTH32_512*4)                 \
+        sregs_xr(SM, muvox_st, XmmO, RT_SIMD_WIDTH32_512*4)                 \
+        sregs_xr(SM, muvox_st, XmmP, RT_SIMD_WIDTH32_512*4)                 \
+        sregs_xr(SM, muvox_st, XmmQ, RT_SIMD_WIDTH32_512*4)                 \
+        sregs_xr(SM, muvox_st, XmmR, RT_SIMD_WIDTH32_512*4)                 \
+        sregs_xr(SM, muvox_st, XmmS, RT_SIMD_WIDTH32_512*4)                 \
+        sregs_xr(SM, muvox_st, XmmT, RT_SIMD_WIDTH32_512*4)
+
+#undef  sregs_lr
+#define sregs_lr(SM) /* load SIMD regs in SM mask, destroys Reax */         \
+        movxx_ld(Reax, Mebp, inf_REGS)                                      \
+        sregs_xr(SM, muvox_ld, Xmm0, RT_SIMD_WIDTH32_512*4)                 \
+        sregs_xr(SM, muvox_ld, Xmm1, RT_SIMD_WIDTH32_512*4)                 \
+        sregs_xr(SM, muvox_ld, Xmm2, RT_SIMD_WIDTH32_512*4)                 \
+        sregs_xr(SM, muvox_ld, Xmm3, RT_SIMD_WIDTH32_512*4)                 \
+        sregs_xr(SM, muvox_ld, Xmm4, RT_SIMD_WIDTH32_512*4)                 \
+        sregs_xr(SM, muvox_ld, Xmm5, RT_SIMD_WIDTH32_512*4)                 \
+        sregs_xr(SM, muvox_ld, Xmm6, RT_SIMD_WIDTH32_512*4)                 \
+        sregs_xr(SM, muvox_ld, Xmm7, RT_SIMD_WIDTH32_512*4)                 \
+        sregs_xr(SM, muvox_ld, Xmm8, RT_SIMD_WIDTH32_512*4)                 \
+        sregs_xr(SM, muvox_ld, Xmm9, RT_SIMD_WIDTH32_512*4)                 \
+        sregs_xr(SM, muvox_ld, XmmA, RT_SIMD_WIDTH32_512*4)                 \
+        sregs_xr(SM, muvox_ld, XmmB, RT_SIMD_WIDTH32_512*4)                 \
+        sregs_xr(SM, muvox_ld, XmmC, RT_SIMD_WIDTH32_512*4)                 \
+        sregs_xr(SM, muvox_ld, XmmD, RT_SIMD_WIDTH32_512*4)                 \
+        sregs_xr(SM, muvox_ld, XmmE, RT_SIMD_WIDTH32_512*4)                 \
+        sregs_xr(SM, muvox_ld, XmmF, RT_SIMD_WIDTH32_512*4)                 \
+        sregs_xr(SM, muvox_ld, XmmG, RT_SIMD_WIDTH32_512*4)                 \
+        sregs_xr(SM, muvox_ld, XmmH, RT_SIMD_WIDTH32_512*4)                 \
+        sregs_xr(SM, muvox_ld, XmmI, RT_SIMD_WIDTH32_512*4)                 \
+        sregs_xr(SM, muvox_ld, XmmJ, RT_SIMD_WIDTH32_512*4)                 \
+        sregs_xr(SM, muvox_ld, XmmK, RT_SIMD_WIDTH32_512*4)                 \
+        sregs_xr(SM, muvox_ld, XmmL, RT_SIMD_WIDTH32_512*4)                 \
+        sregs_xr(SM, muvox_ld, XmmM, RT_SIMD_WIDTH32_512*4)                 \
+        sregs_xr(SM, muvox_ld, XmmN, RT_SIMD_WIDTH32_512*4)                 \
+        sregs_xr(SM, muvox_ld, XmmO, RT_SIMD_WIDTH32_512*4)                 \
+        sregs_xr(SM, muvox_ld, XmmP, RT_SIMD_WIDTH32_512*4)                 \
+        sregs_xr(SM, muvox_ld, XmmQ, RT_SIMD_WIDTH32_512*4)                 \
+        sregs_xr(SM, muvox_ld, XmmR, RT_SIMD_WIDTH32_512*4)                 \
+        sregs_xr(SM, muvox_ld, XmmS, RT_SIMD_WIDTH32_512*4)                 \
+        sregs_xr(SM, muvox_ld, XmmT, RT_SIMD_WIDTH32_512*4)
+
 #endif /* RT_256X1 */
 
 #endif /* RT_SIMD_CODE */
@@ -171,6 +171,17 @@
         MRM(REG(XS),    0x02, REG(MD))                                      \
         AUX(SIB(MD), EMITW(VXL(DD)), EMPTY)
 
+/* stn (D = S) non-temporal store, bypasses caches on the way to memory
+ * weakly-ordered, place sfnce_xx before [D] is read by other threads */
+
+#define stnox_st(XS, MD, DD)                                                \
+    ADR VEX(0,       RXB(MD),    0x00, 1, 0, 1) EMITB(0x2B)                 \
+        MRM(REG(XS),    0x02, REG(MD))                                      \
+        AUX(SIB(MD), EMITW(VAL(DD)), EMPTY)                                 \
+    ADR VEX(1,       RXB(MD),    0x00, 1, 0, 1) EMITB(0x2B)                 \
+        MRM(REG(XS),    0x02, REG(MD))                                      \
+        AUX(SIB(MD), EMITW(VXL(DD)), EMPTY)
+
 /* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
  * uses Xmm0 implicitly as a mask register, destroys Xmm0, 0-masked XS elems */
 
@@ -500,13 +511,13 @@
         MRM(REG(XS), MOD(MD), REG(MD))                                      \
         AUX(SIB(MD), EMITW(VXL(DD)), EMPTY)
 
-#define cvyos_rr(XD, XS)     /* not portable, do not use outside */         \
+#define cvyhs_rr(XD, XS)     /* not portable, do not use outside */         \
         VEX(0,             0,    0x00, 1, 0, 1) EMITB(0x5A)                 \
         MRM(REG(XD), MOD(XS), REG(XS))                                      \
         VEX(1,             1,    0x00, 1, 0, 1) EMITB(0x5A)                 \
         MRM(REG(XD), MOD(XS), REG(XS))
 
-#define cvyos_ld(XD, MS, DS) /* not portable, do not use outside */         \
+#define cvyhs_ld(XD, MS, DS) /* not portable, do not use outside */         \
     ADR VEX(0,       RXB(MS),    0x00, 1, 0, 1) EMITB(0x5A)                 \
         MRM(REG(XD),    0x02, REG(MS))                                      \
         AUX(SIB(MS), EMITW(VAL(DS)), EMPTY)                                 \
@@ -514,7 +525,7 @@
         MRM(REG(XD),    0x02, REG(MS))                                      \
         AUX(SIB(MS), EMITW(VXL(DS)), EMPTY)
 
-#define cvxqs_rr(XD, XS)     /* not portable, do not use outside */         \
+#define cvxhs_rr(XD, XS)     /* not portable, do not use outside */         \
         VEX(0,             0,    0x00, 1, 1, 1) EMITB(0x5A)                 \
         MRM(REG(XD), MOD(XS), REG(XS))                                      \
         VEX(1,             1,    0x00, 1, 1, 1) EMITB(0x5A)                 \
@@ -547,21 +558,21 @@
 #define fmaos_rr(XG, XS, XT)                                                \
         movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
         movox_st(W(XG), Mebp, inf_SCR02(0))                                 \
-        cvyos_rr(W(XG), W(XS))                     /* 1st-pass -> */        \
-        cvyos_rr(W(XS), W(XT))                                              \
+        cvyhs_rr(W(XG), W(XS))                     /* 1st-pass -> */        \
+        cvyhs_rr(W(XS), W(XT))                                              \
         mulqs_rr(W(XS), W(XG))                                              \
-        cvyos_ld(W(XG), Mebp, inf_SCR02(0x00))                              \
+        cvyhs_ld(W(XG), Mebp, inf_SCR02(0x00))                              \
         addqs_rr(W(XG), W(XS))                                              \
-        cvxqs_rr(W(XG), W(XG))                                              \
+        cvxhs_rr(W(XG), W(XG))                                              \
         mivox_st(W(XG), Mebp, inf_SCR02(0x00))                              \
         movox_ld(W(XS), Mebp, inf_SCR01(0))                                 \
         prmox_rr(W(XT), W(XT), IB(1))              /* 1st-pass <- */        \
-        cvyos_ld(W(XG), Mebp, inf_SCR01(0x10))     /* 2nd-pass -> */        \
-        cvyos_rr(W(XS), W(XT))                                              \
+        cvyhs_ld(W(XG), Mebp, inf_SCR01(0x10))     /* 2nd-pass -> */        \
+        cvyhs_rr(W(XS), W(XT))                                              \
         mulqs_rr(W(XS), W(XG))                                              \
-        cvyos_ld(W(XG), Mebp, inf_SCR02(0x10))                              \
+        cvyhs_ld(W(XG), Mebp, inf_SCR02(0x10))                              \
         addqs_rr(W(XG), W(XS))                                              \
-        cvxqs_rr(W(XG), W(XG))                                              \
+        cvxhs_rr(W(XG), W(XG))                                              \
         mivox_st(W(XG), Mebp, inf_SCR02(0x10))                              \
         prmox_rr(W(XT), W(XT), IB(1))              /* 2nd-pass <- */        \
         movox_ld(W(XG), Mebp, inf_SCR02(0))                                 \
@@ -570,19 +581,19 @@
 #define fmaos_ld(XG, XS, MT, DT)                                            \
         movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
         movox_st(W(XG), Mebp, inf_SCR02(0))                                 \
-        cvyos_rr(W(XG), W(XS))                     /* 1st-pass -> */        \
-        cvyos_ld(W(XS), W(MT), W(DT))                                       \
+        cvyhs_rr(W(XG), W(XS))                     /* 1st-pass -> */        \
+        cvyhs_ld(W(XS), W(MT), W(DT))                                       \
         mulqs_rr(W(XS), W(XG))                                              \
-        cvyos_ld(W(XG), Mebp, inf_SCR02(0x00))                              \
+        cvyhs_ld(W(XG), Mebp, inf_SCR02(0x00))                              \
         addqs_rr(W(XG), W(XS))                                              \
-        cvxqs_rr(W(XG), W(XG))                                              \
+        cvxhs_rr(W(XG), W(XG))                                              \
         mivox_st(W(XG), Mebp, inf_SCR02(0x00))     /* 1st-pass <- */        \
-        cvyos_ld(W(XG), Mebp, inf_SCR01(0x10))     /* 2nd-pass -> */        \
-        cvyos_ld(W(XS), W(MT), X(DT))                                       \
+        cvyhs_ld(W(XG), Mebp, inf_SCR01(0x10))     /* 2nd-pass -> */        \
+        cvyhs_ld(W(XS), W(MT), X(DT))                                       \
         mulqs_rr(W(XS), W(XG))                                              \
-        cvyos_ld(W(XG), Mebp, inf_SCR02(0x10))                              \
+        cvyhs_ld(W(XG), Mebp, inf_SCR02(0x10))                              \
         addqs_rr(W(XG), W(XS))                                              \
-        cvxqs_rr(W(XG), W(XG))                                              \
+        cvxhs_rr(W(XG), W(XG))                                              \
         mivox_st(W(XG), Mebp, inf_SCR02(0x10))     /* 2nd-pass <- */        \
         movox_ld(W(XG), Mebp, inf_SCR02(0))                                 \
         movox_ld(W(XS), Mebp, inf_SCR01(0))
@@ -616,21 +627,21 @@
 #define fmsos_rr(XG, XS, XT)                                                \
         movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
         movox_st(W(XG), Mebp, inf_SCR02(0))                                 \
-        cvyos_rr(W(XG), W(XS))                     /* 1st-pass -> */        \
-        cvyos_rr(W(XS), W(XT))                                              \
+        cvyhs_rr(W(XG), W(XS))                     /* 1st-pass -> */        \
+        cvyhs_rr(W(XS), W(XT))                                              \
         mulqs_rr(W(XS), W(XG))                                              \
-        cvyos_ld(W(XG), Mebp, inf_SCR02(0x00))                              \
+        cvyhs_ld(W(XG), Mebp, inf_SCR02(0x00))                              \
         subqs_rr(W(XG), W(XS))                                              \
-        cvxqs_rr(W(XG), W(XG))                                              \
+        cvxhs_rr(W(XG), W(XG))                                              \
         mivox_st(W(XG), Mebp, inf_SCR02(0x00))                              \
         movox_ld(W(XS), Mebp, inf_SCR01(0))                                 \
         prmox_rr(W(XT), W(XT), IB(1))              /* 1st-pass <- */        \
-        cvyos_ld(W(XG), Mebp, inf_SCR01(0x10))     /* 2nd-pass -> */        \
-        cvyos_rr(W(XS), W(XT))                                              \
+        cvyhs_ld(W(XG), Mebp, inf_SCR01(0x10))     /* 2nd-pass -> */        \
+        cvyhs_rr(W(XS), W(XT))                                              \
         mulqs_rr(W(XS), W(XG))                                              \
-        cvyos_ld(W(XG), Mebp, inf_SCR02(0x10))                              \
+        cvyhs_ld(W(XG), Mebp, inf_SCR02(0x10))                              \
         subqs_rr(W(XG), W(XS))                                              \
-        cvxqs_rr(W(XG), W(XG))                                              \
+        cvxhs_rr(W(XG), W(XG))                                              \
         mivox_st(W(XG), Mebp, inf_SCR02(0x10))                              \
         prmox_rr(W(XT), W(XT), IB(1))              /* 2nd-pass <- */        \
         movox_ld(W(XG), Mebp, inf_SCR02(0))                                 \
@@ -639,19 +650,19 @@
 #define fmsos_ld(XG, XS, MT, DT)                                            \
         movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
         movox_st(W(XG), Mebp, inf_SCR02(0))                                 \
-        cvyos_rr(W(XG), W(XS))                     /* 1st-pass -> */        \
-        cvyos_ld(W(XS), W(MT), W(DT))                                       \
+        cvyhs_rr(W(XG), W(XS))                     /* 1st-pass -> */        \
+        cvyhs_ld(W(XS), W(MT), W(DT))                                       \
         mulqs_rr(W(XS), W(XG))                                              \
-        cvyos_ld(W(XG), Mebp, inf_SCR02(0x00))                              \
+        cvyhs_ld(W(XG), Mebp, inf_SCR02(0x00))                              \
         subqs_rr(W(XG), W(XS))                                              \
-        cvxqs_rr(W(XG), W(XG))                                              \
+        cvxhs_rr(W(XG), W(XG))                                              \
         mivox_st(W(XG), Mebp, inf_SCR02(0x00))     /* 1st-pass <- */        \
-        cvyos_ld(W(XG), Mebp, inf_SCR01(0x10))     /* 2nd-pass -> */        \
-        cvyos_ld(W(XS), W(MT), X(DT))                                       \
+        cvyhs_ld(W(XG), Mebp, inf_SCR01(0x10))     /* 2nd-pass -> */        \
+        cvyhs_ld(W(XS), W(MT), X(DT))                                       \
         mulqs_rr(W(XS), W(XG))                                              \
-        cvyos_ld(W(XG), Mebp, inf_SCR02(0x10))                              \
+        cvyhs_ld(W(XG), Mebp, inf_SCR02(0x10))                              \
         subqs_rr(W(XG), W(XS))                                              \
-        cvxqs_rr(W(XG), W(XG))                                              \
+        cvxhs_rr(W(XG), W(XG))                                              \
         mivox_st(W(XG), Mebp, inf_SCR02(0x10))     /* 2nd-pass <- */        \
         movox_ld(W(XG), Mebp, inf_SCR02(0))                                 \
         movox_ld(W(XS), Mebp, inf_SCR01(0))
@@ -2245,6 +2256,30 @@
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
         movox_ld(Xmm7, Oeax, PLAIN)
 
+#undef  sregs_sr
+#define sregs_sr(SM) /* save SIMD regs in SM mask, destroys Reax */         \
+        movxx_ld(Reax, Mebp, inf_REGS)                                      \
+        sregs_xr(SM, movox_st, Xmm0, RT_SIMD_WIDTH32*4)                     \
+        sregs_xr(SM, movox_st, Xmm1, RT_SIMD_WIDTH32*4)                     \
+        sregs_xr(SM, movox_st, Xmm2, RT_SIMD_WIDTH32*4)                     \
+        sregs_xr(SM, movox_st, Xmm3, RT_SIMD_WIDTH32*4)                     \
+        sregs_xr(SM, movox_st, Xmm4, RT_SIMD_WIDTH32*4)                     \
+        sregs_xr(SM, movox_st, Xmm5, RT_SIMD_WIDTH32*4)                     \
+        sregs_xr(SM, movox_st, Xmm6, RT_SIMD_WIDTH32*4)                     \
+        sregs_xr(SM, movox_st, Xmm7, RT_SIMD_WIDTH32*4)
+
+#undef  sregs_lr
+#define sregs_lr(SM) /* load SIMD regs in SM mask, destroys Reax */         \
+        movxx_ld(Reax, Mebp, inf_REGS)                                      \
+        sregs_xr(SM, movox_ld, Xmm0, RT_SIMD_WIDTH32*4)                     \
+        sregs_xr(SM, movox_ld, Xmm1, RT_SIMD_WIDTH32*4)                     \
+        sregs_xr(SM, movox_ld, Xmm2, RT_SIMD_WIDTH32*4)                     \
+        sregs_xr(SM, movox_ld, Xmm3, RT_SIMD_WIDTH32*4)                     \
+        sregs_xr(SM, movox_ld, Xmm4, RT_SIMD_WIDTH32*4)                     \
+        sregs_xr(SM, movox_ld, Xmm5, RT_SIMD_WIDTH32*4)                     \
+        sregs_xr(SM, movox_ld, Xmm6, RT_SIMD_WIDTH32*4)                     \
+        sregs_xr(SM, movox_ld, Xmm7, RT_SIMD_WIDTH32*4)
+
 #endif /* RT_256X2 */
 
 #endif /* RT_SIMD_CODE */
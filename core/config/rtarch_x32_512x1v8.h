@@ -196,6 +196,26 @@
         MRM(REG(XS), MOD(MD), REG(MD))                                      \
         AUX(SIB(MD), CMD(DD), EMPTY)
 
+/* stn (D = S) non-temporal store, bypasses caches on the way to memory
+ * weakly-ordered, place sfnce_xx before [D] is read by other threads */
+
+#define stnox_st(XS, MD, DD)                                                \
+    ADR EVX(RXB(XS), RXB(MD),    0x00, K, 0, 1) EMITB(0x2B)                 \
+        MRM(REG(XS), MOD(MD), REG(MD))                                      \
+        AUX(SIB(MD), CMD(DD), EMPTY)
+
+/* bcs (D = [M]) broadcast scalar element from memory into all SIMD elements
+ * bcs (D = S) broadcast 32-bit BASE register S into all SIMD elements */
+
+#define bcsox_ld(XD, MS, DS)                                                \
+    ADR EVX(RXB(XD), RXB(MS),    0x00, K, 1, 2) EMITB(0x18)                 \
+        MRM(REG(XD), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#define bcsox_rr(XD, RS)                                                    \
+        EVX(RXB(XD), RXB(RS),    0x00, K, 1, 2) EMITB(0x7C)                 \
+        MRM(REG(XD), MOD(RS), REG(RS))
+
 /* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
  * uses Xmm0 implicitly as a mask register, destroys Xmm0, 0-masked XS elems */
 
@@ -216,6 +236,198 @@
         MRM(REG(XS), MOD(MG), REG(MG))                                      \
         AUX(SIB(MG), CMD(DG), EMPTY)
 
+/* gat (D = [M + S]) gather elements at per-lane indices S from M/DS,
+ * indices are in elements within [0, 2^31) (VSIB sign-extends 32-bit ones),
+ * M*** or Oeax, but not indexed modes (I***, ...), XD/XS differ,
+ * uses k1 as a temp mask register here */
+
+#define gatox_ld(XD, XS, MS, DS)                                            \
+        VEX(0,             0,    0x00, 1, 0, 1) EMITB(0x46)                 \
+        MRM(0x01,       0x03,    0x00)                                      \
+    ADR EKX(RXB(XD), RXB(MS) | (RXB(XS) & 1) << 1, REN(XS) & 16, K, 1, 2)   \
+        EMITB(0x92)                                                         \
+        MRM(REG(XD), MOD(MS),    0x04)                                      \
+        AUX(EMITB(0x80 | REG(XS) << 3 | REG(MS)), CMD(DS), EMPTY)
+
+/* sct (M + T = S) scatter elements of S to per-lane indices T at M/DD,
+ * indices are in elements within [0, 2^31) (VSIB sign-extends 32-bit ones),
+ * M*** or Oeax, but not indexed modes (I***, ...),
+ * colliding indices are written in lane order (the highest lane wins),
+ * uses k1 as a temp mask register here */
+
+#define sctox_st(XS, XT, MD, DD)                                            \
+        VEX(0,             0,    0x00, 1, 0, 1) EMITB(0x46)                 \
+        MRM(0x01,       0x03,    0x00)                                      \
+    ADR EKX(RXB(XS), RXB(MD) | (RXB(XT) & 1) << 1, REN(XT) & 16, K, 1, 2)   \
+        EMITB(0xA2)                                                         \
+        MRM(REG(XS), MOD(MD),    0x04)                                      \
+        AUX(EMITB(0x80 | REG(XT) << 3 | REG(MD)), CMD(DD), EMPTY)
+
+/* mtl (D = S) move the first RS lanes only (loop tails), 0 <= RS <= 16 here
+ * load zeroes the remaining lanes of XD, store keeps memory past RS lanes,
+ * uses k1 as a temp mask register here (Xmm0 on AVX), XD/XS != Xmm0 */
+
+#define mtlox_ld(XD, RS, MS, DS)                                            \
+        mtlox_k1(W(RS))                                                     \
+    ADR EZX(RXB(XD), RXB(MS),    0x00, K, 0, 1) EMITB(0x28)                 \
+        MRM(REG(XD), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#define mtlox_st(XS, RS, MD, DD)                                            \
+        mtlox_k1(W(RS))                                                     \
+    ADR EKX(RXB(XS), RXB(MD),    0x00, K, 0, 1) EMITB(0x29)                 \
+        MRM(REG(XS), MOD(MD), REG(MD))                                      \
+        AUX(SIB(MD), CMD(DD), EMPTY)
+
+#define mtlox_k1(RS) /* not portable, do not use outside */                 \
+        stack_st(Recx)                                                      \
+        movwx_rr(Recx, W(RS))                                               \
+        stack_st(Reax)                                                      \
+        movwx_ri(Reax, IB(1))                                               \
+        shlwx_rx(Reax)                                                      \
+        subwx_ri(Reax, IB(1))                                               \
+        VEX(0,             0,    0x00, 0, 0, 1) EMITB(0x92)                 \
+        MRM(0x01,       0x03,    0x00)                                      \
+        stack_ld(Reax)                                                      \
+        stack_ld(Recx)
+
+/* shf (G = G[IS]), (D = S[IT]) shuffle elements within each 128-bit lane
+ * 2-bit fields of the immediate select 32-bit elements in each 128-bit lane */
+
+#define shfox_ri(XG, IS)                                                    \
+        shfox3ri(W(XG), W(XG), W(IS))
+
+#define shfox3ri(XD, XS, IT)                                                \
+        EVX(RXB(XD), RXB(XS),    0x00, K, 1, 3) EMITB(0x04)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(VAL(IT)))
+
+/* tbl (G = G[S]), (D = S[T]) permute elements across the SIMD register
+ * indices are in elements, taken modulo the number of elements in SIMD */
+
+#define tblox_rr(XG, XS)                                                    \
+        tblox3rr(W(XG), W(XG), W(XS))
+
+#define tblox3rr(XD, XS, XT)                                                \
+        EVX(RXB(XD), RXB(XS), REN(XT), K, 1, 2) EMITB(0x16)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))
+
+/* sw4 (D = S[IT]) shuffle 128-bit lanes of S (not portable)
+ * 2-bit fields of the immediate select 128-bit lanes of S */
+
+#define sw4ox3ri(XD, XS, IT) /* not portable, do not use outside */         \
+        EVX(RXB(XD), RXB(XS), REN(XS), K, 1, 3) EMITB(0x23)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(VAL(IT)))
+
+/* hrd (D = S op S op ..) reduce all elements of S with "op" into each of D
+ * in log2 steps via in-register shuffles, temporary register is preserved */
+
+#define hrdos_rx(XD, XS, XT, op) /* not portable, do not use outside */     \
+        movox_st(W(XT), Mebp, inf_SCR02(0))                                 \
+        sw4ox3ri(W(XT), W(XS), IB(0x4E))                                    \
+        op(W(XT), W(XS))                                                    \
+        sw4ox3ri(W(XD), W(XT), IB(0xB1))                                    \
+        op(W(XD), W(XT))                                                    \
+        shfox3ri(W(XT), W(XD), IB(0x4E))                                    \
+        op(W(XD), W(XT))                                                    \
+        shfox3ri(W(XT), W(XD), IB(0xB1))                                    \
+        op(W(XD), W(XT))                                                    \
+        movox_ld(W(XT), Mebp, inf_SCR02(0))
+
+/* aln (G = [S:G] >> IT) concatenate S and G, shift right by IT elements
+ * keeping the lower half, bc0 (D = S[0]) broadcast element 0 (not portable) */
+
+#define alnox_ri(XG, XS, IT) /* not portable, do not use outside */         \
+        EVX(RXB(XG), RXB(XG), REN(XS), K, 1, 3) EMITB(0x03)                 \
+        MRM(REG(XG), MOD(XG), REG(XG))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(VAL(IT)))
+
+#define bc0ox_rr(XD, XS) /* not portable, do not use outside */             \
+        EVX(RXB(XD), RXB(XS),    0x00, K, 1, 2) EMITB(0x58)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))
+
+/* scn (D[i] = S[0] op .. op S[i]) inclusive scan of S with "op" in log2
+ * steps, scz shifts in zeroes (add), scs repeats S[0] (min/max, idempotent),
+ * sce shifts D up by one element (exclusive scan), Xmm0 is used as a temp */
+
+#define sczox_rx(XD, XS, op) /* not portable, do not use outside */         \
+        xorox_rr(Xmm0, Xmm0)                                                \
+        alnox_ri(Xmm0, W(XS), IB(15))                                       \
+        op(Xmm0, W(XS))                                                     \
+        xorox_rr(W(XD), W(XD))                                              \
+        alnox_ri(W(XD), Xmm0, IB(14))                                       \
+        op(W(XD), Xmm0)                                                     \
+        xorox_rr(Xmm0, Xmm0)                                                \
+        alnox_ri(Xmm0, W(XD), IB(12))                                       \
+        op(Xmm0, W(XD))                                                     \
+        xorox_rr(W(XD), W(XD))                                              \
+        alnox_ri(W(XD), Xmm0, IB(8))                                        \
+        op(W(XD), Xmm0)
+
+#define scsox_rx(XD, XS, op) /* not portable, do not use outside */         \
+        bc0ox_rr(Xmm0, W(XS))                                               \
+        alnox_ri(Xmm0, W(XS), IB(15))                                       \
+        op(Xmm0, W(XS))                                                     \
+        bc0ox_rr(W(XD), Xmm0)                                               \
+        alnox_ri(W(XD), Xmm0, IB(14))                                       \
+        op(W(XD), Xmm0)                                                     \
+        bc0ox_rr(Xmm0, W(XD))                                               \
+        alnox_ri(Xmm0, W(XD), IB(12))                                       \
+        op(Xmm0, W(XD))                                                     \
+        bc0ox_rr(W(XD), Xmm0)                                               \
+        alnox_ri(W(XD), Xmm0, IB(8))                                        \
+        op(W(XD), Xmm0)
+
+#define sceox_rx(XD) /* not portable, do not use outside */                 \
+        xorox_rr(Xmm0, Xmm0)                                                \
+        alnox_ri(Xmm0, W(XD), IB(15))                                       \
+        movox_rr(W(XD), Xmm0)
+
+/* adi (D[i] = S[0] + .. + S[i]) inclusive prefix sum of elements of S
+ * uses Xmm0 implicitly as a temp register, destroys Xmm0, XD/XS != Xmm0 */
+
+#define adios_rr(XD, XS)                                                    \
+        sczox_rx(W(XD), W(XS), addos_rr)
+
+#define adiox_rr(XD, XS)                                                    \
+        sczox_rx(W(XD), W(XS), addox_rr)
+
+/* ade (D[i] = S[0] + .. + S[i-1]) exclusive prefix sum of S, D[0] = 0
+ * uses Xmm0 implicitly as a temp register, destroys Xmm0, XD/XS != Xmm0 */
+
+#define adeos_rr(XD, XS)                                                    \
+        sczox_rx(W(XD), W(XS), addos_rr)                                    \
+        sceox_rx(W(XD))
+
+#define adeox_rr(XD, XS)                                                    \
+        sczox_rx(W(XD), W(XS), addox_rr)                                    \
+        sceox_rx(W(XD))
+
+/* mni (D[i] = min(S[0], .. , S[i])) inclusive prefix min of elements of S
+ * uses Xmm0 implicitly as a temp register, destroys Xmm0, XD/XS != Xmm0 */
+
+#define mnios_rr(XD, XS)                                                    \
+        scsox_rx(W(XD), W(XS), minos_rr)
+
+#define mniox_rr(XD, XS)                                                    \
+        scsox_rx(W(XD), W(XS), minox_rr)
+
+#define mnion_rr(XD, XS)                                                    \
+        scsox_rx(W(XD), W(XS), minon_rr)
+
+/* mxi (D[i] = max(S[0], .. , S[i])) inclusive prefix max of elements of S
+ * uses Xmm0 implicitly as a temp register, destroys Xmm0, XD/XS != Xmm0 */
+
+#define mxios_rr(XD, XS)                                                    \
+        scsox_rx(W(XD), W(XS), maxos_rr)
+
+#define mxiox_rr(XD, XS)                                                    \
+        scsox_rx(W(XD), W(XS), maxox_rr)
+
+#define mxion_rr(XD, XS)                                                    \
+        scsox_rx(W(XD), W(XS), maxon_rr)
+
 #if (RT_512X1 == 1 || RT_512X1 == 4)
 
 /* and (G = G & S), (D = S & T) if (#D != #T) */
@@ -432,6 +644,10 @@
         /* adp, adh are defined in rtbase.h (first 15-regs only)
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  adhos_rr
+#define adhos_rr(XD, XS) /* horizontal reductive add, first 15-regs only */ \
+        hrdos_rx(W(XD), W(XS), TmmX(W(XD), W(XS)), addos_rr)
+
 /* sub (G = G - S), (D = S - T) if (#D != #T) */
 
 #define subos_rr(XG, XS)                                                    \
@@ -469,6 +685,10 @@
         /* mlp, mlh are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  mlhos_rr
+#define mlhos_rr(XD, XS) /* horizontal reductive mul */                     \
+        hrdos_rx(W(XD), W(XS), TmmX(W(XD), W(XS)), mulos_rr)
+
 /* div (G = G / S), (D = S / T) if (#D != #T) and on ARMv7 if (#D != #S) */
 
 #define divos_rr(XG, XS)                                                    \
@@ -615,6 +835,10 @@
         /* mnp, mnh are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  mnhos_rr
+#define mnhos_rr(XD, XS) /* horizontal reductive min */                     \
+        hrdos_rx(W(XD), W(XS), TmmX(W(XD), W(XS)), minos_rr)
+
 /* max (G = G > S ? G : S), (D = S > T ? S : T) if (#D != #T) */
 
 #define maxos_rr(XG, XS)                                                    \
@@ -635,6 +859,10 @@
         /* mxp, mxh are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  mxhos_rr
+#define mxhos_rr(XD, XS) /* horizontal reductive max */                     \
+        hrdos_rx(W(XD), W(XS), TmmX(W(XD), W(XS)), maxos_rr)
+
 /* ceq (G = G == S ? -1 : 0), (D = S == T ? -1 : 0) if (#D != #T) */
 
 #define ceqos_rr(XG, XS)                                                    \
@@ -926,6 +1154,29 @@
         ERX(RXB(XD), RXB(XS), 0x00, RT_SIMD_MODE_##mode&3, 1, 1) EMITB(0x5B)\
         MRM(REG(XD), MOD(XS), REG(XS))
 
+/* cvy (D = fp16-to-fp32 S), widens lower half of fp16 elements in S
+ * cvx (D = fp32-to-fp16 S), narrows to lower half of D, upper half is 0
+ * narrowing rounds to nearest-even, _ld/_st access the lower half only */
+
+#define cvyms_rr(XD, XS)                                                    \
+        EVX(RXB(XD), RXB(XS),    0x00, K, 1, 2) EMITB(0x13)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))
+
+#define cvyms_ld(XD, MS, DS)                                                \
+    ADR EVX(RXB(XD), RXB(MS),    0x00, K, 1, 2) EMITB(0x13)                 \
+        MRM(REG(XD), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#define cvxos_rr(XD, XS)                                                    \
+        EVX(RXB(XS), RXB(XD),    0x00, K, 1, 3) EMITB(0x1D)                 \
+        MRM(REG(XS), MOD(XD), REG(XD))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0x00))
+
+#define cvxos_st(XS, MD, DD)                                                \
+    ADR EVX(RXB(XS), RXB(MD),    0x00, K, 1, 3) EMITB(0x1D)                 \
+        MRM(REG(XS), MOD(MD), REG(MD))                                      \
+        AUX(SIB(MD), CMD(DD), EMITB(0x00))
+
 /************   packed single-precision integer arithmetic/shifts   ***********/
 
 /* add (G = G + S), (D = S + T) if (#D != #T) */
@@ -1090,6 +1341,42 @@
         MRM(REG(XD), MOD(MT), REG(MT))                                      \
         AUX(SIB(MT), CMD(DT), EMPTY)
 
+/* clz (D = number of leading zeroes in each element of S), 32 if 0 */
+
+#define clzox_rr(XD, XS)                                                    \
+        EVX(RXB(XD), RXB(XS),    0x00, K, 1, 2) EMITB(0x44)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))
+
+#define clzox_ld(XD, MS, DS)                                                \
+    ADR EVX(RXB(XD), RXB(MS),    0x00, K, 1, 2) EMITB(0x44)                 \
+        MRM(REG(XD), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#if (RT_512X1 == 2 || RT_512X1 == 8)
+
+/* shh (D = S[IT]) shuffle 16-bit elements within 64-bit halves (not portable)
+ * 2-bit fields of the immediate select 16-bit elements in each 64-bit half */
+
+#define shhox3ri(XD, XS, IT) /* not portable, do not use outside */         \
+        EVX(RXB(XD), RXB(XS),    0x00, K, 3, 1) EMITB(0x70)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(VAL(IT)))                               \
+        EVX(RXB(XD), RXB(XD),    0x00, K, 2, 1) EMITB(0x70)                 \
+        MRM(REG(XD), MOD(XD), REG(XD))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(VAL(IT)))
+
+/* bsw (D = S with the order of bytes reversed in each element) */
+
+#define bswox_rr(XD, XS)                                                    \
+        shhox3ri(W(XD), W(XS), IB(0xB1))                                    \
+        bswmx3rx(W(XD), W(XD), TmmX(W(XD), W(XD)))
+
+#define bswox_ld(XD, MS, DS)                                                \
+        movox_ld(W(XD), W(MS), W(DS))                                       \
+        bswox_rr(W(XD), W(XD))
+
+#endif /* RT_512X1 == 2, 8 */
+
 /****************   packed single-precision integer compare   *****************/
 
 /* min (G = G < S ? G : S), (D = S < T ? S : T) if (#D != #T), unsigned */
@@ -1528,6 +1815,74 @@
         stack_ld(Recx)                                                      \
         stack_ld(Redx)
 
+#undef  sregs_sr
+#define sregs_sr(SM) /* save SIMD regs in SM mask, destroys Reax */         \
+        movxx_ld(Reax, Mebp, inf_REGS)                                      \
+        sregs_xr(SM, movox_st, Xmm0, RT_SIMD_WIDTH32*4)                     \
+        sregs_xr(SM, movox_st, Xmm1, RT_SIMD_WIDTH32*4)                     \
+        sregs_xr(SM, movox_st, Xmm2, RT_SIMD_WIDTH32*4)                     \
+        sregs_xr(SM, movox_st, Xmm3, RT_SIMD_WIDTH32*4)                     \
+        sregs_xr(SM, movox_st, Xmm4, RT_SIMD_WIDTH32*4)                     \
+        sregs_xr(SM, movox_st, Xmm5, RT_SIMD_WIDTH32*4)                     \
+        sregs_xr(SM, movox_st, Xmm6, RT_SIMD_WIDTH32*4)                     \
+        sregs_xr(SM, movox_st, Xmm7, RT_SIMD_WIDTH32*4)                     \
+        sregs_xr(SM, movox_st, Xmm8, RT_SIMD_WIDTH32*4)                     \
+        sregs_xr(SM, movox_st, Xmm9, RT_SIMD_WIDTH32*4)                     \
+        sregs_xr(SM, movox_st, XmmA, RT_SIMD_WIDTH32*4)                     \
+        sregs_xr(SM, movox_st, XmmB, RT_SIMD_WIDTH32*4)                     \
+        sregs_xr(SM, movox_st, XmmC, RT_SIMD_WIDTH32*4)                     \
+        sregs_xr(SM, movox_st, XmmD, RT_SIMD_WIDTH32*4)                     \
+        sregs_xr(SM, movox_st, XmmE, RT_SIMD_WIDTH32*4)                     \
+        sregs_xr(SM, movox_st, XmmF, RT_SIMD_WIDTH32*4)                     \
+        sregs_xr(SM, movox_st, XmmG, RT_SIMD_WIDTH32*4)                     \
+        sregs_xr(SM, movox_st, XmmH, RT_SIMD_WIDTH32*4)                     \
+        sregs_xr(SM, movox_st, XmmI, RT_SIMD_WIDTH32*4)                     \
+        sregs_xr(SM, movox_st, XmmJ, RT_SIMD_WIDTH32*4)                     \
+        sregs_xr(SM, movox_st, XmmK, RT_SIMD_WIDTH32*4)                     \
+        sregs_xr(SM, movox_st, XmmL, RT_SIMD_WIDTH32*4)                     \
+        sregs_xr(SM, movox_st, XmmM, RT_SIMD_WIDTH32*4)                     \
+        sregs_xr(SM, movox_st, XmmN, RT_SIMD_WIDTH32*4)                     \
+        sregs_xr(SM, movox_st, XmmO, RT_SIMD_WIDTH32*4)                     \
+        sregs_xr(SM, movox_st, XmmP, RT_SIMD_WIDTH32*4)                     \
+        sregs_xr(SM, movox_st, XmmQ, RT_SIMD_WIDTH32*4)                     \
+        sregs_xr(SM, movox_st, XmmR, RT_SIMD_WIDTH32*4)                     \
+        sregs_xr(SM, movox_st, XmmS, RT_SIMD_WIDTH32*4)                     \
+        sregs_xr(SM, movox_st, XmmT, RT_SIMD_WIDTH32*4)
+
+#undef  sregs_lr
+#define sregs_lr(SM) /* load SIMD regs in SM mask, destroys Reax */         \
+        movxx_ld(Reax, Mebp, inf_REGS)                                      \
+        sregs_xr(SM, movox_ld, Xmm0, RT_SIMD_WIDTH32*4)                     \
+        sregs_xr(SM, movox_ld, Xmm1, RT_SIMD_WIDTH32*4)                     \
+        sregs_xr(SM, movox_ld, Xmm2, RT_SIMD_WIDTH32*4)                     \
+        sregs_xr(SM, movox_ld, Xmm3, RT_SIMD_WIDTH32*4)                     \
+        sregs_xr(SM, movox_ld, Xmm4, RT_SIMD_WIDTH32*4)                     \
+        sregs_xr(SM, movox_ld, Xmm5, RT_SIMD_WIDTH32*4)                     \
+        sregs_xr(SM, movox_ld, Xmm6, RT_SIMD_WIDTH32*4)                     \
+        sregs_xr(SM, movox_ld, Xmm7, RT_SIMD_WIDTH32*4)                     \
+        sregs_xr(SM, movox_ld, Xmm8, RT_SIMD_WIDTH32*4)                     \
+        sregs_xr(SM, movox_ld, Xmm9, RT_SIMD_WIDTH32*4)                     \
+        sregs_xr(SM, movox_ld, XmmA, RT_SIMD_WIDTH32*4)                     \
+        sregs_xr(SM, movox_ld, XmmB, RT_SIMD_WIDTH32*4)                     \
+        sregs_xr(SM, movox_ld, XmmC, RT_SIMD_WIDTH32*4)                     \
+        sregs_xr(SM, movox_ld, XmmD, RT_SIMD_WIDTH32*4)                     \
+        sregs_xr(SM, movox_ld, XmmE, RT_SIMD_WIDTH32*4)                     \
+        sregs_xr(SM, movox_ld, XmmF, RT_SIMD_WIDTH32*4)                     \
+        sregs_xr(SM, movox_ld, XmmG, RT_SIMD_WIDTH32*4)                     \
+        sregs_xr(SM, movox_ld, XmmH, RT_SIMD_WIDTH32*4)                     \
+        sregs_xr(SM, movox_ld, XmmI, RT_SIMD_WIDTH32*4)                     \
+        sregs_xr(SM, movox_ld, XmmJ, RT_SIMD_WIDTH32*4)                     \
+        sregs_xr(SM, movox_ld, XmmK, RT_SIMD_WIDTH32*4)                     \
+        sregs_xr(SM, movox_ld, XmmL, RT_SIMD_WIDTH32*4)                     \
+        sregs_xr(SM, movox_ld, XmmM, RT_SIMD_WIDTH32*4)                     \
+        sregs_xr(SM, movox_ld, XmmN, RT_SIMD_WIDTH32*4)                     \
+        sregs_xr(SM, movox_ld, XmmO, RT_SIMD_WIDTH32*4)                     \
+        sregs_xr(SM, movox_ld, XmmP, RT_SIMD_WIDTH32*4)                     \
+        sregs_xr(SM, movox_ld, XmmQ, RT_SIMD_WIDTH32*4)                     \
+        sregs_xr(SM, movox_ld, XmmR, RT_SIMD_WIDTH32*4)                     \
+        sregs_xr(SM, movox_ld, XmmS, RT_SIMD_WIDTH32*4)                     \
+        sregs_xr(SM, movox_ld, XmmT, RT_SIMD_WIDTH32*4)
+
 #endif /* RT_512X1 */
 
 #endif /* RT_SIMD_CODE */
@@ -206,6 +206,17 @@
         MRM(REG(XS),    0x02, REG(MD))                                      \
         AUX(SIB(MD), EMITW(VZL(DD)), EMPTY)
 
+/* stn (D = S) non-temporal store, bypasses caches on the way to memory
+ * weakly-ordered, place sfnce_xx before [D] is read by other threads */
+
+#define stnox_st(XS, MD, DD)                                                \
+    ADR EVX(RXB(XS), RXB(MD),    0x00, K, 0, 1) EMITB(0x2B)                 \
+        MRM(REG(XS),    0x02, REG(MD))                                      \
+        AUX(SIB(MD), EMITW(VAL(DD)), EMPTY)                                 \
+    ADR EVX(RMB(XS), RXB(MD),    0x00, K, 0, 1) EMITB(0x2B)                 \
+        MRM(REG(XS),    0x02, REG(MD))                                      \
+        AUX(SIB(MD), EMITW(VZL(DD)), EMPTY)
+
 /* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
  * uses Xmm0 implicitly as a mask register, destroys Xmm0, 0-masked XS elems */
 
@@ -1843,6 +1854,46 @@
         stack_ld(Recx)                                                      \
         stack_ld(Redx)
 
+#undef  sregs_sr
+#define sregs_sr(SM) /* save SIMD regs in SM mask, destroys Reax */         \
+        movxx_ld(Reax, Mebp, inf_REGS)                                      \
+        sregs_xr(SM, movox_st, Xmm0, RT_SIMD_WIDTH32*4)                     \
+        sregs_xr(SM, movox_st, Xmm1, RT_SIMD_WIDTH32*4)                     \
+        sregs_xr(SM, movox_st, Xmm2, RT_SIMD_WIDTH32*4)                     \
+        sregs_xr(SM, movox_st, Xmm3, RT_SIMD_WIDTH32*4)                     \
+        sregs_xr(SM, movox_st, Xmm4, RT_SIMD_WIDTH32*4)                     \
+        sregs_xr(SM, movox_st, Xmm5, RT_SIMD_WIDTH32*4)                     \
+        sregs_xr(SM, movox_st, Xmm6, RT_SIMD_WIDTH32*4)                     \
+        sregs_xr(SM, movox_st, Xmm7, RT_SIMD_WIDTH32*4)                     \
+        sregs_xr(SM, movox_st, Xmm8, RT_SIMD_WIDTH32*4)                     \
+        sregs_xr(SM, movox_st, Xmm9, RT_SIMD_WIDTH32*4)                     \
+        sregs_xr(SM, movox_st, XmmA, RT_SIMD_WIDTH32*4)                     \
+        sregs_xr(SM, movox_st, XmmB, RT_SIMD_WIDTH32*4)                     \
+        sregs_xr(SM, movox_st, XmmC, RT_SIMD_WIDTH32*4)                     \
+        sregs_xr(SM, movox_st, XmmD, RT_SIMD_WIDTH32*4)                     \
+        sregs_xr(SM, movox_st, XmmE, RT_SIMD_WIDTH32*4)                     \
+        sregs_xr(SM, movox_st, XmmF, RT_SIMD_WIDTH32*4)
+
+#undef  sregs_lr
+#define sregs_lr(SM) /* load SIMD regs in SM mask, destroys Reax */         \
+        movxx_ld(Reax, Mebp, inf_REGS)                                      \
+        sregs_xr(SM, movox_ld, Xmm0, RT_SIMD_WIDTH32*4)                     \
+        sregs_xr(SM, movox_ld, Xmm1, RT_SIMD_WIDTH32*4)                     \
+        sregs_xr(SM, movox_ld, Xmm2, RT_SIMD_WIDTH32*4)                     \
+        sregs_xr(SM, movox_ld, Xmm3, RT_SIMD_WIDTH32*4)                     \
+        sregs_xr(SM, movox_ld, Xmm4, RT_SIMD_WIDTH32*4)                     \
+        sregs_xr(SM, movox_ld, Xmm5, RT_SIMD_WIDTH32*4)                     \
+        sregs_xr(SM, movox_ld, Xmm6, RT_SIMD_WIDTH32*4)                     \
+        sregs_xr(SM, movox_ld, Xmm7, RT_SIMD_WIDTH32*4)                     \
+        sregs_xr(SM, movox_ld, Xmm8, RT_SIMD_WIDTH32*4)                     \
+        sregs_xr(SM, movox_ld, Xmm9, RT_SIMD_WIDTH32*4)                     \
+        sregs_xr(SM, movox_ld, XmmA, RT_SIMD_WIDTH32*4)                     \
+        sregs_xr(SM, movox_ld, XmmB, RT_SIMD_WIDTH32*4)                     \
+        sregs_xr(SM, movox_ld, XmmC, RT_SIMD_WIDTH32*4)                     \
+        sregs_xr(SM, movox_ld, XmmD, RT_SIMD_WIDTH32*4)                     \
+        sregs_xr(SM, movox_ld, XmmE, RT_SIMD_WIDTH32*4)                     \
+        sregs_xr(SM, movox_ld, XmmF, RT_SIMD_WIDTH32*4)
+
 #endif /* RT_512X2 */
 
 #endif /* RT_SIMD_CODE */
@@ -223,6 +223,23 @@
         MRM(REG(XS),    0x02, REG(MD))                                      \
         AUX(SIB(MD), EMITW(VTL(DD)), EMPTY)
 
+/* stn (D = S) non-temporal store, bypasses caches on the way to memory
+ * weakly-ordered, place sfnce_xx before [D] is read by other threads */
+
+#define stnox_st(XS, MD, DD)                                                \
+    ADR EVX(0,       RXB(MD),    0x00, K, 0, 1) EMITB(0x2B)                 \
+        MRM(REG(XS),    0x02, REG(MD))                                      \
+        AUX(SIB(MD), EMITW(VAL(DD)), EMPTY)                                 \
+    ADR EVX(1,       RXB(MD),    0x00, K, 0, 1) EMITB(0x2B)                 \
+        MRM(REG(XS),    0x02, REG(MD))                                      \
+        AUX(SIB(MD), EMITW(VZL(DD)), EMPTY)                                 \
+    ADR EVX(2,       RXB(MD),    0x00, K, 0, 1) EMITB(0x2B)                 \
+        MRM(REG(XS),    0x02, REG(MD))                                      \
+        AUX(SIB(MD), EMITW(VSL(DD)), EMPTY)                                 \
+    ADR EVX(3,       RXB(MD),    0x00, K, 0, 1) EMITB(0x2B)                 \
+        MRM(REG(XS),    0x02, REG(MD))                                      \
+        AUX(SIB(MD), EMITW(VTL(DD)), EMPTY)
+
 /* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
  * uses Xmm0 implicitly as a mask register, destroys Xmm0, 0-masked XS elems */
 
@@ -2546,6 +2563,30 @@
         stack_ld(Recx)                                                      \
         stack_ld(Redx)
 
+#undef  sregs_sr
+#define sregs_sr(SM) /* save SIMD regs in SM mask, destroys Reax */         \
+        movxx_ld(Reax, Mebp, inf_REGS)                                      \
+        sregs_xr(SM, movox_st, Xmm0, RT_SIMD_WIDTH32*4)                     \
+        sregs_xr(SM, movox_st, Xmm1, RT_SIMD_WIDTH32*4)                     \
+        sregs_xr(SM, movox_st, Xmm2, RT_SIMD_WIDTH32*4)                     \
+        sregs_xr(SM, movox_st, Xmm3, RT_SIMD_WIDTH32*4)                     \
+        sregs_xr(SM, movox_st, Xmm4, RT_SIMD_WIDTH32*4)                     \
+        sregs_xr(SM, movox_st, Xmm5, RT_SIMD_WIDTH32*4)                     \
+        sregs_xr(SM, movox_st, Xmm6, RT_SIMD_WIDTH32*4)                     \
+        sregs_xr(SM, movox_st, Xmm7, RT_SIMD_WIDTH32*4)
+
+#undef  sregs_lr
+#define sregs_lr(SM) /* load SIMD regs in SM mask, destroys Reax */         \
+        movxx_ld(Reax, Mebp, inf_REGS)                                      \
+        sregs_xr(SM, movox_ld, Xmm0, RT_SIMD_WIDTH32*4)                     \
+        sregs_xr(SM, movox_ld, Xmm1, RT_SIMD_WIDTH32*4)                     \
+        sregs_xr(SM, movox_ld, Xmm2, RT_SIMD_WIDTH32*4)                     \
+        sregs_xr(SM, movox_ld, Xmm3, RT_SIMD_WIDTH32*4)                     \
+        sregs_xr(SM, movox_ld, Xmm4, RT_SIMD_WIDTH32*4)                     \
+        sregs_xr(SM, movox_ld, Xmm5, RT_SIMD_WIDTH32*4)                     \
+        sregs_xr(SM, movox_ld, Xmm6, RT_SIMD_WIDTH32*4)                     \
+        sregs_xr(SM, movox_ld, Xmm7, RT_SIMD_WIDTH32*4)
+
 #endif /* RT_512X4 */
 
 #endif /* RT_SIMD_CODE */
@@ -1292,6 +1292,120 @@
 #define remzn_xm(MS, DS)    /* to be placed immediately after divzn_xm */   \
                                      /* to produce remainder Redx<-rem */
 
+/* cnt (D = number of bits set in S), population count
+ * clz (D = number of leading zeroes in S), 64 if S is 0
+ * ctz (D = number of trailing zeroes in S), 64 if S is 0
+ * set-flags: undefined */
+
+#if RT_BASE_COMPAT_BMI < 2 /* 0 - generic, 1 - 3-op-VEX, 2 - BMI1+BMI2 */
+
+#define cntzx_rr(RD, RS)                                                    \
+        movzx_rr(W(RD), W(RS))                                              \
+        REW(0,             1) EMITB(0xBF)  /* <- r15 = 0xAAAA...AAAA */     \
+        EMITW(0xAAAAAAAA) EMITW(0xAAAAAAAA)                                 \
+        REW(RXB(RD),       1) EMITB(0x21)  /* <- r15 &= RD */               \
+        MRM(REG(RD),    0x03,    0x07)                                      \
+        REW(0,             1) EMITB(0xD1)  /* <- r15 >>= 1 */               \
+        MRM(0x05,       0x03,    0x07)                                      \
+        REW(1,       RXB(RD)) EMITB(0x29)  /* <- RD -= r15 */               \
+        MRM(0x07,    MOD(RD), REG(RD))                                      \
+        REW(0,             1) EMITB(0xBF)  /* <- r15 = 0xCCCC...CCCC */     \
+        EMITW(0xCCCCCCCC) EMITW(0xCCCCCCCC)                                 \
+        REW(RXB(RD),       1) EMITB(0x21)  /* <- r15 &= RD */               \
+        MRM(REG(RD),    0x03,    0x07)                                      \
+        REW(1,       RXB(RD)) EMITB(0x29)  /* <- RD -= r15 */               \
+        MRM(0x07,    MOD(RD), REG(RD))                                      \
+        REW(0,             1) EMITB(0xC1)  /* <- r15 >>= 2 */               \
+        MRM(0x05,       0x03,    0x07)                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0x02))                                  \
+        REW(1,       RXB(RD)) EMITB(0x01)  /* <- RD += r15 */               \
+        MRM(0x07,    MOD(RD), REG(RD))                                      \
+        REW(RXB(RD),       1) EMITB(0x89)  /* <- r15 = RD */                \
+        MRM(REG(RD),    0x03,    0x07)                                      \
+        REW(0,             1) EMITB(0xC1)  /* <- r15 >>= 4 */               \
+        MRM(0x05,       0x03,    0x07)                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0x04))                                  \
+        REW(1,       RXB(RD)) EMITB(0x01)  /* <- RD += r15 */               \
+        MRM(0x07,    MOD(RD), REG(RD))                                      \
+        REW(0,             1) EMITB(0xBF)  /* <- r15 = 0x0F0F...0F0F */     \
+        EMITW(0x0F0F0F0F) EMITW(0x0F0F0F0F)                                 \
+        REW(1,       RXB(RD)) EMITB(0x21)  /* <- RD &= r15 */               \
+        MRM(0x07,    MOD(RD), REG(RD))                                      \
+        REW(0,             1) EMITB(0xBF)  /* <- r15 = 0x0101...0101 */     \
+        EMITW(0x01010101) EMITW(0x01010101)                                 \
+        REW(RXB(RD),       1) EMITB(0x0F) EMITB(0xAF)  /* <- RD *= r15 */   \
+        MRM(REG(RD),    0x03,    0x07)                                      \
+        shrzx_ri(W(RD), IB(56))
+
+#define clzzx_rr(RD, RS)                                                    \
+        REW(1,       RXB(RS)) EMITB(0x0F) EMITB(0xBD)  /* <- bsr r15 */     \
+        MRM(0x07,    MOD(RS), REG(RS))                                      \
+        movzx_ri(W(RD), IB(127))                                            \
+        REW(RXB(RD),       1) EMITB(0x0F) EMITB(0x45)  /* <- cmovnz */      \
+        MRM(REG(RD),    0x03,    0x07)                                      \
+        xorzx_ri(W(RD), IB(63))
+
+#define ctzzx_rr(RD, RS)                                                    \
+        REW(1,       RXB(RS)) EMITB(0x0F) EMITB(0xBC)  /* <- bsf r15 */     \
+        MRM(0x07,    MOD(RS), REG(RS))                                      \
+        movzx_ri(W(RD), IB(64))                                             \
+        REW(RXB(RD),       1) EMITB(0x0F) EMITB(0x45)  /* <- cmovnz */      \
+        MRM(REG(RD),    0x03,    0x07)
+
+#define cntzx_ld(RD, MS, DS)                                                \
+        movzx_ld(W(RD), W(MS), W(DS))                                       \
+        cntzx_rr(W(RD), W(RD))
+
+#define clzzx_ld(RD, MS, DS)                                                \
+        movzx_ld(W(RD), W(MS), W(DS))                                       \
+        clzzx_rr(W(RD), W(RD))
+
+#define ctzzx_ld(RD, MS, DS)                                                \
+        movzx_ld(W(RD), W(MS), W(DS))                                       \
+        ctzzx_rr(W(RD), W(RD))
+
+#else /* RT_BASE_COMPAT_BMI >= 2 */
+
+#define cntzx_rr(RD, RS)                                                    \
+        EMITB(0xF3) REW(RXB(RD), RXB(RS)) EMITB(0x0F) EMITB(0xB8)           \
+        MRM(REG(RD), MOD(RS), REG(RS))
+
+#define cntzx_ld(RD, MS, DS)                                                \
+    ADR EMITB(0xF3) REW(RXB(RD), RXB(MS)) EMITB(0x0F) EMITB(0xB8)           \
+        MRM(REG(RD), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#define clzzx_rr(RD, RS)                                                    \
+        EMITB(0xF3) REW(RXB(RD), RXB(RS)) EMITB(0x0F) EMITB(0xBD)           \
+        MRM(REG(RD), MOD(RS), REG(RS))
+
+#define clzzx_ld(RD, MS, DS)                                                \
+    ADR EMITB(0xF3) REW(RXB(RD), RXB(MS)) EMITB(0x0F) EMITB(0xBD)           \
+        MRM(REG(RD), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#define ctzzx_rr(RD, RS)                                                    \
+        EMITB(0xF3) REW(RXB(RD), RXB(RS)) EMITB(0x0F) EMITB(0xBC)           \
+        MRM(REG(RD), MOD(RS), REG(RS))
+
+#define ctzzx_ld(RD, MS, DS)                                                \
+    ADR EMITB(0xF3) REW(RXB(RD), RXB(MS)) EMITB(0x0F) EMITB(0xBC)           \
+        MRM(REG(RD), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#endif /* RT_BASE_COMPAT_BMI >= 2 */
+
+/* bsw (D = S with the order of bytes reversed), byte-swap
+ * set-flags: no */
+
+#define bswzx_rr(RD, RS)                                                    \
+        movzx_rr(W(RD), W(RS))                                              \
+        REW(0,       RXB(RD)) EMITB(0x0F) EMITB(0xC8 | REG(RD))
+
+#define bswzx_ld(RD, MS, DS)                                                \
+        movzx_ld(W(RD), W(MS), W(DS))                                       \
+        REW(0,       RXB(RD)) EMITB(0x0F) EMITB(0xC8 | REG(RD))
+
 /* arj (G = G op S, if cc G then jump lb)
  * set-flags: undefined
  * refer to individual instruction descriptions
@@ -165,6 +165,21 @@
         MRM(REG(XS), MOD(MD), REG(MD))                                      \
         AUX(SIB(MD), CMD(DD), EMPTY)
 
+/* stn (D = S) non-temporal store, bypasses caches on the way to memory
+ * weakly-ordered, place sfnce_xx before [D] is read by other threads */
+
+#define stnjx_st(XS, MD, DD)                                                \
+    ADR EVW(RXB(XS), RXB(MD),    0x00, 0, 1, 1) EMITB(0x2B)                 \
+        MRM(REG(XS), MOD(MD), REG(MD))                                      \
+        AUX(SIB(MD), CMD(DD), EMPTY)
+
+/* bcs (D = [M]) broadcast scalar element from memory into all SIMD elements */
+
+#define bcsjx_ld(XD, MS, DS)                                                \
+    ADR EVW(RXB(XD), RXB(MS),    0x00, 0, 3, 1) EMITB(0x12)                 \
+        MRM(REG(XD), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
 /* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
  * uses Xmm0 implicitly as a mask register, destroys Xmm0, 0-masked XS elems */
 
@@ -185,6 +200,104 @@
         MRM(REG(XS), MOD(MG), REG(MG))                                      \
         AUX(SIB(MG), CMD(DG), EMPTY)
 
+/* shf (G = G[IS]), (D = S[IT]) shuffle elements within each 128-bit lane
+ * 1-bit fields of the immediate select 64-bit elements in each 128-bit lane */
+
+#define shfjx_ri(XG, IS)                                                    \
+        shfjx3ri(W(XG), W(XG), W(IS))
+
+#define shfjx3ri(XD, XS, IT)                                                \
+        EVW(RXB(XD), RXB(XS),    0x00, 0, 1, 3) EMITB(0x05)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(((VAL(IT) & 3) * 0x55)))
+
+/* hrd (D = S op S op ..) reduce all elements of S with "op" into each of D
+ * in log2 steps via in-register shuffles, temporary register is preserved */
+
+#define hrdjs_rx(XD, XS, XT, op) /* not portable, do not use outside */     \
+        movjx_st(W(XT), Mebp, inf_SCR02(0))                                 \
+        shfjx3ri(W(XT), W(XS), IB(1))                                       \
+        op(W(XT), W(XS))                                                    \
+        movjx_rr(W(XD), W(XT))                                              \
+        movjx_ld(W(XT), Mebp, inf_SCR02(0))
+
+/* aln (G = [S:G] >> IT) concatenate S and G, shift right by IT elements
+ * keeping the lower half, bc0 (D = S[0]) broadcast element 0 (not portable) */
+
+#define alnjx_ri(XG, XS, IT) /* not portable, do not use outside */         \
+        EVW(RXB(XG), RXB(XG), REN(XS), 0, 1, 3) EMITB(0x03)                 \
+        MRM(REG(XG), MOD(XG), REG(XG))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(VAL(IT)))
+
+#define bc0jx_rr(XD, XS) /* not portable, do not use outside */             \
+        EVW(RXB(XD), RXB(XS),    0x00, 0, 1, 2) EMITB(0x59)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))
+
+/* scn (D[i] = S[0] op .. op S[i]) inclusive scan of S with "op" in log2
+ * steps, scz shifts in zeroes (add), scs repeats S[0] (min/max, idempotent),
+ * sce shifts D up by one element (exclusive scan), Xmm0 is used as a temp */
+
+#define sczjx_rx(XD, XS, op) /* not portable, do not use outside */         \
+        xorjx_rr(Xmm0, Xmm0)                                                \
+        alnjx_ri(Xmm0, W(XS), IB(1))                                        \
+        op(Xmm0, W(XS))                                                     \
+        movjx_rr(W(XD), Xmm0)
+
+#define scsjx_rx(XD, XS, op) /* not portable, do not use outside */         \
+        bc0jx_rr(Xmm0, W(XS))                                               \
+        alnjx_ri(Xmm0, W(XS), IB(1))                                        \
+        op(Xmm0, W(XS))                                                     \
+        movjx_rr(W(XD), Xmm0)
+
+#define scejx_rx(XD) /* not portable, do not use outside */                 \
+        xorjx_rr(Xmm0, Xmm0)                                                \
+        alnjx_ri(Xmm0, W(XD), IB(1))                                        \
+        movjx_rr(W(XD), Xmm0)
+
+/* adi (D[i] = S[0] + .. + S[i]) inclusive prefix sum of elements of S
+ * uses Xmm0 implicitly as a temp register, destroys Xmm0, XD/XS != Xmm0 */
+
+#define adijs_rr(XD, XS)                                                    \
+        sczjx_rx(W(XD), W(XS), addjs_rr)
+
+#define adijx_rr(XD, XS)                                                    \
+        sczjx_rx(W(XD), W(XS), addjx_rr)
+
+/* ade (D[i] = S[0] + .. + S[i-1]) exclusive prefix sum of S, D[0] = 0
+ * uses Xmm0 implicitly as a temp register, destroys Xmm0, XD/XS != Xmm0 */
+
+#define adejs_rr(XD, XS)                                                    \
+        sczjx_rx(W(XD), W(XS), addjs_rr)                                    \
+        scejx_rx(W(XD))
+
+#define adejx_rr(XD, XS)                                                    \
+        sczjx_rx(W(XD), W(XS), addjx_rr)                                    \
+        scejx_rx(W(XD))
+
+/* mni (D[i] = min(S[0], .. , S[i])) inclusive prefix min of elements of S
+ * uses Xmm0 implicitly as a temp register, destroys Xmm0, XD/XS != Xmm0 */
+
+#define mnijs_rr(XD, XS)                                                    \
+        scsjx_rx(W(XD), W(XS), minjs_rr)
+
+#define mnijx_rr(XD, XS)                                                    \
+        scsjx_rx(W(XD), W(XS), minjx_rr)
+
+#define mnijn_rr(XD, XS)                                                    \
+        scsjx_rx(W(XD), W(XS), minjn_rr)
+
+/* mxi (D[i] = max(S[0], .. , S[i])) inclusive prefix max of elements of S
+ * uses Xmm0 implicitly as a temp register, destroys Xmm0, XD/XS != Xmm0 */
+
+#define mxijs_rr(XD, XS)                                                    \
+        scsjx_rx(W(XD), W(XS), maxjs_rr)
+
+#define mxijx_rr(XD, XS)                                                    \
+        scsjx_rx(W(XD), W(XS), maxjx_rr)
+
+#define mxijn_rr(XD, XS)                                                    \
+        scsjx_rx(W(XD), W(XS), maxjn_rr)
+
 /* and (G = G & S), (D = S & T) if (#D != #T) */
 
 #define andjx_rr(XG, XS)                                                    \
@@ -309,6 +422,10 @@
         /* adp, adh are defined in rtbase.h (first 15-regs only)
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  adhjs_rr
+#define adhjs_rr(XD, XS) /* horizontal reductive add, first 15-regs only */ \
+        hrdjs_rx(W(XD), W(XS), TmmX(W(XD), W(XS)), addjs_rr)
+
 #undef  adpjs3rr
 #define adpjs3rr(XD, XS, XT)                                                \
         VEX(RXB(XD), RXB(XT), REN(XS), 0, 1, 1) EMITB(0x7C)                 \
@@ -357,6 +474,10 @@
         /* mlp, mlh are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  mlhjs_rr
+#define mlhjs_rr(XD, XS) /* horizontal reductive mul */                     \
+        hrdjs_rx(W(XD), W(XS), TmmX(W(XD), W(XS)), muljs_rr)
+
 /* div (G = G / S), (D = S / T) if (#D != #T) and on ARMv7 if (#D != #S) */
 
 #define divjs_rr(XG, XS)                                                    \
@@ -503,6 +624,10 @@
         /* mnp, mnh are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  mnhjs_rr
+#define mnhjs_rr(XD, XS) /* horizontal reductive min */                     \
+        hrdjs_rx(W(XD), W(XS), TmmX(W(XD), W(XS)), minjs_rr)
+
 /* max (G = G > S ? G : S), (D = S > T ? S : T) if (#D != #T) */
 
 #define maxjs_rr(XG, XS)                                                    \
@@ -523,6 +648,10 @@
         /* mxp, mxh are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  mxhjs_rr
+#define mxhjs_rr(XD, XS) /* horizontal reductive max */                     \
+        hrdjs_rx(W(XD), W(XS), TmmX(W(XD), W(XS)), maxjs_rr)
+
 /* ceq (G = G == S ? -1 : 0), (D = S == T ? -1 : 0) if (#D != #T) */
 
 #define ceqjs_rr(XG, XS)                                                    \
@@ -819,6 +948,36 @@
         ERW(RXB(XD), RXB(XS), 0x00, RT_SIMD_MODE_##mode&3, 1, 1) EMITB(0x7B)\
         MRM(REG(XD), MOD(XS), REG(XS))
 
+/* cvy (D = fp32-to-fp64 S), widens lower half of fp32 elements in S
+ * cvu (D = fp32-to-fp64 S), widens upper half of fp32 elements in S
+ * cvx (D = fp64-to-fp32 S), narrows to lower half of D, upper half is 0
+ * narrowing rounds as set in fp control register (in FCTRL blocks)
+ * _ld/_st access the lower half only, _st uses inf_SCR02 to keep S */
+
+#define cvyis_rr(XD, XS)                                                    \
+        EVX(RXB(XD), RXB(XS),    0x00, 0, 0, 1) EMITB(0x5A)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))
+
+#define cvyis_ld(XD, MS, DS)                                                \
+    ADR EVX(RXB(XD), RXB(MS),    0x00, 0, 0, 1) EMITB(0x5A)                 \
+        MRM(REG(XD), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#define cvuis_rr(XD, XS)                                                    \
+        EVX(RXB(XD), RXB(XS), REN(XD), 0, 0, 1) EMITB(0x12)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))                                      \
+        cvyis_rr(W(XD), W(XD))
+
+#define cvxjs_rr(XD, XS)                                                    \
+        EVW(RXB(XD), RXB(XS),    0x00, 0, 1, 1) EMITB(0x5A)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))
+
+#define cvxjs_st(XS, MD, DD)                                                \
+        movjx_st(W(XS), Mebp, inf_SCR02(0))                                 \
+        cvxjs_rr(W(XS), W(XS))                                              \
+        movts_st(W(XS), W(MD), W(DD))                                       \
+        movjx_ld(W(XS), Mebp, inf_SCR02(0))
+
 /************   packed double-precision integer arithmetic/shifts   ***********/
 
 /* add (G = G + S), (D = S + T) if (#D != #T) */
@@ -983,6 +1142,68 @@
         MRM(REG(XD), MOD(MT), REG(MT))                                      \
         AUX(SIB(MT), CMD(DT), EMPTY)
 
+/* clz (D = number of leading zeroes in each element of S), 64 if 0 */
+
+#define clzjx_rr(XD, XS)                                                    \
+        EVW(RXB(XD), RXB(XS),    0x00, 0, 1, 2) EMITB(0x44)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))
+
+#define clzjx_ld(XD, MS, DS)                                                \
+    ADR EVW(RXB(XD), RXB(MS),    0x00, 0, 1, 2) EMITB(0x44)                 \
+        MRM(REG(XD), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+/* cvy (D = S), zero-[x] or sign-[n] extends lower half of 32-bit elements
+ * cvu (D = S), zero-[x] or sign-[n] extends upper half of 32-bit elements
+ * cvx (D = S), narrows signed 64-bit elements to lower half of D, upper is 0
+ * with unsigned-[x] or signed-[n] saturation into 32-bit elements */
+
+#define cvyix_rr(XD, XS)                                                    \
+        EVX(RXB(XD), RXB(XS),    0x00, 0, 1, 2) EMITB(0x35)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))
+
+#define cvyin_rr(XD, XS)                                                    \
+        EVX(RXB(XD), RXB(XS),    0x00, 0, 1, 2) EMITB(0x25)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))
+
+#define cvuix_rr(XD, XS)                                                    \
+        EVX(RXB(XD), RXB(XS),    0x00, 0, 1, 1) EMITB(0x70)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0xEE))                                  \
+        cvyix_rr(W(XD), W(XD))
+
+#define cvuin_rr(XD, XS)                                                    \
+        EVX(RXB(XD), RXB(XS),    0x00, 0, 1, 1) EMITB(0x70)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0xEE))                                  \
+        cvyin_rr(W(XD), W(XD))
+
+#define cvxjx_rr(XD, XS)                                                    \
+        cvxjx3ld(W(XD), W(XS), Mebp, inf_GPC06_64)
+
+#define cvxjn_rr(XD, XS)                                                    \
+        EVX(RXB(XS), RXB(XD),    0x00, 0, 2, 2) EMITB(0x25)                 \
+        MRM(REG(XS), MOD(XD), REG(XD))
+
+/* k1 keeps non-negative elements (sign bit clear in MT), others are zeroed */
+
+#define cvxjx3ld(XD, XS, MT, DT) /* not portable, do not use outside */     \
+    ADR EVW(0,       RXB(MT), REN(XS), 0, 2, 2) EMITB(0x27)                 \
+        MRM(0x01,    MOD(MT), REG(MT))                                      \
+        AUX(SIB(MT), CMD(DT), EMPTY)                                        \
+        EZX(RXB(XS), RXB(XD),    0x00, 0, 2, 2) EMITB(0x15)                 \
+        MRM(REG(XS), MOD(XD), REG(XD))
+
+/* bsw (D = S with the order of bytes reversed in each element) */
+
+#define bswjx_rr(XD, XS)                                                    \
+        shhix3ri(W(XD), W(XS), IB(0x1B))                                    \
+        bswgx3rx(W(XD), W(XD), TmmX(W(XD), W(XD)))
+
+#define bswjx_ld(XD, MS, DS)                                                \
+        movjx_ld(W(XD), W(MS), W(DS))                                       \
+        bswjx_rr(W(XD), W(XD))
+
 /****************   packed double-precision integer compare   *****************/
 
 /* min (G = G < S ? G : S), (D = S < T ? S : T) if (#D != #T), unsigned */
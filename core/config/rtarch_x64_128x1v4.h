@@ -160,6 +160,23 @@ ADR ESC REX(RXB(XS), RXB(MD)) EMITB(0x0F) EMITB(0x29)                       \
         MRM(REG(XS), MOD(MD), REG(MD))                                      \
         AUX(SIB(MD), CMD(DD), EMPTY)
 
+/* stn (D = S) non-temporal store, bypasses caches on the way to memory
+ * weakly-ordered, place sfnce_xx before [D] is read by other threads */
+
+#define stnjx_st(XS, MD, DD)                                                \
+ADR ESC REX(RXB(XS), RXB(MD)) EMITB(0x0F) EMITB(0x2B)                       \
+        MRM(REG(XS), MOD(MD), REG(MD))                                      \
+        AUX(SIB(MD), CMD(DD), EMPTY)
+
+/* bcs (D = [M]) broadcast scalar element from memory into all SIMD elements */
+
+#define bcsjx_ld(XD, MS, DS)                                                \
+ADR xF2 REX(RXB(XD), RXB(MS)) EMITB(0x0F) EMITB(0x10)                       \
+        MRM(REG(XD), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)                                        \
+        REX(RXB(XD), RXB(XD)) EMITB(0x0F) EMITB(0x16)                       \
+        MRM(REG(XD), MOD(XD), REG(XD))
+
 /* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
  * uses Xmm0 implicitly as a mask register, destroys Xmm0, 0-masked XS elems */
 
@@ -196,6 +213,90 @@ ADR ESC REX(RXB(XG), RXB(MS)) EMITB(0x0F) EMITB(0x38) EMITB(0x15)           \
         orrjx_rr(Xmm0, W(XS))                                               \
         movjx_st(Xmm0, W(MG), W(DG))
 
+/* shf (G = G[IS]), (D = S[IT]) shuffle elements within each 128-bit lane
+ * 1-bit fields of the immediate select 64-bit elements in each 128-bit lane */
+
+#define shfjx_ri(XG, IS)                                                    \
+        shfjx3ri(W(XG), W(XG), W(IS))
+
+#define shfjx3ri(XD, XS, IT)                                                \
+    ESC REX(RXB(XD), RXB(XS)) EMITB(0x0F) EMITB(0x70)                       \
+        MRM(REG(XD), MOD(XS), REG(XS))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0x44 | (VAL(IT) & 1) * 0x0A |           \
+                                    (VAL(IT) & 2) * 0x50))
+
+/* hrd (D = S op S op ..) reduce all elements of S with "op" into each of D
+ * in log2 steps via in-register shuffles, temporary register is preserved */
+
+#define hrdjs_rx(XD, XS, XT, op) /* not portable, do not use outside */     \
+        movjx_st(W(XT), Mebp, inf_SCR02(0))                                 \
+        shfjx3ri(W(XT), W(XS), IB(1))                                       \
+        op(W(XT), W(XS))                                                    \
+        movjx_rr(W(XD), W(XT))                                              \
+        movjx_ld(W(XT), Mebp, inf_SCR02(0))
+
+/* scn (D[i] = S[0] op .. op S[i]) inclusive scan of S with "op" in log2
+ * steps, scz shifts in zeroes (add), scs repeats S[0] (min/max, idempotent),
+ * sce shifts D up by one element (exclusive scan), Xmm0 is used as a temp */
+
+#define sczjx_rx(XD, XS, op) /* not portable, do not use outside */         \
+        movjx_rr(Xmm0, W(XS))                                               \
+        shbix_ri(Xmm0, IB(8))                                               \
+        op(Xmm0, W(XS))                                                     \
+        movjx_rr(W(XD), Xmm0)
+
+#define scsjx_rx(XD, XS, op) /* not portable, do not use outside */         \
+        shfjx3ri(Xmm0, W(XS), IB(0))                                        \
+        op(Xmm0, W(XS))                                                     \
+        movjx_rr(W(XD), Xmm0)
+
+#define scejx_rx(XD) /* not portable, do not use outside */                 \
+        shbix_ri(W(XD), IB(8))
+
+/* adi (D[i] = S[0] + .. + S[i]) inclusive prefix sum of elements of S
+ * uses Xmm0 implicitly as a temp register, destroys Xmm0, XD/XS != Xmm0 */
+
+#define adijs_rr(XD, XS)                                                    \
+        sczjx_rx(W(XD), W(XS), addjs_rr)
+
+#define adijx_rr(XD, XS)                                                    \
+        sczjx_rx(W(XD), W(XS), addjx_rr)
+
+/* ade (D[i] = S[0] + .. + S[i-1]) exclusive prefix sum of S, D[0] = 0
+ * uses Xmm0 implicitly as a temp register, destroys Xmm0, XD/XS != Xmm0 */
+
+#define adejs_rr(XD, XS)                                                    \
+        sczjx_rx(W(XD), W(XS), addjs_rr)                                    \
+        scejx_rx(W(XD))
+
+#define adejx_rr(XD, XS)                                                    \
+        sczjx_rx(W(XD), W(XS), addjx_rr)                                    \
+        scejx_rx(W(XD))
+
+/* mni (D[i] = min(S[0], .. , S[i])) inclusive prefix min of elements of S
+ * uses Xmm0 implicitly as a temp register, destroys Xmm0, XD/XS != Xmm0 */
+
+#define mnijs_rr(XD, XS)                                                    \
+        scsjx_rx(W(XD), W(XS), minjs_rr)
+
+#define mnijx_rr(XD, XS)                                                    \
+        scsjx_rx(W(XD), W(XS), minjx_rr)
+
+#define mnijn_rr(XD, XS)                                                    \
+        scsjx_rx(W(XD), W(XS), minjn_rr)
+
+/* mxi (D[i] = max(S[0], .. , S[i])) inclusive prefix max of elements of S
+ * uses Xmm0 implicitly as a temp register, destroys Xmm0, XD/XS != Xmm0 */
+
+#define mxijs_rr(XD, XS)                                                    \
+        scsjx_rx(W(XD), W(XS), maxjs_rr)
+
+#define mxijx_rr(XD, XS)                                                    \
+        scsjx_rx(W(XD), W(XS), maxjx_rr)
+
+#define mxijn_rr(XD, XS)                                                    \
+        scsjx_rx(W(XD), W(XS), maxjn_rr)
+
 /* and (G = G & S), (D = S & T) if (#D != #T) */
 
 #define andjx_rr(XG, XS)                                                    \
@@ -332,6 +433,10 @@ ADR ESC REX(RXB(XG), RXB(MS)) EMITB(0x0F) EMITB(0x58)                       \
         /* adp, adh are defined in rtbase.h (first 15-regs only)
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  adhjs_rr
+#define adhjs_rr(XD, XS) /* horizontal reductive add, first 15-regs only */ \
+        hrdjs_rx(W(XD), W(XS), TmmX(W(XD), W(XS)), addjs_rr)
+
 #if (RT_SIMD_COMPAT_SSE >= 4)
 
 #undef  adpjs_rr
@@ -398,6 +503,10 @@ ADR ESC REX(RXB(XG), RXB(MS)) EMITB(0x0F) EMITB(0x59)                       \
         /* mlp, mlh are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  mlhjs_rr
+#define mlhjs_rr(XD, XS) /* horizontal reductive mul */                     \
+        hrdjs_rx(W(XD), W(XS), TmmX(W(XD), W(XS)), muljs_rr)
+
 /* div (G = G / S), (D = S / T) if (#D != #T) and on ARMv7 if (#D != #S) */
 
 #define divjs_rr(XG, XS)                                                    \
@@ -656,6 +765,10 @@ ADR ESC REX(RXB(XG), RXB(MS)) EMITB(0x0F) EMITB(0x5D)                       \
         /* mnp, mnh are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  mnhjs_rr
+#define mnhjs_rr(XD, XS) /* horizontal reductive min */                     \
+        hrdjs_rx(W(XD), W(XS), TmmX(W(XD), W(XS)), minjs_rr)
+
 /* max (G = G > S ? G : S), (D = S > T ? S : T) if (#D != #T) */
 
 #define maxjs_rr(XG, XS)                                                    \
@@ -678,6 +791,10 @@ ADR ESC REX(RXB(XG), RXB(MS)) EMITB(0x0F) EMITB(0x5F)                       \
         /* mxp, mxh are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  mxhjs_rr
+#define mxhjs_rr(XD, XS) /* horizontal reductive max */                     \
+        hrdjs_rx(W(XD), W(XS), TmmX(W(XD), W(XS)), maxjs_rr)
+
 /* ceq (G = G == S ? -1 : 0), (D = S == T ? -1 : 0) if (#D != #T) */
 
 #define ceqjs_rr(XG, XS)                                                    \
@@ -1109,6 +1226,36 @@ ADR ESC REX(RXB(XD), RXB(MS)) EMITB(0x0F) EMITB(0x3A) EMITB(0x09)           \
 
 #endif /* RT_SIMD_COMPAT_SSE >= 4 */
 
+/* cvy (D = fp32-to-fp64 S), widens lower half of fp32 elements in S
+ * cvu (D = fp32-to-fp64 S), widens upper half of fp32 elements in S
+ * cvx (D = fp64-to-fp32 S), narrows to lower half of D, upper half is 0
+ * narrowing rounds as set in fp control register (in FCTRL blocks)
+ * _ld/_st access the lower half only, _st uses inf_SCR02 to keep S */
+
+#define cvyis_rr(XD, XS)                                                    \
+        REX(RXB(XD), RXB(XS)) EMITB(0x0F) EMITB(0x5A)                       \
+        MRM(REG(XD), MOD(XS), REG(XS))
+
+#define cvyis_ld(XD, MS, DS)                                                \
+    ADR REX(RXB(XD), RXB(MS)) EMITB(0x0F) EMITB(0x5A)                       \
+        MRM(REG(XD), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#define cvuis_rr(XD, XS)                                                    \
+        REX(RXB(XD), RXB(XS)) EMITB(0x0F) EMITB(0x12)                       \
+        MRM(REG(XD), MOD(XS), REG(XS))                                      \
+        cvyis_rr(W(XD), W(XD))
+
+#define cvxjs_rr(XD, XS)                                                    \
+    ESC REX(RXB(XD), RXB(XS)) EMITB(0x0F) EMITB(0x5A)                       \
+        MRM(REG(XD), MOD(XS), REG(XS))
+
+#define cvxjs_st(XS, MD, DD)                                                \
+        movjx_st(W(XS), Mebp, inf_SCR02(0))                                 \
+        cvxjs_rr(W(XS), W(XS))                                              \
+        movts_st(W(XS), W(MD), W(DD))                                       \
+        movjx_ld(W(XS), Mebp, inf_SCR02(0))
+
 /************   packed double-precision integer arithmetic/shifts   ***********/
 
 /* add (G = G + S), (D = S + T) if (#D != #T) */
@@ -1179,6 +1326,54 @@ ADR ESC REX(RXB(XG), RXB(MS)) EMITB(0x0F) EMITB(0xFB)                       \
         stack_ld(Recx)                                                      \
         movjx_ld(W(XD), Mebp, inf_SCR01(0))
 
+/* muw (G = G * S), multiplies lower 32-bit halves of 64-bit elements into
+ * full 64-bit products, unsigned-[x] or signed-[n], upper halves are ignored
+ * mul-high of 64-bit elements has no native form and uses BASE in rtconf.h */
+
+#define muwjx_rr(XG, XS)                                                    \
+        mueix_rr(W(XG), W(XS))
+
+#define muwjx_ld(XG, MS, DS)                                                \
+        mueix_ld(W(XG), W(MS), W(DS))
+
+#if (RT_SIMD_COMPAT_SSE < 4)
+
+#define muwjn_rr(XG, XS)                                                    \
+        movjx_st(W(XG), Mebp, inf_SCR01(0))                                 \
+        movjx_st(W(XS), Mebp, inf_SCR02(0))                                 \
+        muwjn_rx(W(XG))
+
+#define muwjn_ld(XG, MS, DS)                                                \
+        movjx_st(W(XG), Mebp, inf_SCR01(0))                                 \
+        movjx_ld(W(XG), W(MS), W(DS))                                       \
+        movjx_st(W(XG), Mebp, inf_SCR02(0))                                 \
+        muwjn_rx(W(XG))
+
+#define muwjn_rx(XD) /* not portable, do not use outside */                 \
+        stack_st(Reax)                                                      \
+        stack_st(Redx)                                                      \
+        movwx_ld(Reax,  Mebp, inf_SCR01(0x00))                              \
+        mulwn_xm(Mebp,  inf_SCR02(0x00))                                    \
+        movwx_st(Reax,  Mebp, inf_SCR01(0x00))                              \
+        movwx_st(Redx,  Mebp, inf_SCR01(0x04))                              \
+        movwx_ld(Reax,  Mebp, inf_SCR01(0x08))                              \
+        mulwn_xm(Mebp,  inf_SCR02(0x08))                                    \
+        movwx_st(Reax,  Mebp, inf_SCR01(0x08))                              \
+        movwx_st(Redx,  Mebp, inf_SCR01(0x0C))                              \
+        stack_ld(Redx)                                                      \
+        stack_ld(Reax)                                                      \
+        movjx_ld(W(XD), Mebp, inf_SCR01(0))
+
+#else /* RT_SIMD_COMPAT_SSE >= 4 */
+
+#define muwjn_rr(XG, XS)                                                    \
+        muein_rr(W(XG), W(XS))
+
+#define muwjn_ld(XG, MS, DS)                                                \
+        muein_ld(W(XG), W(MS), W(DS))
+
+#endif /* RT_SIMD_COMPAT_SSE >= 4 */
+
 /* shl (G = G << S), (D = S << T) if (#D != #T) - plain, unsigned
  * for maximum compatibility: shift count must be modulo elem-size */
 
@@ -1332,6 +1527,62 @@ ADR ESC REX(RXB(XG), RXB(MS)) EMITB(0x0F) EMITB(0xD3)                       \
         stack_ld(Recx)                                                      \
         movjx_ld(W(XD), Mebp, inf_SCR01(0))
 
+/* cvy (D = S), zero-[x] or sign-[n] extends lower half of 32-bit elements
+ * cvu (D = S), zero-[x] or sign-[n] extends upper half of 32-bit elements
+ * narrowing with saturation from 64-bit elements uses BASE in rtconf.h */
+
+#define cvyix_rr(XD, XS)                                                    \
+        movix_rr(W(XD), W(XS))                                              \
+    ESC REX(RXB(XD), RXB(XD)) EMITB(0x0F) EMITB(0x62)                       \
+        MRM(REG(XD), MOD(XD), REG(XD))                                      \
+        shrjx_ri(W(XD), IB(32))
+
+#define cvuix_rr(XD, XS)                                                    \
+        movix_rr(W(XD), W(XS))                                              \
+    ESC REX(RXB(XD), RXB(XD)) EMITB(0x0F) EMITB(0x6A)                       \
+        MRM(REG(XD), MOD(XD), REG(XD))                                      \
+        shrjx_ri(W(XD), IB(32))
+
+#if (RT_SIMD_COMPAT_SSE < 4)
+
+#define cvyin_rr(XD, XS)                                                    \
+        cvyix_rr(W(XD), W(XS))                                              \
+        movix_st(W(XD), Mebp, inf_SCR01(0))                                 \
+        shljx_ri(W(XD), IB(32))                                             \
+        shrin_ri(W(XD), IB(31))                                             \
+        orrix_ld(W(XD), Mebp, inf_SCR01(0))
+
+#define cvuin_rr(XD, XS)                                                    \
+        cvuix_rr(W(XD), W(XS))                                              \
+        movix_st(W(XD), Mebp, inf_SCR01(0))                                 \
+        shljx_ri(W(XD), IB(32))                                             \
+        shrin_ri(W(XD), IB(31))                                             \
+        orrix_ld(W(XD), Mebp, inf_SCR01(0))
+
+#else /* RT_SIMD_COMPAT_SSE >= 4 */
+
+#define cvyin_rr(XD, XS)                                                    \
+    ESC REX(RXB(XD), RXB(XS)) EMITB(0x0F) EMITB(0x38) EMITB(0x25)           \
+        MRM(REG(XD), MOD(XS), REG(XS))
+
+#define cvuin_rr(XD, XS)                                                    \
+    ESC REX(RXB(XD), RXB(XS)) EMITB(0x0F) EMITB(0x70)                       \
+        MRM(REG(XD), MOD(XS), REG(XS))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0xEE))                                  \
+        cvyin_rr(W(XD), W(XD))
+
+#endif /* RT_SIMD_COMPAT_SSE >= 4 */
+
+/* bsw (D = S with the order of bytes reversed in each element) */
+
+#define bswjx_rr(XD, XS)                                                    \
+        shhix3ri(W(XD), W(XS), IB(0x1B))                                    \
+        bswgx3rx(W(XD), W(XD), TmmX(W(XD), W(XD)))
+
+#define bswjx_ld(XD, MS, DS)                                                \
+        movjx_ld(W(XD), W(MS), W(DS))                                       \
+        bswjx_rr(W(XD), W(XD))
+
 /****************   packed double-precision integer compare   *****************/
 
 /* min (G = G < S ? G : S), (D = S < T ? S : T) if (#D != #T), unsigned */
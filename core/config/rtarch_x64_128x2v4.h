@@ -168,6 +168,17 @@ ADR ESC REX(1,       RXB(MD)) EMITB(0x0F) EMITB(0x29)                       \
         MRM(REG(XS),    0x02, REG(MD))                                      \
         AUX(SIB(MD), EMITW(VYL(DD)), EMPTY)
 
+/* stn (D = S) non-temporal store, bypasses caches on the way to memory
+ * weakly-ordered, place sfnce_xx before [D] is read by other threads */
+
+#define stndx_st(XS, MD, DD)                                                \
+ADR ESC REX(0,       RXB(MD)) EMITB(0x0F) EMITB(0x2B)                       \
+        MRM(REG(XS),    0x02, REG(MD))                                      \
+        AUX(SIB(MD), EMITW(VAL(DD)), EMPTY)                                 \
+ADR ESC REX(1,       RXB(MD)) EMITB(0x0F) EMITB(0x2B)                       \
+        MRM(REG(XS),    0x02, REG(MD))                                      \
+        AUX(SIB(MD), EMITW(VYL(DD)), EMPTY)
+
 /* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
  * uses Xmm0 implicitly as a mask register, destroys Xmm0, 0-masked XS elems */
 
@@ -1253,6 +1264,52 @@ ADR ESC REX(1,       RXB(MS)) EMITB(0x0F) EMITB(0x3A) EMITB(0x09)           \
 
 #endif /* RT_SIMD_COMPAT_SSE >= 4 */
 
+/* cvy (D = fp32-to-fp64 S), widens lower half of fp32 elements in S
+ * cvu (D = fp32-to-fp64 S), widens upper half of fp32 elements in S
+ * cvx (D = fp64-to-fp32 S), narrows to lower half of D, upper half is 0
+ * narrowing rounds as set in fp control register (in FCTRL blocks)
+ * _ld/_st access the lower half only, _st uses inf_SCR02 to keep S */
+
+#define cvycs_rr(XD, XS)                                                    \
+        REX(1,             0) EMITB(0x0F) EMITB(0x12)                       \
+        MRM(REG(XD), MOD(XS), REG(XS))                                      \
+        REX(1,             1) EMITB(0x0F) EMITB(0x5A)                       \
+        MRM(REG(XD), MOD(XD), REG(XD))                                      \
+        REX(0,             0) EMITB(0x0F) EMITB(0x5A)                       \
+        MRM(REG(XD), MOD(XS), REG(XS))
+
+#define cvycs_ld(XD, MS, DS)                                                \
+    ADR REX(0,       RXB(MS)) EMITB(0x0F) EMITB(0x28)                       \
+        MRM(REG(XD),    0x02, REG(MS))                                      \
+        AUX(SIB(MS), EMITW(VAL(DS)), EMPTY)                                 \
+        cvycs_rr(W(XD), W(XD))
+
+#define cvucs_rr(XD, XS)                                                    \
+        REX(0,             1) EMITB(0x0F) EMITB(0x5A)                       \
+        MRM(REG(XD), MOD(XS), REG(XS))                                      \
+        REX(1,             1) EMITB(0x0F) EMITB(0x12)                       \
+        MRM(REG(XD), MOD(XS), REG(XS))                                      \
+        REX(1,             1) EMITB(0x0F) EMITB(0x5A)                       \
+        MRM(REG(XD), MOD(XD), REG(XD))
+
+#define cvxds_rr(XD, XS)                                                    \
+    ESC REX(0,             0) EMITB(0x0F) EMITB(0x5A)                       \
+        MRM(REG(XD), MOD(XS), REG(XS))                                      \
+    ESC REX(1,             1) EMITB(0x0F) EMITB(0x5A)                       \
+        MRM(REG(XD), MOD(XS), REG(XS))                                      \
+        REX(0,             1) EMITB(0x0F) EMITB(0x16)                       \
+        MRM(REG(XD), MOD(XD), REG(XD))                                      \
+        REX(1,             1) EMITB(0x0F) EMITB(0x57)                       \
+        MRM(REG(XD), MOD(XD), REG(XD))
+
+#define cvxds_st(XS, MD, DD)                                                \
+        movdx_st(W(XS), Mebp, inf_SCR02(0))                                 \
+        cvxds_rr(W(XS), W(XS))                                              \
+    ADR REX(0,       RXB(MD)) EMITB(0x0F) EMITB(0x29)                       \
+        MRM(REG(XS),    0x02, REG(MD))                                      \
+        AUX(SIB(MD), EMITW(VAL(DD)), EMPTY)                                 \
+        movdx_ld(W(XS), Mebp, inf_SCR02(0))
+
 /************   packed double-precision integer arithmetic/shifts   ***********/
 
 /* add (G = G + S), (D = S + T) if (#D != #T) */
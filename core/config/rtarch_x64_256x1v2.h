@@ -156,6 +156,21 @@
         MRM(REG(XS), MOD(MD), REG(MD))                                      \
         AUX(SIB(MD), CMD(DD), EMPTY)
 
+/* stn (D = S) non-temporal store, bypasses caches on the way to memory
+ * weakly-ordered, place sfnce_xx before [D] is read by other threads */
+
+#define stndx_st(XS, MD, DD)                                                \
+    ADR VEX(RXB(XS), RXB(MD),    0x00, 1, 1, 1) EMITB(0x2B)                 \
+        MRM(REG(XS), MOD(MD), REG(MD))                                      \
+        AUX(SIB(MD), CMD(DD), EMPTY)
+
+/* bcs (D = [M]) broadcast scalar element from memory into all SIMD elements */
+
+#define bcsdx_ld(XD, MS, DS)                                                \
+    ADR VEX(RXB(XD), RXB(MS),    0x00, 1, 1, 2) EMITB(0x19)                 \
+        MRM(REG(XD), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
 /* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
  * uses Xmm0 implicitly as a mask register, destroys Xmm0, 0-masked XS elems */
 
@@ -174,6 +189,147 @@
         MRM(REG(XS), MOD(MG), REG(MG))                                      \
         AUX(SIB(MG), CMD(DG), EMPTY)
 
+/* mtl (D = S) move the first RS lanes only (loop tails), 0 <= RS <= 4 here
+ * load zeroes the remaining lanes of XD, store keeps memory past RS lanes,
+ * uses Xmm0 implicitly as a temp mask register, destroys Xmm0, XD/XS != Xmm0 */
+
+#define mtldx_ld(XD, RS, MS, DS)                                            \
+        mtlcx_xm(W(RS), Lebp, 4)                                            \
+    ADR VEX(RXB(XD), RXB(MS),    0x00, 1, 1, 2) EMITB(0x2D)                 \
+        MRM(REG(XD), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#define mtldx_st(XS, RS, MD, DD)                                            \
+        mtlcx_xm(W(RS), Lebp, 4)                                            \
+    ADR VEX(RXB(XS), RXB(MD),    0x00, 1, 1, 2) EMITB(0x2F)                 \
+        MRM(REG(XS), MOD(MD), REG(MD))                                      \
+        AUX(SIB(MD), CMD(DD), EMPTY)
+
+#if (RT_256X1 >= 2)
+
+/* gat (D = [M + S]) gather elements at per-lane indices S from M/DS,
+ * indices are 64-bit in elements (full VSIB range), M*** or Oeax,
+ * but not indexed modes (I***, ...), XD/XS differ,
+ * uses XmmF as a temp mask register outside of 15-regs compat set,
+ * otherwise one of Xmm0/Xmm1/Xmm2 (other than XD/XS) preserved via SCR02 */
+
+#if (RT_SIMD_COMPAT_XMM > 0)
+
+#define gatdx_ld(XD, XS, MS, DS)                                            \
+        ceqdx_rr(XmmF, XmmF)                                                \
+        gatdx_xx(W(XD), W(XS), W(MS), W(DS), XmmF)
+
+#else  /* RT_SIMD_COMPAT_XMM == 0 */
+
+#define gatdx_ld(XD, XS, MS, DS)                                            \
+        movdx_st(gatcx_xm(W(XD), W(XS)), Mebp, inf_SCR02(0))                \
+        ceqdx_rr(gatcx_xm(W(XD), W(XS)), gatcx_xm(W(XD), W(XS)))            \
+        gatdx_xx(W(XD), W(XS), W(MS), W(DS), gatcx_xm(W(XD), W(XS)))        \
+        movdx_ld(gatcx_xm(W(XD), W(XS)), Mebp, inf_SCR02(0))
+
+#endif /* RT_SIMD_COMPAT_XMM == 0 */
+
+#define gatdx_xx(XD, XS, MS, DS, XM) /* not portable, do not use outside */ \
+    ADR VSW(RXB(XD), RXB(XS), RXB(MS), REN(XM), 1, 1, 2) EMITB(0x93)        \
+        MRM(REG(XD), MOD(MS),    0x04)                                      \
+        AUX(EMITB(0xC0 | REG(XS) << 3 | REG(MS)), CMD(DS), EMPTY)
+
+#endif /* RT_256X1 >= 2, AVX2 */
+
+/* shf (G = G[IS]), (D = S[IT]) shuffle elements within each 128-bit lane
+ * 1-bit fields of the immediate select 64-bit elements in each 128-bit lane */
+
+#define shfdx_ri(XG, IS)                                                    \
+        shfdx3ri(W(XG), W(XG), W(IS))
+
+#define shfdx3ri(XD, XS, IT)                                                \
+        VEX(RXB(XD), RXB(XS),    0x00, 1, 1, 3) EMITB(0x05)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(((VAL(IT) & 3) * 0x55)))
+
+/* hrd (D = S op S op ..) reduce all elements of S with "op" into each of D
+ * in log2 steps via in-register shuffles, temporary register is preserved */
+
+#define hrdds_rx(XD, XS, XT, op) /* not portable, do not use outside */     \
+        movdx_st(W(XT), Mebp, inf_SCR02(0))                                 \
+        sw2cx_rr(W(XT), W(XS))                                              \
+        op(W(XT), W(XS))                                                    \
+        shfdx3ri(W(XD), W(XT), IB(1))                                       \
+        op(W(XD), W(XT))                                                    \
+        movdx_ld(W(XT), Mebp, inf_SCR02(0))
+
+#if (RT_256X1 >= 2)
+
+/* scn (D[i] = S[0] op .. op S[i]) inclusive scan of S with "op" in log2
+ * steps, scz shifts in zeroes (add), scs repeats S[0] (min/max, idempotent),
+ * sce shifts D up by one element (exclusive scan), Xmm0 is used as a temp */
+
+#define sczdx_rx(XD, XS, op) /* not portable, do not use outside */         \
+        movdx_rr(Xmm0, W(XS))                                               \
+        shbcx_ri(Xmm0, IB(8))                                               \
+        op(Xmm0, W(XS))                                                     \
+        shfdx3ri(W(XD), Xmm0, IB(3))                                        \
+        pr2cx_ri(W(XD), Xmm0, IB(0x28))                                     \
+        op(W(XD), Xmm0)
+
+#define scsdx_rx(XD, XS, op) /* not portable, do not use outside */         \
+        shfdx3ri(Xmm0, W(XS), IB(0))                                        \
+        op(Xmm0, W(XS))                                                     \
+        shfdx3ri(W(XD), Xmm0, IB(3))                                        \
+        pr2cx_ri(W(XD), Xmm0, IB(0x20))                                     \
+        op(W(XD), Xmm0)
+
+#define scedx_rx(XD) /* not portable, do not use outside */                 \
+        pr2cx_ri(Xmm0, W(XD), IB(0x08))                                     \
+        albcx_ri(Xmm0, W(XD), IB(8))                                        \
+        movdx_rr(W(XD), Xmm0)
+
+/* adi (D[i] = S[0] + .. + S[i]) inclusive prefix sum of elements of S
+ * uses Xmm0 implicitly as a temp register, destroys Xmm0, XD/XS != Xmm0 */
+
+#define adids_rr(XD, XS)                                                    \
+        sczdx_rx(W(XD), W(XS), addds_rr)
+
+#define adidx_rr(XD, XS)                                                    \
+        sczdx_rx(W(XD), W(XS), adddx_rr)
+
+/* ade (D[i] = S[0] + .. + S[i-1]) exclusive prefix sum of S, D[0] = 0
+ * uses Xmm0 implicitly as a temp register, destroys Xmm0, XD/XS != Xmm0 */
+
+#define adeds_rr(XD, XS)                                                    \
+        sczdx_rx(W(XD), W(XS), addds_rr)                                    \
+        scedx_rx(W(XD))
+
+#define adedx_rr(XD, XS)                                                    \
+        sczdx_rx(W(XD), W(XS), adddx_rr)                                    \
+        scedx_rx(W(XD))
+
+/* mni (D[i] = min(S[0], .. , S[i])) inclusive prefix min of elements of S
+ * uses Xmm0 implicitly as a temp register, destroys Xmm0, XD/XS != Xmm0 */
+
+#define mnids_rr(XD, XS)                                                    \
+        scsdx_rx(W(XD), W(XS), minds_rr)
+
+#define mnidx_rr(XD, XS)                                                    \
+        scsdx_rx(W(XD), W(XS), mindx_rr)
+
+#define mnidn_rr(XD, XS)                                                    \
+        scsdx_rx(W(XD), W(XS), mindn_rr)
+
+/* mxi (D[i] = max(S[0], .. , S[i])) inclusive prefix max of elements of S
+ * uses Xmm0 implicitly as a temp register, destroys Xmm0, XD/XS != Xmm0 */
+
+#define mxids_rr(XD, XS)                                                    \
+        scsdx_rx(W(XD), W(XS), maxds_rr)
+
+#define mxidx_rr(XD, XS)                                                    \
+        scsdx_rx(W(XD), W(XS), maxdx_rr)
+
+#define mxidn_rr(XD, XS)                                                    \
+        scsdx_rx(W(XD), W(XS), maxdn_rr)
+
+#endif /* RT_256X1 >= 2, AVX2 */
+
 /* and (G = G & S), (D = S & T) if (#D != #T) */
 
 #define anddx_rr(XG, XS)                                                    \
@@ -298,6 +454,10 @@
         /* adp, adh are defined in rtbase.h (first 15-regs only)
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  adhds_rr
+#define adhds_rr(XD, XS) /* horizontal reductive add, first 15-regs only */ \
+        hrdds_rx(W(XD), W(XS), TmmX(W(XD), W(XS)), addds_rr)
+
 /* sub (G = G - S), (D = S - T) if (#D != #T) */
 
 #define subds_rr(XG, XS)                                                    \
@@ -335,6 +495,10 @@
         /* mlp, mlh are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  mlhds_rr
+#define mlhds_rr(XD, XS) /* horizontal reductive mul */                     \
+        hrdds_rx(W(XD), W(XS), TmmX(W(XD), W(XS)), mulds_rr)
+
 /* div (G = G / S), (D = S / T) if (#D != #T) and on ARMv7 if (#D != #S) */
 
 #define divds_rr(XG, XS)                                                    \
@@ -645,6 +809,10 @@
         /* mnp, mnh are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  mnhds_rr
+#define mnhds_rr(XD, XS) /* horizontal reductive min */                     \
+        hrdds_rx(W(XD), W(XS), TmmX(W(XD), W(XS)), minds_rr)
+
 /* max (G = G > S ? G : S), (D = S > T ? S : T) if (#D != #T) */
 
 #define maxds_rr(XG, XS)                                                    \
@@ -665,6 +833,10 @@
         /* mxp, mxh are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  mxhds_rr
+#define mxhds_rr(XD, XS) /* horizontal reductive max */                     \
+        hrdds_rx(W(XD), W(XS), TmmX(W(XD), W(XS)), maxds_rr)
+
 /* ceq (G = G == S ? -1 : 0), (D = S == T ? -1 : 0) if (#D != #T) */
 
 #define ceqds_rr(XG, XS)                                                    \
@@ -971,6 +1143,64 @@
         rnrds_rr(W(XD), W(XS), mode)                                        \
         cvzds_rr(W(XD), W(XD))
 
+/* cvy (D = fp32-to-fp64 S), widens lower half of fp32 elements in S
+ * cvu (D = fp32-to-fp64 S), widens upper half of fp32 elements in S
+ * cvx (D = fp64-to-fp32 S), narrows to lower half of D, upper half is 0
+ * narrowing rounds as set in fp control register (in FCTRL blocks)
+ * _ld/_st access the lower half only, _st uses inf_SCR02 to keep S */
+
+#define cvycs_rr(XD, XS)                                                    \
+        VEX(RXB(XD), RXB(XS),    0x00, 1, 0, 1) EMITB(0x5A)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))
+
+#define cvycs_ld(XD, MS, DS)                                                \
+    ADR VEX(RXB(XD), RXB(MS),    0x00, 1, 0, 1) EMITB(0x5A)                 \
+        MRM(REG(XD), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), EMITW(VAL(DS)), EMPTY)
+
+#define cvucs_rr(XD, XS)                                                    \
+        VEX(RXB(XS), RXB(XD),    0x00, 1, 1, 3) EMITB(0x19)                 \
+        MRM(REG(XS), MOD(XD), REG(XD))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0x01))                                  \
+        cvycs_rr(W(XD), W(XD))
+
+#define cvxds_rr(XD, XS)                                                    \
+        VEX(RXB(XD), RXB(XS),    0x00, 1, 1, 1) EMITB(0x5A)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))
+
+#define cvxds_st(XS, MD, DD)                                                \
+        movdx_st(W(XS), Mebp, inf_SCR02(0))                                 \
+        cvxds_rr(W(XS), W(XS))                                              \
+        movix_st(W(XS), W(MD), W(DD))                                       \
+        movdx_ld(W(XS), Mebp, inf_SCR02(0))
+
+#if (RT_256X1 >= 2)
+
+/* cvy (D = S), zero-[x] or sign-[n] extends lower half of 32-bit elements
+ * cvu (D = S), zero-[x] or sign-[n] extends upper half of 32-bit elements
+ * narrowing with saturation from 64-bit elements uses BASE in rtconf.h */
+
+#define cvycx_rr(XD, XS)                                                    \
+        VEX(RXB(XD), RXB(XS),    0x00, 1, 1, 2) EMITB(0x35)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))
+
+#define cvycn_rr(XD, XS)                                                    \
+        VEX(RXB(XD), RXB(XS),    0x00, 1, 1, 2) EMITB(0x25)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))
+
+#define cvucx_rr(XD, XS)                                                    \
+        VEX(RXB(XS), RXB(XD),    0x00, 1, 1, 3) EMITB(0x39)                 \
+        MRM(REG(XS), MOD(XD), REG(XD))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0x01))                                  \
+        cvycx_rr(W(XD), W(XD))
+
+#define cvucn_rr(XD, XS)                                                    \
+        VEX(RXB(XS), RXB(XD),    0x00, 1, 1, 3) EMITB(0x39)                 \
+        MRM(REG(XS), MOD(XD), REG(XD))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0x01))                                  \
+        cvycn_rr(W(XD), W(XD))
+
+#endif /* RT_256X1 >= 2, AVX2 */
 /************   packed double-precision integer arithmetic/shifts   ***********/
 
 #if (RT_256X1 < 2)
@@ -1261,6 +1491,22 @@
         MRM(REG(XD), MOD(MT), REG(MT))                                      \
         AUX(SIB(MT), CMD(DT), EMPTY)
 
+/* muw (G = G * S), multiplies lower 32-bit halves of 64-bit elements into
+ * full 64-bit products, unsigned-[x] or signed-[n], upper halves are ignored
+ * mul-high of 64-bit elements has no native form and uses BASE in rtconf.h */
+
+#define muwdx_rr(XG, XS)                                                    \
+        muecx_rr(W(XG), W(XS))
+
+#define muwdx_ld(XG, MS, DS)                                                \
+        muecx_ld(W(XG), W(MS), W(DS))
+
+#define muwdn_rr(XG, XS)                                                    \
+        muecn_rr(W(XG), W(XS))
+
+#define muwdn_ld(XG, MS, DS)                                                \
+        muecn_ld(W(XG), W(MS), W(DS))
+
 #endif /* RT_256X1 >= 2, AVX2 */
 
 /* mul (G = G * S), (D = S * T) if (#D != #T) */
@@ -1360,6 +1606,20 @@
         stack_ld(Recx)                                                      \
         movdx_ld(W(XD), Mebp, inf_SCR01(0))
 
+#if (RT_256X1 >= 2)
+
+/* bsw (D = S with the order of bytes reversed in each element) */
+
+#define bswdx_rr(XD, XS)                                                    \
+        shhcx3ri(W(XD), W(XS), IB(0x1B))                                    \
+        bswax3rx(W(XD), W(XD), TmmX(W(XD), W(XD)))
+
+#define bswdx_ld(XD, MS, DS)                                                \
+        movdx_ld(W(XD), W(MS), W(DS))                                       \
+        bswdx_rr(W(XD), W(XD))
+
+#endif /* RT_256X1 >= 2, AVX2 */
+
 /****************   packed double-precision integer compare   *****************/
 
 /* min (G = G < S ? G : S), (D = S < T ? S : T) if (#D != #T), unsigned */
@@ -165,6 +165,21 @@
         MRM(REG(XS), MOD(MD), REG(MD))                                      \
         AUX(SIB(MD), CMD(DD), EMPTY)
 
+/* stn (D = S) non-temporal store, bypasses caches on the way to memory
+ * weakly-ordered, place sfnce_xx before [D] is read by other threads */
+
+#define stndx_st(XS, MD, DD)                                                \
+    ADR EVW(RXB(XS), RXB(MD),    0x00, 1, 1, 1) EMITB(0x2B)                 \
+        MRM(REG(XS), MOD(MD), REG(MD))                                      \
+        AUX(SIB(MD), CMD(DD), EMPTY)
+
+/* bcs (D = [M]) broadcast scalar element from memory into all SIMD elements */
+
+#define bcsdx_ld(XD, MS, DS)                                                \
+    ADR EVW(RXB(XD), RXB(MS),    0x00, 1, 1, 2) EMITB(0x19)                 \
+        MRM(REG(XD), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
 /* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
  * uses Xmm0 implicitly as a mask register, destroys Xmm0, 0-masked XS elems */
 
@@ -185,6 +200,119 @@
         MRM(REG(XS), MOD(MG), REG(MG))                                      \
         AUX(SIB(MG), CMD(DG), EMPTY)
 
+/* shf (G = G[IS]), (D = S[IT]) shuffle elements within each 128-bit lane
+ * 1-bit fields of the immediate select 64-bit elements in each 128-bit lane */
+
+#define shfdx_ri(XG, IS)                                                    \
+        shfdx3ri(W(XG), W(XG), W(IS))
+
+#define shfdx3ri(XD, XS, IT)                                                \
+        EVW(RXB(XD), RXB(XS),    0x00, 1, 1, 3) EMITB(0x05)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(((VAL(IT) & 3) * 0x55)))
+
+/* tbl (G = G[S]), (D = S[T]) permute elements across the SIMD register
+ * indices are in elements, taken modulo the number of elements in SIMD */
+
+#define tbldx_rr(XG, XS)                                                    \
+        tbldx3rr(W(XG), W(XG), W(XS))
+
+#define tbldx3rr(XD, XS, XT)                                                \
+        EVW(RXB(XD), RXB(XS), REN(XT), 1, 1, 2) EMITB(0x16)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))
+
+/* hrd (D = S op S op ..) reduce all elements of S with "op" into each of D
+ * in log2 steps via in-register shuffles, temporary register is preserved */
+
+#define hrdds_rx(XD, XS, XT, op) /* not portable, do not use outside */     \
+        movdx_st(W(XT), Mebp, inf_SCR02(0))                                 \
+        sw2cx_rr(W(XT), W(XS))                                              \
+        op(W(XT), W(XS))                                                    \
+        shfdx3ri(W(XD), W(XT), IB(1))                                       \
+        op(W(XD), W(XT))                                                    \
+        movdx_ld(W(XT), Mebp, inf_SCR02(0))
+
+/* aln (G = [S:G] >> IT) concatenate S and G, shift right by IT elements
+ * keeping the lower half, bc0 (D = S[0]) broadcast element 0 (not portable) */
+
+#define alndx_ri(XG, XS, IT) /* not portable, do not use outside */         \
+        EVW(RXB(XG), RXB(XG), REN(XS), 1, 1, 3) EMITB(0x03)                 \
+        MRM(REG(XG), MOD(XG), REG(XG))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(VAL(IT)))
+
+#define bc0dx_rr(XD, XS) /* not portable, do not use outside */             \
+        EVW(RXB(XD), RXB(XS),    0x00, 1, 1, 2) EMITB(0x59)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))
+
+/* scn (D[i] = S[0] op .. op S[i]) inclusive scan of S with "op" in log2
+ * steps, scz shifts in zeroes (add), scs repeats S[0] (min/max, idempotent),
+ * sce shifts D up by one element (exclusive scan), Xmm0 is used as a temp */
+
+#define sczdx_rx(XD, XS, op) /* not portable, do not use outside */         \
+        xordx_rr(Xmm0, Xmm0)                                                \
+        alndx_ri(Xmm0, W(XS), IB(3))                                        \
+        op(Xmm0, W(XS))                                                     \
+        xordx_rr(W(XD), W(XD))                                              \
+        alndx_ri(W(XD), Xmm0, IB(2))                                        \
+        op(W(XD), Xmm0)
+
+#define scsdx_rx(XD, XS, op) /* not portable, do not use outside */         \
+        bc0dx_rr(Xmm0, W(XS))                                               \
+        alndx_ri(Xmm0, W(XS), IB(3))                                        \
+        op(Xmm0, W(XS))                                                     \
+        bc0dx_rr(W(XD), Xmm0)                                               \
+        alndx_ri(W(XD), Xmm0, IB(2))                                        \
+        op(W(XD), Xmm0)
+
+#define scedx_rx(XD) /* not portable, do not use outside */                 \
+        xordx_rr(Xmm0, Xmm0)                                                \
+        alndx_ri(Xmm0, W(XD), IB(3))                                        \
+        movdx_rr(W(XD), Xmm0)
+
+/* adi (D[i] = S[0] + .. + S[i]) inclusive prefix sum of elements of S
+ * uses Xmm0 implicitly as a temp register, destroys Xmm0, XD/XS != Xmm0 */
+
+#define adids_rr(XD, XS)                                                    \
+        sczdx_rx(W(XD), W(XS), addds_rr)
+
+#define adidx_rr(XD, XS)                                                    \
+        sczdx_rx(W(XD), W(XS), adddx_rr)
+
+/* ade (D[i] = S[0] + .. + S[i-1]) exclusive prefix sum of S, D[0] = 0
+ * uses Xmm0 implicitly as a temp register, destroys Xmm0, XD/XS != Xmm0 */
+
+#define adeds_rr(XD, XS)                                                    \
+        sczdx_rx(W(XD), W(XS), addds_rr)                                    \
+        scedx_rx(W(XD))
+
+#define adedx_rr(XD, XS)                                                    \
+        sczdx_rx(W(XD), W(XS), adddx_rr)                                    \
+        scedx_rx(W(XD))
+
+/* mni (D[i] = min(S[0], .. , S[i])) inclusive prefix min of elements of S
+ * uses Xmm0 implicitly as a temp register, destroys Xmm0, XD/XS != Xmm0 */
+
+#define mnids_rr(XD, XS)                                                    \
+        scsdx_rx(W(XD), W(XS), minds_rr)
+
+#define mnidx_rr(XD, XS)                                                    \
+        scsdx_rx(W(XD), W(XS), mindx_rr)
+
+#define mnidn_rr(XD, XS)                                                    \
+        scsdx_rx(W(XD), W(XS), mindn_rr)
+
+/* mxi (D[i] = max(S[0], .. , S[i])) inclusive prefix max of elements of S
+ * uses Xmm0 implicitly as a temp register, destroys Xmm0, XD/XS != Xmm0 */
+
+#define mxids_rr(XD, XS)                                                    \
+        scsdx_rx(W(XD), W(XS), maxds_rr)
+
+#define mxidx_rr(XD, XS)                                                    \
+        scsdx_rx(W(XD), W(XS), maxdx_rr)
+
+#define mxidn_rr(XD, XS)                                                    \
+        scsdx_rx(W(XD), W(XS), maxdn_rr)
+
 /* and (G = G & S), (D = S & T) if (#D != #T) */
 
 #define anddx_rr(XG, XS)                                                    \
@@ -309,6 +437,10 @@
         /* adp, adh are defined in rtbase.h (first 15-regs only)
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  adhds_rr
+#define adhds_rr(XD, XS) /* horizontal reductive add, first 15-regs only */ \
+        hrdds_rx(W(XD), W(XS), TmmX(W(XD), W(XS)), addds_rr)
+
 /* sub (G = G - S), (D = S - T) if (#D != #T) */
 
 #define subds_rr(XG, XS)                                                    \
@@ -346,6 +478,10 @@
         /* mlp, mlh are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  mlhds_rr
+#define mlhds_rr(XD, XS) /* horizontal reductive mul */                     \
+        hrdds_rx(W(XD), W(XS), TmmX(W(XD), W(XS)), mulds_rr)
+
 /* div (G = G / S), (D = S / T) if (#D != #T) and on ARMv7 if (#D != #S) */
 
 #define divds_rr(XG, XS)                                                    \
@@ -492,6 +628,10 @@
         /* mnp, mnh are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  mnhds_rr
+#define mnhds_rr(XD, XS) /* horizontal reductive min */                     \
+        hrdds_rx(W(XD), W(XS), TmmX(W(XD), W(XS)), minds_rr)
+
 /* max (G = G > S ? G : S), (D = S > T ? S : T) if (#D != #T) */
 
 #define maxds_rr(XG, XS)                                                    \
@@ -512,6 +652,10 @@
         /* mxp, mxh are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  mxhds_rr
+#define mxhds_rr(XD, XS) /* horizontal reductive max */                     \
+        hrdds_rx(W(XD), W(XS), TmmX(W(XD), W(XS)), maxds_rr)
+
 /* ceq (G = G == S ? -1 : 0), (D = S == T ? -1 : 0) if (#D != #T) */
 
 #define ceqds_rr(XG, XS)                                                    \
@@ -808,6 +952,37 @@
         ERW(RXB(XD), RXB(XS), 0x00, RT_SIMD_MODE_##mode&3, 1, 1) EMITB(0x7B)\
         MRM(REG(XD), MOD(XS), REG(XS))
 
+/* cvy (D = fp32-to-fp64 S), widens lower half of fp32 elements in S
+ * cvu (D = fp32-to-fp64 S), widens upper half of fp32 elements in S
+ * cvx (D = fp64-to-fp32 S), narrows to lower half of D, upper half is 0
+ * narrowing rounds as set in fp control register (in FCTRL blocks)
+ * _ld/_st access the lower half only, _st uses inf_SCR02 to keep S */
+
+#define cvycs_rr(XD, XS)                                                    \
+        EVX(RXB(XD), RXB(XS),    0x00, 1, 0, 1) EMITB(0x5A)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))
+
+#define cvycs_ld(XD, MS, DS)                                                \
+    ADR EVX(RXB(XD), RXB(MS),    0x00, 1, 0, 1) EMITB(0x5A)                 \
+        MRM(REG(XD), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#define cvucs_rr(XD, XS)                                                    \
+        EVX(RXB(XS), RXB(XD),    0x00, 1, 1, 3) EMITB(0x19)                 \
+        MRM(REG(XS), MOD(XD), REG(XD))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0x01))                                  \
+        cvycs_rr(W(XD), W(XD))
+
+#define cvxds_rr(XD, XS)                                                    \
+        EVW(RXB(XD), RXB(XS),    0x00, 1, 1, 1) EMITB(0x5A)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))
+
+#define cvxds_st(XS, MD, DD)                                                \
+        movdx_st(W(XS), Mebp, inf_SCR02(0))                                 \
+        cvxds_rr(W(XS), W(XS))                                              \
+        movix_st(W(XS), W(MD), W(DD))                                       \
+        movdx_ld(W(XS), Mebp, inf_SCR02(0))
+
 /************   packed double-precision integer arithmetic/shifts   ***********/
 
 /* add (G = G + S), (D = S + T) if (#D != #T) */
@@ -972,6 +1147,68 @@
         MRM(REG(XD), MOD(MT), REG(MT))                                      \
         AUX(SIB(MT), CMD(DT), EMPTY)
 
+/* clz (D = number of leading zeroes in each element of S), 64 if 0 */
+
+#define clzdx_rr(XD, XS)                                                    \
+        EVW(RXB(XD), RXB(XS),    0x00, 1, 1, 2) EMITB(0x44)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))
+
+#define clzdx_ld(XD, MS, DS)                                                \
+    ADR EVW(RXB(XD), RXB(MS),    0x00, 1, 1, 2) EMITB(0x44)                 \
+        MRM(REG(XD), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+/* cvy (D = S), zero-[x] or sign-[n] extends lower half of 32-bit elements
+ * cvu (D = S), zero-[x] or sign-[n] extends upper half of 32-bit elements
+ * cvx (D = S), narrows signed 64-bit elements to lower half of D, upper is 0
+ * with unsigned-[x] or signed-[n] saturation into 32-bit elements */
+
+#define cvycx_rr(XD, XS)                                                    \
+        EVX(RXB(XD), RXB(XS),    0x00, 1, 1, 2) EMITB(0x35)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))
+
+#define cvycn_rr(XD, XS)                                                    \
+        EVX(RXB(XD), RXB(XS),    0x00, 1, 1, 2) EMITB(0x25)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))
+
+#define cvucx_rr(XD, XS)                                                    \
+        EVX(RXB(XS), RXB(XD),    0x00, 1, 1, 3) EMITB(0x39)                 \
+        MRM(REG(XS), MOD(XD), REG(XD))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0x01))                                  \
+        cvycx_rr(W(XD), W(XD))
+
+#define cvucn_rr(XD, XS)                                                    \
+        EVX(RXB(XS), RXB(XD),    0x00, 1, 1, 3) EMITB(0x39)                 \
+        MRM(REG(XS), MOD(XD), REG(XD))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0x01))                                  \
+        cvycn_rr(W(XD), W(XD))
+
+#define cvxdx_rr(XD, XS)                                                    \
+        cvxdx3ld(W(XD), W(XS), Mebp, inf_GPC06_64)
+
+#define cvxdn_rr(XD, XS)                                                    \
+        EVX(RXB(XS), RXB(XD),    0x00, 1, 2, 2) EMITB(0x25)                 \
+        MRM(REG(XS), MOD(XD), REG(XD))
+
+/* k1 keeps non-negative elements (sign bit clear in MT), others are zeroed */
+
+#define cvxdx3ld(XD, XS, MT, DT) /* not portable, do not use outside */     \
+    ADR EVW(0,       RXB(MT), REN(XS), 1, 2, 2) EMITB(0x27)                 \
+        MRM(0x01,    MOD(MT), REG(MT))                                      \
+        AUX(SIB(MT), CMD(DT), EMPTY)                                        \
+        EZX(RXB(XS), RXB(XD),    0x00, 1, 2, 2) EMITB(0x15)                 \
+        MRM(REG(XS), MOD(XD), REG(XD))
+
+/* bsw (D = S with the order of bytes reversed in each element) */
+
+#define bswdx_rr(XD, XS)                                                    \
+        shhcx3ri(W(XD), W(XS), IB(0x1B))                                    \
+        bswax3rx(W(XD), W(XD), TmmX(W(XD), W(XD)))
+
+#define bswdx_ld(XD, MS, DS)                                                \
+        movdx_ld(W(XD), W(MS), W(DS))                                       \
+        bswdx_rr(W(XD), W(XD))
+
 /****************   packed double-precision integer compare   *****************/
 
 /* min (G = G < S ? G : S), (D = S < T ? S : T) if (#D != #T), unsigned */
@@ -181,6 +181,26 @@
         MRM(REG(XS), MOD(MD), REG(MD))                                      \
         AUX(SIB(MD), CMD(DD), EMPTY)
 
+/* stn (D = S) non-temporal store, bypasses caches on the way to memory
+ * weakly-ordered, place sfnce_xx before [D] is read by other threads */
+
+#define stnqx_st(XS, MD, DD)                                                \
+    ADR EVW(RXB(XS), RXB(MD),    0x00, K, 1, 1) EMITB(0x2B)                 \
+        MRM(REG(XS), MOD(MD), REG(MD))                                      \
+        AUX(SIB(MD), CMD(DD), EMPTY)
+
+/* bcs (D = [M]) broadcast scalar element from memory into all SIMD elements
+ * bcs (D = S) broadcast 64-bit BASE register S into all SIMD elements */
+
+#define bcsqx_ld(XD, MS, DS)                                                \
+    ADR EVW(RXB(XD), RXB(MS),    0x00, K, 1, 2) EMITB(0x19)                 \
+        MRM(REG(XD), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#define bcsqx_rr(XD, RS)                                                    \
+        EVW(RXB(XD), RXB(RS),    0x00, K, 1, 2) EMITB(0x7C)                 \
+        MRM(REG(XD), MOD(RS), REG(RS))
+
 /* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
  * uses Xmm0 implicitly as a mask register, destroys Xmm0, 0-masked XS elems */
 
@@ -201,6 +221,172 @@
         MRM(REG(XS), MOD(MG), REG(MG))                                      \
         AUX(SIB(MG), CMD(DG), EMPTY)
 
+/* gat (D = [M + S]) gather elements at per-lane indices S from M/DS,
+ * indices are 64-bit in elements (full VSIB range), M*** or Oeax,
+ * but not indexed modes (I***, ...), XD/XS differ,
+ * uses k1 as a temp mask register here */
+
+#define gatqx_ld(XD, XS, MS, DS)                                            \
+        VEX(0,             0,    0x00, 1, 0, 1) EMITB(0x46)                 \
+        MRM(0x01,       0x03,    0x00)                                      \
+    ADR EKW(RXB(XD), RXB(MS) | (RXB(XS) & 1) << 1, REN(XS) & 16, K, 1, 2)   \
+        EMITB(0x93)                                                         \
+        MRM(REG(XD), MOD(MS),    0x04)                                      \
+        AUX(EMITB(0xC0 | REG(XS) << 3 | REG(MS)), CMD(DS), EMPTY)
+
+/* sct (M + T = S) scatter elements of S to per-lane indices T at M/DD,
+ * indices are 64-bit in elements (full VSIB range), M*** or Oeax,
+ * but not indexed modes (I***, ...),
+ * colliding indices are written in lane order (the highest lane wins),
+ * uses k1 as a temp mask register here */
+
+#define sctqx_st(XS, XT, MD, DD)                                            \
+        VEX(0,             0,    0x00, 1, 0, 1) EMITB(0x46)                 \
+        MRM(0x01,       0x03,    0x00)                                      \
+    ADR EKW(RXB(XS), RXB(MD) | (RXB(XT) & 1) << 1, REN(XT) & 16, K, 1, 2)   \
+        EMITB(0xA3)                                                         \
+        MRM(REG(XS), MOD(MD),    0x04)                                      \
+        AUX(EMITB(0xC0 | REG(XT) << 3 | REG(MD)), CMD(DD), EMPTY)
+
+/* mtl (D = S) move the first RS lanes only (loop tails), 0 <= RS <= 8 here
+ * load zeroes the remaining lanes of XD, store keeps memory past RS lanes,
+ * uses k1 as a temp mask register here (Xmm0 on AVX), XD/XS != Xmm0 */
+
+#define mtlqx_ld(XD, RS, MS, DS)                                            \
+        mtlox_k1(W(RS))                                                     \
+    ADR EZW(RXB(XD), RXB(MS),    0x00, K, 1, 1) EMITB(0x28)                 \
+        MRM(REG(XD), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#define mtlqx_st(XS, RS, MD, DD)                                            \
+        mtlox_k1(W(RS))                                                     \
+    ADR EKW(RXB(XS), RXB(MD),    0x00, K, 1, 1) EMITB(0x29)                 \
+        MRM(REG(XS), MOD(MD), REG(MD))                                      \
+        AUX(SIB(MD), CMD(DD), EMPTY)
+
+/* shf (G = G[IS]), (D = S[IT]) shuffle elements within each 128-bit lane
+ * 1-bit fields of the immediate select 64-bit elements in each 128-bit lane */
+
+#define shfqx_ri(XG, IS)                                                    \
+        shfqx3ri(W(XG), W(XG), W(IS))
+
+#define shfqx3ri(XD, XS, IT)                                                \
+        EVW(RXB(XD), RXB(XS),    0x00, K, 1, 3) EMITB(0x05)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(((VAL(IT) & 3) * 0x55)))
+
+/* tbl (G = G[S]), (D = S[T]) permute elements across the SIMD register
+ * indices are in elements, taken modulo the number of elements in SIMD */
+
+#define tblqx_rr(XG, XS)                                                    \
+        tblqx3rr(W(XG), W(XG), W(XS))
+
+#define tblqx3rr(XD, XS, XT)                                                \
+        EVW(RXB(XD), RXB(XS), REN(XT), K, 1, 2) EMITB(0x16)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))
+
+/* hrd (D = S op S op ..) reduce all elements of S with "op" into each of D
+ * in log2 steps via in-register shuffles, temporary register is preserved */
+
+#define hrdqs_rx(XD, XS, XT, op) /* not portable, do not use outside */     \
+        movqx_st(W(XT), Mebp, inf_SCR02(0))                                 \
+        sw4ox3ri(W(XT), W(XS), IB(0x4E))                                    \
+        op(W(XT), W(XS))                                                    \
+        sw4ox3ri(W(XD), W(XT), IB(0xB1))                                    \
+        op(W(XD), W(XT))                                                    \
+        shfqx3ri(W(XT), W(XD), IB(1))                                       \
+        op(W(XD), W(XT))                                                    \
+        movqx_ld(W(XT), Mebp, inf_SCR02(0))
+
+/* aln (G = [S:G] >> IT) concatenate S and G, shift right by IT elements
+ * keeping the lower half, bc0 (D = S[0]) broadcast element 0 (not portable) */
+
+#define alnqx_ri(XG, XS, IT) /* not portable, do not use outside */         \
+        EVW(RXB(XG), RXB(XG), REN(XS), K, 1, 3) EMITB(0x03)                 \
+        MRM(REG(XG), MOD(XG), REG(XG))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(VAL(IT)))
+
+#define bc0qx_rr(XD, XS) /* not portable, do not use outside */             \
+        EVW(RXB(XD), RXB(XS),    0x00, K, 1, 2) EMITB(0x59)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))
+
+/* scn (D[i] = S[0] op .. op S[i]) inclusive scan of S with "op" in log2
+ * steps, scz shifts in zeroes (add), scs repeats S[0] (min/max, idempotent),
+ * sce shifts D up by one element (exclusive scan), Xmm0 is used as a temp */
+
+#define sczqx_rx(XD, XS, op) /* not portable, do not use outside */         \
+        xorqx_rr(Xmm0, Xmm0)                                                \
+        alnqx_ri(Xmm0, W(XS), IB(7))                                        \
+        op(Xmm0, W(XS))                                                     \
+        xorqx_rr(W(XD), W(XD))                                              \
+        alnqx_ri(W(XD), Xmm0, IB(6))                                        \
+        op(W(XD), Xmm0)                                                     \
+        xorqx_rr(Xmm0, Xmm0)                                                \
+        alnqx_ri(Xmm0, W(XD), IB(4))                                        \
+        op(Xmm0, W(XD))                                                     \
+        movqx_rr(W(XD), Xmm0)
+
+#define scsqx_rx(XD, XS, op) /* not portable, do not use outside */         \
+        bc0qx_rr(Xmm0, W(XS))                                               \
+        alnqx_ri(Xmm0, W(XS), IB(7))                                        \
+        op(Xmm0, W(XS))                                                     \
+        bc0qx_rr(W(XD), Xmm0)                                               \
+        alnqx_ri(W(XD), Xmm0, IB(6))                                        \
+        op(W(XD), Xmm0)                                                     \
+        bc0qx_rr(Xmm0, W(XD))                                               \
+        alnqx_ri(Xmm0, W(XD), IB(4))                                        \
+        op(Xmm0, W(XD))                                                     \
+        movqx_rr(W(XD), Xmm0)
+
+#define sceqx_rx(XD) /* not portable, do not use outside */                 \
+        xorqx_rr(Xmm0, Xmm0)                                                \
+        alnqx_ri(Xmm0, W(XD), IB(7))                                        \
+        movqx_rr(W(XD), Xmm0)
+
+/* adi (D[i] = S[0] + .. + S[i]) inclusive prefix sum of elements of S
+ * uses Xmm0 implicitly as a temp register, destroys Xmm0, XD/XS != Xmm0 */
+
+#define adiqs_rr(XD, XS)                                                    \
+        sczqx_rx(W(XD), W(XS), addqs_rr)
+
+#define adiqx_rr(XD, XS)                                                    \
+        sczqx_rx(W(XD), W(XS), addqx_rr)
+
+/* ade (D[i] = S[0] + .. + S[i-1]) exclusive prefix sum of S, D[0] = 0
+ * uses Xmm0 implicitly as a temp register, destroys Xmm0, XD/XS != Xmm0 */
+
+#define adeqs_rr(XD, XS)                                                    \
+        sczqx_rx(W(XD), W(XS), addqs_rr)                                    \
+        sceqx_rx(W(XD))
+
+#define adeqx_rr(XD, XS)                                                    \
+        sczqx_rx(W(XD), W(XS), addqx_rr)                                    \
+        sceqx_rx(W(XD))
+
+/* mni (D[i] = min(S[0], .. , S[i])) inclusive prefix min of elements of S
+ * uses Xmm0 implicitly as a temp register, destroys Xmm0, XD/XS != Xmm0 */
+
+#define mniqs_rr(XD, XS)                                                    \
+        scsqx_rx(W(XD), W(XS), minqs_rr)
+
+#define mniqx_rr(XD, XS)                                                    \
+        scsqx_rx(W(XD), W(XS), minqx_rr)
+
+#define mniqn_rr(XD, XS)                                                    \
+        scsqx_rx(W(XD), W(XS), minqn_rr)
+
+/* mxi (D[i] = max(S[0], .. , S[i])) inclusive prefix max of elements of S
+ * uses Xmm0 implicitly as a temp register, destroys Xmm0, XD/XS != Xmm0 */
+
+#define mxiqs_rr(XD, XS)                                                    \
+        scsqx_rx(W(XD), W(XS), maxqs_rr)
+
+#define mxiqx_rr(XD, XS)                                                    \
+        scsqx_rx(W(XD), W(XS), maxqx_rr)
+
+#define mxiqn_rr(XD, XS)                                                    \
+        scsqx_rx(W(XD), W(XS), maxqn_rr)
+
 #if (RT_512X1 == 1 || RT_512X1 == 4)
 
 /* and (G = G & S), (D = S & T) if (#D != #T) */
@@ -417,6 +603,10 @@
         /* adp, adh are defined in rtbase.h (first 15-regs only)
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  adhqs_rr
+#define adhqs_rr(XD, XS) /* horizontal reductive add, first 15-regs only */ \
+        hrdqs_rx(W(XD), W(XS), TmmX(W(XD), W(XS)), addqs_rr)
+
 /* sub (G = G - S), (D = S - T) if (#D != #T) */
 
 #define subqs_rr(XG, XS)                                                    \
@@ -454,6 +644,10 @@
         /* mlp, mlh are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  mlhqs_rr
+#define mlhqs_rr(XD, XS) /* horizontal reductive mul */                     \
+        hrdqs_rx(W(XD), W(XS), TmmX(W(XD), W(XS)), mulqs_rr)
+
 /* div (G = G / S), (D = S / T) if (#D != #T) and on ARMv7 if (#D != #S) */
 
 #define divqs_rr(XG, XS)                                                    \
@@ -600,6 +794,10 @@
         /* mnp, mnh are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  mnhqs_rr
+#define mnhqs_rr(XD, XS) /* horizontal reductive min */                     \
+        hrdqs_rx(W(XD), W(XS), TmmX(W(XD), W(XS)), minqs_rr)
+
 /* max (G = G > S ? G : S), (D = S > T ? S : T) if (#D != #T) */
 
 #define maxqs_rr(XG, XS)                                                    \
@@ -620,6 +818,10 @@
         /* mxp, mxh are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  mxhqs_rr
+#define mxhqs_rr(XD, XS) /* horizontal reductive max */                     \
+        hrdqs_rx(W(XD), W(XS), TmmX(W(XD), W(XS)), maxqs_rr)
+
 /* ceq (G = G == S ? -1 : 0), (D = S == T ? -1 : 0) if (#D != #T) */
 
 #define ceqqs_rr(XG, XS)                                                    \
@@ -1078,6 +1280,39 @@
 
 #endif /* RT_512X1 == 2, 8 */
 
+/* cvy (D = fp32-to-fp64 S), widens lower half of fp32 elements in S
+ * cvu (D = fp32-to-fp64 S), widens upper half of fp32 elements in S
+ * cvx (D = fp64-to-fp32 S), narrows to lower half of D, upper half is 0
+ * narrowing rounds as set in fp control register (in FCTRL blocks)
+ * _ld/_st access the lower half only, _st uses inf_SCR02 to keep S */
+
+#define cvyos_rr(XD, XS)                                                    \
+        EVX(RXB(XD), RXB(XS),    0x00, K, 0, 1) EMITB(0x5A)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))
+
+#define cvyos_ld(XD, MS, DS)                                                \
+    ADR EVX(RXB(XD), RXB(MS),    0x00, K, 0, 1) EMITB(0x5A)                 \
+        MRM(REG(XD), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#define cvuos_rr(XD, XS)                                                    \
+        EVW(RXB(XS), RXB(XD),    0x00, K, 1, 3) EMITB(0x1B)                 \
+        MRM(REG(XS), MOD(XD), REG(XD))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0x01))                                  \
+        cvyos_rr(W(XD), W(XD))
+
+#define cvxqs_rr(XD, XS)                                                    \
+        EVW(RXB(XD), RXB(XS),    0x00, K, 1, 1) EMITB(0x5A)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))
+
+#define cvxqs_st(XS, MD, DD)                                                \
+        movqx_st(W(XS), Mebp, inf_SCR02(0))                                 \
+        cvxqs_rr(W(XS), W(XS))                                              \
+    ADR EVW(RXB(XS), RXB(MD),    0x00, K, 1, 3) EMITB(0x1B)                 \
+        MRM(REG(XS), MOD(MD), REG(MD))                                      \
+        AUX(SIB(MD), CMD(DD), EMITB(0x00))                                  \
+        movqx_ld(W(XS), Mebp, inf_SCR02(0))
+
 /************   packed double-precision integer arithmetic/shifts   ***********/
 
 /* add (G = G + S), (D = S + T) if (#D != #T) */
@@ -1317,6 +1552,72 @@
         MRM(REG(XD), MOD(MT), REG(MT))                                      \
         AUX(SIB(MT), CMD(DT), EMPTY)
 
+/* clz (D = number of leading zeroes in each element of S), 64 if 0 */
+
+#define clzqx_rr(XD, XS)                                                    \
+        EVW(RXB(XD), RXB(XS),    0x00, K, 1, 2) EMITB(0x44)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))
+
+#define clzqx_ld(XD, MS, DS)                                                \
+    ADR EVW(RXB(XD), RXB(MS),    0x00, K, 1, 2) EMITB(0x44)                 \
+        MRM(REG(XD), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+/* cvy (D = S), zero-[x] or sign-[n] extends lower half of 32-bit elements
+ * cvu (D = S), zero-[x] or sign-[n] extends upper half of 32-bit elements
+ * cvx (D = S), narrows signed 64-bit elements to lower half of D, upper is 0
+ * with unsigned-[x] or signed-[n] saturation into 32-bit elements */
+
+#define cvyox_rr(XD, XS)                                                    \
+        EVX(RXB(XD), RXB(XS),    0x00, K, 1, 2) EMITB(0x35)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))
+
+#define cvyon_rr(XD, XS)                                                    \
+        EVX(RXB(XD), RXB(XS),    0x00, K, 1, 2) EMITB(0x25)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))
+
+#define cvuox_rr(XD, XS)                                                    \
+        EVW(RXB(XS), RXB(XD),    0x00, K, 1, 3) EMITB(0x3B)                 \
+        MRM(REG(XS), MOD(XD), REG(XD))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0x01))                                  \
+        cvyox_rr(W(XD), W(XD))
+
+#define cvuon_rr(XD, XS)                                                    \
+        EVW(RXB(XS), RXB(XD),    0x00, K, 1, 3) EMITB(0x3B)                 \
+        MRM(REG(XS), MOD(XD), REG(XD))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0x01))                                  \
+        cvyon_rr(W(XD), W(XD))
+
+#define cvxqx_rr(XD, XS)                                                    \
+        cvxqx3ld(W(XD), W(XS), Mebp, inf_GPC06_64)
+
+#define cvxqn_rr(XD, XS)                                                    \
+        EVX(RXB(XS), RXB(XD),    0x00, K, 2, 2) EMITB(0x25)                 \
+        MRM(REG(XS), MOD(XD), REG(XD))
+
+/* k1 keeps non-negative elements (sign bit clear in MT), others are zeroed */
+
+#define cvxqx3ld(XD, XS, MT, DT) /* not portable, do not use outside */     \
+    ADR EVW(0,       RXB(MT), REN(XS), K, 2, 2) EMITB(0x27)                 \
+        MRM(0x01,    MOD(MT), REG(MT))                                      \
+        AUX(SIB(MT), CMD(DT), EMPTY)                                        \
+        EZX(RXB(XS), RXB(XD),    0x00, K, 2, 2) EMITB(0x15)                 \
+        MRM(REG(XS), MOD(XD), REG(XD))
+
+#if (RT_512X1 == 2 || RT_512X1 == 8)
+
+/* bsw (D = S with the order of bytes reversed in each element) */
+
+#define bswqx_rr(XD, XS)                                                    \
+        shhox3ri(W(XD), W(XS), IB(0x1B))                                    \
+        bswmx3rx(W(XD), W(XD), TmmX(W(XD), W(XD)))
+
+#define bswqx_ld(XD, MS, DS)                                                \
+        movqx_ld(W(XD), W(MS), W(DS))                                       \
+        bswqx_rr(W(XD), W(XD))
+
+#endif /* RT_512X1 == 2, 8 */
+
 /****************   packed double-precision integer compare   *****************/
 
 /* min (G = G < S ? G : S), (D = S < T ? S : T) if (#D != #T), unsigned */
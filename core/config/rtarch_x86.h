@@ -1470,6 +1470,106 @@
 #define remwn_xm(MS, DS)    /* to be placed immediately after divwn_xm */   \
                                      /* to produce remainder Redx<-rem */
 
+/* cnt (D = number of bits set in S), population count
+ * clz (D = number of leading zeroes in S), 32 if S is 0
+ * ctz (D = number of trailing zeroes in S), 32 if S is 0
+ * set-flags: undefined */
+
+#if RT_BASE_COMPAT_BMI < 2 /* 0 - generic, 1 - 3-op-VEX, 2 - BMI1+BMI2 */
+
+#define cntwx_rr(RD, RS)                                                    \
+        movwx_rr(W(RD), W(RS))                                              \
+        stack_st(Rebp)                                                      \
+        movwx_rr(Rebp, W(RD))                                               \
+        shrwx_ri(Rebp, IB(1))                                               \
+        andwx_ri(Rebp, IW(0x55555555))                                      \
+        subwx_rr(W(RD), Rebp)                                               \
+        movwx_rr(Rebp, W(RD))                                               \
+        shrwx_ri(Rebp, IB(2))                                               \
+        andwx_ri(Rebp, IW(0x33333333))                                      \
+        andwx_ri(W(RD), IW(0x33333333))                                     \
+        addwx_rr(W(RD), Rebp)                                               \
+        movwx_rr(Rebp, W(RD))                                               \
+        shrwx_ri(Rebp, IB(4))                                               \
+        addwx_rr(W(RD), Rebp)                                               \
+        andwx_ri(W(RD), IW(0x0F0F0F0F))                                     \
+        mulwx_ri(W(RD), IW(0x01010101))                                     \
+        shrwx_ri(W(RD), IB(24))                                             \
+        stack_ld(Rebp)
+
+#define clzwx_rr(RD, RS)                                                    \
+        stack_st(Rebp)                                                      \
+        EMITB(0x0F) EMITB(0xBD)                  /* <- bsr ebp */           \
+        MRM(0x05,    MOD(RS), REG(RS))                                      \
+        movwx_ri(W(RD), IB(63))                                             \
+        EMITB(0x0F) EMITB(0x45)                  /* <- cmovnz */            \
+        MRM(REG(RD),    0x03,    0x05)                                      \
+        xorwx_ri(W(RD), IB(31))                                             \
+        stack_ld(Rebp)
+
+#define ctzwx_rr(RD, RS)                                                    \
+        stack_st(Rebp)                                                      \
+        EMITB(0x0F) EMITB(0xBC)                  /* <- bsf ebp */           \
+        MRM(0x05,    MOD(RS), REG(RS))                                      \
+        movwx_ri(W(RD), IB(32))                                             \
+        EMITB(0x0F) EMITB(0x45)                  /* <- cmovnz */            \
+        MRM(REG(RD),    0x03,    0x05)                                      \
+        stack_ld(Rebp)
+
+#define cntwx_ld(RD, MS, DS)                                                \
+        movwx_ld(W(RD), W(MS), W(DS))                                       \
+        cntwx_rr(W(RD), W(RD))
+
+#define clzwx_ld(RD, MS, DS)                                                \
+        movwx_ld(W(RD), W(MS), W(DS))                                       \
+        clzwx_rr(W(RD), W(RD))
+
+#define ctzwx_ld(RD, MS, DS)                                                \
+        movwx_ld(W(RD), W(MS), W(DS))                                       \
+        ctzwx_rr(W(RD), W(RD))
+
+#else /* RT_BASE_COMPAT_BMI >= 2 */
+
+#define cntwx_rr(RD, RS)                                                    \
+        EMITB(0xF3) EMITB(0x0F) EMITB(0xB8)                                 \
+        MRM(REG(RD), MOD(RS), REG(RS))
+
+#define cntwx_ld(RD, MS, DS)                                                \
+        EMITB(0xF3) EMITB(0x0F) EMITB(0xB8)                                 \
+        MRM(REG(RD), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#define clzwx_rr(RD, RS)                                                    \
+        EMITB(0xF3) EMITB(0x0F) EMITB(0xBD)                                 \
+        MRM(REG(RD), MOD(RS), REG(RS))
+
+#define clzwx_ld(RD, MS, DS)                                                \
+        EMITB(0xF3) EMITB(0x0F) EMITB(0xBD)                                 \
+        MRM(REG(RD), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#define ctzwx_rr(RD, RS)                                                    \
+        EMITB(0xF3) EMITB(0x0F) EMITB(0xBC)                                 \
+        MRM(REG(RD), MOD(RS), REG(RS))
+
+#define ctzwx_ld(RD, MS, DS)                                                \
+        EMITB(0xF3) EMITB(0x0F) EMITB(0xBC)                                 \
+        MRM(REG(RD), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#endif /* RT_BASE_COMPAT_BMI >= 2 */
+
+/* bsw (D = S with the order of bytes reversed), byte-swap
+ * set-flags: no */
+
+#define bswwx_rr(RD, RS)                                                    \
+        movwx_rr(W(RD), W(RS))                                              \
+        EMITB(0x0F) EMITB(0xC8 | REG(RD))
+
+#define bswwx_ld(RD, MS, DS)                                                \
+        movwx_ld(W(RD), W(MS), W(DS))                                       \
+        EMITB(0x0F) EMITB(0xC8 | REG(RD))
+
 /* arj (G = G op S, if cc G then jump lb)
  * set-flags: undefined
  * refer to individual instruction descriptions
@@ -1779,6 +1879,63 @@
         MRM(REG(RD), MOD(MS), REG(MS))                                      \
         AUX(SIB(MS), CMD(DS), EMPTY)
 
+/* pf0, pf1, pf2, pfn (prefetch [S] into cache, T0/T1/T2-hints, NTA-hint)
+ * T0 - all cache levels, T1 - L2 and up, T2 - L3 and up (if available),
+ * NTA - non-temporal (streaming), hints are advisory, never fault on [S]
+ * set-flags: no */
+
+#define pf0xx_ld(MS, DS)                                                    \
+        EMITB(0x0F) EMITB(0x18)                                             \
+        MRM(0x01,    MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#define pf1xx_ld(MS, DS)                                                    \
+        EMITB(0x0F) EMITB(0x18)                                             \
+        MRM(0x02,    MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#define pf2xx_ld(MS, DS)                                                    \
+        EMITB(0x0F) EMITB(0x18)                                             \
+        MRM(0x03,    MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#define pfnxx_ld(MS, DS)                                                    \
+        EMITB(0x0F) EMITB(0x18)                                             \
+        MRM(0x00,    MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+/* sfn (fence for stores), orders all prior stores before any later stores
+ * place after non-temporal stores (stn) before [D] is read by other threads
+ * set-flags: no */
+
+#define sfnce_xx()                                                          \
+        EMITB(0x0F) EMITB(0xAE) EMITB(0xF8)
+
+/* zcl (zero 128-byte block at [D]), [D] must be aligned to 128 bytes
+ * no cache-line zeroing in ISA, 32 regular 32-bit stores of immediate 0
+ * set-flags: no */
+
+#define zclxx_st(MD, DD)                                                    \
+        zclxx_r8(W(MD), W(DD), 0x00)                                        \
+        zclxx_r8(W(MD), W(DD), 0x20)                                        \
+        zclxx_r8(W(MD), W(DD), 0x40)                                        \
+        zclxx_r8(W(MD), W(DD), 0x60)
+
+#define zclxx_r8(MD, DD, dp) /* not portable, do not use outside */         \
+        zclxx_rx(W(MD), W(DD), dp+0x00)                                     \
+        zclxx_rx(W(MD), W(DD), dp+0x04)                                     \
+        zclxx_rx(W(MD), W(DD), dp+0x08)                                     \
+        zclxx_rx(W(MD), W(DD), dp+0x0C)                                     \
+        zclxx_rx(W(MD), W(DD), dp+0x10)                                     \
+        zclxx_rx(W(MD), W(DD), dp+0x14)                                     \
+        zclxx_rx(W(MD), W(DD), dp+0x18)                                     \
+        zclxx_rx(W(MD), W(DD), dp+0x1C)
+
+#define zclxx_rx(MD, DD, dp) /* not portable, do not use outside */         \
+        EMITB(0xC7)                                                         \
+        MRM(0x00,       0x02, REG(MD))                                      \
+        AUX(SIB(MD), EMITW(VAL(DD)+(dp)), EMITW(0x00000000))
+
 /************************* pointer-sized instructions *************************/
 
 /* label (D = Reax = adr lb)
@@ -402,6 +402,117 @@ ADR ESC REX(RXB(XG), RXB(MS)) EMITB(0x0F) EMITB(0xD5)                       \
         movgx_rr(W(XD), W(XS))                                              \
         mulgx_ld(W(XD), W(MT), W(DT))
 
+/* muh (G = G * S), keeps upper half of the full-width product of elements
+ * unsigned-[x] or signed-[n], lower half is returned by mul */
+
+#define muhgx_rr(XG, XS)                                                    \
+    ESC REX(RXB(XG), RXB(XS)) EMITB(0x0F) EMITB(0xE4)                       \
+        MRM(REG(XG), MOD(XS), REG(XS))
+
+#define muhgx_ld(XG, MS, DS)                                                \
+ADR ESC REX(RXB(XG), RXB(MS)) EMITB(0x0F) EMITB(0xE4)                       \
+        MRM(REG(XG), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#define muhgn_rr(XG, XS)                                                    \
+    ESC REX(RXB(XG), RXB(XS)) EMITB(0x0F) EMITB(0xE5)                       \
+        MRM(REG(XG), MOD(XS), REG(XS))
+
+#define muhgn_ld(XG, MS, DS)                                                \
+ADR ESC REX(RXB(XG), RXB(MS)) EMITB(0x0F) EMITB(0xE5)                       \
+        MRM(REG(XG), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+/* dph (G = G + S * T) if (#G != #S && #G != #T), 16-bit pairs into 32-bit */
+
+#define dphix_rr(XG, XS, XT)                                                \
+        movix_st(W(XG), Mebp, inf_SCR02(0))                                 \
+        movix_rr(W(XG), W(XS))                                              \
+        madgx_rr(W(XG), W(XT))                                              \
+        addix_ld(W(XG), Mebp, inf_SCR02(0))
+
+#define dphix_ld(XG, XS, MT, DT)                                            \
+        movix_st(W(XG), Mebp, inf_SCR02(0))                                 \
+        movix_rr(W(XG), W(XS))                                              \
+        madgx_ld(W(XG), W(MT), W(DT))                                       \
+        addix_ld(W(XG), Mebp, inf_SCR02(0))
+
+#define madgx_rr(XG, XS) /* not portable, do not use outside */             \
+    ESC REX(RXB(XG), RXB(XS)) EMITB(0x0F) EMITB(0xF5)                       \
+        MRM(REG(XG), MOD(XS), REG(XS))
+
+#define madgx_ld(XG, MS, DS) /* not portable, do not use outside */         \
+ADR ESC REX(RXB(XG), RXB(MS)) EMITB(0x0F) EMITB(0xF5)                       \
+        MRM(REG(XG), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+/* cvy (D = S), zero-[x] or sign-[n] extends lower half of 16-bit elements
+ * cvu (D = S), zero-[x] or sign-[n] extends upper half of 16-bit elements
+ * cvx (D = S), narrows signed 32-bit elements to lower half of D, upper is 0
+ * with unsigned-[x] or signed-[n] saturation into 16-bit elements */
+
+#define cvygx_rr(XD, XS)                                                    \
+        movix_rr(W(XD), W(XS))                                              \
+    ESC REX(RXB(XD), RXB(XD)) EMITB(0x0F) EMITB(0x61)                       \
+        MRM(REG(XD), MOD(XD), REG(XD))                                      \
+        shrix_ri(W(XD), IB(16))
+
+#define cvygn_rr(XD, XS)                                                    \
+        movix_rr(W(XD), W(XS))                                              \
+    ESC REX(RXB(XD), RXB(XD)) EMITB(0x0F) EMITB(0x61)                       \
+        MRM(REG(XD), MOD(XD), REG(XD))                                      \
+        shrin_ri(W(XD), IB(16))
+
+#define cvugx_rr(XD, XS)                                                    \
+        movix_rr(W(XD), W(XS))                                              \
+    ESC REX(RXB(XD), RXB(XD)) EMITB(0x0F) EMITB(0x69)                       \
+        MRM(REG(XD), MOD(XD), REG(XD))                                      \
+        shrix_ri(W(XD), IB(16))
+
+#define cvugn_rr(XD, XS)                                                    \
+        movix_rr(W(XD), W(XS))                                              \
+    ESC REX(RXB(XD), RXB(XD)) EMITB(0x0F) EMITB(0x69)                       \
+        MRM(REG(XD), MOD(XD), REG(XD))                                      \
+        shrin_ri(W(XD), IB(16))
+
+#if (RT_SIMD_COMPAT_SSE < 4)
+
+#define cvxix_rr(XD, XS) /* clamps below 0, packs with bias, no packusdw */ \
+        movix_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movix_rr(W(XD), W(XS))                                              \
+        shrin_ri(W(XD), IB(31))                                             \
+        annix_ld(W(XD), Mebp, inf_SCR01(0))                                 \
+        movix_st(W(XD), Mebp, inf_SCR01(0))                                 \
+        ceqix_rr(W(XD), W(XD))                                              \
+        shlix_ri(W(XD), IB(15))                                             \
+        addix_ld(W(XD), Mebp, inf_SCR01(0))                                 \
+    ESC REX(RXB(XD), RXB(XD)) EMITB(0x0F) EMITB(0x6B)                       \
+        MRM(REG(XD), MOD(XD), REG(XD))                                      \
+        movix_st(W(XD), Mebp, inf_SCR01(0))                                 \
+        ceqix_rr(W(XD), W(XD))                                              \
+        shlgx_ri(W(XD), IB(15))                                             \
+        xorix_ld(W(XD), Mebp, inf_SCR01(0))                                 \
+    xF3 REX(RXB(XD), RXB(XD)) EMITB(0x0F) EMITB(0x7E)                       \
+        MRM(REG(XD), MOD(XD), REG(XD))
+
+#else /* RT_SIMD_COMPAT_SSE >= 4 */
+
+#define cvxix_rr(XD, XS)                                                    \
+        movix_rr(W(XD), W(XS))                                              \
+    ESC REX(RXB(XD), RXB(XD)) EMITB(0x0F) EMITB(0x38) EMITB(0x2B)           \
+        MRM(REG(XD), MOD(XD), REG(XD))                                      \
+    xF3 REX(RXB(XD), RXB(XD)) EMITB(0x0F) EMITB(0x7E)                       \
+        MRM(REG(XD), MOD(XD), REG(XD))
+
+#endif /* RT_SIMD_COMPAT_SSE >= 4 */
+
+#define cvxin_rr(XD, XS)                                                    \
+        movix_rr(W(XD), W(XS))                                              \
+    ESC REX(RXB(XD), RXB(XD)) EMITB(0x0F) EMITB(0x6B)                       \
+        MRM(REG(XD), MOD(XD), REG(XD))                                      \
+    xF3 REX(RXB(XD), RXB(XD)) EMITB(0x0F) EMITB(0x7E)                       \
+        MRM(REG(XD), MOD(XD), REG(XD))
+
 /* shl (G = G << S), (D = S << T) if (#D != #T) - plain, unsigned
  * for maximum compatibility: shift count must be modulo elem-size */
 
@@ -588,6 +699,24 @@ ADR ESC REX(RXB(XG), RXB(MS)) EMITB(0x0F) EMITB(0xE1)                       \
         stack_ld(Recx)                                                      \
         movgx_ld(W(XD), Mebp, inf_SCR01(0))
 
+/* bsw (D = S with the order of bytes reversed in each element) */
+
+#define bswgx_rr(XD, XS)                                                    \
+        bswgx3rx(W(XD), W(XS), TmmX(W(XD), W(XS)))
+
+#define bswgx_ld(XD, MS, DS)                                                \
+        movgx_ld(W(XD), W(MS), W(DS))                                       \
+        bswgx3rx(W(XD), W(XD), TmmX(W(XD), W(XD)))
+
+/* swap bytes in each 16-bit element of S into D, temporary XT is preserved */
+
+#define bswgx3rx(XD, XS, XT) /* not portable, do not use outside */         \
+        movgx_st(W(XT), Mebp, inf_SCR02(0))                                 \
+        shrgx3ri(W(XT), W(XS), IB(8))                                       \
+        shlgx3ri(W(XD), W(XS), IB(8))                                       \
+        orrgx_rr(W(XD), W(XT))                                              \
+        movgx_ld(W(XT), Mebp, inf_SCR02(0))
+
 /*****************   packed half-precision integer compare   ******************/
 
 #if (RT_SIMD_COMPAT_SSE < 4)
@@ -1008,6 +1137,30 @@ ADR ESC REX(RXB(XG), RXB(MS)) EMITB(0x0F) EMITB(0x65)                       \
         orrgx_rr(Xmm0, W(XS))                                               \
         movgx_st(Xmm0, W(MG), W(DG))
 
+#if (RT_SIMD_COMPAT_SSE >= 4)
+
+/* tbl (G = G[S]), (D = S[T]) if (#D != #T) look up bytes within 128-bit lanes
+ * indices 0-15 pick bytes in the same lane, 0x80-0xFF produce zero bytes */
+
+#define tblgb_rr(XG, XS)                                                    \
+    ESC REX(RXB(XG), RXB(XS)) EMITB(0x0F) EMITB(0x38) EMITB(0x00)           \
+        MRM(REG(XG), MOD(XS), REG(XS))
+
+#define tblgb_ld(XG, MS, DS)                                                \
+ADR ESC REX(RXB(XG), RXB(MS)) EMITB(0x0F) EMITB(0x38) EMITB(0x00)           \
+        MRM(REG(XG), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#define tblgb3rr(XD, XS, XT)                                                \
+        movgx_rr(W(XD), W(XS))                                              \
+        tblgb_rr(W(XD), W(XT))
+
+#define tblgb3ld(XD, XS, MT, DT)                                            \
+        movgx_rr(W(XD), W(XS))                                              \
+        tblgb_ld(W(XD), W(MT), W(DT))
+
+#endif /* RT_SIMD_COMPAT_SSE >= 4 */
+
 /* move/logic instructions are sizeless and provided in 16-bit subset above */
 
 /*************   packed byte-precision integer arithmetic/shifts   ************/
@@ -1198,6 +1351,86 @@ ADR ESC REX(RXB(XG), RXB(MS)) EMITB(0x0F) EMITB(0xE8)                       \
         stack_ld(Recx)                                                      \
         movgx_ld(W(XD), Mebp, inf_SCR01(0))
 
+/* dpb (G = G + S * T) if (#G != #S && #G != #T), 8-bit quads into 32-bit
+ * even/odd bytes are widened to 16-bit (S unsigned, T signed) for pmaddwd */
+
+#define dpbix_rr(XG, XS, XT)                                                \
+        movix_st(W(XG), Mebp, inf_SCR02(0))                                 \
+        movix_rr(W(XG), W(XT))                                              \
+        shlgx_ri(W(XG), IB(8))                                              \
+        dpbix_rx(W(XG), W(XS))                                              \
+        movix_rr(W(XG), W(XT))                                              \
+        dpbix_rh(W(XG), W(XS))
+
+#define dpbix_ld(XG, XS, MT, DT)                                            \
+        movix_st(W(XG), Mebp, inf_SCR02(0))                                 \
+        movix_ld(W(XG), W(MT), W(DT))                                       \
+        shlgx_ri(W(XG), IB(8))                                              \
+        dpbix_rx(W(XG), W(XS))                                              \
+        movix_ld(W(XG), W(MT), W(DT))                                       \
+        dpbix_rh(W(XG), W(XS))
+
+#define dpbix_rx(XG, XS) /* not portable, do not use outside */             \
+        shrgn_ri(W(XG), IB(8))                                              \
+        movix_st(W(XG), Mebp, inf_SCR01(0))                                 \
+        movix_rr(W(XG), W(XS))                                              \
+        shlgx_ri(W(XG), IB(8))                                              \
+        shrgx_ri(W(XG), IB(8))                                              \
+        madgx_ld(W(XG), Mebp, inf_SCR01(0))                                 \
+        addix_ld(W(XG), Mebp, inf_SCR02(0))                                 \
+        movix_st(W(XG), Mebp, inf_SCR02(0))
+
+#define dpbix_rh(XG, XS) /* not portable, do not use outside */             \
+        shrgn_ri(W(XG), IB(8))                                              \
+        movix_st(W(XG), Mebp, inf_SCR01(0))                                 \
+        movix_rr(W(XG), W(XS))                                              \
+        shrgx_ri(W(XG), IB(8))                                              \
+        madgx_ld(W(XG), Mebp, inf_SCR01(0))                                 \
+        addix_ld(W(XG), Mebp, inf_SCR02(0))
+
+/* cvy (D = S), zero-[b] or sign-[c] extends lower half of 8-bit elements
+ * cvu (D = S), zero-[b] or sign-[c] extends upper half of 8-bit elements
+ * cvx (D = S), narrows signed 16-bit elements to lower half of D, upper is 0
+ * with unsigned-[x] or signed-[n] saturation into 8-bit elements */
+
+#define cvygb_rr(XD, XS)                                                    \
+        movix_rr(W(XD), W(XS))                                              \
+    ESC REX(RXB(XD), RXB(XD)) EMITB(0x0F) EMITB(0x60)                       \
+        MRM(REG(XD), MOD(XD), REG(XD))                                      \
+        shrgx_ri(W(XD), IB(8))
+
+#define cvygc_rr(XD, XS)                                                    \
+        movix_rr(W(XD), W(XS))                                              \
+    ESC REX(RXB(XD), RXB(XD)) EMITB(0x0F) EMITB(0x60)                       \
+        MRM(REG(XD), MOD(XD), REG(XD))                                      \
+        shrgn_ri(W(XD), IB(8))
+
+#define cvugb_rr(XD, XS)                                                    \
+        movix_rr(W(XD), W(XS))                                              \
+    ESC REX(RXB(XD), RXB(XD)) EMITB(0x0F) EMITB(0x68)                       \
+        MRM(REG(XD), MOD(XD), REG(XD))                                      \
+        shrgx_ri(W(XD), IB(8))
+
+#define cvugc_rr(XD, XS)                                                    \
+        movix_rr(W(XD), W(XS))                                              \
+    ESC REX(RXB(XD), RXB(XD)) EMITB(0x0F) EMITB(0x68)                       \
+        MRM(REG(XD), MOD(XD), REG(XD))                                      \
+        shrgn_ri(W(XD), IB(8))
+
+#define cvxgx_rr(XD, XS)                                                    \
+        movix_rr(W(XD), W(XS))                                              \
+    ESC REX(RXB(XD), RXB(XD)) EMITB(0x0F) EMITB(0x67)                       \
+        MRM(REG(XD), MOD(XD), REG(XD))                                      \
+    xF3 REX(RXB(XD), RXB(XD)) EMITB(0x0F) EMITB(0x7E)                       \
+        MRM(REG(XD), MOD(XD), REG(XD))
+
+#define cvxgn_rr(XD, XS)                                                    \
+        movix_rr(W(XD), W(XS))                                              \
+    ESC REX(RXB(XD), RXB(XD)) EMITB(0x0F) EMITB(0x63)                       \
+        MRM(REG(XD), MOD(XD), REG(XD))                                      \
+    xF3 REX(RXB(XD), RXB(XD)) EMITB(0x0F) EMITB(0x7E)                       \
+        MRM(REG(XD), MOD(XD), REG(XD))
+
 /* shl (G = G << S), (D = S << T) if (#D != #T) - plain, unsigned
  * for maximum compatibility: shift count must be modulo elem-size */
 
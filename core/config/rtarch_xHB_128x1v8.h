@@ -559,6 +559,24 @@
         stack_ld(Recx)                                                      \
         movgx_ld(W(XD), Mebp, inf_SCR01(0))
 
+/* bsw (D = S with the order of bytes reversed in each element) */
+
+#define bswgx_rr(XD, XS)                                                    \
+        bswgx3rx(W(XD), W(XS), TmmX(W(XD), W(XS)))
+
+#define bswgx_ld(XD, MS, DS)                                                \
+        movgx_ld(W(XD), W(MS), W(DS))                                       \
+        bswgx3rx(W(XD), W(XD), TmmX(W(XD), W(XD)))
+
+/* swap bytes in each 16-bit element of S into D, temporary XT is preserved */
+
+#define bswgx3rx(XD, XS, XT) /* not portable, do not use outside */         \
+        movgx_st(W(XT), Mebp, inf_SCR02(0))                                 \
+        shrgx3ri(W(XT), W(XS), IB(8))                                       \
+        shlgx3ri(W(XD), W(XS), IB(8))                                       \
+        orrgx_rr(W(XD), W(XT))                                              \
+        movgx_ld(W(XT), Mebp, inf_SCR02(0))
+
 /*****************   packed half-precision integer compare   ******************/
 
 /* min (G = G < S ? G : S), (D = S < T ? S : T) if (#D != #T), unsigned */
@@ -832,6 +850,24 @@
         orrgx_rr(Xmm0, W(XS))                                               \
         movgx_st(Xmm0, W(MG), W(DG))
 
+/* tbl (G = G[S]), (D = S[T]) if (#D != #T) look up bytes within 128-bit lanes
+ * indices 0-15 pick bytes in the same lane, 0x80-0xFF produce zero bytes */
+
+#define tblgb_rr(XG, XS)                                                    \
+        tblgb3rr(W(XG), W(XG), W(XS))
+
+#define tblgb_ld(XG, MS, DS)                                                \
+        tblgb3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define tblgb3rr(XD, XS, XT)                                                \
+        VEX(RXB(XD), RXB(XT), REN(XS), 0, 1, 2) EMITB(0x00)                 \
+        MRM(REG(XD), MOD(XT), REG(XT))
+
+#define tblgb3ld(XD, XS, MT, DT)                                            \
+    ADR VEX(RXB(XD), RXB(MT), REN(XS), 0, 1, 2) EMITB(0x00)                 \
+        MRM(REG(XD), MOD(MT), REG(MT))                                      \
+        AUX(SIB(MT), CMD(DT), EMPTY)
+
 /* move/logic instructions are sizeless and provided in 16-bit subset above */
 
 /*************   packed byte-precision integer arithmetic/shifts   ************/
@@ -1241,6 +1241,35 @@ ADR ESC REX(1,       RXB(MS)) EMITB(0x0F) EMITB(0x65)                       \
         orrax_rr(Xmm0, W(XS))                                               \
         movax_st(Xmm0, W(MG), W(DG))
 
+#if (RT_SIMD_COMPAT_SSE >= 4)
+
+/* tbl (G = G[S]), (D = S[T]) if (#D != #T) look up bytes within 128-bit lanes
+ * indices 0-15 pick bytes in the same lane, 0x80-0xFF produce zero bytes */
+
+#define tblab_rr(XG, XS)                                                    \
+    ESC REX(0,             0) EMITB(0x0F) EMITB(0x38) EMITB(0x00)           \
+        MRM(REG(XG), MOD(XS), REG(XS))                                      \
+    ESC REX(1,             1) EMITB(0x0F) EMITB(0x38) EMITB(0x00)           \
+        MRM(REG(XG), MOD(XS), REG(XS))
+
+#define tblab_ld(XG, MS, DS)                                                \
+ADR ESC REX(0,       RXB(MS)) EMITB(0x0F) EMITB(0x38) EMITB(0x00)           \
+        MRM(REG(XG),    0x02, REG(MS))                                      \
+        AUX(SIB(MS), EMITW(VAL(DS)), EMPTY)                                 \
+ADR ESC REX(1,       RXB(MS)) EMITB(0x0F) EMITB(0x38) EMITB(0x00)           \
+        MRM(REG(XG),    0x02, REG(MS))                                      \
+        AUX(SIB(MS), EMITW(VYL(DS)), EMPTY)
+
+#define tblab3rr(XD, XS, XT)                                                \
+        movax_rr(W(XD), W(XS))                                              \
+        tblab_rr(W(XD), W(XT))
+
+#define tblab3ld(XD, XS, MT, DT)                                            \
+        movax_rr(W(XD), W(XS))                                              \
+        tblab_ld(W(XD), W(MT), W(DT))
+
+#endif /* RT_SIMD_COMPAT_SSE >= 4 */
+
 /* move/logic instructions are sizeless and provided in 16-bit subset above */
 
 /*************   packed byte-precision integer arithmetic/shifts   ************/
@@ -752,6 +752,91 @@
         MRM(REG(XD), MOD(MT), REG(MT))                                      \
         AUX(SIB(MT), CMD(DT), EMPTY)
 
+/* muh (G = G * S), keeps upper half of the full-width product of elements
+ * unsigned-[x] or signed-[n], lower half is returned by mul */
+
+#define muhax_rr(XG, XS)                                                    \
+        VEX(RXB(XG), RXB(XS), REN(XG), 1, 1, 1) EMITB(0xE4)                 \
+        MRM(REG(XG), MOD(XS), REG(XS))
+
+#define muhax_ld(XG, MS, DS)                                                \
+    ADR VEX(RXB(XG), RXB(MS), REN(XG), 1, 1, 1) EMITB(0xE4)                 \
+        MRM(REG(XG), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#define muhan_rr(XG, XS)                                                    \
+        VEX(RXB(XG), RXB(XS), REN(XG), 1, 1, 1) EMITB(0xE5)                 \
+        MRM(REG(XG), MOD(XS), REG(XS))
+
+#define muhan_ld(XG, MS, DS)                                                \
+    ADR VEX(RXB(XG), RXB(MS), REN(XG), 1, 1, 1) EMITB(0xE5)                 \
+        MRM(REG(XG), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+/* dph (G = G + S * T) if (#G != #S && #G != #T), 16-bit pairs into 32-bit */
+
+#define dphcx_rr(XG, XS, XT)                                                \
+        movcx_st(W(XG), Mebp, inf_SCR02(0))                                 \
+        madax3rr(W(XG), W(XS), W(XT))                                       \
+        addcx_ld(W(XG), Mebp, inf_SCR02(0))
+
+#define dphcx_ld(XG, XS, MT, DT)                                            \
+        movcx_st(W(XG), Mebp, inf_SCR02(0))                                 \
+        madax3ld(W(XG), W(XS), W(MT), W(DT))                                \
+        addcx_ld(W(XG), Mebp, inf_SCR02(0))
+
+#define madax3rr(XD, XS, XT) /* not portable, do not use outside */         \
+        VEX(RXB(XD), RXB(XT), REN(XS), 1, 1, 1) EMITB(0xF5)                 \
+        MRM(REG(XD), MOD(XT), REG(XT))
+
+#define madax3ld(XD, XS, MT, DT) /* not portable, do not use outside */     \
+    ADR VEX(RXB(XD), RXB(MT), REN(XS), 1, 1, 1) EMITB(0xF5)                 \
+        MRM(REG(XD), MOD(MT), REG(MT))                                      \
+        AUX(SIB(MT), CMD(DT), EMPTY)
+
+/* cvy (D = S), zero-[x] or sign-[n] extends lower half of 16-bit elements
+ * cvu (D = S), zero-[x] or sign-[n] extends upper half of 16-bit elements
+ * cvx (D = S), narrows signed 32-bit elements to lower half of D, upper is 0
+ * with unsigned-[x] or signed-[n] saturation into 16-bit elements */
+
+#define cvyax_rr(XD, XS)                                                    \
+        VEX(RXB(XD), RXB(XS),    0x00, 1, 1, 2) EMITB(0x33)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))
+
+#define cvyan_rr(XD, XS)                                                    \
+        VEX(RXB(XD), RXB(XS),    0x00, 1, 1, 2) EMITB(0x23)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))
+
+#define cvuax_rr(XD, XS)                                                    \
+        cvuax_rx(W(XD), W(XS))                                              \
+        cvyax_rr(W(XD), W(XD))
+
+#define cvuan_rr(XD, XS)                                                    \
+        cvuax_rx(W(XD), W(XS))                                              \
+        cvyan_rr(W(XD), W(XD))
+
+#define cvuax_rx(XD, XS) /* not portable, do not use outside */             \
+        VEX(RXB(XS), RXB(XD),    0x00, 1, 1, 3) EMITB(0x39)                 \
+        MRM(REG(XS), MOD(XD), REG(XD))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0x01))
+
+#define cvxcx_rr(XD, XS)                                                    \
+        VEX(RXB(XD), RXB(XS), REN(XS), 1, 1, 2) EMITB(0x2B)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))                                      \
+        cvxcx_rx(W(XD))
+
+#define cvxcn_rr(XD, XS)                                                    \
+        VEX(RXB(XD), RXB(XS), REN(XS), 1, 1, 1) EMITB(0x6B)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))                                      \
+        cvxcx_rx(W(XD))
+
+#define cvxcx_rx(XD) /* not portable, do not use outside */                 \
+        VEW(RXB(XD), RXB(XD),    0x00, 1, 1, 3) EMITB(0x00)                 \
+        MRM(REG(XD), MOD(XD), REG(XD))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0x08))                                  \
+        VEX(RXB(XD), RXB(XD),    0x00, 0, 1, 1) EMITB(0x6F)                 \
+        MRM(REG(XD), MOD(XD), REG(XD))
+
 /* shl (G = G << S), (D = S << T) if (#D != #T) - plain, unsigned
  * for maximum compatibility: shift count must be modulo elem-size */
 
@@ -982,6 +1067,28 @@
         stack_ld(Recx)                                                      \
         movax_ld(W(XD), Mebp, inf_SCR01(0))
 
+#if (RT_256X1 >= 2)
+
+/* bsw (D = S with the order of bytes reversed in each element) */
+
+#define bswax_rr(XD, XS)                                                    \
+        bswax3rx(W(XD), W(XS), TmmX(W(XD), W(XS)))
+
+#define bswax_ld(XD, MS, DS)                                                \
+        movax_ld(W(XD), W(MS), W(DS))                                       \
+        bswax3rx(W(XD), W(XD), TmmX(W(XD), W(XD)))
+
+/* swap bytes in each 16-bit element of S into D, temporary XT is preserved */
+
+#define bswax3rx(XD, XS, XT) /* not portable, do not use outside */         \
+        movax_st(W(XT), Mebp, inf_SCR02(0))                                 \
+        shrax3ri(W(XT), W(XS), IB(8))                                       \
+        shlax3ri(W(XD), W(XS), IB(8))                                       \
+        orrax_rr(W(XD), W(XT))                                              \
+        movax_ld(W(XT), Mebp, inf_SCR02(0))
+
+#endif /* RT_256X1 >= 2, AVX2 */
+
 /*****************   packed half-precision integer compare   ******************/
 
 #if (RT_256X1 < 2)
@@ -1429,6 +1536,59 @@
         orrax_rr(Xmm0, W(XS))                                               \
         movax_st(Xmm0, W(MG), W(DG))
 
+#if (RT_256X1 < 2)
+
+/* tbl (G = G[S]), (D = S[T]) if (#D != #T) look up bytes within 128-bit lanes
+ * indices 0-15 pick bytes in the same lane, 0x80-0xFF produce zero bytes */
+
+#define tblab_rr(XG, XS)                                                    \
+        tblab3rr(W(XG), W(XG), W(XS))
+
+#define tblab_ld(XG, MS, DS)                                                \
+        tblab3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define tblab3rr(XD, XS, XT)                                                \
+        movax_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movax_st(W(XT), Mebp, inf_SCR02(0))                                 \
+        tblab_rx(W(XD))
+
+#define tblab3ld(XD, XS, MT, DT)                                            \
+        movax_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movax_ld(W(XD), W(MT), W(DT))                                       \
+        movax_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        tblab_rx(W(XD))
+
+#define tblab_rx(XD) /* not portable, do not use outside */                 \
+        movgx_ld(W(XD), Mebp, inf_SCR01(0x00))                              \
+        tblgb_ld(W(XD), Mebp, inf_SCR02(0x00))                              \
+        movgx_st(W(XD), Mebp, inf_SCR01(0x00))                              \
+        movgx_ld(W(XD), Mebp, inf_SCR01(0x10))                              \
+        tblgb_ld(W(XD), Mebp, inf_SCR02(0x10))                              \
+        movgx_st(W(XD), Mebp, inf_SCR01(0x10))                              \
+        movax_ld(W(XD), Mebp, inf_SCR01(0))
+
+#else /* RT_256X1 >= 2, AVX2 */
+
+/* tbl (G = G[S]), (D = S[T]) if (#D != #T) look up bytes within 128-bit lanes
+ * indices 0-15 pick bytes in the same lane, 0x80-0xFF produce zero bytes */
+
+#define tblab_rr(XG, XS)                                                    \
+        tblab3rr(W(XG), W(XG), W(XS))
+
+#define tblab_ld(XG, MS, DS)                                                \
+        tblab3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define tblab3rr(XD, XS, XT)                                                \
+        VEX(RXB(XD), RXB(XT), REN(XS), 1, 1, 2) EMITB(0x00)                 \
+        MRM(REG(XD), MOD(XT), REG(XT))
+
+#define tblab3ld(XD, XS, MT, DT)                                            \
+    ADR VEX(RXB(XD), RXB(MT), REN(XS), 1, 1, 2) EMITB(0x00)                 \
+        MRM(REG(XD), MOD(MT), REG(MT))                                      \
+        AUX(SIB(MT), CMD(DT), EMPTY)
+
+#endif /* RT_256X1 >= 2, AVX2 */
+
 /* move/logic instructions are sizeless and provided in 16-bit subset above */
 
 /*************   packed byte-precision integer arithmetic/shifts   ************/
@@ -1707,6 +1867,71 @@
         MRM(REG(XD), MOD(MT), REG(MT))                                      \
         AUX(SIB(MT), CMD(DT), EMPTY)
 
+/* dpb (G = G + S * T) if (#G != #S && #G != #T), 8-bit quads into 32-bit
+ * even/odd bytes are widened to 16-bit (S unsigned, T signed) for pmaddwd */
+
+#define dpbcx_rr(XG, XS, XT)                                                \
+        movcx_st(W(XG), Mebp, inf_SCR02(0))                                 \
+        shlax3ri(W(XG), W(XT), IB(8))                                       \
+        dpbcx_rx(W(XG), W(XS))                                              \
+        shran3ri(W(XG), W(XT), IB(8))                                       \
+        dpbcx_rh(W(XG), W(XS))
+
+#define dpbcx_ld(XG, XS, MT, DT)                                            \
+        movcx_st(W(XG), Mebp, inf_SCR02(0))                                 \
+        movcx_ld(W(XG), W(MT), W(DT))                                       \
+        shlax_ri(W(XG), IB(8))                                              \
+        dpbcx_rx(W(XG), W(XS))                                              \
+        movcx_ld(W(XG), W(MT), W(DT))                                       \
+        shran_ri(W(XG), IB(8))                                              \
+        dpbcx_rh(W(XG), W(XS))
+
+#define dpbcx_rx(XG, XS) /* not portable, do not use outside */             \
+        shran_ri(W(XG), IB(8))                                              \
+        movcx_st(W(XG), Mebp, inf_SCR01(0))                                 \
+        shlax3ri(W(XG), W(XS), IB(8))                                       \
+        shrax_ri(W(XG), IB(8))                                              \
+        madax3ld(W(XG), W(XG), Mebp, inf_SCR01(0))                          \
+        addcx_ld(W(XG), Mebp, inf_SCR02(0))                                 \
+        movcx_st(W(XG), Mebp, inf_SCR02(0))
+
+#define dpbcx_rh(XG, XS) /* not portable, do not use outside */             \
+        movcx_st(W(XG), Mebp, inf_SCR01(0))                                 \
+        shrax3ri(W(XG), W(XS), IB(8))                                       \
+        madax3ld(W(XG), W(XG), Mebp, inf_SCR01(0))                          \
+        addcx_ld(W(XG), Mebp, inf_SCR02(0))
+
+/* cvy (D = S), zero-[b] or sign-[c] extends lower half of 8-bit elements
+ * cvu (D = S), zero-[b] or sign-[c] extends upper half of 8-bit elements
+ * cvx (D = S), narrows signed 16-bit elements to lower half of D, upper is 0
+ * with unsigned-[x] or signed-[n] saturation into 8-bit elements */
+
+#define cvyab_rr(XD, XS)                                                    \
+        VEX(RXB(XD), RXB(XS),    0x00, 1, 1, 2) EMITB(0x30)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))
+
+#define cvyac_rr(XD, XS)                                                    \
+        VEX(RXB(XD), RXB(XS),    0x00, 1, 1, 2) EMITB(0x20)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))
+
+#define cvuab_rr(XD, XS)                                                    \
+        cvuax_rx(W(XD), W(XS))                                              \
+        cvyab_rr(W(XD), W(XD))
+
+#define cvuac_rr(XD, XS)                                                    \
+        cvuax_rx(W(XD), W(XS))                                              \
+        cvyac_rr(W(XD), W(XD))
+
+#define cvxax_rr(XD, XS)                                                    \
+        VEX(RXB(XD), RXB(XS), REN(XS), 1, 1, 1) EMITB(0x67)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))                                      \
+        cvxcx_rx(W(XD))
+
+#define cvxan_rr(XD, XS)                                                    \
+        VEX(RXB(XD), RXB(XS), REN(XS), 1, 1, 1) EMITB(0x63)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))                                      \
+        cvxcx_rx(W(XD))
+
 #endif /* RT_256X1 >= 2, AVX2 */
 
 /* mul (G = G * S), (D = S * T) if (#D != #T) */
@@ -394,6 +394,42 @@
         MRM(REG(XD), MOD(MT), REG(MT))                                      \
         AUX(SIB(MT), CMD(DT), EMPTY)
 
+/* dph (G = G + S * T) if (#G != #S && #G != #T), 16-bit pairs into 32-bit */
+
+#if (RT_SIMD_COMPAT_DOT == 0)
+
+#define dphcx_rr(XG, XS, XT)                                                \
+        movcx_st(W(XG), Mebp, inf_SCR02(0))                                 \
+        madax3rr(W(XG), W(XS), W(XT))                                       \
+        addcx_ld(W(XG), Mebp, inf_SCR02(0))
+
+#define dphcx_ld(XG, XS, MT, DT)                                            \
+        movcx_st(W(XG), Mebp, inf_SCR02(0))                                 \
+        madax3ld(W(XG), W(XS), W(MT), W(DT))                                \
+        addcx_ld(W(XG), Mebp, inf_SCR02(0))
+
+#else /* RT_SIMD_COMPAT_DOT != 0, AVX512-VNNI */
+
+#define dphcx_rr(XG, XS, XT)                                                \
+        EVX(RXB(XG), RXB(XT), REN(XS), 1, 1, 2) EMITB(0x52)                 \
+        MRM(REG(XG), MOD(XT), REG(XT))
+
+#define dphcx_ld(XG, XS, MT, DT)                                            \
+    ADR EVX(RXB(XG), RXB(MT), REN(XS), 1, 1, 2) EMITB(0x52)                 \
+        MRM(REG(XG), MOD(MT), REG(MT))                                      \
+        AUX(SIB(MT), CMD(DT), EMPTY)
+
+#endif /* RT_SIMD_COMPAT_DOT */
+
+#define madax3rr(XD, XS, XT) /* not portable, do not use outside */         \
+        EVX(RXB(XD), RXB(XT), REN(XS), 1, 1, 1) EMITB(0xF5)                 \
+        MRM(REG(XD), MOD(XT), REG(XT))
+
+#define madax3ld(XD, XS, MT, DT) /* not portable, do not use outside */     \
+    ADR EVX(RXB(XD), RXB(MT), REN(XS), 1, 1, 1) EMITB(0xF5)                 \
+        MRM(REG(XD), MOD(MT), REG(MT))                                      \
+        AUX(SIB(MT), CMD(DT), EMPTY)
+
 /* shl (G = G << S), (D = S << T) if (#D != #T) - plain, unsigned
  * for maximum compatibility: shift count must be modulo elem-size */
 
@@ -505,6 +541,24 @@
         MRM(REG(XD), MOD(MT), REG(MT))                                      \
         AUX(SIB(MT), CMD(DT), EMPTY)
 
+/* bsw (D = S with the order of bytes reversed in each element) */
+
+#define bswax_rr(XD, XS)                                                    \
+        bswax3rx(W(XD), W(XS), TmmX(W(XD), W(XS)))
+
+#define bswax_ld(XD, MS, DS)                                                \
+        movax_ld(W(XD), W(MS), W(DS))                                       \
+        bswax3rx(W(XD), W(XD), TmmX(W(XD), W(XD)))
+
+/* swap bytes in each 16-bit element of S into D, temporary XT is preserved */
+
+#define bswax3rx(XD, XS, XT) /* not portable, do not use outside */         \
+        movax_st(W(XT), Mebp, inf_SCR02(0))                                 \
+        shrax3ri(W(XT), W(XS), IB(8))                                       \
+        shlax3ri(W(XD), W(XS), IB(8))                                       \
+        orrax_rr(W(XD), W(XT))                                              \
+        movax_ld(W(XT), Mebp, inf_SCR02(0))
+
 /*****************   packed half-precision integer compare   ******************/
 
 /* min (G = G < S ? G : S), (D = S < T ? S : T) if (#D != #T), unsigned */
@@ -812,6 +866,24 @@
         MRM(REG(XS), MOD(MG), REG(MG))                                      \
         AUX(SIB(MG), CMD(DG), EMPTY)
 
+/* tbl (G = G[S]), (D = S[T]) if (#D != #T) look up bytes within 128-bit lanes
+ * indices 0-15 pick bytes in the same lane, 0x80-0xFF produce zero bytes */
+
+#define tblab_rr(XG, XS)                                                    \
+        tblab3rr(W(XG), W(XG), W(XS))
+
+#define tblab_ld(XG, MS, DS)                                                \
+        tblab3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define tblab3rr(XD, XS, XT)                                                \
+        EVX(RXB(XD), RXB(XT), REN(XS), 1, 1, 2) EMITB(0x00)                 \
+        MRM(REG(XD), MOD(XT), REG(XT))
+
+#define tblab3ld(XD, XS, MT, DT)                                            \
+    ADR EVX(RXB(XD), RXB(MT), REN(XS), 1, 1, 2) EMITB(0x00)                 \
+        MRM(REG(XD), MOD(MT), REG(MT))                                      \
+        AUX(SIB(MT), CMD(DT), EMPTY)
+
 /* move/logic instructions are sizeless and provided in 16-bit subset above */
 
 /*************   packed byte-precision integer arithmetic/shifts   ************/
@@ -918,6 +990,55 @@
         MRM(REG(XD), MOD(MT), REG(MT))                                      \
         AUX(SIB(MT), CMD(DT), EMPTY)
 
+/* dpb (G = G + S * T) if (#G != #S && #G != #T), 8-bit quads into 32-bit
+ * even/odd bytes are widened to 16-bit (S unsigned, T signed) for vpmaddwd */
+
+#if (RT_SIMD_COMPAT_DOT == 0)
+
+#define dpbcx_rr(XG, XS, XT)                                                \
+        movcx_st(W(XG), Mebp, inf_SCR02(0))                                 \
+        shlax3ri(W(XG), W(XT), IB(8))                                       \
+        dpbcx_rx(W(XG), W(XS))                                              \
+        shran3ri(W(XG), W(XT), IB(8))                                       \
+        dpbcx_rh(W(XG), W(XS))
+
+#define dpbcx_ld(XG, XS, MT, DT)                                            \
+        movcx_st(W(XG), Mebp, inf_SCR02(0))                                 \
+        movcx_ld(W(XG), W(MT), W(DT))                                       \
+        shlax_ri(W(XG), IB(8))                                              \
+        dpbcx_rx(W(XG), W(XS))                                              \
+        movcx_ld(W(XG), W(MT), W(DT))                                       \
+        shran_ri(W(XG), IB(8))                                              \
+        dpbcx_rh(W(XG), W(XS))
+
+#define dpbcx_rx(XG, XS) /* not portable, do not use outside */             \
+        shran_ri(W(XG), IB(8))                                              \
+        movcx_st(W(XG), Mebp, inf_SCR01(0))                                 \
+        shlax3ri(W(XG), W(XS), IB(8))                                       \
+        shrax_ri(W(XG), IB(8))                                              \
+        madax3ld(W(XG), W(XG), Mebp, inf_SCR01(0))                          \
+        addcx_ld(W(XG), Mebp, inf_SCR02(0))                                 \
+        movcx_st(W(XG), Mebp, inf_SCR02(0))
+
+#define dpbcx_rh(XG, XS) /* not portable, do not use outside */             \
+        movcx_st(W(XG), Mebp, inf_SCR01(0))                                 \
+        shrax3ri(W(XG), W(XS), IB(8))                                       \
+        madax3ld(W(XG), W(XG), Mebp, inf_SCR01(0))                          \
+        addcx_ld(W(XG), Mebp, inf_SCR02(0))
+
+#else /* RT_SIMD_COMPAT_DOT != 0, AVX512-VNNI */
+
+#define dpbcx_rr(XG, XS, XT)                                                \
+        EVX(RXB(XG), RXB(XT), REN(XS), 1, 1, 2) EMITB(0x50)                 \
+        MRM(REG(XG), MOD(XT), REG(XT))
+
+#define dpbcx_ld(XG, XS, MT, DT)                                            \
+    ADR EVX(RXB(XG), RXB(MT), REN(XS), 1, 1, 2) EMITB(0x50)                 \
+        MRM(REG(XG), MOD(MT), REG(MT))                                      \
+        AUX(SIB(MT), CMD(DT), EMPTY)
+
+#endif /* RT_SIMD_COMPAT_DOT */
+
 /* mul (G = G * S), (D = S * T) if (#D != #T) */
 
 #define mulab_rr(XG, XS)                                                    \
@@ -913,6 +913,32 @@
         MRM(REG(XD),    0x02, REG(MT))                                      \
         AUX(SIB(MT), EMITW(VXL(DT)), EMPTY)
 
+/* dph (G = G + S * T) if (#G != #S && #G != #T), 16-bit pairs into 32-bit */
+
+#define dphox_rr(XG, XS, XT)                                                \
+        movox_st(W(XG), Mebp, inf_SCR02(0))                                 \
+        madmx3rr(W(XG), W(XS), W(XT))                                       \
+        addox_ld(W(XG), Mebp, inf_SCR02(0))
+
+#define dphox_ld(XG, XS, MT, DT)                                            \
+        movox_st(W(XG), Mebp, inf_SCR02(0))                                 \
+        madmx3ld(W(XG), W(XS), W(MT), W(DT))                                \
+        addox_ld(W(XG), Mebp, inf_SCR02(0))
+
+#define madmx3rr(XD, XS, XT) /* not portable, do not use outside */         \
+        VEX(0,             0, REG(XS), 1, 1, 1) EMITB(0xF5)                 \
+        MRM(REG(XD), MOD(XT), REG(XT))                                      \
+        VEX(1,             1, REH(XS), 1, 1, 1) EMITB(0xF5)                 \
+        MRM(REG(XD), MOD(XT), REG(XT))
+
+#define madmx3ld(XD, XS, MT, DT) /* not portable, do not use outside */     \
+    ADR VEX(0,       RXB(MT), REG(XS), 1, 1, 1) EMITB(0xF5)                 \
+        MRM(REG(XD),    0x02, REG(MT))                                      \
+        AUX(SIB(MT), EMITW(VAL(DT)), EMPTY)                                 \
+    ADR VEX(1,       RXB(MT), REH(XS), 1, 1, 1) EMITB(0xF5)                 \
+        MRM(REG(XD),    0x02, REG(MT))                                      \
+        AUX(SIB(MT), EMITW(VXL(DT)), EMPTY)
+
 /* shl (G = G << S), (D = S << T) if (#D != #T) - plain, unsigned
  * for maximum compatibility: shift count must be modulo elem-size */
 
@@ -2124,6 +2150,40 @@
         MRM(REG(XD),    0x02, REG(MT))                                      \
         AUX(SIB(MT), EMITW(VXL(DT)), EMPTY)
 
+/* dpb (G = G + S * T) if (#G != #S && #G != #T), 8-bit quads into 32-bit
+ * even/odd bytes are widened to 16-bit (S unsigned, T signed) for vpmaddwd */
+
+#define dpbox_rr(XG, XS, XT)                                                \
+        movox_st(W(XG), Mebp, inf_SCR02(0))                                 \
+        shlmx3ri(W(XG), W(XT), IB(8))                                       \
+        dpbox_rl(W(XG), W(XS))                                              \
+        shrmn3ri(W(XG), W(XT), IB(8))                                       \
+        dpbox_rh(W(XG), W(XS))
+
+#define dpbox_ld(XG, XS, MT, DT)                                            \
+        movox_st(W(XG), Mebp, inf_SCR02(0))                                 \
+        movox_ld(W(XG), W(MT), W(DT))                                       \
+        shlmx_ri(W(XG), IB(8))                                              \
+        dpbox_rl(W(XG), W(XS))                                              \
+        movox_ld(W(XG), W(MT), W(DT))                                       \
+        shrmn_ri(W(XG), IB(8))                                              \
+        dpbox_rh(W(XG), W(XS))
+
+#define dpbox_rl(XG, XS) /* not portable, do not use outside */             \
+        shrmn_ri(W(XG), IB(8))                                              \
+        movox_st(W(XG), Mebp, inf_SCR01(0))                                 \
+        shlmx3ri(W(XG), W(XS), IB(8))                                       \
+        shrmx_ri(W(XG), IB(8))                                              \
+        madmx3ld(W(XG), W(XG), Mebp, inf_SCR01(0))                          \
+        addox_ld(W(XG), Mebp, inf_SCR02(0))                                 \
+        movox_st(W(XG), Mebp, inf_SCR02(0))
+
+#define dpbox_rh(XG, XS) /* not portable, do not use outside */             \
+        movox_st(W(XG), Mebp, inf_SCR01(0))                                 \
+        shrmx3ri(W(XG), W(XS), IB(8))                                       \
+        madmx3ld(W(XG), W(XG), Mebp, inf_SCR01(0))                          \
+        addox_ld(W(XG), Mebp, inf_SCR02(0))
+
 #endif /* RT_256X2 >= 2, AVX2 */
 
 /* mul (G = G * S), (D = S * T) if (#D != #T) */
@@ -523,6 +523,32 @@
         movax_st(W(XD), Mebp, inf_SCR01(0x20))                              \
         movmx_ld(W(XD), Mebp, inf_SCR01(0))
 
+/* dph (G = G + S * T) if (#G != #S && #G != #T), 16-bit pairs into 32-bit
+ * 256-bit vpmaddwd on each half, T is kept in SCR01, G is summed in SCR02 */
+
+#define dphox_rr(XG, XS, XT)                                                \
+        movox_st(W(XG), Mebp, inf_SCR02(0))                                 \
+        movox_st(W(XT), Mebp, inf_SCR01(0))                                 \
+        madax3rr(W(XG), W(XS), W(XT))                                       \
+        dphox_rh(W(XG), W(XS))
+
+#define dphox_ld(XG, XS, MT, DT)                                            \
+        movox_st(W(XG), Mebp, inf_SCR02(0))                                 \
+        movox_ld(W(XG), W(MT), W(DT))                                       \
+        movox_st(W(XG), Mebp, inf_SCR01(0))                                 \
+        madax3rr(W(XG), W(XS), W(XG))                                       \
+        dphox_rh(W(XG), W(XS))
+
+#define dphox_rh(XG, XS) /* not portable, do not use outside */             \
+        addcx_ld(W(XG), Mebp, inf_SCR02(0x00))                              \
+        movax_st(W(XG), Mebp, inf_SCR02(0x00))                              \
+        movax_ld(W(XG), Mebp, inf_SCR01(0x20))                              \
+        movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        madax3ld(W(XG), W(XG), Mebp, inf_SCR01(0x20))                       \
+        addcx_ld(W(XG), Mebp, inf_SCR02(0x20))                              \
+        movax_st(W(XG), Mebp, inf_SCR02(0x20))                              \
+        movox_ld(W(XG), Mebp, inf_SCR02(0))
+
 /* shl (G = G << S), (D = S << T) if (#D != #T) - plain, unsigned
  * for maximum compatibility: shift count must be modulo elem-size */
 
@@ -992,6 +1018,42 @@
         MRM(REG(XD), MOD(MT), REG(MT))                                      \
         AUX(SIB(MT), CMD(DT), EMPTY)
 
+/* dph (G = G + S * T) if (#G != #S && #G != #T), 16-bit pairs into 32-bit */
+
+#if (RT_SIMD_COMPAT_DOT == 0)
+
+#define dphox_rr(XG, XS, XT)                                                \
+        movox_st(W(XG), Mebp, inf_SCR02(0))                                 \
+        madmx3rr(W(XG), W(XS), W(XT))                                       \
+        addox_ld(W(XG), Mebp, inf_SCR02(0))
+
+#define dphox_ld(XG, XS, MT, DT)                                            \
+        movox_st(W(XG), Mebp, inf_SCR02(0))                                 \
+        madmx3ld(W(XG), W(XS), W(MT), W(DT))                                \
+        addox_ld(W(XG), Mebp, inf_SCR02(0))
+
+#else /* RT_SIMD_COMPAT_DOT != 0, AVX512-VNNI */
+
+#define dphox_rr(XG, XS, XT)                                                \
+        EVX(RXB(XG), RXB(XT), REN(XS), K, 1, 2) EMITB(0x52)                 \
+        MRM(REG(XG), MOD(XT), REG(XT))
+
+#define dphox_ld(XG, XS, MT, DT)                                            \
+    ADR EVX(RXB(XG), RXB(MT), REN(XS), K, 1, 2) EMITB(0x52)                 \
+        MRM(REG(XG), MOD(MT), REG(MT))                                      \
+        AUX(SIB(MT), CMD(DT), EMPTY)
+
+#endif /* RT_SIMD_COMPAT_DOT */
+
+#define madmx3rr(XD, XS, XT) /* not portable, do not use outside */         \
+        EVX(RXB(XD), RXB(XT), REN(XS), K, 1, 1) EMITB(0xF5)                 \
+        MRM(REG(XD), MOD(XT), REG(XT))
+
+#define madmx3ld(XD, XS, MT, DT) /* not portable, do not use outside */     \
+    ADR EVX(RXB(XD), RXB(MT), REN(XS), K, 1, 1) EMITB(0xF5)                 \
+        MRM(REG(XD), MOD(MT), REG(MT))                                      \
+        AUX(SIB(MT), CMD(DT), EMPTY)
+
 /* shl (G = G << S), (D = S << T) if (#D != #T) - plain, unsigned
  * for maximum compatibility: shift count must be modulo elem-size */
 
@@ -1105,6 +1167,28 @@
 
 #endif /* RT_512X1 == 2, 8 */
 
+#if (RT_512X1 == 2 || RT_512X1 == 8)
+
+/* bsw (D = S with the order of bytes reversed in each element) */
+
+#define bswmx_rr(XD, XS)                                                    \
+        bswmx3rx(W(XD), W(XS), TmmX(W(XD), W(XS)))
+
+#define bswmx_ld(XD, MS, DS)                                                \
+        movmx_ld(W(XD), W(MS), W(DS))                                       \
+        bswmx3rx(W(XD), W(XD), TmmX(W(XD), W(XD)))
+
+/* swap bytes in each 16-bit element of S into D, temporary XT is preserved */
+
+#define bswmx3rx(XD, XS, XT) /* not portable, do not use outside */         \
+        movmx_st(W(XT), Mebp, inf_SCR02(0))                                 \
+        shrmx3ri(W(XT), W(XS), IB(8))                                       \
+        shlmx3ri(W(XD), W(XS), IB(8))                                       \
+        orrmx_rr(W(XD), W(XT))                                              \
+        movmx_ld(W(XT), Mebp, inf_SCR02(0))
+
+#endif /* RT_512X1 == 2, 8 */
+
 /*****************   packed half-precision integer compare   ******************/
 
 #if (RT_512X1 == 1 || RT_512X1 == 4)
@@ -2040,6 +2124,55 @@
         MRM(REG(XD), MOD(MT), REG(MT))                                      \
         AUX(SIB(MT), CMD(DT), EMPTY)
 
+/* dpb (G = G + S * T) if (#G != #S && #G != #T), 8-bit quads into 32-bit
+ * even/odd bytes are widened to 16-bit (S unsigned, T signed) for vpmaddwd */
+
+#if (RT_SIMD_COMPAT_DOT == 0)
+
+#define dpbox_rr(XG, XS, XT)                                                \
+        movox_st(W(XG), Mebp, inf_SCR02(0))                                 \
+        shlmx3ri(W(XG), W(XT), IB(8))                                       \
+        dpbox_rl(W(XG), W(XS))                                              \
+        shrmn3ri(W(XG), W(XT), IB(8))                                       \
+        dpbox_rh(W(XG), W(XS))
+
+#define dpbox_ld(XG, XS, MT, DT)                                            \
+        movox_st(W(XG), Mebp, inf_SCR02(0))                                 \
+        movox_ld(W(XG), W(MT), W(DT))                                       \
+        shlmx_ri(W(XG), IB(8))                                              \
+        dpbox_rl(W(XG), W(XS))                                              \
+        movox_ld(W(XG), W(MT), W(DT))                                       \
+        shrmn_ri(W(XG), IB(8))                                              \
+        dpbox_rh(W(XG), W(XS))
+
+#define dpbox_rl(XG, XS) /* not portable, do not use outside */             \
+        shrmn_ri(W(XG), IB(8))                                              \
+        movox_st(W(XG), Mebp, inf_SCR01(0))                                 \
+        shlmx3ri(W(XG), W(XS), IB(8))                                       \
+        shrmx_ri(W(XG), IB(8))                                              \
+        madmx3ld(W(XG), W(XG), Mebp, inf_SCR01(0))                          \
+        addox_ld(W(XG), Mebp, inf_SCR02(0))                                 \
+        movox_st(W(XG), Mebp, inf_SCR02(0))
+
+#define dpbox_rh(XG, XS) /* not portable, do not use outside */             \
+        movox_st(W(XG), Mebp, inf_SCR01(0))                                 \
+        shrmx3ri(W(XG), W(XS), IB(8))                                       \
+        madmx3ld(W(XG), W(XG), Mebp, inf_SCR01(0))                          \
+        addox_ld(W(XG), Mebp, inf_SCR02(0))
+
+#else /* RT_SIMD_COMPAT_DOT != 0, AVX512-VNNI */
+
+#define dpbox_rr(XG, XS, XT)                                                \
+        EVX(RXB(XG), RXB(XT), REN(XS), K, 1, 2) EMITB(0x50)                 \
+        MRM(REG(XG), MOD(XT), REG(XT))
+
+#define dpbox_ld(XG, XS, MT, DT)                                            \
+    ADR EVX(RXB(XG), RXB(MT), REN(XS), K, 1, 2) EMITB(0x50)                 \
+        MRM(REG(XG), MOD(MT), REG(MT))                                      \
+        AUX(SIB(MT), CMD(DT), EMPTY)
+
+#endif /* RT_SIMD_COMPAT_DOT */
+
 #endif /* RT_512X1 == 2, 8 */
 
 /* mul (G = G * S), (D = S * T) if (#D != #T) */
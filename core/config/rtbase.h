@@ -848,6 +848,7 @@ struct rt_SIMD_INFO
 
     rt_ui32 fctrl[R-3];     /* reserved, do not use! */
 #define inf_FCTRL(nx)       DP(0x00C + nx)
+#define inf_DCZID           DP(0x00C) /* AArch64 DCZID_EL0 <- verxx_xx */
 
     /* general purpose constants (32-bit) */
 
@@ -952,10 +953,68 @@ struct rt_SIMD_REGS
     RT_SIMD_SET64((__Info__)->gpc04_64, LL(0x7FFFFFFFFFFFFFFF));            \
     RT_SIMD_SET64((__Info__)->gpc05_64, LL(0x3FF0000000000000));            \
     RT_SIMD_SET64((__Info__)->gpc06_64, LL(0x8000000000000000));            \
+    __Info__->fctrl[0] = 0; /* DCZID_EL0 is set by verxx_xx on AArch64 */   \
     __Info__->regs = (rt_ui64)(rt_uptr)(__Regs__);
 
 #define ASM_DONE(__Info__)
 
+/*
+ * Command queue for persistent ASM sections (executors), which run a dispatch
+ * loop over a list of command records within a single ASM_ENTER/ASM_LEAVE pair
+ * instead of entering/leaving a separate section for each chained kernel.
+ * Each record selects a kernel body pre-assembled within the same section
+ * (registered in the per-call label table with cmdqx_lb) by its id and passes
+ * a size along with up to 3 argument pointers, see cmdq* instructions below.
+ * The queue is read-only in backend, so a prebuilt queue can run in many
+ * threads and code instances at once, while the label table along with
+ * the end of the list are kept in a per-call rt_SIMD_CMDT (in info-struct).
+ */
+#define RT_CMDQ_KERN        16      /* max number of kernels per executor */
+
+struct rt_SIMD_CMD
+{
+    rt_si32 kern;           /* kernel id, index in queue's label table */
+#define cmd_KERN            DP(0x000)
+
+    rt_si32 size;           /* kernel-specific size (number of elements) */
+#define cmd_SIZE            DP(0x004)
+
+    rt_pntr arg0;           /* kernel-specific argument pointer 0 */
+#define cmd_ARG0            DP(0x008+0x000*P+E)
+
+    rt_pntr arg1;           /* kernel-specific argument pointer 1 */
+#define cmd_ARG1            DP(0x008+0x004*P+E)
+
+    rt_pntr arg2;           /* kernel-specific argument pointer 2 */
+#define cmd_ARG2            DP(0x008+0x008*P+E)
+
+};
+
+#define RT_CMD_SIZE         (0x008+0x00C*P) /* sizeof(rt_SIMD_CMD) in ASM */
+
+struct rt_SIMD_CMDQ
+{
+    rt_SIMD_CMD *list;      /* array of command records */
+#define cmq_LIST            DP(0x000+E)
+
+    rt_si32 size;           /* number of command records in the list */
+#define cmq_SIZE            DP(0x004*P)
+
+};
+
+struct rt_SIMD_CMDT
+{
+    rt_pntr kern[RT_CMDQ_KERN]; /* kernel label table, filled by cmdqx_lb */
+#define cmt_KERN(nx)        DP(0x000+(nx)*0x004*P)
+
+    rt_SIMD_CMDQ *cmdq;     /* command queue, set by cmdqx_ld */
+#define cmt_CMDQ            DP(0x040*P+E)
+
+    rt_pntr lend;           /* end of the command list, set by cmdqx_go */
+#define cmt_LEND            DP(0x044*P+E)
+
+};
+
 /*
  * Return SIMD target mask (in rt_SIMD_INFO->ver format) from "simd" parameters:
  * SIMD native-size (1,..,16) in 0th (lowest) byte  <- number of 128-bit chunks
@@ -5581,6 +5640,44 @@ rt_si32 from_mask(rt_si32 mask)
 #define jmpxx_mm(MS, DS)                                                    \
         jmpxx_xm(W(MS), W(DS))
 
+/* cmdq (command-queue executor, see rt_SIMD_CMDQ above)
+ * set-flags: undefined
+ * Rebx holds the per-call table (cmdqx_ld), Recx holds the current record,
+ * both are reserved within kernel bodies, which read their arguments with
+ * Mecx and cmd_ARG0/1/2, cmd_SIZE, and end with cmdqx_nx to run the next one.
+ * Kernel labels (lb) are registered with cmdqx_lb before cmdqx_go, which
+ * defines dispatch label (lb) and exits to label (le) when the list is done,
+ * which is detected by comparing Recx with the end of the list (no counter),
+ * a record with kernel id out of [0, RT_CMDQ_KERN) also exits to label (le) */
+
+#define cmdqx_ld(MS, DS, MT, DT) /* destroys Reax, MS: queue, MT: table */  \
+        movxx_ld(Reax, W(MS), W(DS))                                        \
+        adrxx_ld(Rebx, W(MT), W(DT))                                        \
+        movxx_st(Reax, Mebx, cmt_CMDQ)
+
+#define cmdqx_lb(id, lb) /* destroys Reax */                                \
+        label_st(lb##f, Mebx, cmt_KERN(id))
+
+#define cmdqx_go(lb, le) /* destroys Reax */                                \
+        movxx_ld(Recx, Mebx, cmt_CMDQ)                                      \
+        movwx_ld(Reax, Mecx, cmq_SIZE)                                      \
+        mulxx_ri(Reax, IB(RT_CMD_SIZE))                                     \
+        addxx_ld(Reax, Mecx, cmq_LIST)                                      \
+        movxx_st(Reax, Mebx, cmt_LEND)                                      \
+        movxx_ld(Recx, Mecx, cmq_LIST)                                      \
+    LBL(lb)                                                                 \
+        cmjxx_rm(Recx, Mebx, cmt_LEND,                                      \
+        /* if */ EQ_x, le##f)                                               \
+        movwx_ld(Reax, Mecx, cmd_KERN)                                      \
+        cmjwx_ri(Reax, IB(RT_CMDQ_KERN),                                    \
+        /* if */ GE_x, le##f)                                               \
+        shlwx_ri(Reax, IB(1+P))                                             \
+        jmpxx_mm(Iebx, cmt_KERN(0))
+
+#define cmdqx_nx(lb)                                                        \
+        addxx_ri(Recx, IB(RT_CMD_SIZE))                                     \
+        jmpxx_lb(lb##b)
+
 /******************************************************************************/
 /*********************************   CONFIG   *********************************/
 /******************************************************************************/
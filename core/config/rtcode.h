@@ -0,0 +1,1333 @@
+/******************************************************************************/
+/* Copyright (c) 2013-2023 VectorChief (at github, bitbucket, sourceforge)    */
+/* Distributed under the MIT software license, see the accompanying           */
+/* file COPYING or http://www.opensource.org/licenses/mit-license.php         */
+/******************************************************************************/
+
+#ifndef RT_RTCODE_H
+#define RT_RTCODE_H
+
+#include <stdio.h>
+#include <string.h>
+
+#if   (defined RT_WIN64) /* Win64, GCC -------------------------------------- */
+
+#include <windows.h>
+#include <io.h>
+
+#elif (defined RT_LINUX) /* Linux, GCC -------------------------------------- */
+
+#include <sys/mman.h>
+#include <dlfcn.h>
+
+#ifndef MAP_ANONYMOUS
+#define MAP_ANONYMOUS MAP_ANON  /* workaround for macOS compilation */
+#endif /* MAP_ANONYMOUS */
+
+#endif /* ------------- OS specific ----------------------------------------- */
+
+/******************************************************************************/
+/*********************************   LEGEND   *********************************/
+/******************************************************************************/
+
+/*
+ * rtcode.h: Runtime code generation for ASM sections (RT_RUNTIME builds).
+ *
+ * When RT_RUNTIME is enabled in makefiles (x32/x64 targets only) ASM sections
+ * are no longer assembled statically with inline assembler. Instead, EMITB,
+ * EMITW and EMITH append machine code into an anonymous memory buffer at the
+ * current (cur++) offset, while ASM_ENTER/ASM_LEAVE open the buffer and then
+ * turn it into a callable function (by changing page rights to read+exec).
+ * As instruction fields are now computed by C/C++ compiler, the M definition
+ * is switched to (-) for the true-condition mask to remain (-1) in rtarch.h.
+ *
+ * Code buffer is private to a given ASM section invocation and is released
+ * upon return from the generated function. Buffer is initially allocated at
+ * RT_CODE_SIZE bytes and grows by doubling if the section doesn't fit into it.
+ * Writable and executable rights are never granted to the buffer at once.
+ *
+ * Labels (LBL) and label-targeted jumps (j**xx_lb) are tracked in per-section
+ * tables with the same rules as assembler's local labels: numeric references
+ * with "b"/"f" suffix resolve to the closest label backward/forward from the
+ * jump, other names resolve to the only label with that name in the section.
+ * Backward jumps are encoded in short form (8-bit displacement) when in range,
+ * forward jumps and address loads (label_ld) always use 32-bit displacements
+ * and are back-patched in a fixup pass once the section is complete.
+ *
+ * With RT_CODE_CACHE enabled (default) finished sections are kept in a cache
+ * keyed by the section's call site (kernel id), the SIMD target mask from
+ * rt_SIMD_INFO->ver and the specialization key given to ASM_ENTER_K (if any),
+ * so that code is generated only on the first invocation for each of them.
+ * Cached code is copied into its own page-rounded mapping, which is switched
+ * to read+exec before it is published and is never made writable again.
+ * Lookups take no locks: an entry is pinned with an atomic reference count
+ * for the duration of the call, while insertions and evictions (rare path)
+ * are serialized with a spinlock. When mapped code exceeds RT_CODE_LIMIT,
+ * least recently used entries not pinned by calls in flight are unpublished
+ * and released, entries unpublished while pinned are released once the last
+ * call has returned (reclaimed on next insertion) and don't count towards
+ * the budget meanwhile. Known limitation: pinning is an atomic RMW on the
+ * entry's shared counter, so calling the same short kernel from many threads
+ * at a high rate bounces its cache line between cores, callers of that kind
+ * should batch work per call (per-thread/epoch pinning is not implemented).
+ *
+ * Cached code can be persisted with code_store(path) and mapped back by a new
+ * process with code_load(path), which then skips generation for matching
+ * kernels. The file consists of a header, a table of blobs and a page-aligned
+ * code region mapped directly from the file with read+exec rights. Each blob
+ * records a kernel id (hashed source location of the ASM section), the SIMD
+ * target mask (ver), the specialization key, RT_ADDRESS/RT_ELEMENT, the build
+ * id and a checksum of its code bytes, only blobs matching all of them are
+ * used. The build id hashes the header version (RT_CODE_STAMP) and build
+ * configuration together with RT_CODE_BUILD string, which defaults to the
+ * compile time and compiler version of the translation unit, so recompiling
+ * it invalidates the file. Build systems with reproducible timestamps should
+ * define RT_CODE_BUILD to identify sources, compiler and flags instead. With
+ * RT_CODE_FILE enabled contents of the executable/library containing the
+ * translation unit are hashed as well (slow for large binaries, as it reads
+ * the whole file at first use). If the build id cannot be obtained the
+ * file is neither loaded nor written, if any usable blob's checksum doesn't
+ * match its code bytes the whole file is rejected. Both functions act on the
+ * cache of the translation unit they are called from, the file is replaced
+ * atomically.
+ */
+
+/******************************************************************************/
+/*******************************   DEFINITIONS   ******************************/
+/******************************************************************************/
+
+#ifndef RT_CODE_SIZE
+#define RT_CODE_SIZE        0x10000 /* initial code buffer size in bytes */
+#endif /* RT_CODE_SIZE */
+
+#define RT_CODE_PAGE        0x1000  /* buffer allocation granularity */
+
+#define RT_CODE_TABS        64      /* initial label/fixup tables' size */
+
+#ifndef RT_CODE_CACHE
+#define RT_CODE_CACHE       1       /* 0 - regenerate sections on each call */
+#endif /* RT_CODE_CACHE */
+
+#ifndef RT_CODE_SLOTS
+#define RT_CODE_SLOTS       1024    /* number of cache entries (power of 2) */
+#endif /* RT_CODE_SLOTS */
+
+#ifndef RT_CODE_LIMIT
+#define RT_CODE_LIMIT       0x1000000 /* cache memory budget in bytes */
+#endif /* RT_CODE_LIMIT */
+
+#define RT_CODE_PROBE       8       /* entries probed from hashed position */
+
+#ifndef RT_CODE_STAMP
+#define RT_CODE_STAMP       "UniSIMD v1.1.0d, rtcode r1" /* header revision */
+#endif /* RT_CODE_STAMP, bump when instruction encodings or blobs change */
+
+#ifndef RT_CODE_BUILD
+#define RT_CODE_BUILD       __DATE__ " " __TIME__ " " __VERSION__
+#endif /* RT_CODE_BUILD, define to identify sources, compiler and flags */
+
+#ifndef RT_CODE_FILE
+#define RT_CODE_FILE        0       /* 1 - also hash module file in build id */
+#endif /* RT_CODE_FILE */
+
+#define RT_CODE_MAGIC       ULL(0x333045444F435452) /* "RTCODE03" */
+
+/*
+ * Default specialization key for ASM sections without bound constants,
+ * shadowed by a local variable of the same name within ASM_ENTER_K.
+ */
+static const
+rt_ui64 __Spec__ = 0;
+
+/*
+ * Code label entry, name is a stringized LBL argument,
+ * position is an offset of the label in code buffer.
+ */
+struct rt_CODE_LABEL
+{
+    rt_pstr  name;          /* label name (not 0-terminated for refs) */
+    rt_si32  nlen;          /* label name length */
+    rt_size  pos;           /* label offset in code buffer */
+};
+
+/*
+ * Code fixup entry for unresolved label references,
+ * position is an offset of 32-bit displacement field,
+ * which is relative to the end of that field.
+ */
+struct rt_CODE_FIXUP
+{
+    rt_pstr  name;          /* referenced label name */
+    rt_si32  nlen;          /* referenced label name length */
+    rt_si32  dir;           /* -1 backward, +1 forward, 0 any */
+    rt_si32  idx;           /* labels defined before the reference */
+    rt_size  pos;           /* displacement offset in code buffer */
+};
+
+/*
+ * Code buffer structure for runtime generation of ASM sections.
+ * All positions are kept as offsets from buffer's start,
+ * as buffer's base address may change when it grows.
+ */
+struct rt_CODE
+{
+    rt_byte *buf;           /* code buffer (page-aligned) */
+    rt_size  pos;           /* current emission offset */
+    rt_size  len;           /* allocated buffer size */
+
+    rt_CODE_LABEL *lbl;     /* label table */
+    rt_si32  lbl_num;       /* number of labels defined */
+    rt_si32  lbl_max;       /* label table capacity */
+
+    rt_CODE_FIXUP *fix;     /* fixup table */
+    rt_si32  fix_num;       /* number of pending fixups */
+    rt_si32  fix_max;       /* fixup table capacity */
+};
+
+/*
+ * Call site descriptor of ASM section, its address serves as kernel id
+ * within the process, source location is hashed into persisted kernel id.
+ */
+struct rt_CODE_SITE
+{
+    rt_pstr  file;          /* source file of ASM section */
+    rt_si32  line;          /* source line of ASM section */
+    rt_si32  uniq;          /* unique counter for sections on the same line */
+};
+
+/*
+ * Code cache entry, holds a finished ASM section in read+exec mapping.
+ * Fields are accessed atomically, as lookups are performed without locks,
+ * entry is only reused when it is neither published nor pinned by a call.
+ */
+struct rt_CODE_ENTRY
+{
+    rt_CODE_SITE *site;     /* kernel id (address of call site's tag) */
+    rt_ui32  ver;           /* SIMD target mask (rt_SIMD_INFO->ver) */
+    rt_ui32  used;          /* cache epoch of the last lookup */
+    rt_ui64  key;           /* specialization key of bound constants */
+    rt_si32  live;          /* 1 - published, -1 - uncached, 0 - free */
+    rt_si32  refs;          /* number of calls in flight */
+    rt_byte *buf;           /* code mapping, RT_NULL if released */
+    rt_size  len;           /* code mapping size, 0 if mapped from file */
+    rt_size  cnt;           /* code size in bytes */
+};
+
+/*
+ * Code cache file header, followed by the table of blobs.
+ */
+struct rt_CODE_HEAD
+{
+    rt_ui64  magic;         /* RT_CODE_MAGIC, also format version */
+    rt_ui32  num;           /* number of blobs in the table */
+    rt_ui32  off;           /* offset of code region (page-aligned) */
+    rt_ui64  len;           /* total file size */
+};
+
+/*
+ * Code cache file blob, describes one cached ASM section.
+ */
+struct rt_CODE_BLOB
+{
+    rt_ui64  kid;           /* kernel id (hashed source location) */
+    rt_ui64  key;           /* specialization key of bound constants */
+    rt_ui64  bid;           /* build id (header version, config, module) */
+    rt_ui64  sum;           /* checksum of code bytes */
+    rt_ui32  ver;           /* SIMD target mask (rt_SIMD_INFO->ver) */
+    rt_ui32  cnt;           /* code size in bytes */
+    rt_ui16  address;       /* RT_ADDRESS of the build */
+    rt_ui16  element;       /* RT_ELEMENT of the build */
+    rt_ui32  pad;           /* reserved, written as zero */
+    rt_ui64  off;           /* code offset from the start of file */
+};
+
+/*
+ * Code cache structure, one instance per translation unit.
+ */
+struct rt_CODE_CACHE
+{
+    rt_CODE_ENTRY slot[RT_CODE_SLOTS];
+    rt_size  size;          /* total size of code mappings */
+    rt_ui32  epoch;         /* advanced on each insertion */
+    rt_si32  lock;          /* spinlock for insertions/evictions */
+
+    rt_CODE_HEAD *head;     /* mapped file (header and table), read-only */
+    rt_byte *text;          /* mapped file (code region), read+exec */
+    rt_ui64  bid;           /* build id, computed on first load/store */
+};
+
+/*
+ * Function type of generated ASM section,
+ * takes the pointer to rt_SIMD_INFO(X) structure.
+ */
+typedef rt_void (*rt_FUNC_CODE)(rt_pntr info);
+
+/*
+ * Allocate code buffer with read+write rights.
+ */
+static
+rt_byte *code_map(rt_size len)
+{
+#if   (defined RT_WIN64) /* Win64, GCC -------------------------------------- */
+
+    rt_pntr ptr = VirtualAlloc(NULL, len, MEM_COMMIT | MEM_RESERVE,
+                  PAGE_READWRITE);
+
+#elif (defined RT_LINUX) /* Linux, GCC -------------------------------------- */
+
+    rt_pntr ptr = mmap(NULL, len, PROT_READ | PROT_WRITE,
+                  MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+    if (ptr == MAP_FAILED)
+    {
+        ptr = RT_NULL;
+    }
+
+#endif /* ------------- OS specific ----------------------------------------- */
+
+    if (ptr == RT_NULL)
+    {
+        abort(); /* code generation cannot proceed without a buffer */
+    }
+
+    return (rt_byte *)ptr;
+}
+
+/*
+ * Release code buffer.
+ */
+static
+rt_void code_unmap(rt_byte *buf, rt_size len)
+{
+#if   (defined RT_WIN64) /* Win64, GCC -------------------------------------- */
+
+    VirtualFree(buf, 0, MEM_RELEASE);
+
+#elif (defined RT_LINUX) /* Linux, GCC -------------------------------------- */
+
+    munmap(buf, len);
+
+#endif /* ------------- OS specific ----------------------------------------- */
+}
+
+/*
+ * Change code buffer rights to read+exec (exec != 0) or read+write.
+ */
+static
+rt_void code_prot(rt_byte *buf, rt_size len, rt_si32 exec)
+{
+#if   (defined RT_WIN64) /* Win64, GCC -------------------------------------- */
+
+    DWORD old;
+    VirtualProtect(buf, len, exec ? PAGE_EXECUTE_READ : PAGE_READWRITE, &old);
+    if (exec)
+    {
+        FlushInstructionCache(GetCurrentProcess(), buf, len);
+    }
+
+#elif (defined RT_LINUX) /* Linux, GCC -------------------------------------- */
+
+    mprotect(buf, len, exec ? PROT_READ | PROT_EXEC : PROT_READ | PROT_WRITE);
+
+#endif /* ------------- OS specific ----------------------------------------- */
+}
+
+/*
+ * Open code buffer for emission at ASM_ENTER.
+ */
+static
+rt_void code_init(rt_CODE *code)
+{
+    code->len = (RT_CODE_SIZE + RT_CODE_PAGE - 1) & ~(RT_CODE_PAGE - 1);
+    code->buf = code_map(code->len);
+    code->pos = 0;
+
+    code->lbl = RT_NULL;
+    code->lbl_num = code->lbl_max = 0;
+
+    code->fix = RT_NULL;
+    code->fix_num = code->fix_max = 0;
+}
+
+/*
+ * Double the size of code buffer, keep already emitted code.
+ */
+static
+rt_void code_grow(rt_CODE *code)
+{
+    rt_byte *buf = code_map(code->len * 2);
+    memcpy(buf, code->buf, code->pos);
+    code_unmap(code->buf, code->len);
+    code->buf = buf;
+    code->len = code->len * 2;
+}
+
+/*
+ * Emit 1 byte at current offset (EMITB).
+ */
+static inline
+rt_void code_emitb(rt_CODE *code, rt_ui32 b)
+{
+    if (code->pos + 1 > code->len)
+    {
+        code_grow(code);
+    }
+    code->buf[code->pos++] = (rt_byte)b;
+}
+
+/*
+ * Emit 4 bytes at current offset in little-endian order (EMITW).
+ */
+static inline
+rt_void code_emitw(rt_CODE *code, rt_ui32 w)
+{
+    if (code->pos + 4 > code->len)
+    {
+        code_grow(code);
+    }
+    code->buf[code->pos++] = (rt_byte)(w >> 0x00);
+    code->buf[code->pos++] = (rt_byte)(w >> 0x08);
+    code->buf[code->pos++] = (rt_byte)(w >> 0x10);
+    code->buf[code->pos++] = (rt_byte)(w >> 0x18);
+}
+
+/*
+ * Patch 32-bit displacement at given offset (relative to the end of field).
+ */
+static
+rt_void code_patch(rt_CODE *code, rt_size pos, rt_size dst)
+{
+    rt_ui32 w = (rt_ui32)(dst - (pos + 4));
+    code->buf[pos + 0] = (rt_byte)(w >> 0x00);
+    code->buf[pos + 1] = (rt_byte)(w >> 0x08);
+    code->buf[pos + 2] = (rt_byte)(w >> 0x10);
+    code->buf[pos + 3] = (rt_byte)(w >> 0x18);
+}
+
+/*
+ * Split label reference into name and direction (local numeric labels).
+ */
+static
+rt_si32 code_name(rt_pstr name, rt_si32 *nlen)
+{
+    rt_si32 n = (rt_si32)strlen(name), i;
+
+    *nlen = n;
+
+    if (n < 2 || (name[n-1] != 'b' && name[n-1] != 'f'))
+    {
+        return 0;
+    }
+    for (i = 0; i < n-1; i++)
+    {
+        if (name[i] < '0' || name[i] > '9')
+        {
+            return 0;
+        }
+    }
+
+    *nlen = n-1;
+    return name[n-1] == 'b' ? -1 : +1;
+}
+
+/*
+ * Find label index from reference, -1 if not (yet) defined.
+ */
+static
+rt_si32 code_find(rt_CODE *code, rt_pstr name, rt_si32 nlen,
+                  rt_si32 dir, rt_si32 idx)
+{
+    rt_si32 i;
+
+    if (dir > 0)
+    {
+        for (i = idx; i < code->lbl_num; i++)
+        {
+            if (code->lbl[i].nlen == nlen
+            &&  memcmp(code->lbl[i].name, name, nlen) == 0)
+            {
+                return i;
+            }
+        }
+        return -1;
+    }
+
+    for (i = (dir < 0 ? idx : code->lbl_num) - 1; i >= 0; i--)
+    {
+        if (code->lbl[i].nlen == nlen
+        &&  memcmp(code->lbl[i].name, name, nlen) == 0)
+        {
+            return i;
+        }
+    }
+    return -1;
+}
+
+/*
+ * Define label at current offset (LBL).
+ */
+static
+rt_void code_label(rt_CODE *code, rt_pstr name)
+{
+    if (code->lbl_num == code->lbl_max)
+    {
+        code->lbl_max = code->lbl_max == 0 ? RT_CODE_TABS : code->lbl_max * 2;
+        code->lbl = (rt_CODE_LABEL *)realloc(code->lbl,
+                                    code->lbl_max * sizeof(rt_CODE_LABEL));
+        if (code->lbl == RT_NULL)
+        {
+            abort(); /* code generation cannot proceed without a table */
+        }
+    }
+
+    code->lbl[code->lbl_num].name = name;
+    code->lbl[code->lbl_num].nlen = (rt_si32)strlen(name);
+    code->lbl[code->lbl_num].pos = code->pos;
+    code->lbl_num++;
+}
+
+/*
+ * Emit 32-bit displacement to label (relative to the end of field),
+ * unresolved references are recorded for the fixup pass.
+ */
+static
+rt_void code_refer(rt_CODE *code, rt_pstr name)
+{
+    rt_si32 nlen, dir = code_name(name, &nlen);
+    rt_si32 i = dir > 0 ? -1 : code_find(code, name, nlen, dir, code->lbl_num);
+
+    if (i < 0)
+    {
+        if (code->fix_num == code->fix_max)
+        {
+            code->fix_max = code->fix_max == 0 ? RT_CODE_TABS :
+                                                 code->fix_max * 2;
+            code->fix = (rt_CODE_FIXUP *)realloc(code->fix,
+                                        code->fix_max * sizeof(rt_CODE_FIXUP));
+            if (code->fix == RT_NULL)
+            {
+                abort(); /* code generation cannot proceed without a table */
+            }
+        }
+
+        code->fix[code->fix_num].name = name;
+        code->fix[code->fix_num].nlen = nlen;
+        code->fix[code->fix_num].dir = dir;
+        code->fix[code->fix_num].idx = code->lbl_num;
+        code->fix[code->fix_num].pos = code->pos;
+        code->fix_num++;
+
+        code_emitw(code, 0);
+    }
+    else
+    {
+        code_emitw(code, (rt_ui32)(code->lbl[i].pos - (code->pos + 4)));
+    }
+}
+
+/*
+ * Emit label-targeted jump (x86), op is a short form opcode:
+ * 0xEB for unconditional jump, 0x70-0x7F for conditional jumps.
+ * Known (backward) targets within 8-bit range use short form,
+ * otherwise near form with 32-bit displacement is emitted.
+ */
+static
+rt_void code_jump(rt_CODE *code, rt_ui32 op, rt_pstr name)
+{
+    rt_si32 nlen, dir = code_name(name, &nlen);
+    rt_si32 i = dir > 0 ? -1 : code_find(code, name, nlen, dir, code->lbl_num);
+    rt_si64 d = i < 0 ? 0 : (rt_si64)code->lbl[i].pos - (rt_si64)(code->pos + 2);
+
+    if (i >= 0 && d >= -128 && d <= 127)
+    {
+        code_emitb(code, op);
+        code_emitb(code, (rt_ui32)d);
+        return;
+    }
+
+    if (op == 0xEB)
+    {
+        code_emitb(code, 0xE9);
+    }
+    else
+    {
+        code_emitb(code, 0x0F);
+        code_emitb(code, op + 0x10);
+    }
+    code_refer(code, name);
+}
+
+/*
+ * Resolve pending fixups once the section is complete.
+ */
+static
+rt_void code_link(rt_CODE *code)
+{
+    rt_si32 i, k;
+
+    for (k = 0; k < code->fix_num; k++)
+    {
+        i = code_find(code, code->fix[k].name, code->fix[k].nlen,
+                            code->fix[k].dir,  code->fix[k].idx);
+        if (i < 0)
+        {
+            abort(); /* undefined label referenced in ASM section */
+        }
+        code_patch(code, code->fix[k].pos, code->lbl[i].pos);
+    }
+    code->fix_num = 0;
+}
+
+/*
+ * Turn code buffer into callable function at ASM_LEAVE,
+ * resolve pending fixups first.
+ */
+static
+rt_FUNC_CODE code_seal(rt_CODE *code)
+{
+    code_link(code);
+
+    code_prot(code->buf, code->len, 1);
+    return (rt_FUNC_CODE)(rt_uptr)code->buf;
+}
+
+/*
+ * Release code buffer after the generated function has returned.
+ */
+static
+rt_void code_done(rt_CODE *code)
+{
+    code_unmap(code->buf, code->len);
+    code->buf = RT_NULL;
+    code->pos = code->len = 0;
+
+    free(code->lbl);
+    code->lbl = RT_NULL;
+    code->lbl_num = code->lbl_max = 0;
+
+    free(code->fix);
+    code->fix = RT_NULL;
+    code->fix_num = code->fix_max = 0;
+}
+
+#if RT_CODE_CACHE != 0
+
+static
+rt_CODE_CACHE code_cache;
+
+/*
+ * Return starting cache slot for given kernel id and SIMD target mask.
+ */
+static inline
+rt_si32 code_hash(rt_CODE_SITE *site, rt_ui32 ver, rt_ui64 key)
+{
+    rt_ui64 h = ((rt_ui64)(rt_uptr)site ^ ((rt_ui64)ver << 32) ^ key)
+              * ULL(0x9E3779B97F4A7C15);
+    return (rt_si32)(h >> 40) & (RT_CODE_SLOTS - 1);
+}
+
+static
+rt_CODE_ENTRY *code_read(rt_CODE_SITE *site, rt_ui32 ver, rt_ui64 key);
+
+/*
+ * Find published entry for given kernel id and SIMD target mask,
+ * return it pinned for the call (lock-free) or RT_NULL if not cached.
+ */
+static inline
+rt_CODE_ENTRY *code_look(rt_CODE_SITE *site, rt_ui32 ver, rt_ui64 key)
+{
+    rt_si32 i, k = code_hash(site, ver, key);
+    rt_ui32 epoch = __atomic_load_n(&code_cache.epoch, __ATOMIC_RELAXED);
+
+    for (i = 0; i < RT_CODE_PROBE; i++)
+    {
+        rt_CODE_ENTRY *e = &code_cache.slot[(k + i) & (RT_CODE_SLOTS - 1)];
+
+        if (__atomic_load_n(&e->site, __ATOMIC_RELAXED) != site)
+        {
+            continue;
+        }
+
+        /* pin first, then check if still published (pairs with evict) */
+        __atomic_add_fetch(&e->refs, 1, __ATOMIC_SEQ_CST);
+        if (__atomic_load_n(&e->live, __ATOMIC_SEQ_CST) == 1
+        &&  __atomic_load_n(&e->site, __ATOMIC_RELAXED) == site
+        &&  __atomic_load_n(&e->ver,  __ATOMIC_RELAXED) == ver
+        &&  __atomic_load_n(&e->key,  __ATOMIC_RELAXED) == key)
+        {
+            if (__atomic_load_n(&e->used, __ATOMIC_RELAXED) != epoch)
+            {
+                __atomic_store_n(&e->used, epoch, __ATOMIC_RELAXED);
+            }
+            return e;
+        }
+        __atomic_sub_fetch(&e->refs, 1, __ATOMIC_RELEASE);
+    }
+
+    /* slow path, check mapped code cache file (if any) */
+    if (__atomic_load_n(&code_cache.head, __ATOMIC_ACQUIRE) != RT_NULL)
+    {
+        return code_read(site, ver, key);
+    }
+
+    return RT_NULL;
+}
+
+/*
+ * Unpin entry after the call has returned,
+ * uncached entries are released right away.
+ */
+static inline
+rt_void code_drop(rt_CODE_ENTRY *e)
+{
+    if (e->live == -1)
+    {
+        if (e->len != 0)
+        {
+            code_unmap(e->buf, e->len);
+        }
+        free(e);
+        return;
+    }
+    __atomic_sub_fetch(&e->refs, 1, __ATOMIC_RELEASE);
+}
+
+/*
+ * Unpublish cache entry and release its memory if not pinned (locked).
+ */
+static
+rt_void code_evict(rt_CODE_ENTRY *e)
+{
+    /* unpublish first, then check pins (pairs with look) */
+    __atomic_store_n(&e->live, 0, __ATOMIC_SEQ_CST);
+    if (e->buf != RT_NULL && __atomic_load_n(&e->refs, __ATOMIC_SEQ_CST) == 0)
+    {
+        if (e->len != 0)
+        {
+            code_unmap(e->buf, e->len);
+            code_cache.size -= e->len;
+        }
+        e->buf = RT_NULL;
+    }
+}
+
+/*
+ * Release memory of unpublished entries no longer pinned (locked).
+ */
+static
+rt_void code_reclaim()
+{
+    rt_si32 i;
+
+    for (i = 0; i < RT_CODE_SLOTS; i++)
+    {
+        rt_CODE_ENTRY *e = &code_cache.slot[i];
+
+        if (e->buf != RT_NULL && e->live == 0)
+        {
+            code_evict(e);
+        }
+    }
+}
+
+/*
+ * Publish read+exec code in the cache, return pinned entry
+ * (existing one if another thread was faster, then code is released).
+ * Code mapped from file (len == 0) is not counted towards the budget.
+ */
+static
+rt_CODE_ENTRY *code_push(rt_CODE_SITE *site, rt_ui32 ver, rt_ui64 key,
+                         rt_byte *buf, rt_size len, rt_size cnt)
+{
+    rt_si32 i, k = code_hash(site, ver, key);
+    rt_CODE_ENTRY *e, *f = RT_NULL;
+    rt_size pend = 0;
+
+    while (__atomic_test_and_set(&code_cache.lock, __ATOMIC_ACQUIRE))
+    {
+        /* spin, only taken on cache misses */
+    }
+
+    code_reclaim();
+
+    for (i = 0; i < RT_CODE_PROBE; i++)
+    {
+        e = &code_cache.slot[(k + i) & (RT_CODE_SLOTS - 1)];
+
+        if (e->live == 1 && e->site == site && e->ver == ver && e->key == key)
+        {
+            __atomic_add_fetch(&e->refs, 1, __ATOMIC_SEQ_CST);
+            __atomic_clear(&code_cache.lock, __ATOMIC_RELEASE);
+            if (len != 0)
+            {
+                code_unmap(buf, len);
+            }
+            return e;
+        }
+        if (e->live == 0 && e->buf == RT_NULL
+        &&  __atomic_load_n(&e->refs, __ATOMIC_SEQ_CST) == 0)
+        {
+            f = f != RT_NULL ? f : e;
+        }
+    }
+
+    /* evict least recently used entries from probed range if it's full */
+    for (i = 0; f == RT_NULL && i < RT_CODE_PROBE; i++)
+    {
+        rt_si32 j, m = -1;
+
+        for (j = 0; j < RT_CODE_PROBE; j++)
+        {
+            e = &code_cache.slot[(k + j) & (RT_CODE_SLOTS - 1)];
+
+            if (e->live == 1 && (m < 0 || (rt_si32)(e->used -
+                code_cache.slot[(k + m) & (RT_CODE_SLOTS - 1)].used) < 0))
+            {
+                m = j;
+            }
+        }
+        if (m < 0)
+        {
+            break;
+        }
+
+        e = &code_cache.slot[(k + m) & (RT_CODE_SLOTS - 1)];
+        code_evict(e);
+        if (e->buf == RT_NULL)
+        {
+            f = e;
+        }
+    }
+
+    if (f == RT_NULL)
+    {
+        /* all probed entries are pinned, call without caching */
+        __atomic_clear(&code_cache.lock, __ATOMIC_RELEASE);
+        f = (rt_CODE_ENTRY *)malloc(sizeof(rt_CODE_ENTRY));
+        if (f == RT_NULL)
+        {
+            abort(); /* code generation cannot proceed without an entry */
+        }
+        f->site = site;
+        f->ver = ver;
+        f->key = key;
+        f->live = -1;
+        f->refs = 1;
+        f->buf = buf;
+        f->len = len;
+        f->cnt = cnt;
+        return f;
+    }
+
+    code_cache.epoch++;
+    code_cache.size += len;
+
+    __atomic_add_fetch(&f->refs, 1, __ATOMIC_SEQ_CST);
+    __atomic_store_n(&f->site, site, __ATOMIC_RELAXED);
+    __atomic_store_n(&f->ver,  ver,  __ATOMIC_RELAXED);
+    __atomic_store_n(&f->key,  key,  __ATOMIC_RELAXED);
+    __atomic_store_n(&f->used, code_cache.epoch, __ATOMIC_RELAXED);
+    f->buf = buf;
+    f->len = len;
+    f->cnt = cnt;
+    __atomic_store_n(&f->live, 1, __ATOMIC_SEQ_CST);
+
+    /* keep mapped code within the budget, evict least recently used,
+     * pinned entries cannot be released now and are not counted/evicted */
+    for (i = 0; i < RT_CODE_SLOTS; i++)
+    {
+        e = &code_cache.slot[i];
+
+        if (e->live == 0 && e->buf != RT_NULL)
+        {
+            pend += e->len;
+        }
+    }
+    while (code_cache.size - pend > RT_CODE_LIMIT)
+    {
+        rt_CODE_ENTRY *m = RT_NULL;
+
+        for (i = 0; i < RT_CODE_SLOTS; i++)
+        {
+            e = &code_cache.slot[i];
+
+            if (e != f && e->live == 1 && e->len != 0
+            &&  __atomic_load_n(&e->refs, __ATOMIC_SEQ_CST) == 0
+            && (m == RT_NULL || (rt_si32)(e->used - m->used) < 0))
+            {
+                m = e;
+            }
+        }
+        if (m == RT_NULL)
+        {
+            break; /* only pinned entries remain */
+        }
+        code_evict(m);
+        if (m->buf != RT_NULL)
+        {
+            pend += m->len; /* pinned by a lookup in the meantime */
+        }
+    }
+
+    __atomic_clear(&code_cache.lock, __ATOMIC_RELEASE);
+    return f;
+}
+
+/*
+ * Store finished section into code cache at ASM_LEAVE, return pinned entry.
+ * Code buffer is released, as its contents are copied into a separate
+ * read+exec mapping (position-independent, labels are IP-relative).
+ */
+static
+rt_CODE_ENTRY *code_save(rt_CODE *code, rt_CODE_SITE *site, rt_ui32 ver,
+                                                              rt_ui64 key)
+{
+    rt_size cnt = code->pos;
+    rt_size len = (cnt + RT_CODE_PAGE - 1) & ~(RT_CODE_PAGE - 1);
+    rt_byte *buf;
+
+    code_link(code);
+    buf = code_map(len);
+    memcpy(buf, code->buf, cnt);
+    code_prot(buf, len, 1);
+    code_done(code);
+
+    return code_push(site, ver, key, buf, len, cnt);
+}
+
+/*
+ * Return persisted kernel id from source location of ASM section (FNV-1a).
+ */
+static
+rt_ui64 code_kid(rt_CODE_SITE *site)
+{
+    rt_ui64 h = ULL(0xCBF29CE484222325);
+    rt_pstr p;
+
+    for (p = site->file; *p != 0; p++)
+    {
+        h = (h ^ (rt_byte)*p) * ULL(0x100000001B3);
+    }
+    h = (h ^ (rt_ui32)site->line) * ULL(0x100000001B3);
+    h = (h ^ (rt_ui32)site->uniq) * ULL(0x100000001B3);
+
+    return h;
+}
+
+/*
+ * Return checksum of code bytes (FNV-1a).
+ */
+static
+rt_ui64 code_sum(rt_byte *buf, rt_size cnt)
+{
+    rt_ui64 h = ULL(0xCBF29CE484222325);
+    rt_size i;
+
+    for (i = 0; i < cnt; i++)
+    {
+        h = (h ^ buf[i]) * ULL(0x100000001B3);
+    }
+
+    return h;
+}
+
+/*
+ * Return build id from header version, build configuration, RT_CODE_BUILD
+ * string and (if RT_CODE_FILE) contents of the executable/library containing
+ * this translation unit (FNV-1a), blobs from other builds are never used,
+ * return 0 if module file cannot be read (persistence is disabled then).
+ */
+static
+rt_ui64 code_bid()
+{
+    rt_ui64 h = ULL(0xCBF29CE484222325);
+    rt_ui32 c[8], i;
+    rt_pstr p;
+
+    if (code_cache.bid != 0)
+    {
+        return code_cache.bid;
+    }
+
+    for (p = RT_CODE_STAMP; *p != 0; p++)
+    {
+        h = (h ^ (rt_byte)*p) * ULL(0x100000001B3);
+    }
+
+    c[0] = RT_POINTER;
+    c[1] = RT_ADDRESS;
+    c[2] = RT_ELEMENT;
+    c[3] = RT_ENDIAN;
+    c[4] = RT_REGS;
+#if (defined RT_SIMD)
+    c[5] = RT_SIMD;
+#else /* RT_SIMD */
+    c[5] = 0;
+#endif /* RT_SIMD */
+#if (defined Q)
+    c[6] = Q;
+#else /* Q */
+    c[6] = 0;
+#endif /* Q */
+    c[7] = sizeof(rt_CODE_BLOB);
+
+    for (i = 0; i < 8; i++)
+    {
+        h = (h ^ c[i]) * ULL(0x100000001B3);
+    }
+
+    for (p = RT_CODE_BUILD; *p != 0; p++)
+    {
+        h = (h ^ (rt_byte)*p) * ULL(0x100000001B3);
+    }
+
+#if (RT_CODE_FILE != 0)
+
+    rt_byte data[0x1000];
+    rt_char name[1024];
+    rt_size k;
+    FILE *f;
+
+    name[0] = 0;
+
+#if   (defined RT_WIN64) /* Win64, GCC -------------------------------------- */
+
+    HMODULE m;
+    if (GetModuleHandleExA(GET_MODULE_HANDLE_EX_FLAG_FROM_ADDRESS
+                         | GET_MODULE_HANDLE_EX_FLAG_UNCHANGED_REFCOUNT,
+                           (LPCSTR)&code_cache, &m)
+    &&  GetModuleFileNameA(m, name, sizeof(name)) >= sizeof(name))
+    {
+        name[0] = 0;
+    }
+
+#elif (defined RT_LINUX) /* Linux, GCC -------------------------------------- */
+
+    Dl_info info;
+    if (dladdr((rt_pntr)&code_cache, &info) != 0 && info.dli_fname != RT_NULL
+    &&  strlen(info.dli_fname) < sizeof(name))
+    {
+        strcpy(name, info.dli_fname);
+    }
+
+#endif /* ------------- OS specific ----------------------------------------- */
+
+    if (name[0] == 0 || (f = fopen(name, "rb")) == RT_NULL)
+    {
+        return 0;
+    }
+
+    while ((k = fread(data, 1, sizeof(data), f)) != 0)
+    {
+        for (i = 0; i < k; i++)
+        {
+            h = (h ^ data[i]) * ULL(0x100000001B3);
+        }
+    }
+
+    if (ferror(f) | fclose(f))
+    {
+        return 0;
+    }
+
+#endif /* RT_CODE_FILE */
+
+    h += h == 0;
+    code_cache.bid = h;
+
+    return h;
+}
+
+/*
+ * Find kernel in mapped code cache file and publish it (cache miss path).
+ */
+static
+rt_CODE_ENTRY *code_read(rt_CODE_SITE *site, rt_ui32 ver, rt_ui64 key)
+{
+    rt_CODE_HEAD *head = code_cache.head;
+    rt_CODE_BLOB *blob = (rt_CODE_BLOB *)(head + 1);
+    rt_ui64 kid = code_kid(site);
+    rt_ui64 bid = code_bid();
+    rt_ui32 i;
+
+    for (i = 0; i < head->num; i++)
+    {
+        if (blob[i].kid == kid && blob[i].ver == ver && blob[i].key == key
+        &&  blob[i].bid == bid
+        &&  blob[i].address == RT_ADDRESS && blob[i].element == RT_ELEMENT)
+        {
+            return code_push(site, ver, key, code_cache.text
+                           + (blob[i].off - head->off), 0, blob[i].cnt);
+        }
+    }
+
+    return RT_NULL;
+}
+
+/*
+ * Map code cache file (once per translation unit), code region is mapped
+ * with read+exec rights, return number of blobs usable in this build.
+ */
+static
+rt_si32 code_load(rt_pstr path)
+{
+    rt_CODE_HEAD head, *map = RT_NULL;
+    rt_CODE_BLOB *blob;
+    rt_byte *text = RT_NULL;
+    rt_ui64 bid = code_bid();
+    rt_si32 n = 0;
+    rt_ui32 i;
+    FILE *f;
+
+    if (code_cache.head != RT_NULL || bid == 0
+    ||  (f = fopen(path, "rb")) == RT_NULL)
+    {
+        return 0;
+    }
+
+    if (fread(&head, sizeof(head), 1, f) != 1 || head.magic != RT_CODE_MAGIC
+    ||  fseek(f, 0, SEEK_END) != 0 || (rt_ui64)ftell(f) != head.len
+    ||  head.off < sizeof(head) + head.num * sizeof(rt_CODE_BLOB)
+    ||  head.off % RT_CODE_PAGE != 0 || head.off >= head.len)
+    {
+        fclose(f);
+        return 0;
+    }
+
+#if   (defined RT_WIN64) /* Win64, GCC -------------------------------------- */
+
+    HANDLE h = CreateFileMappingA((HANDLE)_get_osfhandle(_fileno(f)), NULL,
+                                  PAGE_EXECUTE_READ, 0, 0, NULL);
+    if (h != NULL)
+    {
+        map = (rt_CODE_HEAD *)MapViewOfFile(h,
+                                  FILE_MAP_READ | FILE_MAP_EXECUTE, 0, 0, 0);
+        CloseHandle(h);
+    }
+    text = map != RT_NULL ? (rt_byte *)map + head.off : RT_NULL;
+
+#elif (defined RT_LINUX) /* Linux, GCC -------------------------------------- */
+
+    map = (rt_CODE_HEAD *)mmap(NULL, head.off, PROT_READ,
+                               MAP_PRIVATE, fileno(f), 0);
+    text = (rt_byte *)mmap(NULL, head.len - head.off, PROT_READ | PROT_EXEC,
+                               MAP_PRIVATE, fileno(f), head.off);
+    if (map == MAP_FAILED || text == MAP_FAILED)
+    {
+        if (map != MAP_FAILED)
+        {
+            munmap(map, head.off);
+        }
+        if (text != MAP_FAILED)
+        {
+            munmap(text, head.len - head.off);
+        }
+        map = RT_NULL;
+    }
+
+#endif /* ------------- OS specific ----------------------------------------- */
+
+    fclose(f);
+
+    if (map == RT_NULL)
+    {
+        return 0;
+    }
+
+    blob = (rt_CODE_BLOB *)(map + 1);
+    for (i = 0; i < head.num; i++)
+    {
+        if (blob[i].off < head.off || blob[i].off + blob[i].cnt > head.len)
+        {
+            n = -1; /* corrupted table, file is not used */
+            break;
+        }
+        if (blob[i].bid == bid
+        &&  blob[i].address == RT_ADDRESS && blob[i].element == RT_ELEMENT)
+        {
+            if (blob[i].sum != code_sum(text + (blob[i].off - head.off),
+                                        blob[i].cnt))
+            {
+                n = -1; /* code doesn't match checksum, file is not used */
+                break;
+            }
+            n++;
+        }
+    }
+
+    if (n <= 0)
+    {
+#if   (defined RT_WIN64) /* Win64, GCC -------------------------------------- */
+        UnmapViewOfFile(map);
+#elif (defined RT_LINUX) /* Linux, GCC -------------------------------------- */
+        munmap(map, head.off);
+        munmap(text, head.len - head.off);
+#endif /* ------------- OS specific ----------------------------------------- */
+        return 0;
+    }
+
+    /* mapping is kept until process exit, as code may still be in use */
+    code_cache.text = text;
+    __atomic_store_n(&code_cache.head, map, __ATOMIC_RELEASE);
+
+    return n;
+}
+
+/*
+ * Write cached code into file (replaced atomically via rename),
+ * return number of blobs written or -1 if file cannot be written.
+ */
+static
+rt_si32 code_store(rt_pstr path)
+{
+    rt_CODE_HEAD head;
+    rt_CODE_BLOB blob;
+    rt_CODE_ENTRY **list;
+    rt_ui64 bid = code_bid();
+    rt_byte zero[64] = {0};
+    rt_char temp[1024];
+    rt_ui64 off;
+    rt_si32 i, n = 0;
+    FILE *f;
+
+    if (bid == 0 || strlen(path) + 5 > sizeof(temp))
+    {
+        return -1;
+    }
+    strcpy(temp, path);
+    strcat(temp, ".tmp");
+
+    list = (rt_CODE_ENTRY **)malloc(RT_CODE_SLOTS * sizeof(rt_CODE_ENTRY *));
+    if (list == RT_NULL)
+    {
+        return -1;
+    }
+
+    if ((f = fopen(temp, "wb")) == RT_NULL)
+    {
+        free(list);
+        return -1;
+    }
+
+    while (__atomic_test_and_set(&code_cache.lock, __ATOMIC_ACQUIRE))
+    {
+        /* spin, only taken on cache misses */
+    }
+
+    /* snapshot published entries and pin them, so that their code isn't
+     * released if evicted, then write the file without holding the lock */
+    for (i = 0; i < RT_CODE_SLOTS; i++)
+    {
+        rt_CODE_ENTRY *e = &code_cache.slot[i];
+
+        if (e->live == 1)
+        {
+            __atomic_add_fetch(&e->refs, 1, __ATOMIC_SEQ_CST);
+            list[n++] = e;
+        }
+    }
+
+    __atomic_clear(&code_cache.lock, __ATOMIC_RELEASE);
+
+    head.magic = RT_CODE_MAGIC;
+    head.num = n;
+    head.off = (sizeof(head) + n * sizeof(blob) + RT_CODE_PAGE - 1)
+             & ~(RT_CODE_PAGE - 1);
+    off = head.off;
+
+    /* blobs are 64-byte aligned within code region */
+    for (i = 0; i < n; i++)
+    {
+        off += (list[i]->cnt + 63) & ~63;
+    }
+    head.len = off;
+
+    fwrite(&head, sizeof(head), 1, f);
+
+    for (i = 0, off = head.off; i < n; i++)
+    {
+        rt_CODE_ENTRY *e = list[i];
+
+        blob.kid = code_kid(e->site);
+        blob.ver = e->ver;
+        blob.key = e->key;
+        blob.bid = bid;
+        blob.sum = code_sum(e->buf, e->cnt);
+        blob.address = RT_ADDRESS;
+        blob.element = RT_ELEMENT;
+        blob.cnt = (rt_ui32)e->cnt;
+        blob.pad = 0;
+        blob.off = off;
+        fwrite(&blob, sizeof(blob), 1, f);
+        off += (e->cnt + 63) & ~63;
+    }
+
+    for (off = sizeof(head) + n * sizeof(blob); off < head.off;)
+    {
+        rt_size k = head.off - off < 64 ? head.off - off : 64;
+        fwrite(zero, 1, k, f);
+        off += k;
+    }
+
+    for (i = 0; i < n; i++)
+    {
+        rt_CODE_ENTRY *e = list[i];
+
+        fwrite(e->buf, 1, e->cnt, f);
+        fwrite(zero, 1, ((e->cnt + 63) & ~63) - e->cnt, f);
+        code_drop(e);
+    }
+
+    free(list);
+
+    if (ferror(f) | fclose(f))
+    {
+        remove(temp);
+        return -1;
+    }
+
+#if   (defined RT_WIN64) /* Win64, GCC -------------------------------------- */
+    if (!MoveFileExA(temp, path, MOVEFILE_REPLACE_EXISTING))
+#elif (defined RT_LINUX) /* Linux, GCC -------------------------------------- */
+    if (rename(temp, path) != 0)
+#endif /* ------------- OS specific ----------------------------------------- */
+    {
+        remove(temp);
+        return -1;
+    }
+
+    return n;
+}
+
+/*
+ * Release all cached code not pinned by calls in flight,
+ * can be used to free memory when kernels are no longer needed.
+ */
+static
+rt_void code_flush()
+{
+    rt_si32 i;
+
+    while (__atomic_test_and_set(&code_cache.lock, __ATOMIC_ACQUIRE))
+    {
+        /* spin, only taken on cache misses */
+    }
+
+    for (i = 0; i < RT_CODE_SLOTS; i++)
+    {
+        if (code_cache.slot[i].live == 1)
+        {
+            code_evict(&code_cache.slot[i]);
+        }
+    }
+
+    __atomic_clear(&code_cache.lock, __ATOMIC_RELEASE);
+}
+
+#endif /* RT_CODE_CACHE */
+
+#endif /* RT_RTCODE_H */
+
+/******************************************************************************/
+/******************************************************************************/
+/******************************************************************************/
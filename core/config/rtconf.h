@@ -30,6 +30,9 @@
 /**** 128-bit **** (rcp/rsq/fma/fms) with fixed-64-bit element ****************/
 /**** scalar ***** (rcp/rsq/fma/fms) with fixed-64-bit element ****************/
 
+/**** var-len **** (bcs/gat/sct/mtl/shf/tbl/scn) with fixed-32-bit element ****/
+/**** var-len **** (bcs/gat/sct/mtl/shf/tbl/scn) with fixed-64-bit element ****/
+
 /**** var-len **** SIMD instructions with fixed-16-bit element **** 256-bit ***/
 /**** var-len **** SIMD instructions with fixed-16-bit element **** 128-bit ***/
 /**** var-len **** SIMD instructions with fixed-32-bit element **** 256-bit ***/
@@ -890,125 +893,3418 @@
         subjs_rr(W(XG), W(XS))                                              \
         movjx_ld(W(XS), Mebp, inf_SCR01(0))
 
-#define fmsjs_ld(XG, XS, MT, DT)                                            \
-        movjx_st(W(XS), Mebp, inf_SCR01(0))                                 \
-        muljs_ld(W(XS), W(MT), W(DT))                                       \
-        subjs_rr(W(XG), W(XS))                                              \
-        movjx_ld(W(XS), Mebp, inf_SCR01(0))
+#define fmsjs_ld(XG, XS, MT, DT)                                            \
+        movjx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        muljs_ld(W(XS), W(MT), W(DT))                                       \
+        subjs_rr(W(XG), W(XS))                                              \
+        movjx_ld(W(XS), Mebp, inf_SCR01(0))
+
+#endif /* RT_SIMD_COMPAT_FMS */
+
+#define fmsjs3rr(XG, XS, XT)                                                \
+        fmsjs_rr(W(XG), W(XS), W(XT))
+
+#define fmsjs3ld(XG, XS, MT, DT)                                            \
+        fmsjs_ld(W(XG), W(XS), W(MT), W(DT))
+
+/******************************************************************************/
+/**** scalar ***** (rcp/rsq/fma/fms) with fixed-64-bit element ****************/
+/******************************************************************************/
+
+/* rcp (D = 1.0 / S)
+ * accuracy/behavior may vary across supported targets, use accordingly */
+
+#if   RT_SIMD_COMPAT_RCP == 0 || RT_SIMD_COMPAT_RCP == 2
+
+#define rcpts_rr(XD, XS) /* destroys XS */                                  \
+        rcets_rr(W(XD), W(XS))                                              \
+        rcsts_rr(W(XD), W(XS)) /* <- not reusable without extra temp reg */
+
+#elif RT_SIMD_COMPAT_RCP == 1
+
+#define rcpts_rr(XD, XS) /* destroys XS */                                  \
+        movts_ld(W(XD), Mebp, inf_GPC01_64)                                 \
+        divts_rr(W(XD), W(XS))
+
+#define rcets_rr(XD, XS)                                                    \
+        movts_st(W(XS), Mebp, inf_SCR02(0))                                 \
+        movts_ld(W(XD), Mebp, inf_GPC01_64)                                 \
+        divts_ld(W(XD), Mebp, inf_SCR02(0))
+
+#define rcsts_rr(XG, XS) /* destroys XS */
+
+#endif /* RT_SIMD_COMPAT_RCP */
+
+/* rsq (D = 1.0 / sqrt S)
+ * accuracy/behavior may vary across supported targets, use accordingly */
+
+#if   RT_SIMD_COMPAT_RSQ == 0 || RT_SIMD_COMPAT_RSQ == 2
+
+#define rsqts_rr(XD, XS) /* destroys XS */                                  \
+        rsets_rr(W(XD), W(XS))                                              \
+        rssts_rr(W(XD), W(XS)) /* <- not reusable without extra temp reg */
+
+#elif RT_SIMD_COMPAT_RSQ == 1
+
+#define rsqts_rr(XD, XS) /* destroys XS */                                  \
+        sqrts_rr(W(XS), W(XS))                                              \
+        movts_ld(W(XD), Mebp, inf_GPC01_64)                                 \
+        divts_rr(W(XD), W(XS))
+
+#define rsets_rr(XD, XS)                                                    \
+        sqrts_rr(W(XD), W(XS))                                              \
+        movts_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        movts_ld(W(XD), Mebp, inf_GPC01_64)                                 \
+        divts_ld(W(XD), Mebp, inf_SCR02(0))
+
+#define rssts_rr(XG, XS) /* destroys XS */
+
+#endif /* RT_SIMD_COMPAT_RSQ */
+
+/* fma (G = G + S * T) if (#G != #S && #G != #T)
+ * NOTE: x87 fpu-fallbacks for fma/fms use round-to-nearest mode by default,
+ * enable RT_SIMD_COMPAT_FMR for current SIMD rounding mode to be honoured */
+
+#if RT_SIMD_COMPAT_FMA == 2
+
+#define fmats_rr(XG, XS, XT)                                                \
+        movts_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        mults_rr(W(XS), W(XT))                                              \
+        addts_rr(W(XG), W(XS))                                              \
+        movts_ld(W(XS), Mebp, inf_SCR01(0))
+
+#define fmats_ld(XG, XS, MT, DT)                                            \
+        movts_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        mults_ld(W(XS), W(MT), W(DT))                                       \
+        addts_rr(W(XG), W(XS))                                              \
+        movts_ld(W(XS), Mebp, inf_SCR01(0))
+
+#endif /* RT_SIMD_COMPAT_FMA */
+
+#define fmats3rr(XG, XS, XT)                                                \
+        fmats_rr(W(XG), W(XS), W(XT))
+
+#define fmats3ld(XG, XS, MT, DT)                                            \
+        fmats_ld(W(XG), W(XS), W(MT), W(DT))
+
+/* fms (G = G - S * T) if (#G != #S && #G != #T)
+ * NOTE: due to final negation being outside of rounding on all POWER systems
+ * only symmetric rounding modes (RN, RZ) are compatible across all targets */
+
+#if RT_SIMD_COMPAT_FMS == 2
+
+#define fmsts_rr(XG, XS, XT)                                                \
+        movts_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        mults_rr(W(XS), W(XT))                                              \
+        subts_rr(W(XG), W(XS))                                              \
+        movts_ld(W(XS), Mebp, inf_SCR01(0))
+
+#define fmsts_ld(XG, XS, MT, DT)                                            \
+        movts_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        mults_ld(W(XS), W(MT), W(DT))                                       \
+        subts_rr(W(XG), W(XS))                                              \
+        movts_ld(W(XS), Mebp, inf_SCR01(0))
+
+#endif /* RT_SIMD_COMPAT_FMS */
+
+#define fmsts3rr(XG, XS, XT)                                                \
+        fmsts_rr(W(XG), W(XS), W(XT))
+
+#define fmsts3ld(XG, XS, MT, DT)                                            \
+        fmsts_ld(W(XG), W(XS), W(MT), W(DT))
+
+/******************************************************************************/
+/**** var-len **** (bcs/gat/sct/mtl/shf/tbl/scn) with fixed-32-bit element ****/
+/******************************************************************************/
+
+/* bcs (D = [M]) broadcast scalar element from memory into all SIMD elements
+ * bcs (D = S) broadcast 32-bit BASE register S into all SIMD elements
+ * targets without native broadcasts use inf_SCR01/SCR02 and BASE-moves below */
+
+#if   (RT_SIMD == 256) && !(defined RT_SVEX1) && (defined bcscx_ld)
+
+#define bcsox_ld(XD, MS, DS)                                                \
+        bcscx_ld(W(XD), W(MS), W(DS))
+
+#elif (RT_SIMD == 128) && !(defined RT_SVEX1) && (defined bcsix_ld)
+
+#define bcsox_ld(XD, MS, DS)                                                \
+        bcsix_ld(W(XD), W(MS), W(DS))
+
+#endif /* RT_SIMD: 256, 128 */
+
+#ifndef bcsox_ld
+
+#define bcsox_ld(XD, MS, DS)                                                \
+        stack_st(Reax)                                                      \
+        movwx_ld(Reax,  W(MS), W(DS))                                       \
+        bcsox_rn(0x00)                                                      \
+        stack_ld(Reax)                                                      \
+        movox_ld(W(XD), Mebp, inf_SCR01(0))
+
+#define bcsox_rx(nx) /* not portable, do not use outside */                 \
+        movwx_st(Reax,  Mebp, inf_SCR01(nx))
+
+#define bcsox_r1(nx) /* not portable, do not use outside */                 \
+        bcsox_rx(nx+0x00)                                                   \
+        bcsox_rx(nx+0x04)                                                   \
+        bcsox_rx(nx+0x08)                                                   \
+        bcsox_rx(nx+0x0C)
+
+#define bcsox_r2(nx) /* not portable, do not use outside */                 \
+        bcsox_r1(nx+0x00)                                                   \
+        bcsox_r1(nx+0x10)
+
+#define bcsox_r4(nx) /* not portable, do not use outside */                 \
+        bcsox_r2(nx+0x00)                                                   \
+        bcsox_r2(nx+0x20)
+
+#define bcsox_r8(nx) /* not portable, do not use outside */                 \
+        bcsox_r4(nx+0x00)                                                   \
+        bcsox_r4(nx+0x40)
+
+#define bcsox_rG(nx) /* not portable, do not use outside */                 \
+        bcsox_r8(nx+0x00)                                                   \
+        bcsox_r8(nx+0x80)
+
+#if   (RT_SIMD == 2048)
+#define bcsox_rn(nx)        bcsox_rG(nx)
+#elif (RT_SIMD == 1024)
+#define bcsox_rn(nx)        bcsox_r8(nx)
+#elif (RT_SIMD == 512)
+#define bcsox_rn(nx)        bcsox_r4(nx)
+#elif (RT_SIMD == 256)
+#define bcsox_rn(nx)        bcsox_r2(nx)
+#elif (RT_SIMD == 128)
+#define bcsox_rn(nx)        bcsox_r1(nx)
+#endif /* RT_SIMD: 2048, 1024, 512, 256, 128 */
+
+#endif /* bcsox_ld */
+
+#ifndef bcsox_rr
+
+#define bcsox_rr(XD, RS)                                                    \
+        movwx_st(W(RS), Mebp, inf_SCR02(0))                                 \
+        bcsox_ld(W(XD), Mebp, inf_SCR02(0))
+
+#endif /* bcsox_rr */
+
+/* gat (D = [M + S]) gather elements at per-lane indices S from M/DS,
+ * indices are in elements within [0, 2^31) (VSIB sign-extends 32-bit ones),
+ * M*** or Oeax, but not indexed modes (I***, ...), XD/XS differ,
+ * SIMD registers other than XD are preserved (masks are internal)
+ * targets without native gathers use inf_SCR01/SCR02 and BASE-loads below */
+
+#if   (RT_SIMD == 256) && !(defined RT_SVEX1) && (defined gatcx_ld)
+
+#define gatox_ld(XD, XS, MS, DS)                                            \
+        gatcx_ld(W(XD), W(XS), W(MS), W(DS))
+
+#endif /* RT_SIMD: 256 */
+
+#ifndef gatox_ld
+
+#define gatox_ld(XD, XS, MS, DS)                                            \
+        movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        stack_st(Recx)                                                      \
+        adrxx_ld(Recx,  W(MS), W(DS))                                       \
+        stack_st(Reax)                                                      \
+        gatox_rn(0x00)                                                      \
+        stack_ld(Reax)                                                      \
+        stack_ld(Recx)                                                      \
+        movox_ld(W(XD), Mebp, inf_SCR02(0))
+
+#define gatox_rx(nx) /* not portable, do not use outside */                 \
+        movwx_ld(Reax,  Mebp, inf_SCR01(nx))                                \
+        movwx_ld(Reax,  Kecx, DP(0x00))                                     \
+        movwx_st(Reax,  Mebp, inf_SCR02(nx))
+
+#define gatox_r1(nx) /* not portable, do not use outside */                 \
+        gatox_rx(nx+0x00)                                                   \
+        gatox_rx(nx+0x04)                                                   \
+        gatox_rx(nx+0x08)                                                   \
+        gatox_rx(nx+0x0C)
+
+#define gatox_r2(nx) /* not portable, do not use outside */                 \
+        gatox_r1(nx+0x00)                                                   \
+        gatox_r1(nx+0x10)
+
+#define gatox_r4(nx) /* not portable, do not use outside */                 \
+        gatox_r2(nx+0x00)                                                   \
+        gatox_r2(nx+0x20)
+
+#define gatox_r8(nx) /* not portable, do not use outside */                 \
+        gatox_r4(nx+0x00)                                                   \
+        gatox_r4(nx+0x40)
+
+#define gatox_rG(nx) /* not portable, do not use outside */                 \
+        gatox_r8(nx+0x00)                                                   \
+        gatox_r8(nx+0x80)
+
+#if   (RT_SIMD == 2048)
+#define gatox_rn(nx)        gatox_rG(nx)
+#elif (RT_SIMD == 1024)
+#define gatox_rn(nx)        gatox_r8(nx)
+#elif (RT_SIMD == 512)
+#define gatox_rn(nx)        gatox_r4(nx)
+#elif (RT_SIMD == 256)
+#define gatox_rn(nx)        gatox_r2(nx)
+#elif (RT_SIMD == 128)
+#define gatox_rn(nx)        gatox_r1(nx)
+#endif /* RT_SIMD: 2048, 1024, 512, 256, 128 */
+
+#endif /* gatox_ld */
+
+/* sct (M + T = S) scatter elements of S to per-lane indices T at M/DD,
+ * indices are in elements within [0, 2^31) (VSIB sign-extends 32-bit ones),
+ * M*** or Oeax, but not indexed modes (I***, ...),
+ * colliding indices are written in lane order (the highest lane wins)
+ * targets without native scatters use inf_SCR01/SCR02 and BASE-stores below */
+
+#ifndef sctox_st
+
+#define sctox_st(XS, XT, MD, DD)                                            \
+        movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movox_st(W(XT), Mebp, inf_SCR02(0))                                 \
+        stack_st(Recx)                                                      \
+        adrxx_ld(Recx,  W(MD), W(DD))                                       \
+        stack_st(Reax)                                                      \
+        stack_st(Redx)                                                      \
+        sctox_rn(0x00)                                                      \
+        stack_ld(Redx)                                                      \
+        stack_ld(Reax)                                                      \
+        stack_ld(Recx)
+
+#define sctox_rx(nx) /* not portable, do not use outside */                 \
+        movwx_ld(Reax,  Mebp, inf_SCR02(nx))                                \
+        movwx_ld(Redx,  Mebp, inf_SCR01(nx))                                \
+        movwx_st(Redx,  Kecx, DP(0x00))
+
+#define sctox_r1(nx) /* not portable, do not use outside */                 \
+        sctox_rx(nx+0x00)                                                   \
+        sctox_rx(nx+0x04)                                                   \
+        sctox_rx(nx+0x08)                                                   \
+        sctox_rx(nx+0x0C)
+
+#define sctox_r2(nx) /* not portable, do not use outside */                 \
+        sctox_r1(nx+0x00)                                                   \
+        sctox_r1(nx+0x10)
+
+#define sctox_r4(nx) /* not portable, do not use outside */                 \
+        sctox_r2(nx+0x00)                                                   \
+        sctox_r2(nx+0x20)
+
+#define sctox_r8(nx) /* not portable, do not use outside */                 \
+        sctox_r4(nx+0x00)                                                   \
+        sctox_r4(nx+0x40)
+
+#define sctox_rG(nx) /* not portable, do not use outside */                 \
+        sctox_r8(nx+0x00)                                                   \
+        sctox_r8(nx+0x80)
+
+#if   (RT_SIMD == 2048)
+#define sctox_rn(nx)        sctox_rG(nx)
+#elif (RT_SIMD == 1024)
+#define sctox_rn(nx)        sctox_r8(nx)
+#elif (RT_SIMD == 512)
+#define sctox_rn(nx)        sctox_r4(nx)
+#elif (RT_SIMD == 256)
+#define sctox_rn(nx)        sctox_r2(nx)
+#elif (RT_SIMD == 128)
+#define sctox_rn(nx)        sctox_r1(nx)
+#endif /* RT_SIMD: 2048, 1024, 512, 256, 128 */
+
+#endif /* sctox_st */
+
+/* mtl (D = S) move the first RS lanes only (loop tails), 0 <= RS <= S
+ * load zeroes the remaining lanes of XD, store keeps memory past RS lanes,
+ * memory past RS lanes is never accessed, RS holds the count as cmdw value,
+ * uses Xmm0 implicitly as a temp mask register, destroys Xmm0, XD/XS != Xmm0
+ * targets without native masking use inf_SCR01/SCR02 and BASE-moves below,
+ * which pick per lane either the given address or the scratchpad itself */
+
+#if   (RT_SIMD == 256) && !(defined RT_SVEX1) && (defined mtlcx_ld)
+
+#define mtlox_ld(XD, RS, MS, DS)                                            \
+        mtlcx_ld(W(XD), W(RS), W(MS), W(DS))
+
+#define mtlox_st(XS, RS, MD, DD)                                            \
+        mtlcx_st(W(XS), W(RS), W(MD), W(DD))
+
+#endif /* RT_SIMD: 256 */
+
+#ifndef mtlox_ld
+
+#define mtlox_ld(XD, RS, MS, DS)                                            \
+        xorox_rr(W(XD), W(XD))                                              \
+        movox_st(W(XD), Mebp, inf_SCR01(0))                                 \
+        mtlox_rb(W(RS), W(MS), W(DS))                                       \
+        mtlox_rn(mtlox_rl, 0x00)                                            \
+        stack_ld(Rebx)                                                      \
+        stack_ld(Reax)                                                      \
+        stack_ld(Recx)                                                      \
+        stack_ld(Redx)                                                      \
+        movox_ld(W(XD), Mebp, inf_SCR01(0))
+
+#define mtlox_st(XS, RS, MD, DD)                                            \
+        movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        mtlox_rb(W(RS), W(MD), W(DD))                                       \
+        mtlox_rn(mtlox_rs, 0x00)                                            \
+        stack_ld(Rebx)                                                      \
+        stack_ld(Reax)                                                      \
+        stack_ld(Recx)                                                      \
+        stack_ld(Redx)
+
+#define mtlox_rb(RS, MS, DS) /* not portable, do not use outside */         \
+        movxx_st(W(RS), Mebp, inf_SCR02(0))                                 \
+        stack_st(Redx)                                                      \
+        adrxx_ld(Redx,  W(MS), W(DS))                                       \
+        stack_st(Recx)                                                      \
+        adrxx_ld(Recx,  Mebp, inf_SCR01(0))                                 \
+        subxx_rr(Redx,  Recx)                                               \
+        stack_st(Reax)                                                      \
+        stack_st(Rebx)
+
+#define mtlox_rx(nx) /* not portable, do not use outside */                 \
+        movxx_ri(Reax,  IB((nx)/4))                                         \
+        subxx_ld(Reax,  Mebp, inf_SCR02(0))                                 \
+        shrxn_ri(Reax,  IB(A*32-1))                                         \
+        andxx_rr(Reax,  Redx)                                               \
+        addxx_rr(Reax,  Recx)
+
+#define mtlox_rl(nx) /* not portable, do not use outside */                 \
+        mtlox_rx(nx)                                                        \
+        movwx_ld(Rebx,  Oeax, PLAIN)                                        \
+        movwx_st(Rebx,  Mebp, inf_SCR01(nx))                                \
+        addxx_ri(Recx,  IB(4))
+
+#define mtlox_rs(nx) /* not portable, do not use outside */                 \
+        mtlox_rx(nx)                                                        \
+        movwx_ld(Rebx,  Mebp, inf_SCR01(nx))                                \
+        movwx_st(Rebx,  Oeax, PLAIN)                                        \
+        addxx_ri(Recx,  IB(4))
+
+#define mtlox_r1(op, nx) /* not portable, do not use outside */             \
+        op(nx+0x00)                                                         \
+        op(nx+0x04)                                                         \
+        op(nx+0x08)                                                         \
+        op(nx+0x0C)
+
+#define mtlox_r2(op, nx) /* not portable, do not use outside */             \
+        mtlox_r1(op, nx+0x00)                                               \
+        mtlox_r1(op, nx+0x10)
+
+#define mtlox_r4(op, nx) /* not portable, do not use outside */             \
+        mtlox_r2(op, nx+0x00)                                               \
+        mtlox_r2(op, nx+0x20)
+
+#define mtlox_r8(op, nx) /* not portable, do not use outside */             \
+        mtlox_r4(op, nx+0x00)                                               \
+        mtlox_r4(op, nx+0x40)
+
+#define mtlox_rG(op, nx) /* not portable, do not use outside */             \
+        mtlox_r8(op, nx+0x00)                                               \
+        mtlox_r8(op, nx+0x80)
+
+#if   (RT_SIMD == 2048)
+#define mtlox_rn(op, nx)    mtlox_rG(op, nx)
+#elif (RT_SIMD == 1024)
+#define mtlox_rn(op, nx)    mtlox_r8(op, nx)
+#elif (RT_SIMD == 512)
+#define mtlox_rn(op, nx)    mtlox_r4(op, nx)
+#elif (RT_SIMD == 256)
+#define mtlox_rn(op, nx)    mtlox_r2(op, nx)
+#elif (RT_SIMD == 128)
+#define mtlox_rn(op, nx)    mtlox_r1(op, nx)
+#endif /* RT_SIMD: 2048, 1024, 512, 256, 128 */
+
+#endif /* mtlox_ld */
+
+/* stn (D = S) non-temporal store, bypasses caches on the way to memory
+ * weakly-ordered, place sfnce_xx before [D] is read by other threads
+ * targets without native non-temporal stores use regular stores below */
+
+#if   (RT_SIMD == 256) && !(defined RT_SVEX1) && (defined stncx_st)
+
+#define stnox_st(XS, MD, DD)                                                \
+        stncx_st(W(XS), W(MD), W(DD))
+
+#elif (RT_SIMD == 128) && !(defined RT_SVEX1) && (defined stnix_st)
+
+#define stnox_st(XS, MD, DD)                                                \
+        stnix_st(W(XS), W(MD), W(DD))
+
+#endif /* RT_SIMD: 256, 128 */
+
+#ifndef stnox_st
+
+#define stnox_st(XS, MD, DD)                                                \
+        movox_st(W(XS), W(MD), W(DD))
+
+#endif /* stnox_st */
+
+/* shf (G = G[IS]), (D = S[IT]) shuffle elements within each 128-bit lane
+ * 2-bit fields of the immediate select 32-bit elements in each 128-bit lane
+ * targets without native shuffles use inf_SCR01/SCR02 and BASE-moves below */
+
+#if   (RT_SIMD == 256) && !(defined RT_SVEX1) && (defined shfcx3ri)
+
+#define shfox_ri(XG, IS)                                                    \
+        shfcx_ri(W(XG), W(IS))
+
+#define shfox3ri(XD, XS, IT)                                                \
+        shfcx3ri(W(XD), W(XS), W(IT))
+
+#elif (RT_SIMD == 128) && !(defined RT_SVEX1) && (defined shfix3ri)
+
+#define shfox_ri(XG, IS)                                                    \
+        shfix_ri(W(XG), W(IS))
+
+#define shfox3ri(XD, XS, IT)                                                \
+        shfix3ri(W(XD), W(XS), W(IT))
+
+#endif /* RT_SIMD: 256, 128 */
+
+#ifndef shfox3ri
+
+#define shfox_ri(XG, IS)                                                    \
+        shfox3ri(W(XG), W(XG), W(IS))
+
+#define shfox3ri(XD, XS, IT)                                                \
+        movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        stack_st(Reax)                                                      \
+        shfox_rn(VAL(IT), 0x00)                                             \
+        stack_ld(Reax)                                                      \
+        movox_ld(W(XD), Mebp, inf_SCR02(0))
+
+#define shfox_rx(it, nx) /* not portable, do not use outside */             \
+        movwx_ld(Reax,  Mebp, inf_SCR01(nx+((it)>>0&3)*4))                  \
+        movwx_st(Reax,  Mebp, inf_SCR02(nx+0x00))                           \
+        movwx_ld(Reax,  Mebp, inf_SCR01(nx+((it)>>2&3)*4))                  \
+        movwx_st(Reax,  Mebp, inf_SCR02(nx+0x04))                           \
+        movwx_ld(Reax,  Mebp, inf_SCR01(nx+((it)>>4&3)*4))                  \
+        movwx_st(Reax,  Mebp, inf_SCR02(nx+0x08))                           \
+        movwx_ld(Reax,  Mebp, inf_SCR01(nx+((it)>>6&3)*4))                  \
+        movwx_st(Reax,  Mebp, inf_SCR02(nx+0x0C))
+
+#define shfox_r1(it, nx) /* not portable, do not use outside */             \
+        shfox_rx(it, nx)
+
+#define shfox_r2(it, nx) /* not portable, do not use outside */             \
+        shfox_r1(it, nx+0x00)                                               \
+        shfox_r1(it, nx+0x10)
+
+#define shfox_r4(it, nx) /* not portable, do not use outside */             \
+        shfox_r2(it, nx+0x00)                                               \
+        shfox_r2(it, nx+0x20)
+
+#define shfox_r8(it, nx) /* not portable, do not use outside */             \
+        shfox_r4(it, nx+0x00)                                               \
+        shfox_r4(it, nx+0x40)
+
+#define shfox_rG(it, nx) /* not portable, do not use outside */             \
+        shfox_r8(it, nx+0x00)                                               \
+        shfox_r8(it, nx+0x80)
+
+#if   (RT_SIMD == 2048)
+#define shfox_rn(it, nx)    shfox_rG(it, nx)
+#elif (RT_SIMD == 1024)
+#define shfox_rn(it, nx)    shfox_r8(it, nx)
+#elif (RT_SIMD == 512)
+#define shfox_rn(it, nx)    shfox_r4(it, nx)
+#elif (RT_SIMD == 256)
+#define shfox_rn(it, nx)    shfox_r2(it, nx)
+#elif (RT_SIMD == 128)
+#define shfox_rn(it, nx)    shfox_r1(it, nx)
+#endif /* RT_SIMD: 2048, 1024, 512, 256, 128 */
+
+#endif /* shfox3ri */
+
+/* tbl (G = G[S]), (D = S[T]) permute elements across the SIMD register
+ * indices are in elements, taken modulo the number of elements in SIMD
+ * targets without native permutes use inf_SCR01/SCR02 and BASE-loads below */
+
+#if   (RT_SIMD == 256) && !(defined RT_SVEX1) && (defined tblcx3rr)
+
+#define tblox_rr(XG, XS)                                                    \
+        tblcx_rr(W(XG), W(XS))
+
+#define tblox3rr(XD, XS, XT)                                                \
+        tblcx3rr(W(XD), W(XS), W(XT))
+
+#elif (RT_SIMD == 128) && !(defined RT_SVEX1) && (defined tblix3rr)
+
+#define tblox_rr(XG, XS)                                                    \
+        tblix_rr(W(XG), W(XS))
+
+#define tblox3rr(XD, XS, XT)                                                \
+        tblix3rr(W(XD), W(XS), W(XT))
+
+#endif /* RT_SIMD: 256, 128 */
+
+#ifndef tblox3rr
+
+#define tblox_rr(XG, XS)                                                    \
+        tblox3rr(W(XG), W(XG), W(XS))
+
+#define tblox3rr(XD, XS, XT)                                                \
+        movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movox_st(W(XT), Mebp, inf_SCR02(0))                                 \
+        stack_st(Reax)                                                      \
+        tblox_rn(0x00)                                                      \
+        stack_ld(Reax)                                                      \
+        movox_ld(W(XD), Mebp, inf_SCR02(0))
+
+#define tblox_rx(nx) /* not portable, do not use outside */                 \
+        movwx_ld(Reax,  Mebp, inf_SCR02(nx))                                \
+        andwx_ri(Reax,  IB(RT_SIMD/32-1))                                   \
+        movwx_ld(Reax,  Kebp, inf_SCR01(0))                                 \
+        movwx_st(Reax,  Mebp, inf_SCR02(nx))
+
+#define tblox_r1(nx) /* not portable, do not use outside */                 \
+        tblox_rx(nx+0x00)                                                   \
+        tblox_rx(nx+0x04)                                                   \
+        tblox_rx(nx+0x08)                                                   \
+        tblox_rx(nx+0x0C)
+
+#define tblox_r2(nx) /* not portable, do not use outside */                 \
+        tblox_r1(nx+0x00)                                                   \
+        tblox_r1(nx+0x10)
+
+#define tblox_r4(nx) /* not portable, do not use outside */                 \
+        tblox_r2(nx+0x00)                                                   \
+        tblox_r2(nx+0x20)
+
+#define tblox_r8(nx) /* not portable, do not use outside */                 \
+        tblox_r4(nx+0x00)                                                   \
+        tblox_r4(nx+0x40)
+
+#define tblox_rG(nx) /* not portable, do not use outside */                 \
+        tblox_r8(nx+0x00)                                                   \
+        tblox_r8(nx+0x80)
+
+#if   (RT_SIMD == 2048)
+#define tblox_rn(nx)    tblox_rG(nx)
+#elif (RT_SIMD == 1024)
+#define tblox_rn(nx)    tblox_r8(nx)
+#elif (RT_SIMD == 512)
+#define tblox_rn(nx)    tblox_r4(nx)
+#elif (RT_SIMD == 256)
+#define tblox_rn(nx)    tblox_r2(nx)
+#elif (RT_SIMD == 128)
+#define tblox_rn(nx)    tblox_r1(nx)
+#endif /* RT_SIMD: 2048, 1024, 512, 256, 128 */
+
+#endif /* tblox3rr */
+
+/* scn (D[i] = S[0] op .. op S[i]) inclusive prefix scans in log2 steps
+ * adi/ade (sum), mni/mxi (min/max), exclusive scan is only provided for add
+ * targets without native scans use inf_SCR01/SCR02 and BASE-moves below
+ * uses Xmm0 implicitly as a temp register, destroys Xmm0, XD/XS != Xmm0 */
+
+#if   (RT_SIMD == 256) && !(defined RT_SVEX1) && (defined adicx_rr)
+
+#define adios_rr(XD, XS)                                                    \
+        adics_rr(W(XD), W(XS))
+
+#define adiox_rr(XD, XS)                                                    \
+        adicx_rr(W(XD), W(XS))
+
+#define adeos_rr(XD, XS)                                                    \
+        adecs_rr(W(XD), W(XS))
+
+#define adeox_rr(XD, XS)                                                    \
+        adecx_rr(W(XD), W(XS))
+
+#define mnios_rr(XD, XS)                                                    \
+        mnics_rr(W(XD), W(XS))
+
+#define mniox_rr(XD, XS)                                                    \
+        mnicx_rr(W(XD), W(XS))
+
+#define mnion_rr(XD, XS)                                                    \
+        mnicn_rr(W(XD), W(XS))
+
+#define mxios_rr(XD, XS)                                                    \
+        mxics_rr(W(XD), W(XS))
+
+#define mxiox_rr(XD, XS)                                                    \
+        mxicx_rr(W(XD), W(XS))
+
+#define mxion_rr(XD, XS)                                                    \
+        mxicn_rr(W(XD), W(XS))
+
+#elif (RT_SIMD == 128) && !(defined RT_SVEX1) && (defined adiix_rr)
+
+#define adios_rr(XD, XS)                                                    \
+        adiis_rr(W(XD), W(XS))
+
+#define adiox_rr(XD, XS)                                                    \
+        adiix_rr(W(XD), W(XS))
+
+#define adeos_rr(XD, XS)                                                    \
+        adeis_rr(W(XD), W(XS))
+
+#define adeox_rr(XD, XS)                                                    \
+        adeix_rr(W(XD), W(XS))
+
+#define mnios_rr(XD, XS)                                                    \
+        mniis_rr(W(XD), W(XS))
+
+#define mniox_rr(XD, XS)                                                    \
+        mniix_rr(W(XD), W(XS))
+
+#define mnion_rr(XD, XS)                                                    \
+        mniin_rr(W(XD), W(XS))
+
+#define mxios_rr(XD, XS)                                                    \
+        mxiis_rr(W(XD), W(XS))
+
+#define mxiox_rr(XD, XS)                                                    \
+        mxiix_rr(W(XD), W(XS))
+
+#define mxion_rr(XD, XS)                                                    \
+        mxiin_rr(W(XD), W(XS))
+
+#endif /* RT_SIMD: 256, 128 */
+
+#ifndef adiox_rr
+
+#define adios_rr(XD, XS)                                                    \
+        movox_rr(W(XD), W(XS))                                              \
+        scnox_ra(W(XD), addos_rr, scnox_rz)
+
+#define adiox_rr(XD, XS)                                                    \
+        movox_rr(W(XD), W(XS))                                              \
+        scnox_ra(W(XD), addox_rr, scnox_rz)
+
+#define adeos_rr(XD, XS)                                                    \
+        movox_rr(W(XD), W(XS))                                              \
+        scnox_ra(W(XD), addos_rr, scnox_rz)                                 \
+        scnox_rs(W(XD), movox_rr, scnox_rz, 0x04)
+
+#define adeox_rr(XD, XS)                                                    \
+        movox_rr(W(XD), W(XS))                                              \
+        scnox_ra(W(XD), addox_rr, scnox_rz)                                 \
+        scnox_rs(W(XD), movox_rr, scnox_rz, 0x04)
+
+#define mnios_rr(XD, XS)                                                    \
+        movox_rr(W(XD), W(XS))                                              \
+        scnox_ra(W(XD), minos_rr, scnox_rf)
+
+#define mniox_rr(XD, XS)                                                    \
+        movox_rr(W(XD), W(XS))                                              \
+        scnox_ra(W(XD), minox_rr, scnox_rf)
+
+#define mnion_rr(XD, XS)                                                    \
+        movox_rr(W(XD), W(XS))                                              \
+        scnox_ra(W(XD), minon_rr, scnox_rf)
+
+#define mxios_rr(XD, XS)                                                    \
+        movox_rr(W(XD), W(XS))                                              \
+        scnox_ra(W(XD), maxos_rr, scnox_rf)
+
+#define mxiox_rr(XD, XS)                                                    \
+        movox_rr(W(XD), W(XS))                                              \
+        scnox_ra(W(XD), maxox_rr, scnox_rf)
+
+#define mxion_rr(XD, XS)                                                    \
+        movox_rr(W(XD), W(XS))                                              \
+        scnox_ra(W(XD), maxon_rr, scnox_rf)
+
+/* shift XD up by nb bytes via SCR02, the vacated lower elements are read
+ * from the area right below SCR02 (within SCR01) filled in by "fl" first */
+
+#define scnox_rs(XD, op, fl, nb) /* not portable, do not use outside */     \
+        movox_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        stack_st(Reax)                                                      \
+        scnox_rn(fl, nb, 0x00)                                              \
+        stack_ld(Reax)                                                      \
+        movox_ld(Xmm0, Mebp, inf_SCR02(0))                                  \
+        op(W(XD), Xmm0)
+
+#define scnox_rx(fl, nb, nx) /* not portable, do not use outside */         \
+        fl(nx)                                                              \
+        movwx_ld(Reax,  Mebp, inf_SCR02(nx+0x0C-(nb)))                      \
+        movwx_st(Reax,  Mebp, inf_SCR02(nx+0x0C))                           \
+        movwx_ld(Reax,  Mebp, inf_SCR02(nx+0x08-(nb)))                      \
+        movwx_st(Reax,  Mebp, inf_SCR02(nx+0x08))                           \
+        movwx_ld(Reax,  Mebp, inf_SCR02(nx+0x04-(nb)))                      \
+        movwx_st(Reax,  Mebp, inf_SCR02(nx+0x04))                           \
+        movwx_ld(Reax,  Mebp, inf_SCR02(nx+0x00-(nb)))                      \
+        movwx_st(Reax,  Mebp, inf_SCR02(nx+0x00))
+
+#define scnox_rz(nx) /* not portable, do not use outside */                 \
+        movwx_mi(Mebp,  inf_SCR02(nx+0x00-(RT_SIMD/8)), IB(0))              \
+        movwx_mi(Mebp,  inf_SCR02(nx+0x04-(RT_SIMD/8)), IB(0))              \
+        movwx_mi(Mebp,  inf_SCR02(nx+0x08-(RT_SIMD/8)), IB(0))              \
+        movwx_mi(Mebp,  inf_SCR02(nx+0x0C-(RT_SIMD/8)), IB(0))
+
+#define scnox_rf(nx) /* not portable, do not use outside */                 \
+        movwx_ld(Reax,  Mebp, inf_SCR02(0x00))                              \
+        movwx_st(Reax,  Mebp, inf_SCR02(nx+0x00-(RT_SIMD/8)))               \
+        movwx_st(Reax,  Mebp, inf_SCR02(nx+0x04-(RT_SIMD/8)))               \
+        movwx_st(Reax,  Mebp, inf_SCR02(nx+0x08-(RT_SIMD/8)))               \
+        movwx_st(Reax,  Mebp, inf_SCR02(nx+0x0C-(RT_SIMD/8)))
+
+#define scnox_r1(fl, nb, nx) /* not portable, do not use outside */         \
+        scnox_rx(fl, nb, nx)
+
+#define scnox_r2(fl, nb, nx) /* not portable, do not use outside */         \
+        scnox_r1(fl, nb, nx+0x10)                                           \
+        scnox_r1(fl, nb, nx+0x00)
+
+#define scnox_r4(fl, nb, nx) /* not portable, do not use outside */         \
+        scnox_r2(fl, nb, nx+0x20)                                           \
+        scnox_r2(fl, nb, nx+0x00)
+
+#define scnox_r8(fl, nb, nx) /* not portable, do not use outside */         \
+        scnox_r4(fl, nb, nx+0x40)                                           \
+        scnox_r4(fl, nb, nx+0x00)
+
+#define scnox_rG(fl, nb, nx) /* not portable, do not use outside */         \
+        scnox_r8(fl, nb, nx+0x80)                                           \
+        scnox_r8(fl, nb, nx+0x00)
+
+#define scnox_a1(XD, op, fl) /* not portable, do not use outside */         \
+        scnox_rs(W(XD), op, fl, 0x04)                                       \
+        scnox_rs(W(XD), op, fl, 0x08)
+
+#define scnox_a2(XD, op, fl) /* not portable, do not use outside */         \
+        scnox_a1(W(XD), op, fl)                                             \
+        scnox_rs(W(XD), op, fl, 0x10)
+
+#define scnox_a4(XD, op, fl) /* not portable, do not use outside */         \
+        scnox_a2(W(XD), op, fl)                                             \
+        scnox_rs(W(XD), op, fl, 0x20)
+
+#define scnox_a8(XD, op, fl) /* not portable, do not use outside */         \
+        scnox_a4(W(XD), op, fl)                                             \
+        scnox_rs(W(XD), op, fl, 0x40)
+
+#define scnox_aG(XD, op, fl) /* not portable, do not use outside */         \
+        scnox_a8(W(XD), op, fl)                                             \
+        scnox_rs(W(XD), op, fl, 0x80)
+
+#if   (RT_SIMD == 2048)
+#define scnox_ra(XD, op, fl)    scnox_aG(W(XD), op, fl)
+#define scnox_rn(fl, nb, nx)    scnox_rG(fl, nb, nx)
+#elif (RT_SIMD == 1024)
+#define scnox_ra(XD, op, fl)    scnox_a8(W(XD), op, fl)
+#define scnox_rn(fl, nb, nx)    scnox_r8(fl, nb, nx)
+#elif (RT_SIMD == 512)
+#define scnox_ra(XD, op, fl)    scnox_a4(W(XD), op, fl)
+#define scnox_rn(fl, nb, nx)    scnox_r4(fl, nb, nx)
+#elif (RT_SIMD == 256)
+#define scnox_ra(XD, op, fl)    scnox_a2(W(XD), op, fl)
+#define scnox_rn(fl, nb, nx)    scnox_r2(fl, nb, nx)
+#elif (RT_SIMD == 128)
+#define scnox_ra(XD, op, fl)    scnox_a1(W(XD), op, fl)
+#define scnox_rn(fl, nb, nx)    scnox_r1(fl, nb, nx)
+#endif /* RT_SIMD: 2048, 1024, 512, 256, 128 */
+
+#endif /* adiox_rr */
+
+/* cnt (D = number of bits set in each element of S), population count
+ * clz (D = number of leading zeroes in each element of S), 32 if 0
+ * ctz (D = number of trailing zeroes in each element of S), 32 if 0
+ * targets without native bit-counts use inf_SCR02 and BASE-ops below */
+
+#if   (RT_SIMD == 256) && !(defined RT_SVEX1) && (defined cntcx_rr)
+
+#define cntox_rr(XD, XS)                                                    \
+        cntcx_rr(W(XD), W(XS))
+
+#define cntox_ld(XD, MS, DS)                                                \
+        cntcx_ld(W(XD), W(MS), W(DS))
+
+#elif (RT_SIMD == 128) && !(defined RT_SVEX1) && (defined cntix_rr)
+
+#define cntox_rr(XD, XS)                                                    \
+        cntix_rr(W(XD), W(XS))
+
+#define cntox_ld(XD, MS, DS)                                                \
+        cntix_ld(W(XD), W(MS), W(DS))
+
+#endif /* RT_SIMD: 256, 128 */
+
+#if   (RT_SIMD == 256) && !(defined RT_SVEX1) && (defined clzcx_rr)
+
+#define clzox_rr(XD, XS)                                                    \
+        clzcx_rr(W(XD), W(XS))
+
+#define clzox_ld(XD, MS, DS)                                                \
+        clzcx_ld(W(XD), W(MS), W(DS))
+
+#elif (RT_SIMD == 128) && !(defined RT_SVEX1) && (defined clzix_rr)
+
+#define clzox_rr(XD, XS)                                                    \
+        clzix_rr(W(XD), W(XS))
+
+#define clzox_ld(XD, MS, DS)                                                \
+        clzix_ld(W(XD), W(MS), W(DS))
+
+#endif /* RT_SIMD: 256, 128 */
+
+#if   (RT_SIMD == 256) && !(defined RT_SVEX1) && (defined ctzcx_rr)
+
+#define ctzox_rr(XD, XS)                                                    \
+        ctzcx_rr(W(XD), W(XS))
+
+#define ctzox_ld(XD, MS, DS)                                                \
+        ctzcx_ld(W(XD), W(MS), W(DS))
+
+#elif (RT_SIMD == 128) && !(defined RT_SVEX1) && (defined ctzix_rr)
+
+#define ctzox_rr(XD, XS)                                                    \
+        ctzix_rr(W(XD), W(XS))
+
+#define ctzox_ld(XD, MS, DS)                                                \
+        ctzix_ld(W(XD), W(MS), W(DS))
+
+#endif /* RT_SIMD: 256, 128 */
+
+#ifndef cntox_rr
+
+#define cntox_rr(XD, XS)                                                    \
+        cntox_rs(W(XD), W(XS), cntox_rx)
+
+#define cntox_ld(XD, MS, DS)                                                \
+        movox_ld(W(XD), W(MS), W(DS))                                       \
+        cntox_rr(W(XD), W(XD))
+
+#endif /* cntox_rr */
+
+#ifndef clzox_rr
+
+#define clzox_rr(XD, XS)                                                    \
+        cntox_rs(W(XD), W(XS), clzox_rx)
+
+#define clzox_ld(XD, MS, DS)                                                \
+        movox_ld(W(XD), W(MS), W(DS))                                       \
+        clzox_rr(W(XD), W(XD))
+
+#endif /* clzox_rr */
+
+#ifndef ctzox_rr
+
+#define ctzox_rr(XD, XS)                                                    \
+        cntox_rs(W(XD), W(XS), ctzox_rx)
+
+#define ctzox_ld(XD, MS, DS)                                                \
+        movox_ld(W(XD), W(MS), W(DS))                                       \
+        ctzox_rr(W(XD), W(XD))
+
+#endif /* ctzox_rr */
+
+/* cnt (D = number of bits set in each element of S), population count
+ * clz (D = number of leading zeroes in each element of S), 16 if 0
+ * ctz (D = number of trailing zeroes in each element of S), 16 if 0
+ * 16-bit elements are processed in pairs within 32-bit BASE-ops below */
+
+#ifndef cntmx_rr
+
+#define cntmx_rr(XD, XS)                                                    \
+        cntmx_rs(W(XD), W(XS), cntmx_rx)
+
+#define cntmx_ld(XD, MS, DS)                                                \
+        movmx_ld(W(XD), W(MS), W(DS))                                       \
+        cntmx_rr(W(XD), W(XD))
+
+#endif /* cntmx_rr */
+
+#ifndef clzmx_rr
+
+#define clzmx_rr(XD, XS)                                                    \
+        cntmx_rs(W(XD), W(XS), clzmx_rx)
+
+#define clzmx_ld(XD, MS, DS)                                                \
+        movmx_ld(W(XD), W(MS), W(DS))                                       \
+        clzmx_rr(W(XD), W(XD))
+
+#endif /* clzmx_rr */
+
+#ifndef ctzmx_rr
+
+#define ctzmx_rr(XD, XS)                                                    \
+        cntmx_rs(W(XD), W(XS), ctzmx_rx)
+
+#define ctzmx_ld(XD, MS, DS)                                                \
+        movmx_ld(W(XD), W(MS), W(DS))                                       \
+        ctzmx_rr(W(XD), W(XD))
+
+#endif /* ctzmx_rr */
+
+/* apply 32-bit BASE-op "op" to each 32-bit word of S via SCR02 */
+
+#define cntox_rs(XD, XS, op) /* not portable, do not use outside */         \
+        movox_st(W(XS), Mebp, inf_SCR02(0))                                 \
+        stack_st(Reax)                                                      \
+        cntox_rn(op, 0x00)                                                  \
+        stack_ld(Reax)                                                      \
+        movox_ld(W(XD), Mebp, inf_SCR02(0))
+
+#define cntox_rx(nx) /* not portable, do not use outside */                 \
+        movwx_ld(Reax,  Mebp, inf_SCR02(nx))                                \
+        cntwx_rr(Reax,  Reax)                                               \
+        movwx_st(Reax,  Mebp, inf_SCR02(nx))
+
+#define clzox_rx(nx) /* not portable, do not use outside */                 \
+        movwx_ld(Reax,  Mebp, inf_SCR02(nx))                                \
+        clzwx_rr(Reax,  Reax)                                               \
+        movwx_st(Reax,  Mebp, inf_SCR02(nx))
+
+#define ctzox_rx(nx) /* not portable, do not use outside */                 \
+        movwx_ld(Reax,  Mebp, inf_SCR02(nx))                                \
+        ctzwx_rr(Reax,  Reax)                                               \
+        movwx_st(Reax,  Mebp, inf_SCR02(nx))
+
+#define cntmx_rs(XD, XS, op) /* not portable, do not use outside */         \
+        movmx_st(W(XS), Mebp, inf_SCR02(0))                                 \
+        stack_st(Reax)                                                      \
+        stack_st(Recx)                                                      \
+        cntox_rn(op, 0x00)                                                  \
+        stack_ld(Recx)                                                      \
+        stack_ld(Reax)                                                      \
+        movmx_ld(W(XD), Mebp, inf_SCR02(0))
+
+#define cntmx_rx(nx) /* not portable, do not use outside */                 \
+        cntmx_rl(nx)                                                        \
+        cntwx_rr(Reax,  Reax)                                               \
+        cntwx_rr(Recx,  Recx)                                               \
+        cntmx_rh(nx)
+
+#define clzmx_rx(nx) /* not portable, do not use outside */                 \
+        cntmx_rl(nx)                                                        \
+        clzwx_rr(Reax,  Reax)                                               \
+        clzwx_rr(Recx,  Recx)                                               \
+        subwx_ri(Reax,  IB(16))                                             \
+        subwx_ri(Recx,  IB(16))                                             \
+        cntmx_rh(nx)
+
+#define ctzmx_rx(nx) /* not portable, do not use outside */                 \
+        cntmx_rl(nx)                                                        \
+        orrwx_ri(Reax,  IV(0x00010000))                                     \
+        orrwx_ri(Recx,  IV(0x00010000))                                     \
+        ctzwx_rr(Reax,  Reax)                                               \
+        ctzwx_rr(Recx,  Recx)                                               \
+        cntmx_rh(nx)
+
+#define cntmx_rl(nx) /* not portable, do not use outside */                 \
+        movwx_ld(Reax,  Mebp, inf_SCR02(nx))                                \
+        movwx_rr(Recx,  Reax)                                               \
+        andwx_ri(Reax,  IH(0xFFFF))                                         \
+        shrwx_ri(Recx,  IB(16))
+
+#define cntmx_rh(nx) /* not portable, do not use outside */                 \
+        shlwx_ri(Recx,  IB(16))                                             \
+        orrwx_rr(Reax,  Recx)                                               \
+        movwx_st(Reax,  Mebp, inf_SCR02(nx))
+
+#define cntox_r1(op, nx) /* not portable, do not use outside */             \
+        op(nx+0x00)                                                         \
+        op(nx+0x04)                                                         \
+        op(nx+0x08)                                                         \
+        op(nx+0x0C)
+
+#define cntox_r2(op, nx) /* not portable, do not use outside */             \
+        cntox_r1(op, nx+0x00)                                               \
+        cntox_r1(op, nx+0x10)
+
+#define cntox_r4(op, nx) /* not portable, do not use outside */             \
+        cntox_r2(op, nx+0x00)                                               \
+        cntox_r2(op, nx+0x20)
+
+#define cntox_r8(op, nx) /* not portable, do not use outside */             \
+        cntox_r4(op, nx+0x00)                                               \
+        cntox_r4(op, nx+0x40)
+
+#define cntox_rG(op, nx) /* not portable, do not use outside */             \
+        cntox_r8(op, nx+0x00)                                               \
+        cntox_r8(op, nx+0x80)
+
+#if   (RT_SIMD == 2048)
+#define cntox_rn(op, nx)    cntox_rG(op, nx)
+#elif (RT_SIMD == 1024)
+#define cntox_rn(op, nx)    cntox_r8(op, nx)
+#elif (RT_SIMD == 512)
+#define cntox_rn(op, nx)    cntox_r4(op, nx)
+#elif (RT_SIMD == 256)
+#define cntox_rn(op, nx)    cntox_r2(op, nx)
+#elif (RT_SIMD == 128)
+#define cntox_rn(op, nx)    cntox_r1(op, nx)
+#endif /* RT_SIMD: 2048, 1024, 512, 256, 128 */
+
+/* bsw (D = S with the order of bytes reversed in each element), byte-swap
+ * targets without native byte-swaps use inf_SCR02 and xor-shifts below */
+
+#if   (RT_SIMD == 256) && !(defined RT_SVEX1) && (defined bswcx_rr)
+
+#define bswox_rr(XD, XS)                                                    \
+        bswcx_rr(W(XD), W(XS))
+
+#define bswox_ld(XD, MS, DS)                                                \
+        bswcx_ld(W(XD), W(MS), W(DS))
+
+#elif (RT_SIMD == 128) && !(defined RT_SVEX1) && (defined bswix_rr)
+
+#define bswox_rr(XD, XS)                                                    \
+        bswix_rr(W(XD), W(XS))
+
+#define bswox_ld(XD, MS, DS)                                                \
+        bswix_ld(W(XD), W(MS), W(DS))
+
+#endif /* RT_SIMD: 256, 128 */
+
+#if   (RT_SIMD == 256) && !(defined RT_SVEX1) && (defined bswax_rr)
+
+#define bswmx_rr(XD, XS)                                                    \
+        bswax_rr(W(XD), W(XS))
+
+#define bswmx_ld(XD, MS, DS)                                                \
+        bswax_ld(W(XD), W(MS), W(DS))
+
+#elif (RT_SIMD == 128) && !(defined RT_SVEX1) && (defined bswgx_rr)
+
+#define bswmx_rr(XD, XS)                                                    \
+        bswgx_rr(W(XD), W(XS))
+
+#define bswmx_ld(XD, MS, DS)                                                \
+        bswgx_ld(W(XD), W(MS), W(DS))
+
+#endif /* RT_SIMD: 256, 128 */
+
+#ifndef bswmx_rr
+
+#define bswmx_rr(XD, XS)                                                    \
+        movmx_rr(W(XD), W(XS))                                              \
+        bswmx_rx(W(XD))
+
+#define bswmx_ld(XD, MS, DS)                                                \
+        movmx_ld(W(XD), W(MS), W(DS))                                       \
+        bswmx_rx(W(XD))
+
+#endif /* bswmx_rr */
+
+#ifndef bswox_rr
+
+#define bswox_rr(XD, XS)                                                    \
+        bswmx_rr(W(XD), W(XS))                                              \
+        bswox_rx(W(XD))
+
+#define bswox_ld(XD, MS, DS)                                                \
+        bswmx_ld(W(XD), W(MS), W(DS))                                       \
+        bswox_rx(W(XD))
+
+#endif /* bswox_rr */
+
+/* swap upper and lower halves of each element of XG, 16-bit (m), 32-bit (o),
+ * three xor-shift steps keep shifts emulated via inf_SCR01 intact */
+
+#define bswmx_rx(XG) /* not portable, do not use outside */                 \
+        movmx_st(W(XG), Mebp, inf_SCR02(0))                                 \
+        shrmx_ri(W(XG), IB(8))                                              \
+        xormx_ld(W(XG), Mebp, inf_SCR02(0))                                 \
+        movmx_st(W(XG), Mebp, inf_SCR02(0))                                 \
+        shlmx_ri(W(XG), IB(8))                                              \
+        xormx_ld(W(XG), Mebp, inf_SCR02(0))                                 \
+        movmx_st(W(XG), Mebp, inf_SCR02(0))                                 \
+        shrmx_ri(W(XG), IB(8))                                              \
+        xormx_ld(W(XG), Mebp, inf_SCR02(0))
+
+#define bswox_rx(XG) /* not portable, do not use outside */                 \
+        movox_st(W(XG), Mebp, inf_SCR02(0))                                 \
+        shrox_ri(W(XG), IB(16))                                             \
+        xorox_ld(W(XG), Mebp, inf_SCR02(0))                                 \
+        movox_st(W(XG), Mebp, inf_SCR02(0))                                 \
+        shlox_ri(W(XG), IB(16))                                             \
+        xorox_ld(W(XG), Mebp, inf_SCR02(0))                                 \
+        movox_st(W(XG), Mebp, inf_SCR02(0))                                 \
+        shrox_ri(W(XG), IB(16))                                             \
+        xorox_ld(W(XG), Mebp, inf_SCR02(0))
+
+/* dph (G = G + S * T) if (#G != #S && #G != #T), 16-bit pairs dot-product
+ * adds two signed 16-bit products to each 32-bit element of G (wrap-around)
+ * dpb (G = G + S * T) if (#G != #S && #G != #T), 8-bit quads dot-product
+ * adds four unsigned 8-bit (S) by signed 8-bit (T) products to each element
+ * targets without native dot-products use inf_SCR01/SCR02 and BASE below */
+
+#if   (RT_SIMD == 256) && !(defined RT_SVEX1) && (defined dphcx_rr)
+
+#define dphox_rr(XG, XS, XT)                                                \
+        dphcx_rr(W(XG), W(XS), W(XT))
+
+#define dphox_ld(XG, XS, MT, DT)                                            \
+        dphcx_ld(W(XG), W(XS), W(MT), W(DT))
+
+#elif (RT_SIMD == 128) && !(defined RT_SVEX1) && (defined dphix_rr)
+
+#define dphox_rr(XG, XS, XT)                                                \
+        dphix_rr(W(XG), W(XS), W(XT))
+
+#define dphox_ld(XG, XS, MT, DT)                                            \
+        dphix_ld(W(XG), W(XS), W(MT), W(DT))
+
+#endif /* RT_SIMD: 256, 128 */
+
+#if   (RT_SIMD == 256) && !(defined RT_SVEX1) && (defined dpbcx_rr)
+
+#define dpbox_rr(XG, XS, XT)                                                \
+        dpbcx_rr(W(XG), W(XS), W(XT))
+
+#define dpbox_ld(XG, XS, MT, DT)                                            \
+        dpbcx_ld(W(XG), W(XS), W(MT), W(DT))
+
+#elif (RT_SIMD == 128) && !(defined RT_SVEX1) && (defined dpbix_rr)
+
+#define dpbox_rr(XG, XS, XT)                                                \
+        dpbix_rr(W(XG), W(XS), W(XT))
+
+#define dpbox_ld(XG, XS, MT, DT)                                            \
+        dpbix_ld(W(XG), W(XS), W(MT), W(DT))
+
+#endif /* RT_SIMD: 256, 128 */
+
+#ifndef dphox_rr
+
+#define dphox_rr(XG, XS, XT)                                                \
+        movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movox_st(W(XT), Mebp, inf_SCR02(0))                                 \
+        dpbox_rs(W(XG), dphox_rx)
+
+#define dphox_ld(XG, XS, MT, DT)                                            \
+        dpbox_rm(W(XG), W(XS), W(MT), W(DT))                                \
+        dpbox_rs(W(XG), dphox_rx)
+
+#endif /* dphox_rr */
+
+#ifndef dpbox_rr
+
+#define dpbox_rr(XG, XS, XT)                                                \
+        movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movox_st(W(XT), Mebp, inf_SCR02(0))                                 \
+        dpbox_rs(W(XG), dpbox_rx)
+
+#define dpbox_ld(XG, XS, MT, DT)                                            \
+        dpbox_rm(W(XG), W(XS), W(MT), W(DT))                                \
+        dpbox_rs(W(XG), dpbox_rx)
+
+#endif /* dpbox_rr */
+
+/* place S to SCR01 and T to SCR02, use XS as temporary for accumulator */
+
+#define dpbox_rm(XG, XS, MT, DT) /* not portable, do not use outside */     \
+        movox_st(W(XG), Mebp, inf_SCR02(0))                                 \
+        movox_ld(W(XG), W(MT), W(DT))                                       \
+        movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movox_ld(W(XS), Mebp, inf_SCR02(0))                                 \
+        movox_st(W(XG), Mebp, inf_SCR02(0))                                 \
+        movox_rr(W(XG), W(XS))                                              \
+        movox_ld(W(XS), Mebp, inf_SCR01(0))
+
+/* apply 32-bit BASE-op "op" to each 32-bit word of SCR01/SCR02, add to G */
+
+#define dpbox_rs(XG, op) /* not portable, do not use outside */             \
+        stack_st(Reax)                                                      \
+        stack_st(Recx)                                                      \
+        cntox_rn(op, 0x00)                                                  \
+        stack_ld(Recx)                                                      \
+        stack_ld(Reax)                                                      \
+        addox_ld(W(XG), Mebp, inf_SCR02(0))
+
+#define dphox_rx(nx) /* not portable, do not use outside */                 \
+        movhn_ld(Reax,  Mebp, inf_SCR01(nx+0x00))                           \
+        mulhn_ld(Reax,  Mebp, inf_SCR02(nx+0x00))                           \
+        movhn_ld(Recx,  Mebp, inf_SCR01(nx+0x02))                           \
+        mulhn_ld(Recx,  Mebp, inf_SCR02(nx+0x02))                           \
+        addwx_rr(Reax,  Recx)                                               \
+        movwx_st(Reax,  Mebp, inf_SCR02(nx))
+
+#define dpbox_rx(nx) /* not portable, do not use outside */                 \
+        movbz_ld(Reax,  Mebp, inf_SCR01(nx+0x00))                           \
+        mulbn_ld(Reax,  Mebp, inf_SCR02(nx+0x00))                           \
+        movbz_ld(Recx,  Mebp, inf_SCR01(nx+0x01))                           \
+        mulbn_ld(Recx,  Mebp, inf_SCR02(nx+0x01))                           \
+        addwx_rr(Reax,  Recx)                                               \
+        movbz_ld(Recx,  Mebp, inf_SCR01(nx+0x02))                           \
+        mulbn_ld(Recx,  Mebp, inf_SCR02(nx+0x02))                           \
+        addwx_rr(Reax,  Recx)                                               \
+        movbz_ld(Recx,  Mebp, inf_SCR01(nx+0x03))                           \
+        mulbn_ld(Recx,  Mebp, inf_SCR02(nx+0x03))                           \
+        addwx_rr(Reax,  Recx)                                               \
+        movwx_st(Reax,  Mebp, inf_SCR02(nx))
+
+/* cvy (D = fp16-to-fp32 S), widens lower half of fp16 elements in S
+ * cvx (D = fp32-to-fp16 S), narrows to lower half of D, upper half is 0
+ * narrowing rounds to nearest-even, _ld/_st access the lower half only
+ * targets without native fp16 converters use bit-exact BASE emulation */
+
+#if   (RT_SIMD == 256) && !(defined RT_SVEX1) && (defined cvyas_rr)
+
+#define cvyms_rr(XD, XS)                                                    \
+        cvyas_rr(W(XD), W(XS))
+
+#define cvyms_ld(XD, MS, DS)                                                \
+        cvyas_ld(W(XD), W(MS), W(DS))
+
+#define cvxos_rr(XD, XS)                                                    \
+        cvxcs_rr(W(XD), W(XS))
+
+#define cvxos_st(XS, MD, DD)                                                \
+        cvxcs_st(W(XS), W(MD), W(DD))
+
+#elif (RT_SIMD == 128) && !(defined RT_SVEX1) && (defined cvygs_rr)
+
+#define cvyms_rr(XD, XS)                                                    \
+        cvygs_rr(W(XD), W(XS))
+
+#define cvyms_ld(XD, MS, DS)                                                \
+        cvygs_ld(W(XD), W(MS), W(DS))
+
+#define cvxos_rr(XD, XS)                                                    \
+        cvxis_rr(W(XD), W(XS))
+
+#define cvxos_st(XS, MD, DD)                                                \
+        cvxis_st(W(XS), W(MD), W(DD))
+
+#endif /* RT_SIMD: 256, 128 */
+
+#ifndef cvyms_rr
+
+#define cvyms_rr(XD, XS)                                                    \
+        movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        cvyms_rs(cvyms_rx)                                                  \
+        movox_ld(W(XD), Mebp, inf_SCR02(0))
+
+#define cvyms_ld(XD, MS, DS)                                                \
+        stack_st(Resi)                                                      \
+        adrxx_ld(Resi,  W(MS), W(DS))                                       \
+        cvyms_rs(cvyms_rm)                                                  \
+        stack_ld(Resi)                                                      \
+        movox_ld(W(XD), Mebp, inf_SCR02(0))
+
+#define cvxos_rr(XD, XS)                                                    \
+        movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        xorox_rr(W(XD), W(XD))                                              \
+        movox_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        cvyms_rs(cvxos_rx)                                                  \
+        movox_ld(W(XD), Mebp, inf_SCR02(0))
+
+#define cvxos_st(XS, MD, DD)                                                \
+        stack_st(Resi)                                                      \
+        adrxx_ld(Resi,  W(MD), W(DD))                                       \
+        movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        xorox_rr(W(XS), W(XS))                                              \
+        movox_st(W(XS), Mebp, inf_SCR02(0))                                 \
+        movox_ld(W(XS), Mebp, inf_SCR01(0))                                 \
+        cvyms_rs(cvxos_rm)                                                  \
+        stack_ld(Resi)
+
+#endif /* cvyms_rr */
+
+/* apply 32-bit BASE-op "op" to each 32-bit word, results are in SCR02 */
+
+#define cvyms_rs(op) /* not portable, do not use outside */                 \
+        stack_st(Reax)                                                      \
+        stack_st(Recx)                                                      \
+        stack_st(Redx)                                                      \
+        cntox_rn(op, 0x00)                                                  \
+        stack_ld(Redx)                                                      \
+        stack_ld(Recx)                                                      \
+        stack_ld(Reax)
+
+#define cvyms_rx(nx) /* not portable, do not use outside */                 \
+        cvyms_rv(nx, Mebp, inf_SCR01((nx)/2))
+
+#define cvyms_rm(nx) /* not portable, do not use outside */                 \
+        cvyms_rv(nx, Mesi, DP((nx)/2))
+
+/* subnormals are normalized with clz, inf/NaN get the max exponent, NaNs
+ * are quieted, zeroes are masked, all without branches in BASE registers */
+
+#define cvyms_rv(nx, MS, DS) /* not portable, do not use outside */         \
+        movhz_ld(Reax,  W(MS), W(DS))                                       \
+        andwx_ri(Reax,  IH(0x7FFF))                                         \
+        clzwx_rr(Recx,  Reax)                                               \
+        subwx_ri(Recx,  IB(21))                                             \
+        movwx_rr(Redx,  Recx)                                               \
+        shrwn_ri(Redx,  IB(31))                                             \
+        notwx_rx(Redx)                                                      \
+        andwx_rr(Recx,  Redx)                                               \
+        shlwx_rx(Reax)                                                      \
+        shlwx_ri(Reax,  IB(13))                                             \
+        shlwx_ri(Recx,  IB(23))                                             \
+        subwx_rr(Reax,  Recx)                                               \
+        addwx_ri(Reax,  IV(0x38000000))                                     \
+        movhz_ld(Recx,  W(MS), W(DS))                                       \
+        andwx_ri(Recx,  IH(0x7FFF))                                         \
+        movwx_rr(Redx,  Recx)                                               \
+        negwx_rx(Redx)                                                      \
+        shrwn_ri(Redx,  IB(31))                                             \
+        andwx_rr(Reax,  Redx)                                               \
+        movwx_ri(Redx,  IH(0x7BFF))                                         \
+        subwx_rr(Redx,  Recx)                                               \
+        shrwn_ri(Redx,  IB(31))                                             \
+        andwx_ri(Redx,  IV(0x38000000))                                     \
+        addwx_rr(Reax,  Redx)                                               \
+        movwx_ri(Redx,  IH(0x7C00))                                         \
+        subwx_rr(Redx,  Recx)                                               \
+        shrwn_ri(Redx,  IB(31))                                             \
+        andwx_ri(Redx,  IV(0x00400000))                                     \
+        orrwx_rr(Reax,  Redx)                                               \
+        movhz_ld(Recx,  W(MS), W(DS))                                       \
+        andwx_ri(Recx,  IH(0x8000))                                         \
+        shlwx_ri(Recx,  IB(16))                                             \
+        orrwx_rr(Reax,  Recx)                                               \
+        movwx_st(Reax,  Mebp, inf_SCR02(nx))
+
+#define cvxos_rx(nx) /* not portable, do not use outside */                 \
+        cvxos_rv(nx)                                                        \
+        orrwx_st(Reax,  Mebp, inf_SCR02(((nx)/8)*4))
+
+#define cvxos_rm(nx) /* not portable, do not use outside */                 \
+        cvxos_rx(nx)                                                        \
+        movwx_ld(Reax,  Mebp, inf_SCR02(((nx)/8)*4))                        \
+        movwx_st(Reax,  Mesi, DP(((nx)/8)*4))
+
+/* below 2^-14 the implicit one is restored and the shift count grows to
+ * denormalize (capped at 31), rounding adds (half - 1) and the lsb of the
+ * result, then inf saturates, NaNs are quieted, two halves share a word */
+
+#define cvxos_rv(nx) /* not portable, do not use outside */                 \
+        movwx_ld(Reax,  Mebp, inf_SCR01(nx))                                \
+        andwx_ri(Reax,  IV(0x7FFFFFFF))                                     \
+        movwx_rr(Recx,  Reax)                                               \
+        shrwx_ri(Recx,  IB(23))                                             \
+        movwx_rr(Redx,  Reax)                                               \
+        subwx_ri(Redx,  IV(0x38800000))                                     \
+        shrwn_ri(Redx,  IB(31))                                             \
+        negwx_rx(Recx)                                                      \
+        addwx_ri(Recx,  IB(113))                                            \
+        andwx_rr(Recx,  Redx)                                               \
+        movwx_rr(Redx,  Recx)                                               \
+        shlwx_ri(Redx,  IB(23))                                             \
+        addwx_rr(Reax,  Redx)                                               \
+        subwx_ri(Reax,  IV(0x38000000))                                     \
+        subwx_ri(Recx,  IB(18))                                             \
+        movwx_rr(Redx,  Recx)                                               \
+        shrwn_ri(Redx,  IB(31))                                             \
+        andwx_rr(Recx,  Redx)                                               \
+        addwx_ri(Recx,  IB(31))                                             \
+        movwx_rr(Redx,  Reax)                                               \
+        shrwx_rx(Redx)                                                      \
+        andwx_ri(Redx,  IB(1))                                              \
+        addwx_rr(Reax,  Redx)                                               \
+        movwx_ri(Redx,  IB(1))                                              \
+        shlwx_rx(Redx)                                                      \
+        shrwx_ri(Redx,  IB(1))                                              \
+        subwx_ri(Redx,  IB(1))                                              \
+        addwx_rr(Reax,  Redx)                                               \
+        shrwx_rx(Reax)                                                      \
+        subwx_ri(Reax,  IH(0x7C00))                                         \
+        movwx_rr(Redx,  Reax)                                               \
+        shrwn_ri(Redx,  IB(31))                                             \
+        andwx_rr(Reax,  Redx)                                               \
+        addwx_ri(Reax,  IH(0x7C00))                                         \
+        movwx_ld(Recx,  Mebp, inf_SCR01(nx))                                \
+        andwx_ri(Recx,  IV(0x7FFFFFFF))                                     \
+        movwx_ri(Redx,  IV(0x7F800000))                                     \
+        subwx_rr(Redx,  Recx)                                               \
+        shrwn_ri(Redx,  IB(31))                                             \
+        shrwx_ri(Recx,  IB(13))                                             \
+        andwx_ri(Recx,  IH(0x03FF))                                         \
+        orrwx_ri(Recx,  IH(0x0200))                                         \
+        andwx_rr(Recx,  Redx)                                               \
+        orrwx_rr(Reax,  Recx)                                               \
+        movwx_ld(Recx,  Mebp, inf_SCR01(nx))                                \
+        shrwx_ri(Recx,  IB(16))                                             \
+        andwx_ri(Recx,  IH(0x8000))                                         \
+        orrwx_rr(Reax,  Recx)                                               \
+        shlwx_ri(Reax,  IB((((nx)&4)^(RT_ENDIAN*4))*4))
+
+/* cvy (D = S), zero-[x] or sign-[n] extends lower half of 16-bit elements
+ * cvu (D = S), zero-[x] or sign-[n] extends upper half of 16-bit elements
+ * cvx (D = S), narrows signed 32-bit elements to lower half of D, upper is 0
+ * with unsigned-[x] or signed-[n] saturation into 16-bit elements
+ * targets without native pack/unpack use inf_SCR01/SCR02 and BASE-ops below */
+
+#if   (RT_SIMD == 256) && !(defined RT_SVEX1) && (defined cvyax_rr)
+
+#define cvymx_rr(XD, XS)                                                    \
+        cvyax_rr(W(XD), W(XS))
+
+#define cvymn_rr(XD, XS)                                                    \
+        cvyan_rr(W(XD), W(XS))
+
+#define cvumx_rr(XD, XS)                                                    \
+        cvuax_rr(W(XD), W(XS))
+
+#define cvumn_rr(XD, XS)                                                    \
+        cvuan_rr(W(XD), W(XS))
+
+#define cvxox_rr(XD, XS)                                                    \
+        cvxcx_rr(W(XD), W(XS))
+
+#define cvxon_rr(XD, XS)                                                    \
+        cvxcn_rr(W(XD), W(XS))
+
+#elif (RT_SIMD == 128) && !(defined RT_SVEX1) && (defined cvygx_rr)
+
+#define cvymx_rr(XD, XS)                                                    \
+        cvygx_rr(W(XD), W(XS))
+
+#define cvymn_rr(XD, XS)                                                    \
+        cvygn_rr(W(XD), W(XS))
+
+#define cvumx_rr(XD, XS)                                                    \
+        cvugx_rr(W(XD), W(XS))
+
+#define cvumn_rr(XD, XS)                                                    \
+        cvugn_rr(W(XD), W(XS))
+
+#define cvxox_rr(XD, XS)                                                    \
+        cvxix_rr(W(XD), W(XS))
+
+#define cvxon_rr(XD, XS)                                                    \
+        cvxin_rr(W(XD), W(XS))
+
+#endif /* RT_SIMD: 256, 128 */
+
+#ifndef cvymx_rr
+
+#define cvymx_rr(XD, XS)                                                    \
+        movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        cvyms_rs(cvymx_rx)                                                  \
+        movox_ld(W(XD), Mebp, inf_SCR02(0))
+
+#define cvymn_rr(XD, XS)                                                    \
+        movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        cvyms_rs(cvymn_rx)                                                  \
+        movox_ld(W(XD), Mebp, inf_SCR02(0))
+
+#define cvumx_rr(XD, XS)                                                    \
+        movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        cvyms_rs(cvumx_rx)                                                  \
+        movox_ld(W(XD), Mebp, inf_SCR02(0))
+
+#define cvumn_rr(XD, XS)                                                    \
+        movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        cvyms_rs(cvumn_rx)                                                  \
+        movox_ld(W(XD), Mebp, inf_SCR02(0))
+
+#define cvxox_rr(XD, XS)                                                    \
+        movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        xorox_rr(W(XD), W(XD))                                              \
+        movox_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        cvyms_rs(cvxox_rx)                                                  \
+        movox_ld(W(XD), Mebp, inf_SCR02(0))
+
+#define cvxon_rr(XD, XS)                                                    \
+        movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        xorox_rr(W(XD), W(XD))                                              \
+        movox_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        cvyms_rs(cvxon_rx)                                                  \
+        movox_ld(W(XD), Mebp, inf_SCR02(0))
+
+#endif /* cvymx_rr */
+
+/* cvy (D = S), zero-[b] or sign-[c] extends lower half of 8-bit elements
+ * cvu (D = S), zero-[b] or sign-[c] extends upper half of 8-bit elements
+ * cvx (D = S), narrows signed 16-bit elements to lower half of D, upper is 0
+ * with unsigned-[x] or signed-[n] saturation into 8-bit elements */
+
+#if   (RT_SIMD == 256) && !(defined RT_SVEX1) && (defined cvyab_rr)
+
+#define cvymb_rr(XD, XS)                                                    \
+        cvyab_rr(W(XD), W(XS))
+
+#define cvymc_rr(XD, XS)                                                    \
+        cvyac_rr(W(XD), W(XS))
+
+#define cvumb_rr(XD, XS)                                                    \
+        cvuab_rr(W(XD), W(XS))
+
+#define cvumc_rr(XD, XS)                                                    \
+        cvuac_rr(W(XD), W(XS))
+
+#define cvxmx_rr(XD, XS)                                                    \
+        cvxax_rr(W(XD), W(XS))
+
+#define cvxmn_rr(XD, XS)                                                    \
+        cvxan_rr(W(XD), W(XS))
+
+#elif (RT_SIMD == 128) && !(defined RT_SVEX1) && (defined cvygb_rr)
+
+#define cvymb_rr(XD, XS)                                                    \
+        cvygb_rr(W(XD), W(XS))
+
+#define cvymc_rr(XD, XS)                                                    \
+        cvygc_rr(W(XD), W(XS))
+
+#define cvumb_rr(XD, XS)                                                    \
+        cvugb_rr(W(XD), W(XS))
+
+#define cvumc_rr(XD, XS)                                                    \
+        cvugc_rr(W(XD), W(XS))
+
+#define cvxmx_rr(XD, XS)                                                    \
+        cvxgx_rr(W(XD), W(XS))
+
+#define cvxmn_rr(XD, XS)                                                    \
+        cvxgn_rr(W(XD), W(XS))
+
+#endif /* RT_SIMD: 256, 128 */
+
+#ifndef cvymb_rr
+
+#define cvymb_rr(XD, XS)                                                    \
+        movmx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        cvyms_rs(cvymb_rx)                                                  \
+        movmx_ld(W(XD), Mebp, inf_SCR02(0))
+
+#define cvymc_rr(XD, XS)                                                    \
+        movmx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        cvyms_rs(cvymc_rx)                                                  \
+        movmx_ld(W(XD), Mebp, inf_SCR02(0))
+
+#define cvumb_rr(XD, XS)                                                    \
+        movmx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        cvyms_rs(cvumb_rx)                                                  \
+        movmx_ld(W(XD), Mebp, inf_SCR02(0))
+
+#define cvumc_rr(XD, XS)                                                    \
+        movmx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        cvyms_rs(cvumc_rx)                                                  \
+        movmx_ld(W(XD), Mebp, inf_SCR02(0))
+
+#define cvxmx_rr(XD, XS)                                                    \
+        movmx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        xormx_rr(W(XD), W(XD))                                              \
+        movmx_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        cvyms_rs(cvxmx_rx)                                                  \
+        movmx_ld(W(XD), Mebp, inf_SCR02(0))
+
+#define cvxmn_rr(XD, XS)                                                    \
+        movmx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        xormx_rr(W(XD), W(XD))                                              \
+        movmx_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        cvyms_rs(cvxmn_rx)                                                  \
+        movmx_ld(W(XD), Mebp, inf_SCR02(0))
+
+#endif /* cvymb_rr */
+
+/* elements are moved one by one within SCR01/SCR02 in memory order,
+ * so the same sequences work regardless of RT_ENDIAN */
+
+#define cvymx_rx(nx) /* not portable, do not use outside */                 \
+        movhz_ld(Reax,  Mebp, inf_SCR01((nx)/2))                            \
+        movwx_st(Reax,  Mebp, inf_SCR02(nx))
+
+#define cvymn_rx(nx) /* not portable, do not use outside */                 \
+        movhn_ld(Reax,  Mebp, inf_SCR01((nx)/2))                            \
+        movwx_st(Reax,  Mebp, inf_SCR02(nx))
+
+#define cvumx_rx(nx) /* not portable, do not use outside */                 \
+        movhz_ld(Reax,  Mebp, inf_SCR01((nx)/2+Q*0x08))                     \
+        movwx_st(Reax,  Mebp, inf_SCR02(nx))
+
+#define cvumn_rx(nx) /* not portable, do not use outside */                 \
+        movhn_ld(Reax,  Mebp, inf_SCR01((nx)/2+Q*0x08))                     \
+        movwx_st(Reax,  Mebp, inf_SCR02(nx))
+
+#define cvymb_rx(nx) /* not portable, do not use outside */                 \
+        movbz_ld(Reax,  Mebp, inf_SCR01((nx)/2+0x00))                       \
+        movhx_st(Reax,  Mebp, inf_SCR02((nx)+0x00))                         \
+        movbz_ld(Reax,  Mebp, inf_SCR01((nx)/2+0x01))                       \
+        movhx_st(Reax,  Mebp, inf_SCR02((nx)+0x02))
+
+#define cvymc_rx(nx) /* not portable, do not use outside */                 \
+        movbn_ld(Reax,  Mebp, inf_SCR01((nx)/2+0x00))                       \
+        movhx_st(Reax,  Mebp, inf_SCR02((nx)+0x00))                         \
+        movbn_ld(Reax,  Mebp, inf_SCR01((nx)/2+0x01))                       \
+        movhx_st(Reax,  Mebp, inf_SCR02((nx)+0x02))
+
+#define cvumb_rx(nx) /* not portable, do not use outside */                 \
+        movbz_ld(Reax,  Mebp, inf_SCR01((nx)/2+Q*0x08+0x00))                \
+        movhx_st(Reax,  Mebp, inf_SCR02((nx)+0x00))                         \
+        movbz_ld(Reax,  Mebp, inf_SCR01((nx)/2+Q*0x08+0x01))                \
+        movhx_st(Reax,  Mebp, inf_SCR02((nx)+0x02))
+
+#define cvumc_rx(nx) /* not portable, do not use outside */                 \
+        movbn_ld(Reax,  Mebp, inf_SCR01((nx)/2+Q*0x08+0x00))                \
+        movhx_st(Reax,  Mebp, inf_SCR02((nx)+0x00))                         \
+        movbn_ld(Reax,  Mebp, inf_SCR01((nx)/2+Q*0x08+0x01))                \
+        movhx_st(Reax,  Mebp, inf_SCR02((nx)+0x02))
+
+#define cvxox_rx(nx) /* not portable, do not use outside */                 \
+        movwx_ld(Reax,  Mebp, inf_SCR01(nx))                                \
+        movwx_rr(Recx,  Reax)                                               \
+        shrwx_ri(Recx,  IB(16))                                             \
+        cvxox_rc(IH(0xFFFF))                                                \
+        movhx_st(Reax,  Mebp, inf_SCR02((nx)/2))
+
+#define cvxon_rx(nx) /* not portable, do not use outside */                 \
+        movwx_ld(Reax,  Mebp, inf_SCR01(nx))                                \
+        movwx_rr(Recx,  Reax)                                               \
+        addwx_ri(Recx,  IH(0x8000))                                         \
+        shrwx_ri(Recx,  IB(16))                                             \
+        cvxox_rc(IH(0x7FFF))                                                \
+        movhx_st(Reax,  Mebp, inf_SCR02((nx)/2))
+
+#define cvxmx_rx(nx) /* not portable, do not use outside */                 \
+        cvxmx_rv(nx+0x00)                                                   \
+        cvxmx_rv(nx+0x02)
+
+#define cvxmn_rx(nx) /* not portable, do not use outside */                 \
+        cvxmn_rv(nx+0x00)                                                   \
+        cvxmn_rv(nx+0x02)
+
+#define cvxmx_rv(nx) /* not portable, do not use outside */                 \
+        movhn_ld(Reax,  Mebp, inf_SCR01(nx))                                \
+        movwx_rr(Recx,  Reax)                                               \
+        shrwx_ri(Recx,  IB(8))                                              \
+        cvxox_rc(IB(0xFF))                                                  \
+        movbx_st(Reax,  Mebp, inf_SCR02((nx)/2))
+
+#define cvxmn_rv(nx) /* not portable, do not use outside */                 \
+        movhn_ld(Reax,  Mebp, inf_SCR01(nx))                                \
+        movwx_rr(Recx,  Reax)                                               \
+        addwx_ri(Recx,  IB(0x80))                                           \
+        shrwx_ri(Recx,  IB(8))                                              \
+        cvxox_rc(IB(0x7F))                                                  \
+        movbx_st(Reax,  Mebp, inf_SCR02((nx)/2))
+
+/* Recx holds the biased value shifted right by the target width, non-zero
+ * if out of range, then Reax is replaced by the saturation value built from
+ * its sign (xor-ed with the max value "is") without branches */
+
+#define cvxox_rc(is) /* not portable, do not use outside */                 \
+        negwx_rx(Recx)                                                      \
+        shrwn_ri(Recx,  IB(31))                                             \
+        movwx_rr(Redx,  Reax)                                               \
+        shrwn_ri(Redx,  IB(31))                                             \
+        xorwx_ri(Redx,  W(is))                                              \
+        xorwx_rr(Redx,  Reax)                                               \
+        andwx_rr(Redx,  Recx)                                               \
+        xorwx_rr(Reax,  Redx)
+
+/* muh (G = G * S), keeps upper half of the full-width product of 16-bit
+ * elements, unsigned-[x] or signed-[n], lower half is returned by mul
+ * targets without native mul-high use inf_SCR01/SCR02 and BASE-ops below */
+
+#if   (RT_SIMD == 256) && !(defined RT_SVEX1) && (defined muhax_rr)
+
+#define muhmx_rr(XG, XS)                                                    \
+        muhax_rr(W(XG), W(XS))
+
+#define muhmx_ld(XG, MS, DS)                                                \
+        muhax_ld(W(XG), W(MS), W(DS))
+
+#define muhmn_rr(XG, XS)                                                    \
+        muhan_rr(W(XG), W(XS))
+
+#define muhmn_ld(XG, MS, DS)                                                \
+        muhan_ld(W(XG), W(MS), W(DS))
+
+#elif (RT_SIMD == 128) && !(defined RT_SVEX1) && (defined muhgx_rr)
+
+#define muhmx_rr(XG, XS)                                                    \
+        muhgx_rr(W(XG), W(XS))
+
+#define muhmx_ld(XG, MS, DS)                                                \
+        muhgx_ld(W(XG), W(MS), W(DS))
+
+#define muhmn_rr(XG, XS)                                                    \
+        muhgn_rr(W(XG), W(XS))
+
+#define muhmn_ld(XG, MS, DS)                                                \
+        muhgn_ld(W(XG), W(MS), W(DS))
+
+#endif /* RT_SIMD: 256, 128 */
+
+#ifndef muhmx_rr
+
+#define muhmx_rr(XG, XS)                                                    \
+        movmx_st(W(XG), Mebp, inf_SCR01(0))                                 \
+        movmx_st(W(XS), Mebp, inf_SCR02(0))                                 \
+        cvyms_rs(muhmx_rx)                                                  \
+        movmx_ld(W(XG), Mebp, inf_SCR02(0))
+
+#define muhmx_ld(XG, MS, DS)                                                \
+        movmx_st(W(XG), Mebp, inf_SCR01(0))                                 \
+        movmx_ld(W(XG), W(MS), W(DS))                                       \
+        movmx_st(W(XG), Mebp, inf_SCR02(0))                                 \
+        cvyms_rs(muhmx_rx)                                                  \
+        movmx_ld(W(XG), Mebp, inf_SCR02(0))
+
+#define muhmn_rr(XG, XS)                                                    \
+        movmx_st(W(XG), Mebp, inf_SCR01(0))                                 \
+        movmx_st(W(XS), Mebp, inf_SCR02(0))                                 \
+        cvyms_rs(muhmn_rx)                                                  \
+        movmx_ld(W(XG), Mebp, inf_SCR02(0))
+
+#define muhmn_ld(XG, MS, DS)                                                \
+        movmx_st(W(XG), Mebp, inf_SCR01(0))                                 \
+        movmx_ld(W(XG), W(MS), W(DS))                                       \
+        movmx_st(W(XG), Mebp, inf_SCR02(0))                                 \
+        cvyms_rs(muhmn_rx)                                                  \
+        movmx_ld(W(XG), Mebp, inf_SCR02(0))
+
+#endif /* muhmx_rr */
+
+/* muh (G = G * S), keeps upper half of the full-width product of 32-bit
+ * elements, unsigned-[x] or signed-[n], lower half is returned by mul
+ * targets without native mul-high use inf_SCR01/SCR02 and BASE-ops below */
+
+#if   (RT_SIMD == 256) && !(defined RT_SVEX1) && (defined muhcx_rr)
+
+#define muhox_rr(XG, XS)                                                    \
+        muhcx_rr(W(XG), W(XS))
+
+#define muhox_ld(XG, MS, DS)                                                \
+        muhcx_ld(W(XG), W(MS), W(DS))
+
+#define muhon_rr(XG, XS)                                                    \
+        muhcn_rr(W(XG), W(XS))
+
+#define muhon_ld(XG, MS, DS)                                                \
+        muhcn_ld(W(XG), W(MS), W(DS))
+
+#elif (RT_SIMD == 128) && !(defined RT_SVEX1) && (defined muhix_rr)
+
+#define muhox_rr(XG, XS)                                                    \
+        muhix_rr(W(XG), W(XS))
+
+#define muhox_ld(XG, MS, DS)                                                \
+        muhix_ld(W(XG), W(MS), W(DS))
+
+#define muhon_rr(XG, XS)                                                    \
+        muhin_rr(W(XG), W(XS))
+
+#define muhon_ld(XG, MS, DS)                                                \
+        muhin_ld(W(XG), W(MS), W(DS))
+
+#endif /* RT_SIMD: 256, 128 */
+
+#ifndef muhox_rr
+
+#define muhox_rr(XG, XS)                                                    \
+        movox_st(W(XG), Mebp, inf_SCR01(0))                                 \
+        movox_st(W(XS), Mebp, inf_SCR02(0))                                 \
+        cvyms_rs(muhox_rx)                                                  \
+        movox_ld(W(XG), Mebp, inf_SCR02(0))
+
+#define muhox_ld(XG, MS, DS)                                                \
+        movox_st(W(XG), Mebp, inf_SCR01(0))                                 \
+        movox_ld(W(XG), W(MS), W(DS))                                       \
+        movox_st(W(XG), Mebp, inf_SCR02(0))                                 \
+        cvyms_rs(muhox_rx)                                                  \
+        movox_ld(W(XG), Mebp, inf_SCR02(0))
+
+#define muhon_rr(XG, XS)                                                    \
+        movox_st(W(XG), Mebp, inf_SCR01(0))                                 \
+        movox_st(W(XS), Mebp, inf_SCR02(0))                                 \
+        cvyms_rs(muhon_rx)                                                  \
+        movox_ld(W(XG), Mebp, inf_SCR02(0))
+
+#define muhon_ld(XG, MS, DS)                                                \
+        movox_st(W(XG), Mebp, inf_SCR01(0))                                 \
+        movox_ld(W(XG), W(MS), W(DS))                                       \
+        movox_st(W(XG), Mebp, inf_SCR02(0))                                 \
+        cvyms_rs(muhon_rx)                                                  \
+        movox_ld(W(XG), Mebp, inf_SCR02(0))
+
+#endif /* muhox_rr */
+
+/* 16-bit products fit into 32-bit BASE registers regardless of the sign,
+ * 32-bit products use the double-width BASE multiply with Redx:Reax */
+
+#define muhmx_rx(nx) /* not portable, do not use outside */                 \
+        movhz_ld(Reax,  Mebp, inf_SCR01(nx+0x00))                           \
+        mulhz_ld(Reax,  Mebp, inf_SCR02(nx+0x00))                           \
+        shrwx_ri(Reax,  IB(16))                                             \
+        movhx_st(Reax,  Mebp, inf_SCR02(nx+0x00))                           \
+        movhz_ld(Reax,  Mebp, inf_SCR01(nx+0x02))                           \
+        mulhz_ld(Reax,  Mebp, inf_SCR02(nx+0x02))                           \
+        shrwx_ri(Reax,  IB(16))                                             \
+        movhx_st(Reax,  Mebp, inf_SCR02(nx+0x02))
+
+#define muhmn_rx(nx) /* not portable, do not use outside */                 \
+        movhn_ld(Reax,  Mebp, inf_SCR01(nx+0x00))                           \
+        mulhn_ld(Reax,  Mebp, inf_SCR02(nx+0x00))                           \
+        shrwx_ri(Reax,  IB(16))                                             \
+        movhx_st(Reax,  Mebp, inf_SCR02(nx+0x00))                           \
+        movhn_ld(Reax,  Mebp, inf_SCR01(nx+0x02))                           \
+        mulhn_ld(Reax,  Mebp, inf_SCR02(nx+0x02))                           \
+        shrwx_ri(Reax,  IB(16))                                             \
+        movhx_st(Reax,  Mebp, inf_SCR02(nx+0x02))
+
+#define muhox_rx(nx) /* not portable, do not use outside */                 \
+        movwx_ld(Reax,  Mebp, inf_SCR01(nx))                                \
+        mulwx_xm(Mebp,  inf_SCR02(nx))                                      \
+        movwx_st(Redx,  Mebp, inf_SCR02(nx))
+
+#define muhon_rx(nx) /* not portable, do not use outside */                 \
+        movwx_ld(Reax,  Mebp, inf_SCR01(nx))                                \
+        mulwn_xm(Mebp,  inf_SCR02(nx))                                      \
+        movwx_st(Redx,  Mebp, inf_SCR02(nx))
+
+/******************************************************************************/
+/**** var-len **** (bcs/gat/sct/mtl/shf/tbl/scn) with fixed-64-bit element ****/
+/******************************************************************************/
+
+/* bcs (D = [M]) broadcast scalar element from memory into all SIMD elements
+ * bcs (D = S) broadcast 64-bit BASE register S into all SIMD elements
+ * targets without native broadcasts use inf_SCR01/SCR02 and BASE-moves below */
+
+#if   (RT_SIMD == 256) && !(defined RT_SVEX1) && (defined bcsdx_ld)
+
+#define bcsqx_ld(XD, MS, DS)                                                \
+        bcsdx_ld(W(XD), W(MS), W(DS))
+
+#elif (RT_SIMD == 128) && !(defined RT_SVEX1) && (defined bcsjx_ld)
+
+#define bcsqx_ld(XD, MS, DS)                                                \
+        bcsjx_ld(W(XD), W(MS), W(DS))
+
+#endif /* RT_SIMD: 256, 128 */
+
+#ifndef bcsqx_ld
+
+#define bcsqx_ld(XD, MS, DS)                                                \
+        stack_st(Recx)                                                      \
+        adrxx_ld(Recx,  W(MS), W(DS))                                       \
+        stack_st(Reax)                                                      \
+        movwx_ld(Reax,  Mecx, DP(0x00))                                     \
+        movwx_ld(Recx,  Mecx, DP(0x04))                                     \
+        bcsqx_rn(0x00)                                                      \
+        stack_ld(Reax)                                                      \
+        stack_ld(Recx)                                                      \
+        movqx_ld(W(XD), Mebp, inf_SCR01(0))
+
+#define bcsqx_rx(nx) /* not portable, do not use outside */                 \
+        movwx_st(Reax,  Mebp, inf_SCR01(nx+0x00))                           \
+        movwx_st(Recx,  Mebp, inf_SCR01(nx+0x04))
+
+#define bcsqx_r1(nx) /* not portable, do not use outside */                 \
+        bcsqx_rx(nx+0x00)                                                   \
+        bcsqx_rx(nx+0x08)
+
+#define bcsqx_r2(nx) /* not portable, do not use outside */                 \
+        bcsqx_r1(nx+0x00)                                                   \
+        bcsqx_r1(nx+0x10)
+
+#define bcsqx_r4(nx) /* not portable, do not use outside */                 \
+        bcsqx_r2(nx+0x00)                                                   \
+        bcsqx_r2(nx+0x20)
+
+#define bcsqx_r8(nx) /* not portable, do not use outside */                 \
+        bcsqx_r4(nx+0x00)                                                   \
+        bcsqx_r4(nx+0x40)
+
+#define bcsqx_rG(nx) /* not portable, do not use outside */                 \
+        bcsqx_r8(nx+0x00)                                                   \
+        bcsqx_r8(nx+0x80)
+
+#if   (RT_SIMD == 2048)
+#define bcsqx_rn(nx)        bcsqx_rG(nx)
+#elif (RT_SIMD == 1024)
+#define bcsqx_rn(nx)        bcsqx_r8(nx)
+#elif (RT_SIMD == 512)
+#define bcsqx_rn(nx)        bcsqx_r4(nx)
+#elif (RT_SIMD == 256)
+#define bcsqx_rn(nx)        bcsqx_r2(nx)
+#elif (RT_SIMD == 128)
+#define bcsqx_rn(nx)        bcsqx_r1(nx)
+#endif /* RT_SIMD: 2048, 1024, 512, 256, 128 */
+
+#endif /* bcsqx_ld */
+
+#ifndef bcsqx_rr
+
+#define bcsqx_rr(XD, RS)                                                    \
+        movzx_st(W(RS), Mebp, inf_SCR02(0))                                 \
+        bcsqx_ld(W(XD), Mebp, inf_SCR02(0))
+
+#endif /* bcsqx_rr */
+
+/* gat (D = [M + S]) gather elements at per-lane indices S from M/DS,
+ * indices are 64-bit in elements (only RT_ADDRESS bits are used when 32),
+ * M*** or Oeax, but not indexed modes (I***, ...), XD/XS differ,
+ * SIMD registers other than XD are preserved (masks are internal)
+ * targets without native gathers use inf_SCR01/SCR02 and BASE-loads below */
+
+#if   (RT_SIMD == 256) && !(defined RT_SVEX1) && (defined gatdx_ld)
+
+#define gatqx_ld(XD, XS, MS, DS)                                            \
+        gatdx_ld(W(XD), W(XS), W(MS), W(DS))
+
+#endif /* RT_SIMD: 256 */
+
+#ifndef gatqx_ld
+
+#define gatqx_ld(XD, XS, MS, DS)                                            \
+        movqx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        stack_st(Recx)                                                      \
+        adrxx_ld(Recx,  W(MS), W(DS))                                       \
+        stack_st(Reax)                                                      \
+        stack_st(Redx)                                                      \
+        gatqx_rn(0x00)                                                      \
+        stack_ld(Redx)                                                      \
+        stack_ld(Reax)                                                      \
+        stack_ld(Recx)                                                      \
+        movqx_ld(W(XD), Mebp, inf_SCR02(0))
+
+#define gatqx_rx(nx) /* not portable, do not use outside */                 \
+        movxx_ld(Reax,  Mebp, inf_SCR01(nx+C))                              \
+        movwx_ld(Redx,  Lecx, DP(0x00))                                     \
+        movwx_st(Redx,  Mebp, inf_SCR02(nx+0x00))                           \
+        movwx_ld(Redx,  Lecx, DP(0x04))                                     \
+        movwx_st(Redx,  Mebp, inf_SCR02(nx+0x04))
+
+#define gatqx_r1(nx) /* not portable, do not use outside */                 \
+        gatqx_rx(nx+0x00)                                                   \
+        gatqx_rx(nx+0x08)
+
+#define gatqx_r2(nx) /* not portable, do not use outside */                 \
+        gatqx_r1(nx+0x00)                                                   \
+        gatqx_r1(nx+0x10)
+
+#define gatqx_r4(nx) /* not portable, do not use outside */                 \
+        gatqx_r2(nx+0x00)                                                   \
+        gatqx_r2(nx+0x20)
+
+#define gatqx_r8(nx) /* not portable, do not use outside */                 \
+        gatqx_r4(nx+0x00)                                                   \
+        gatqx_r4(nx+0x40)
+
+#define gatqx_rG(nx) /* not portable, do not use outside */                 \
+        gatqx_r8(nx+0x00)                                                   \
+        gatqx_r8(nx+0x80)
+
+#if   (RT_SIMD == 2048)
+#define gatqx_rn(nx)        gatqx_rG(nx)
+#elif (RT_SIMD == 1024)
+#define gatqx_rn(nx)        gatqx_r8(nx)
+#elif (RT_SIMD == 512)
+#define gatqx_rn(nx)        gatqx_r4(nx)
+#elif (RT_SIMD == 256)
+#define gatqx_rn(nx)        gatqx_r2(nx)
+#elif (RT_SIMD == 128)
+#define gatqx_rn(nx)        gatqx_r1(nx)
+#endif /* RT_SIMD: 2048, 1024, 512, 256, 128 */
+
+#endif /* gatqx_ld */
+
+/* sct (M + T = S) scatter elements of S to per-lane indices T at M/DD,
+ * indices are 64-bit in elements (only RT_ADDRESS bits are used when 32),
+ * M*** or Oeax, but not indexed modes (I***, ...),
+ * colliding indices are written in lane order (the highest lane wins)
+ * targets without native scatters use inf_SCR01/SCR02 and BASE-stores below */
+
+#ifndef sctqx_st
+
+#define sctqx_st(XS, XT, MD, DD)                                            \
+        movqx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movqx_st(W(XT), Mebp, inf_SCR02(0))                                 \
+        stack_st(Recx)                                                      \
+        adrxx_ld(Recx,  W(MD), W(DD))                                       \
+        stack_st(Reax)                                                      \
+        stack_st(Redx)                                                      \
+        sctqx_rn(0x00)                                                      \
+        stack_ld(Redx)                                                      \
+        stack_ld(Reax)                                                      \
+        stack_ld(Recx)
+
+#define sctqx_rx(nx) /* not portable, do not use outside */                 \
+        movxx_ld(Reax,  Mebp, inf_SCR02(nx+C))                              \
+        movwx_ld(Redx,  Mebp, inf_SCR01(nx+0x00))                           \
+        movwx_st(Redx,  Lecx, DP(0x00))                                     \
+        movwx_ld(Redx,  Mebp, inf_SCR01(nx+0x04))                           \
+        movwx_st(Redx,  Lecx, DP(0x04))
+
+#define sctqx_r1(nx) /* not portable, do not use outside */                 \
+        sctqx_rx(nx+0x00)                                                   \
+        sctqx_rx(nx+0x08)
+
+#define sctqx_r2(nx) /* not portable, do not use outside */                 \
+        sctqx_r1(nx+0x00)                                                   \
+        sctqx_r1(nx+0x10)
+
+#define sctqx_r4(nx) /* not portable, do not use outside */                 \
+        sctqx_r2(nx+0x00)                                                   \
+        sctqx_r2(nx+0x20)
+
+#define sctqx_r8(nx) /* not portable, do not use outside */                 \
+        sctqx_r4(nx+0x00)                                                   \
+        sctqx_r4(nx+0x40)
+
+#define sctqx_rG(nx) /* not portable, do not use outside */                 \
+        sctqx_r8(nx+0x00)                                                   \
+        sctqx_r8(nx+0x80)
+
+#if   (RT_SIMD == 2048)
+#define sctqx_rn(nx)        sctqx_rG(nx)
+#elif (RT_SIMD == 1024)
+#define sctqx_rn(nx)        sctqx_r8(nx)
+#elif (RT_SIMD == 512)
+#define sctqx_rn(nx)        sctqx_r4(nx)
+#elif (RT_SIMD == 256)
+#define sctqx_rn(nx)        sctqx_r2(nx)
+#elif (RT_SIMD == 128)
+#define sctqx_rn(nx)        sctqx_r1(nx)
+#endif /* RT_SIMD: 2048, 1024, 512, 256, 128 */
+
+#endif /* sctqx_st */
+
+/* mtl (D = S) move the first RS lanes only (loop tails), 0 <= RS <= S
+ * load zeroes the remaining lanes of XD, store keeps memory past RS lanes,
+ * memory past RS lanes is never accessed, RS holds the count as cmdw value,
+ * uses Xmm0 implicitly as a temp mask register, destroys Xmm0, XD/XS != Xmm0
+ * targets without native masking use inf_SCR01/SCR02 and BASE-moves below,
+ * which pick per lane either the given address or the scratchpad itself */
+
+#if   (RT_SIMD == 256) && !(defined RT_SVEX1) && (defined mtldx_ld)
+
+#define mtlqx_ld(XD, RS, MS, DS)                                            \
+        mtldx_ld(W(XD), W(RS), W(MS), W(DS))
+
+#define mtlqx_st(XS, RS, MD, DD)                                            \
+        mtldx_st(W(XS), W(RS), W(MD), W(DD))
+
+#endif /* RT_SIMD: 256 */
+
+#ifndef mtlqx_ld
+
+#define mtlqx_ld(XD, RS, MS, DS)                                            \
+        xorqx_rr(W(XD), W(XD))                                              \
+        movqx_st(W(XD), Mebp, inf_SCR01(0))                                 \
+        mtlqx_rb(W(RS), W(MS), W(DS))                                       \
+        mtlqx_rn(mtlqx_rl, 0x00)                                            \
+        stack_ld(Rebx)                                                      \
+        stack_ld(Reax)                                                      \
+        stack_ld(Recx)                                                      \
+        stack_ld(Redx)                                                      \
+        movqx_ld(W(XD), Mebp, inf_SCR01(0))
+
+#define mtlqx_st(XS, RS, MD, DD)                                            \
+        movqx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        mtlqx_rb(W(RS), W(MD), W(DD))                                       \
+        mtlqx_rn(mtlqx_rs, 0x00)                                            \
+        stack_ld(Rebx)                                                      \
+        stack_ld(Reax)                                                      \
+        stack_ld(Recx)                                                      \
+        stack_ld(Redx)
+
+#define mtlqx_rb(RS, MS, DS) /* not portable, do not use outside */         \
+        movxx_st(W(RS), Mebp, inf_SCR02(0))                                 \
+        stack_st(Redx)                                                      \
+        adrxx_ld(Redx,  W(MS), W(DS))                                       \
+        stack_st(Recx)                                                      \
+        adrxx_ld(Recx,  Mebp, inf_SCR01(0))                                 \
+        subxx_rr(Redx,  Recx)                                               \
+        stack_st(Reax)                                                      \
+        stack_st(Rebx)
+
+#define mtlqx_rx(nx) /* not portable, do not use outside */                 \
+        movxx_ri(Reax,  IB((nx)/8))                                         \
+        subxx_ld(Reax,  Mebp, inf_SCR02(0))                                 \
+        shrxn_ri(Reax,  IB(A*32-1))                                         \
+        andxx_rr(Reax,  Redx)                                               \
+        addxx_rr(Reax,  Recx)
+
+#define mtlqx_rl(nx) /* not portable, do not use outside */                 \
+        mtlqx_rx(nx)                                                        \
+        movwx_ld(Rebx,  Oeax, PLAIN)                                        \
+        movwx_st(Rebx,  Mebp, inf_SCR01(nx+0x00))                           \
+        addxx_ri(Reax,  IB(4))                                              \
+        movwx_ld(Rebx,  Oeax, PLAIN)                                        \
+        movwx_st(Rebx,  Mebp, inf_SCR01(nx+0x04))                           \
+        addxx_ri(Recx,  IB(8))
+
+#define mtlqx_rs(nx) /* not portable, do not use outside */                 \
+        mtlqx_rx(nx)                                                        \
+        movwx_ld(Rebx,  Mebp, inf_SCR01(nx+0x00))                           \
+        movwx_st(Rebx,  Oeax, PLAIN)                                        \
+        addxx_ri(Reax,  IB(4))                                              \
+        movwx_ld(Rebx,  Mebp, inf_SCR01(nx+0x04))                           \
+        movwx_st(Rebx,  Oeax, PLAIN)                                        \
+        addxx_ri(Recx,  IB(8))
+
+#define mtlqx_r1(op, nx) /* not portable, do not use outside */             \
+        op(nx+0x00)                                                         \
+        op(nx+0x08)
+
+#define mtlqx_r2(op, nx) /* not portable, do not use outside */             \
+        mtlqx_r1(op, nx+0x00)                                               \
+        mtlqx_r1(op, nx+0x10)
+
+#define mtlqx_r4(op, nx) /* not portable, do not use outside */             \
+        mtlqx_r2(op, nx+0x00)                                               \
+        mtlqx_r2(op, nx+0x20)
+
+#define mtlqx_r8(op, nx) /* not portable, do not use outside */             \
+        mtlqx_r4(op, nx+0x00)                                               \
+        mtlqx_r4(op, nx+0x40)
+
+#define mtlqx_rG(op, nx) /* not portable, do not use outside */             \
+        mtlqx_r8(op, nx+0x00)                                               \
+        mtlqx_r8(op, nx+0x80)
+
+#if   (RT_SIMD == 2048)
+#define mtlqx_rn(op, nx)    mtlqx_rG(op, nx)
+#elif (RT_SIMD == 1024)
+#define mtlqx_rn(op, nx)    mtlqx_r8(op, nx)
+#elif (RT_SIMD == 512)
+#define mtlqx_rn(op, nx)    mtlqx_r4(op, nx)
+#elif (RT_SIMD == 256)
+#define mtlqx_rn(op, nx)    mtlqx_r2(op, nx)
+#elif (RT_SIMD == 128)
+#define mtlqx_rn(op, nx)    mtlqx_r1(op, nx)
+#endif /* RT_SIMD: 2048, 1024, 512, 256, 128 */
+
+#endif /* mtlqx_ld */
+
+/* stn (D = S) non-temporal store, bypasses caches on the way to memory
+ * weakly-ordered, place sfnce_xx before [D] is read by other threads
+ * targets without native non-temporal stores use regular stores below */
+
+#if   (RT_SIMD == 256) && !(defined RT_SVEX1) && (defined stndx_st)
+
+#define stnqx_st(XS, MD, DD)                                                \
+        stndx_st(W(XS), W(MD), W(DD))
+
+#elif (RT_SIMD == 128) && !(defined RT_SVEX1) && (defined stnjx_st)
+
+#define stnqx_st(XS, MD, DD)                                                \
+        stnjx_st(W(XS), W(MD), W(DD))
+
+#endif /* RT_SIMD: 256, 128 */
+
+#ifndef stnqx_st
+
+#define stnqx_st(XS, MD, DD)                                                \
+        movqx_st(W(XS), W(MD), W(DD))
+
+#endif /* stnqx_st */
+
+/* shf (G = G[IS]), (D = S[IT]) shuffle elements within each 128-bit lane
+ * 1-bit fields of the immediate select 64-bit elements in each 128-bit lane
+ * targets without native shuffles use inf_SCR01/SCR02 and BASE-moves below */
+
+#if   (RT_SIMD == 256) && !(defined RT_SVEX1) && (defined shfdx3ri)
+
+#define shfqx_ri(XG, IS)                                                    \
+        shfdx_ri(W(XG), W(IS))
+
+#define shfqx3ri(XD, XS, IT)                                                \
+        shfdx3ri(W(XD), W(XS), W(IT))
+
+#elif (RT_SIMD == 128) && !(defined RT_SVEX1) && (defined shfjx3ri)
+
+#define shfqx_ri(XG, IS)                                                    \
+        shfjx_ri(W(XG), W(IS))
+
+#define shfqx3ri(XD, XS, IT)                                                \
+        shfjx3ri(W(XD), W(XS), W(IT))
+
+#endif /* RT_SIMD: 256, 128 */
+
+#ifndef shfqx3ri
+
+#define shfqx_ri(XG, IS)                                                    \
+        shfqx3ri(W(XG), W(XG), W(IS))
+
+#define shfqx3ri(XD, XS, IT)                                                \
+        movqx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        stack_st(Reax)                                                      \
+        shfqx_rn(VAL(IT), 0x00)                                             \
+        stack_ld(Reax)                                                      \
+        movqx_ld(W(XD), Mebp, inf_SCR02(0))
+
+#define shfqx_rx(it, nx) /* not portable, do not use outside */             \
+        movwx_ld(Reax,  Mebp, inf_SCR01(nx+((it)>>0&1)*8+0))                \
+        movwx_st(Reax,  Mebp, inf_SCR02(nx+0x00))                           \
+        movwx_ld(Reax,  Mebp, inf_SCR01(nx+((it)>>0&1)*8+4))                \
+        movwx_st(Reax,  Mebp, inf_SCR02(nx+0x04))                           \
+        movwx_ld(Reax,  Mebp, inf_SCR01(nx+((it)>>1&1)*8+0))                \
+        movwx_st(Reax,  Mebp, inf_SCR02(nx+0x08))                           \
+        movwx_ld(Reax,  Mebp, inf_SCR01(nx+((it)>>1&1)*8+4))                \
+        movwx_st(Reax,  Mebp, inf_SCR02(nx+0x0C))
+
+#define shfqx_r1(it, nx) /* not portable, do not use outside */             \
+        shfqx_rx(it, nx)
+
+#define shfqx_r2(it, nx) /* not portable, do not use outside */             \
+        shfqx_r1(it, nx+0x00)                                               \
+        shfqx_r1(it, nx+0x10)
+
+#define shfqx_r4(it, nx) /* not portable, do not use outside */             \
+        shfqx_r2(it, nx+0x00)                                               \
+        shfqx_r2(it, nx+0x20)
+
+#define shfqx_r8(it, nx) /* not portable, do not use outside */             \
+        shfqx_r4(it, nx+0x00)                                               \
+        shfqx_r4(it, nx+0x40)
+
+#define shfqx_rG(it, nx) /* not portable, do not use outside */             \
+        shfqx_r8(it, nx+0x00)                                               \
+        shfqx_r8(it, nx+0x80)
+
+#if   (RT_SIMD == 2048)
+#define shfqx_rn(it, nx)    shfqx_rG(it, nx)
+#elif (RT_SIMD == 1024)
+#define shfqx_rn(it, nx)    shfqx_r8(it, nx)
+#elif (RT_SIMD == 512)
+#define shfqx_rn(it, nx)    shfqx_r4(it, nx)
+#elif (RT_SIMD == 256)
+#define shfqx_rn(it, nx)    shfqx_r2(it, nx)
+#elif (RT_SIMD == 128)
+#define shfqx_rn(it, nx)    shfqx_r1(it, nx)
+#endif /* RT_SIMD: 2048, 1024, 512, 256, 128 */
+
+#endif /* shfqx3ri */
+
+/* tbl (G = G[S]), (D = S[T]) permute elements across the SIMD register
+ * indices are in elements, taken modulo the number of elements in SIMD
+ * targets without native permutes use inf_SCR01/SCR02 and BASE-loads below */
+
+#if   (RT_SIMD == 256) && !(defined RT_SVEX1) && (defined tbldx3rr)
+
+#define tblqx_rr(XG, XS)                                                    \
+        tbldx_rr(W(XG), W(XS))
+
+#define tblqx3rr(XD, XS, XT)                                                \
+        tbldx3rr(W(XD), W(XS), W(XT))
+
+#elif (RT_SIMD == 128) && !(defined RT_SVEX1) && (defined tbljx3rr)
+
+#define tblqx_rr(XG, XS)                                                    \
+        tbljx_rr(W(XG), W(XS))
+
+#define tblqx3rr(XD, XS, XT)                                                \
+        tbljx3rr(W(XD), W(XS), W(XT))
+
+#endif /* RT_SIMD: 256, 128 */
+
+#ifndef tblqx3rr
+
+#define tblqx_rr(XG, XS)                                                    \
+        tblqx3rr(W(XG), W(XG), W(XS))
+
+#define tblqx3rr(XD, XS, XT)                                                \
+        movqx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movqx_st(W(XT), Mebp, inf_SCR02(0))                                 \
+        stack_st(Reax)                                                      \
+        stack_st(Recx)                                                      \
+        tblqx_rn(0x00)                                                      \
+        stack_ld(Recx)                                                      \
+        stack_ld(Reax)                                                      \
+        movqx_ld(W(XD), Mebp, inf_SCR02(0))
+
+#define tblqx_rx(nx) /* not portable, do not use outside */                 \
+        movwx_ld(Reax,  Mebp, inf_SCR02(nx+B))                              \
+        andwx_ri(Reax,  IB(RT_SIMD/64-1))                                   \
+        movwx_ld(Recx,  Lebp, inf_SCR01(0x00))                              \
+        movwx_ld(Reax,  Lebp, inf_SCR01(0x04))                              \
+        movwx_st(Recx,  Mebp, inf_SCR02(nx+0x00))                           \
+        movwx_st(Reax,  Mebp, inf_SCR02(nx+0x04))
+
+#define tblqx_r1(nx) /* not portable, do not use outside */                 \
+        tblqx_rx(nx+0x00)                                                   \
+        tblqx_rx(nx+0x08)
+
+#define tblqx_r2(nx) /* not portable, do not use outside */                 \
+        tblqx_r1(nx+0x00)                                                   \
+        tblqx_r1(nx+0x10)
+
+#define tblqx_r4(nx) /* not portable, do not use outside */                 \
+        tblqx_r2(nx+0x00)                                                   \
+        tblqx_r2(nx+0x20)
+
+#define tblqx_r8(nx) /* not portable, do not use outside */                 \
+        tblqx_r4(nx+0x00)                                                   \
+        tblqx_r4(nx+0x40)
+
+#define tblqx_rG(nx) /* not portable, do not use outside */                 \
+        tblqx_r8(nx+0x00)                                                   \
+        tblqx_r8(nx+0x80)
+
+#if   (RT_SIMD == 2048)
+#define tblqx_rn(nx)    tblqx_rG(nx)
+#elif (RT_SIMD == 1024)
+#define tblqx_rn(nx)    tblqx_r8(nx)
+#elif (RT_SIMD == 512)
+#define tblqx_rn(nx)    tblqx_r4(nx)
+#elif (RT_SIMD == 256)
+#define tblqx_rn(nx)    tblqx_r2(nx)
+#elif (RT_SIMD == 128)
+#define tblqx_rn(nx)    tblqx_r1(nx)
+#endif /* RT_SIMD: 2048, 1024, 512, 256, 128 */
+
+#endif /* tblqx3rr */
+
+/* scn (D[i] = S[0] op .. op S[i]) inclusive prefix scans in log2 steps
+ * adi/ade (sum), mni/mxi (min/max), exclusive scan is only provided for add
+ * targets without native scans use inf_SCR01/SCR02 and BASE-moves below
+ * uses Xmm0 implicitly as a temp register, destroys Xmm0, XD/XS != Xmm0 */
+
+#if   (RT_SIMD == 256) && !(defined RT_SVEX1) && (defined adidx_rr)
+
+#define adiqs_rr(XD, XS)                                                    \
+        adids_rr(W(XD), W(XS))
+
+#define adiqx_rr(XD, XS)                                                    \
+        adidx_rr(W(XD), W(XS))
+
+#define adeqs_rr(XD, XS)                                                    \
+        adeds_rr(W(XD), W(XS))
+
+#define adeqx_rr(XD, XS)                                                    \
+        adedx_rr(W(XD), W(XS))
+
+#define mniqs_rr(XD, XS)                                                    \
+        mnids_rr(W(XD), W(XS))
+
+#define mniqx_rr(XD, XS)                                                    \
+        mnidx_rr(W(XD), W(XS))
+
+#define mniqn_rr(XD, XS)                                                    \
+        mnidn_rr(W(XD), W(XS))
+
+#define mxiqs_rr(XD, XS)                                                    \
+        mxids_rr(W(XD), W(XS))
+
+#define mxiqx_rr(XD, XS)                                                    \
+        mxidx_rr(W(XD), W(XS))
+
+#define mxiqn_rr(XD, XS)                                                    \
+        mxidn_rr(W(XD), W(XS))
+
+#elif (RT_SIMD == 128) && !(defined RT_SVEX1) && (defined adijx_rr)
+
+#define adiqs_rr(XD, XS)                                                    \
+        adijs_rr(W(XD), W(XS))
+
+#define adiqx_rr(XD, XS)                                                    \
+        adijx_rr(W(XD), W(XS))
+
+#define adeqs_rr(XD, XS)                                                    \
+        adejs_rr(W(XD), W(XS))
+
+#define adeqx_rr(XD, XS)                                                    \
+        adejx_rr(W(XD), W(XS))
+
+#define mniqs_rr(XD, XS)                                                    \
+        mnijs_rr(W(XD), W(XS))
+
+#define mniqx_rr(XD, XS)                                                    \
+        mnijx_rr(W(XD), W(XS))
+
+#define mniqn_rr(XD, XS)                                                    \
+        mnijn_rr(W(XD), W(XS))
+
+#define mxiqs_rr(XD, XS)                                                    \
+        mxijs_rr(W(XD), W(XS))
+
+#define mxiqx_rr(XD, XS)                                                    \
+        mxijx_rr(W(XD), W(XS))
+
+#define mxiqn_rr(XD, XS)                                                    \
+        mxijn_rr(W(XD), W(XS))
+
+#endif /* RT_SIMD: 256, 128 */
+
+#ifndef adiqx_rr
+
+#define adiqs_rr(XD, XS)                                                    \
+        movqx_rr(W(XD), W(XS))                                              \
+        scnqx_ra(W(XD), addqs_rr, scnqx_rz)
+
+#define adiqx_rr(XD, XS)                                                    \
+        movqx_rr(W(XD), W(XS))                                              \
+        scnqx_ra(W(XD), addqx_rr, scnqx_rz)
+
+#define adeqs_rr(XD, XS)                                                    \
+        movqx_rr(W(XD), W(XS))                                              \
+        scnqx_ra(W(XD), addqs_rr, scnqx_rz)                                 \
+        scnqx_rs(W(XD), movqx_rr, scnqx_rz, 0x08)
+
+#define adeqx_rr(XD, XS)                                                    \
+        movqx_rr(W(XD), W(XS))                                              \
+        scnqx_ra(W(XD), addqx_rr, scnqx_rz)                                 \
+        scnqx_rs(W(XD), movqx_rr, scnqx_rz, 0x08)
+
+#define mniqs_rr(XD, XS)                                                    \
+        movqx_rr(W(XD), W(XS))                                              \
+        scnqx_ra(W(XD), minqs_rr, scnqx_rf)
+
+#define mniqx_rr(XD, XS)                                                    \
+        movqx_rr(W(XD), W(XS))                                              \
+        scnqx_ra(W(XD), minqx_rr, scnqx_rf)
+
+#define mniqn_rr(XD, XS)                                                    \
+        movqx_rr(W(XD), W(XS))                                              \
+        scnqx_ra(W(XD), minqn_rr, scnqx_rf)
+
+#define mxiqs_rr(XD, XS)                                                    \
+        movqx_rr(W(XD), W(XS))                                              \
+        scnqx_ra(W(XD), maxqs_rr, scnqx_rf)
+
+#define mxiqx_rr(XD, XS)                                                    \
+        movqx_rr(W(XD), W(XS))                                              \
+        scnqx_ra(W(XD), maxqx_rr, scnqx_rf)
+
+#define mxiqn_rr(XD, XS)                                                    \
+        movqx_rr(W(XD), W(XS))                                              \
+        scnqx_ra(W(XD), maxqn_rr, scnqx_rf)
+
+/* shift XD up by nb bytes via SCR02, the vacated lower elements are read
+ * from the area right below SCR02 (within SCR01) filled in by "fl" first */
+
+#define scnqx_rs(XD, op, fl, nb) /* not portable, do not use outside */     \
+        movqx_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        stack_st(Reax)                                                      \
+        scnqx_rn(fl, nb, 0x00)                                              \
+        stack_ld(Reax)                                                      \
+        movqx_ld(Xmm0, Mebp, inf_SCR02(0))                                  \
+        op(W(XD), Xmm0)
+
+#define scnqx_rx(fl, nb, nx) /* not portable, do not use outside */         \
+        fl(nx)                                                              \
+        movwx_ld(Reax,  Mebp, inf_SCR02(nx+0x0C-(nb)))                      \
+        movwx_st(Reax,  Mebp, inf_SCR02(nx+0x0C))                           \
+        movwx_ld(Reax,  Mebp, inf_SCR02(nx+0x08-(nb)))                      \
+        movwx_st(Reax,  Mebp, inf_SCR02(nx+0x08))                           \
+        movwx_ld(Reax,  Mebp, inf_SCR02(nx+0x04-(nb)))                      \
+        movwx_st(Reax,  Mebp, inf_SCR02(nx+0x04))                           \
+        movwx_ld(Reax,  Mebp, inf_SCR02(nx+0x00-(nb)))                      \
+        movwx_st(Reax,  Mebp, inf_SCR02(nx+0x00))
+
+#define scnqx_rz(nx) /* not portable, do not use outside */                 \
+        movwx_mi(Mebp,  inf_SCR02(nx+0x00-(RT_SIMD/8)), IB(0))              \
+        movwx_mi(Mebp,  inf_SCR02(nx+0x04-(RT_SIMD/8)), IB(0))              \
+        movwx_mi(Mebp,  inf_SCR02(nx+0x08-(RT_SIMD/8)), IB(0))              \
+        movwx_mi(Mebp,  inf_SCR02(nx+0x0C-(RT_SIMD/8)), IB(0))
+
+#define scnqx_rf(nx) /* not portable, do not use outside */                 \
+        movwx_ld(Reax,  Mebp, inf_SCR02(0x00))                              \
+        movwx_st(Reax,  Mebp, inf_SCR02(nx+0x00-(RT_SIMD/8)))               \
+        movwx_st(Reax,  Mebp, inf_SCR02(nx+0x08-(RT_SIMD/8)))               \
+        movwx_ld(Reax,  Mebp, inf_SCR02(0x04))                              \
+        movwx_st(Reax,  Mebp, inf_SCR02(nx+0x04-(RT_SIMD/8)))               \
+        movwx_st(Reax,  Mebp, inf_SCR02(nx+0x0C-(RT_SIMD/8)))
+
+#define scnqx_r1(fl, nb, nx) /* not portable, do not use outside */         \
+        scnqx_rx(fl, nb, nx)
+
+#define scnqx_r2(fl, nb, nx) /* not portable, do not use outside */         \
+        scnqx_r1(fl, nb, nx+0x10)                                           \
+        scnqx_r1(fl, nb, nx+0x00)
+
+#define scnqx_r4(fl, nb, nx) /* not portable, do not use outside */         \
+        scnqx_r2(fl, nb, nx+0x20)                                           \
+        scnqx_r2(fl, nb, nx+0x00)
+
+#define scnqx_r8(fl, nb, nx) /* not portable, do not use outside */         \
+        scnqx_r4(fl, nb, nx+0x40)                                           \
+        scnqx_r4(fl, nb, nx+0x00)
+
+#define scnqx_rG(fl, nb, nx) /* not portable, do not use outside */         \
+        scnqx_r8(fl, nb, nx+0x80)                                           \
+        scnqx_r8(fl, nb, nx+0x00)
+
+#define scnqx_a1(XD, op, fl) /* not portable, do not use outside */         \
+        scnqx_rs(W(XD), op, fl, 0x08)
+
+#define scnqx_a2(XD, op, fl) /* not portable, do not use outside */         \
+        scnqx_a1(W(XD), op, fl)                                             \
+        scnqx_rs(W(XD), op, fl, 0x10)
+
+#define scnqx_a4(XD, op, fl) /* not portable, do not use outside */         \
+        scnqx_a2(W(XD), op, fl)                                             \
+        scnqx_rs(W(XD), op, fl, 0x20)
+
+#define scnqx_a8(XD, op, fl) /* not portable, do not use outside */         \
+        scnqx_a4(W(XD), op, fl)                                             \
+        scnqx_rs(W(XD), op, fl, 0x40)
+
+#define scnqx_aG(XD, op, fl) /* not portable, do not use outside */         \
+        scnqx_a8(W(XD), op, fl)                                             \
+        scnqx_rs(W(XD), op, fl, 0x80)
+
+#if   (RT_SIMD == 2048)
+#define scnqx_ra(XD, op, fl)    scnqx_aG(W(XD), op, fl)
+#define scnqx_rn(fl, nb, nx)    scnqx_rG(fl, nb, nx)
+#elif (RT_SIMD == 1024)
+#define scnqx_ra(XD, op, fl)    scnqx_a8(W(XD), op, fl)
+#define scnqx_rn(fl, nb, nx)    scnqx_r8(fl, nb, nx)
+#elif (RT_SIMD == 512)
+#define scnqx_ra(XD, op, fl)    scnqx_a4(W(XD), op, fl)
+#define scnqx_rn(fl, nb, nx)    scnqx_r4(fl, nb, nx)
+#elif (RT_SIMD == 256)
+#define scnqx_ra(XD, op, fl)    scnqx_a2(W(XD), op, fl)
+#define scnqx_rn(fl, nb, nx)    scnqx_r2(fl, nb, nx)
+#elif (RT_SIMD == 128)
+#define scnqx_ra(XD, op, fl)    scnqx_a1(W(XD), op, fl)
+#define scnqx_rn(fl, nb, nx)    scnqx_r1(fl, nb, nx)
+#endif /* RT_SIMD: 2048, 1024, 512, 256, 128 */
+
+#endif /* adiqx_rr */
+
+/* cnt (D = number of bits set in each element of S), population count
+ * clz (D = number of leading zeroes in each element of S), 64 if 0
+ * ctz (D = number of trailing zeroes in each element of S), 64 if 0
+ * targets without native bit-counts use inf_SCR02 and BASE-ops below */
+
+#if   (RT_SIMD == 256) && !(defined RT_SVEX1) && (defined cntdx_rr)
+
+#define cntqx_rr(XD, XS)                                                    \
+        cntdx_rr(W(XD), W(XS))
+
+#define cntqx_ld(XD, MS, DS)                                                \
+        cntdx_ld(W(XD), W(MS), W(DS))
+
+#elif (RT_SIMD == 128) && !(defined RT_SVEX1) && (defined cntjx_rr)
+
+#define cntqx_rr(XD, XS)                                                    \
+        cntjx_rr(W(XD), W(XS))
+
+#define cntqx_ld(XD, MS, DS)                                                \
+        cntjx_ld(W(XD), W(MS), W(DS))
+
+#endif /* RT_SIMD: 256, 128 */
+
+#if   (RT_SIMD == 256) && !(defined RT_SVEX1) && (defined clzdx_rr)
+
+#define clzqx_rr(XD, XS)                                                    \
+        clzdx_rr(W(XD), W(XS))
+
+#define clzqx_ld(XD, MS, DS)                                                \
+        clzdx_ld(W(XD), W(MS), W(DS))
+
+#elif (RT_SIMD == 128) && !(defined RT_SVEX1) && (defined clzjx_rr)
+
+#define clzqx_rr(XD, XS)                                                    \
+        clzjx_rr(W(XD), W(XS))
+
+#define clzqx_ld(XD, MS, DS)                                                \
+        clzjx_ld(W(XD), W(MS), W(DS))
+
+#endif /* RT_SIMD: 256, 128 */
+
+#if   (RT_SIMD == 256) && !(defined RT_SVEX1) && (defined ctzdx_rr)
+
+#define ctzqx_rr(XD, XS)                                                    \
+        ctzdx_rr(W(XD), W(XS))
+
+#define ctzqx_ld(XD, MS, DS)                                                \
+        ctzdx_ld(W(XD), W(MS), W(DS))
+
+#elif (RT_SIMD == 128) && !(defined RT_SVEX1) && (defined ctzjx_rr)
+
+#define ctzqx_rr(XD, XS)                                                    \
+        ctzjx_rr(W(XD), W(XS))
+
+#define ctzqx_ld(XD, MS, DS)                                                \
+        ctzjx_ld(W(XD), W(MS), W(DS))
+
+#endif /* RT_SIMD: 256, 128 */
+
+#ifndef cntqx_rr
+
+#define cntqx_rr(XD, XS)                                                    \
+        cntqx_rs(W(XD), W(XS), cntqx_rx)
+
+#define cntqx_ld(XD, MS, DS)                                                \
+        movqx_ld(W(XD), W(MS), W(DS))                                       \
+        cntqx_rr(W(XD), W(XD))
+
+#endif /* cntqx_rr */
+
+#ifndef clzqx_rr
+
+#define clzqx_rr(XD, XS)                                                    \
+        cntqx_rs(W(XD), W(XS), clzqx_rx)
+
+#define clzqx_ld(XD, MS, DS)                                                \
+        movqx_ld(W(XD), W(MS), W(DS))                                       \
+        clzqx_rr(W(XD), W(XD))
+
+#endif /* clzqx_rr */
+
+#ifndef ctzqx_rr
+
+#define ctzqx_rr(XD, XS)                                                    \
+        cntqx_rs(W(XD), W(XS), ctzqx_rx)
+
+#define ctzqx_ld(XD, MS, DS)                                                \
+        movqx_ld(W(XD), W(MS), W(DS))                                       \
+        ctzqx_rr(W(XD), W(XD))
+
+#endif /* ctzqx_rr */
+
+/* apply bit-counts to each 64-bit element of S via SCR02 in 32-bit halves
+ * (clz/ctz: the second half is added only if the first one is all zeroes)
+ * to keep the fallback available on targets with 32-bit BASE registers */
+
+#define cntqx_rs(XD, XS, op) /* not portable, do not use outside */         \
+        movqx_st(W(XS), Mebp, inf_SCR02(0))                                 \
+        stack_st(Reax)                                                      \
+        stack_st(Recx)                                                      \
+        stack_st(Redx)                                                      \
+        cntqx_rn(op, 0x00)                                                  \
+        stack_ld(Redx)                                                      \
+        stack_ld(Recx)                                                      \
+        stack_ld(Reax)                                                      \
+        movqx_ld(W(XD), Mebp, inf_SCR02(0))
+
+#define cntqx_rx(nx) /* not portable, do not use outside */                 \
+        movwx_ld(Reax,  Mebp, inf_SCR02(nx+0x00))                           \
+        movwx_ld(Recx,  Mebp, inf_SCR02(nx+0x04))                           \
+        cntwx_rr(Reax,  Reax)                                               \
+        cntwx_rr(Recx,  Recx)                                               \
+        addwx_rr(Reax,  Recx)                                               \
+        cntqx_rh(nx)
+
+#define clzqx_rx(nx) /* not portable, do not use outside */                 \
+        movwx_ld(Reax,  Mebp, inf_SCR02(nx+0x04-B))                         \
+        movwx_ld(Recx,  Mebp, inf_SCR02(nx+B))                              \
+        clzwx_rr(Reax,  Reax)                                               \
+        clzwx_rr(Recx,  Recx)                                               \
+        cntqx_rc(nx)
+
+#define ctzqx_rx(nx) /* not portable, do not use outside */                 \
+        movwx_ld(Reax,  Mebp, inf_SCR02(nx+B))                              \
+        movwx_ld(Recx,  Mebp, inf_SCR02(nx+0x04-B))                         \
+        ctzwx_rr(Reax,  Reax)                                               \
+        ctzwx_rr(Recx,  Recx)                                               \
+        cntqx_rc(nx)
+
+#define cntqx_rc(nx) /* not portable, do not use outside */                 \
+        movwx_rr(Redx,  Reax)                                               \
+        shlwx_ri(Redx,  IB(26))                                             \
+        shrwn_ri(Redx,  IB(31))                                             \
+        andwx_rr(Recx,  Redx)                                               \
+        addwx_rr(Reax,  Recx)                                               \
+        cntqx_rh(nx)
+
+#define cntqx_rh(nx) /* not portable, do not use outside */                 \
+        movwx_st(Reax,  Mebp, inf_SCR02(nx+B))                              \
+        movwx_mi(Mebp,  inf_SCR02(nx+0x04-B), IB(0))
+
+#define cntqx_r1(op, nx) /* not portable, do not use outside */             \
+        op(nx+0x00)                                                         \
+        op(nx+0x08)
+
+#define cntqx_r2(op, nx) /* not portable, do not use outside */             \
+        cntqx_r1(op, nx+0x00)                                               \
+        cntqx_r1(op, nx+0x10)
+
+#define cntqx_r4(op, nx) /* not portable, do not use outside */             \
+        cntqx_r2(op, nx+0x00)                                               \
+        cntqx_r2(op, nx+0x20)
+
+#define cntqx_r8(op, nx) /* not portable, do not use outside */             \
+        cntqx_r4(op, nx+0x00)                                               \
+        cntqx_r4(op, nx+0x40)
+
+#define cntqx_rG(op, nx) /* not portable, do not use outside */             \
+        cntqx_r8(op, nx+0x00)                                               \
+        cntqx_r8(op, nx+0x80)
+
+#if   (RT_SIMD == 2048)
+#define cntqx_rn(op, nx)    cntqx_rG(op, nx)
+#elif (RT_SIMD == 1024)
+#define cntqx_rn(op, nx)    cntqx_r8(op, nx)
+#elif (RT_SIMD == 512)
+#define cntqx_rn(op, nx)    cntqx_r4(op, nx)
+#elif (RT_SIMD == 256)
+#define cntqx_rn(op, nx)    cntqx_r2(op, nx)
+#elif (RT_SIMD == 128)
+#define cntqx_rn(op, nx)    cntqx_r1(op, nx)
+#endif /* RT_SIMD: 2048, 1024, 512, 256, 128 */
+
+/* bsw (D = S with the order of bytes reversed in each element), byte-swap
+ * targets without native byte-swaps use inf_SCR02 and xor-shifts below */
+
+#if   (RT_SIMD == 256) && !(defined RT_SVEX1) && (defined bswdx_rr)
+
+#define bswqx_rr(XD, XS)                                                    \
+        bswdx_rr(W(XD), W(XS))
+
+#define bswqx_ld(XD, MS, DS)                                                \
+        bswdx_ld(W(XD), W(MS), W(DS))
+
+#elif (RT_SIMD == 128) && !(defined RT_SVEX1) && (defined bswjx_rr)
+
+#define bswqx_rr(XD, XS)                                                    \
+        bswjx_rr(W(XD), W(XS))
+
+#define bswqx_ld(XD, MS, DS)                                                \
+        bswjx_ld(W(XD), W(MS), W(DS))
+
+#endif /* RT_SIMD: 256, 128 */
+
+#ifndef bswqx_rr
+
+#define bswqx_rr(XD, XS)                                                    \
+        bswox_rr(W(XD), W(XS))                                              \
+        bswqx_rx(W(XD))
+
+#define bswqx_ld(XD, MS, DS)                                                \
+        bswox_ld(W(XD), W(MS), W(DS))                                       \
+        bswqx_rx(W(XD))
+
+#endif /* bswqx_rr */
+
+/* swap upper and lower halves of each 64-bit element of XG, via inf_SCR02 */
+
+#define bswqx_rx(XG) /* not portable, do not use outside */                 \
+        movqx_st(W(XG), Mebp, inf_SCR02(0))                                 \
+        shrqx_ri(W(XG), IB(32))                                             \
+        xorqx_ld(W(XG), Mebp, inf_SCR02(0))                                 \
+        movqx_st(W(XG), Mebp, inf_SCR02(0))                                 \
+        shlqx_ri(W(XG), IB(32))                                             \
+        xorqx_ld(W(XG), Mebp, inf_SCR02(0))                                 \
+        movqx_st(W(XG), Mebp, inf_SCR02(0))                                 \
+        shrqx_ri(W(XG), IB(32))                                             \
+        xorqx_ld(W(XG), Mebp, inf_SCR02(0))
+
+/* cvy (D = fp32-to-fp64 S), widens lower half of fp32 elements in S
+ * cvu (D = fp32-to-fp64 S), widens upper half of fp32 elements in S
+ * cvx (D = fp64-to-fp32 S), narrows to lower half of D, upper half is 0
+ * _ld/_st access the lower half only, targets without native converters
+ * use BASE emulation below, which narrows with round-to-nearest-even */
+
+#if   (RT_SIMD == 256) && !(defined RT_SVEX1) && (defined cvucs_rr)
+
+#define cvyos_rr(XD, XS)                                                    \
+        cvycs_rr(W(XD), W(XS))
+
+#define cvyos_ld(XD, MS, DS)                                                \
+        cvycs_ld(W(XD), W(MS), W(DS))
+
+#define cvuos_rr(XD, XS)                                                    \
+        cvucs_rr(W(XD), W(XS))
+
+#define cvxqs_rr(XD, XS)                                                    \
+        cvxds_rr(W(XD), W(XS))
+
+#define cvxqs_st(XS, MD, DD)                                                \
+        cvxds_st(W(XS), W(MD), W(DD))
+
+#elif (RT_SIMD == 128) && !(defined RT_SVEX1) && (defined cvuis_rr)
+
+#define cvyos_rr(XD, XS)                                                    \
+        cvyis_rr(W(XD), W(XS))
+
+#define cvyos_ld(XD, MS, DS)                                                \
+        cvyis_ld(W(XD), W(MS), W(DS))
+
+#define cvuos_rr(XD, XS)                                                    \
+        cvuis_rr(W(XD), W(XS))
+
+#define cvxqs_rr(XD, XS)                                                    \
+        cvxjs_rr(W(XD), W(XS))
+
+#define cvxqs_st(XS, MD, DD)                                                \
+        cvxjs_st(W(XS), W(MD), W(DD))
+
+#endif /* RT_SIMD: 256, 128 */
+
+#ifndef cvyos_rr
+
+#define cvyos_rr(XD, XS)                                                    \
+        movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        cvyos_rs(cvyos_rx)                                                  \
+        movqx_ld(W(XD), Mebp, inf_SCR02(0))
+
+#define cvyos_ld(XD, MS, DS)                                                \
+        stack_st(Resi)                                                      \
+        adrxx_ld(Resi,  W(MS), W(DS))                                       \
+        cvyos_rs(cvyos_rm)                                                  \
+        stack_ld(Resi)                                                      \
+        movqx_ld(W(XD), Mebp, inf_SCR02(0))
+
+#define cvuos_rr(XD, XS)                                                    \
+        movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        cvyos_rs(cvuos_rx)                                                  \
+        movqx_ld(W(XD), Mebp, inf_SCR02(0))
+
+#define cvxqs_rr(XD, XS)                                                    \
+        movqx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        xorox_rr(W(XD), W(XD))                                              \
+        movox_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        cvyos_rs(cvxqs_rx)                                                  \
+        movox_ld(W(XD), Mebp, inf_SCR02(0))
+
+#define cvxqs_st(XS, MD, DD)                                                \
+        stack_st(Resi)                                                      \
+        adrxx_ld(Resi,  W(MD), W(DD))                                       \
+        movqx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        cvyos_rs(cvxqs_rm)                                                  \
+        stack_ld(Resi)
+
+#endif /* cvyos_rr */
+
+/* apply BASE-op "op" to each 64-bit element of SCR02, words are combined
+ * as (hi, lo) with the order of words in memory following RT_ENDIAN */
+
+#define cvyos_rs(op) /* not portable, do not use outside */                 \
+        stack_st(Reax)                                                      \
+        stack_st(Recx)                                                      \
+        stack_st(Redx)                                                      \
+        stack_st(Rebx)                                                      \
+        cntqx_rn(op, 0x00)                                                  \
+        stack_ld(Rebx)                                                      \
+        stack_ld(Redx)                                                      \
+        stack_ld(Recx)                                                      \
+        stack_ld(Reax)
+
+#define cvyos_hi(nx) /* not portable, do not use outside */                 \
+        ((nx)+4-RT_ENDIAN*4)
+
+#define cvyos_lo(nx) /* not portable, do not use outside */                 \
+        ((nx)+RT_ENDIAN*4)
+
+#define cvyos_rx(nx) /* not portable, do not use outside */                 \
+        cvyos_rv(nx, Mebp, inf_SCR01((nx)/2))
+
+#define cvyos_rm(nx) /* not portable, do not use outside */                 \
+        cvyos_rv(nx, Mesi, DP((nx)/2))
+
+#define cvuos_rx(nx) /* not portable, do not use outside */                 \
+        cvyos_rv(nx, Mebp, inf_SCR01((nx)/2+Q*0x08))
+
+/* subnormals are normalized with clz, inf/NaN get the max exponent, NaNs
+ * are quieted, zeroes are masked, all without branches in BASE registers */
+
+#define cvyos_rv(nx, MS, DS) /* not portable, do not use outside */         \
+        movwx_ld(Reax,  W(MS), W(DS))                                       \
+        andwx_ri(Reax,  IV(0x7FFFFFFF))                                     \
+        clzwx_rr(Recx,  Reax)                                               \
+        subwx_ri(Recx,  IB(8))                                              \
+        movwx_rr(Redx,  Recx)                                               \
+        shrwn_ri(Redx,  IB(31))                                             \
+        notwx_rx(Redx)                                                      \
+        andwx_rr(Recx,  Redx)                                               \
+        shlwx_rx(Reax)                                                      \
+        movwx_rr(Redx,  Reax)                                               \
+        shlwx_ri(Redx,  IB(29))                                             \
+        movwx_st(Redx,  Mebp, inf_SCR02(cvyos_lo(nx)))                      \
+        shrwx_ri(Reax,  IB(3))                                              \
+        addwx_ri(Reax,  IV(0x38000000))                                     \
+        shlwx_ri(Recx,  IB(20))                                             \
+        subwx_rr(Reax,  Recx)                                               \
+        movwx_ld(Recx,  W(MS), W(DS))                                       \
+        andwx_ri(Recx,  IV(0x7FFFFFFF))                                     \
+        movwx_rr(Redx,  Recx)                                               \
+        negwx_rx(Redx)                                                      \
+        shrwn_ri(Redx,  IB(31))                                             \
+        andwx_rr(Reax,  Redx)                                               \
+        movwx_ri(Redx,  IV(0x7F7FFFFF))                                     \
+        subwx_rr(Redx,  Recx)                                               \
+        shrwn_ri(Redx,  IB(31))                                             \
+        andwx_ri(Redx,  IV(0x38000000))                                     \
+        addwx_rr(Reax,  Redx)                                               \
+        movwx_ri(Redx,  IV(0x7F800000))                                     \
+        subwx_rr(Redx,  Recx)                                               \
+        shrwn_ri(Redx,  IB(31))                                             \
+        andwx_ri(Redx,  IV(0x00080000))                                     \
+        orrwx_rr(Reax,  Redx)                                               \
+        movwx_ld(Recx,  W(MS), W(DS))                                       \
+        shrwx_ri(Recx,  IB(31))                                             \
+        shlwx_ri(Recx,  IB(31))                                             \
+        orrwx_rr(Reax,  Recx)                                               \
+        movwx_st(Reax,  Mebp, inf_SCR02(cvyos_hi(nx)))
+
+#define cvxqs_rx(nx) /* not portable, do not use outside */                 \
+        cvxqs_rv(nx)                                                        \
+        movwx_st(Rebx,  Mebp, inf_SCR02((nx)/2))
+
+#define cvxqs_rm(nx) /* not portable, do not use outside */                 \
+        cvxqs_rv(nx)                                                        \
+        movwx_st(Rebx,  Mesi, DP((nx)/2))
+
+/* normal results are rebiased and rounded with (half - 1) and the lsb, then
+ * 31 top bits of the mantissa with the rest folded as sticky bit are shifted
+ * for subnormals (zero beyond 31), then inf saturates and NaNs are quieted */
+
+#define cvxqs_rv(nx) /* not portable, do not use outside */                 \
+        movwx_ld(Rebx,  Mebp, inf_SCR01(cvyos_hi(nx)))                      \
+        andwx_ri(Rebx,  IV(0x7FFFFFFF))                                     \
+        subwx_ri(Rebx,  IV(0x38000000))                                     \
+        shlwx_ri(Rebx,  IB(3))                                              \
+        movwx_ld(Reax,  Mebp, inf_SCR01(cvyos_lo(nx)))                      \
+        shrwx_ri(Reax,  IB(29))                                             \
+        orrwx_rr(Rebx,  Reax)                                               \
+        movwx_rr(Redx,  Rebx)                                               \
+        andwx_ri(Redx,  IB(1))                                              \
+        movwx_ld(Reax,  Mebp, inf_SCR01(cvyos_lo(nx)))                      \
+        andwx_ri(Reax,  IV(0x1FFFFFFF))                                     \
+        addwx_rr(Reax,  Redx)                                               \
+        addwx_ri(Reax,  IV(0x0FFFFFFF))                                     \
+        shrwx_ri(Reax,  IB(29))                                             \
+        addwx_rr(Rebx,  Reax)                                               \
+        movwx_ld(Reax,  Mebp, inf_SCR01(cvyos_hi(nx)))                      \
+        andwx_ri(Reax,  IV(0x000FFFFF))                                     \
+        orrwx_ri(Reax,  IV(0x00100000))                                     \
+        shlwx_ri(Reax,  IB(10))                                             \
+        movwx_ld(Redx,  Mebp, inf_SCR01(cvyos_lo(nx)))                      \
+        shrwx_ri(Redx,  IB(22))                                             \
+        orrwx_rr(Reax,  Redx)                                               \
+        movwx_ld(Redx,  Mebp, inf_SCR01(cvyos_lo(nx)))                      \
+        andwx_ri(Redx,  IV(0x003FFFFF))                                     \
+        negwx_rx(Redx)                                                      \
+        shrwx_ri(Redx,  IB(31))                                             \
+        orrwx_rr(Reax,  Redx)                                               \
+        movwx_ld(Recx,  Mebp, inf_SCR01(cvyos_hi(nx)))                      \
+        andwx_ri(Recx,  IV(0x7FFFFFFF))                                     \
+        shrwx_ri(Recx,  IB(20))                                             \
+        negwx_rx(Recx)                                                      \
+        addwx_ri(Recx,  IH(904))                                            \
+        movwx_rr(Redx,  Reax)                                               \
+        shrwx_rx(Redx)                                                      \
+        andwx_ri(Redx,  IB(1))                                              \
+        addwx_rr(Reax,  Redx)                                               \
+        movwx_ri(Redx,  IB(1))                                              \
+        shlwx_rx(Redx)                                                      \
+        shrwx_ri(Redx,  IB(1))                                              \
+        subwx_ri(Redx,  IB(1))                                              \
+        addwx_rr(Reax,  Redx)                                               \
+        shrwx_rx(Reax)                                                      \
+        movwx_ri(Redx,  IB(31))                                             \
+        subwx_rr(Redx,  Recx)                                               \
+        shrwn_ri(Redx,  IB(31))                                             \
+        notwx_rx(Redx)                                                      \
+        andwx_rr(Reax,  Redx)                                               \
+        movwx_ld(Recx,  Mebp, inf_SCR01(cvyos_hi(nx)))                      \
+        andwx_ri(Recx,  IV(0x7FFFFFFF))                                     \
+        subwx_ri(Recx,  IV(0x38100000))                                     \
+        shrwn_ri(Recx,  IB(31))                                             \
+        andwx_rr(Reax,  Recx)                                               \
+        notwx_rx(Recx)                                                      \
+        andwx_rr(Rebx,  Recx)                                               \
+        orrwx_rr(Rebx,  Reax)                                               \
+        movwx_ld(Recx,  Mebp, inf_SCR01(cvyos_hi(nx)))                      \
+        andwx_ri(Recx,  IV(0x7FFFFFFF))                                     \
+        movwx_ri(Redx,  IV(0x47EFFFFF))                                     \
+        subwx_rr(Redx,  Recx)                                               \
+        shrwn_ri(Redx,  IB(31))                                             \
+        movwx_rr(Reax,  Redx)                                               \
+        notwx_rx(Reax)                                                      \
+        andwx_rr(Rebx,  Reax)                                               \
+        andwx_ri(Redx,  IV(0x7F800000))                                     \
+        orrwx_rr(Rebx,  Redx)                                               \
+        movwx_ld(Reax,  Mebp, inf_SCR01(cvyos_lo(nx)))                      \
+        movwx_rr(Redx,  Reax)                                               \
+        negwx_rx(Redx)                                                      \
+        orrwx_rr(Redx,  Reax)                                               \
+        shrwx_ri(Redx,  IB(31))                                             \
+        orrwx_rr(Redx,  Recx)                                               \
+        movwx_ri(Reax,  IV(0x7FF00000))                                     \
+        subwx_rr(Reax,  Redx)                                               \
+        shrwn_ri(Reax,  IB(31))                                             \
+        andwx_ri(Recx,  IV(0x0007FFFF))                                     \
+        shlwx_ri(Recx,  IB(3))                                              \
+        movwx_ld(Redx,  Mebp, inf_SCR01(cvyos_lo(nx)))                      \
+        shrwx_ri(Redx,  IB(29))                                             \
+        orrwx_rr(Recx,  Redx)                                               \
+        orrwx_ri(Recx,  IV(0x00400000))                                     \
+        andwx_rr(Recx,  Reax)                                               \
+        orrwx_rr(Rebx,  Recx)                                               \
+        movwx_ld(Recx,  Mebp, inf_SCR01(cvyos_hi(nx)))                      \
+        shrwx_ri(Recx,  IB(31))                                             \
+        shlwx_ri(Recx,  IB(31))                                             \
+        orrwx_rr(Rebx,  Recx)
+
+/* cvy (D = S), zero-[x] or sign-[n] extends lower half of 32-bit elements
+ * cvu (D = S), zero-[x] or sign-[n] extends upper half of 32-bit elements
+ * cvx (D = S), narrows signed 64-bit elements to lower half of D, upper is 0
+ * with unsigned-[x] or signed-[n] saturation into 32-bit elements
+ * targets without native pack/unpack use inf_SCR01/SCR02 and BASE-ops below */
+
+#if   (RT_SIMD == 256) && !(defined RT_SVEX1) && (defined cvycx_rr)
+
+#define cvyox_rr(XD, XS)                                                    \
+        cvycx_rr(W(XD), W(XS))
+
+#define cvyon_rr(XD, XS)                                                    \
+        cvycn_rr(W(XD), W(XS))
+
+#define cvuox_rr(XD, XS)                                                    \
+        cvucx_rr(W(XD), W(XS))
+
+#define cvuon_rr(XD, XS)                                                    \
+        cvucn_rr(W(XD), W(XS))
+
+#elif (RT_SIMD == 128) && !(defined RT_SVEX1) && (defined cvyix_rr)
+
+#define cvyox_rr(XD, XS)                                                    \
+        cvyix_rr(W(XD), W(XS))
+
+#define cvyon_rr(XD, XS)                                                    \
+        cvyin_rr(W(XD), W(XS))
+
+#define cvuox_rr(XD, XS)                                                    \
+        cvuix_rr(W(XD), W(XS))
+
+#define cvuon_rr(XD, XS)                                                    \
+        cvuin_rr(W(XD), W(XS))
 
-#endif /* RT_SIMD_COMPAT_FMS */
+#endif /* RT_SIMD: 256, 128 */
 
-#define fmsjs3rr(XG, XS, XT)                                                \
-        fmsjs_rr(W(XG), W(XS), W(XT))
+#if   (RT_SIMD == 256) && !(defined RT_SVEX1) && (defined cvxdx_rr)
 
-#define fmsjs3ld(XG, XS, MT, DT)                                            \
-        fmsjs_ld(W(XG), W(XS), W(MT), W(DT))
+#define cvxqx_rr(XD, XS)                                                    \
+        cvxdx_rr(W(XD), W(XS))
 
-/******************************************************************************/
-/**** scalar ***** (rcp/rsq/fma/fms) with fixed-64-bit element ****************/
-/******************************************************************************/
+#define cvxqn_rr(XD, XS)                                                    \
+        cvxdn_rr(W(XD), W(XS))
 
-/* rcp (D = 1.0 / S)
- * accuracy/behavior may vary across supported targets, use accordingly */
+#elif (RT_SIMD == 128) && !(defined RT_SVEX1) && (defined cvxjx_rr)
 
-#if   RT_SIMD_COMPAT_RCP == 0 || RT_SIMD_COMPAT_RCP == 2
+#define cvxqx_rr(XD, XS)                                                    \
+        cvxjx_rr(W(XD), W(XS))
 
-#define rcpts_rr(XD, XS) /* destroys XS */                                  \
-        rcets_rr(W(XD), W(XS))                                              \
-        rcsts_rr(W(XD), W(XS)) /* <- not reusable without extra temp reg */
+#define cvxqn_rr(XD, XS)                                                    \
+        cvxjn_rr(W(XD), W(XS))
 
-#elif RT_SIMD_COMPAT_RCP == 1
+#endif /* RT_SIMD: 256, 128 */
 
-#define rcpts_rr(XD, XS) /* destroys XS */                                  \
-        movts_ld(W(XD), Mebp, inf_GPC01_64)                                 \
-        divts_rr(W(XD), W(XS))
+#ifndef cvyox_rr
 
-#define rcets_rr(XD, XS)                                                    \
-        movts_st(W(XS), Mebp, inf_SCR02(0))                                 \
-        movts_ld(W(XD), Mebp, inf_GPC01_64)                                 \
-        divts_ld(W(XD), Mebp, inf_SCR02(0))
+#define cvyox_rr(XD, XS)                                                    \
+        movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        cvyos_rs(cvyox_rx)                                                  \
+        movqx_ld(W(XD), Mebp, inf_SCR02(0))
 
-#define rcsts_rr(XG, XS) /* destroys XS */
+#define cvyon_rr(XD, XS)                                                    \
+        movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        cvyos_rs(cvyon_rx)                                                  \
+        movqx_ld(W(XD), Mebp, inf_SCR02(0))
 
-#endif /* RT_SIMD_COMPAT_RCP */
+#define cvuox_rr(XD, XS)                                                    \
+        movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        cvyos_rs(cvuox_rx)                                                  \
+        movqx_ld(W(XD), Mebp, inf_SCR02(0))
 
-/* rsq (D = 1.0 / sqrt S)
- * accuracy/behavior may vary across supported targets, use accordingly */
+#define cvuon_rr(XD, XS)                                                    \
+        movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        cvyos_rs(cvuon_rx)                                                  \
+        movqx_ld(W(XD), Mebp, inf_SCR02(0))
 
-#if   RT_SIMD_COMPAT_RSQ == 0 || RT_SIMD_COMPAT_RSQ == 2
+#endif /* cvyox_rr */
 
-#define rsqts_rr(XD, XS) /* destroys XS */                                  \
-        rsets_rr(W(XD), W(XS))                                              \
-        rssts_rr(W(XD), W(XS)) /* <- not reusable without extra temp reg */
+#ifndef cvxqx_rr
 
-#elif RT_SIMD_COMPAT_RSQ == 1
+#define cvxqx_rr(XD, XS)                                                    \
+        movqx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        xorox_rr(W(XD), W(XD))                                              \
+        movox_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        cvyos_rs(cvxqx_rx)                                                  \
+        movox_ld(W(XD), Mebp, inf_SCR02(0))
 
-#define rsqts_rr(XD, XS) /* destroys XS */                                  \
-        sqrts_rr(W(XS), W(XS))                                              \
-        movts_ld(W(XD), Mebp, inf_GPC01_64)                                 \
-        divts_rr(W(XD), W(XS))
+#define cvxqn_rr(XD, XS)                                                    \
+        movqx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        xorox_rr(W(XD), W(XD))                                              \
+        movox_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        cvyos_rs(cvxqn_rx)                                                  \
+        movox_ld(W(XD), Mebp, inf_SCR02(0))
+
+#endif /* cvxqx_rr */
+
+#define cvyox_rx(nx) /* not portable, do not use outside */                 \
+        movwx_ld(Reax,  Mebp, inf_SCR01((nx)/2))                            \
+        movwx_st(Reax,  Mebp, inf_SCR02(cvyos_lo(nx)))                      \
+        movwx_mi(Mebp,  inf_SCR02(cvyos_hi(nx)), IB(0))
+
+#define cvyon_rx(nx) /* not portable, do not use outside */                 \
+        movwx_ld(Reax,  Mebp, inf_SCR01((nx)/2))                            \
+        movwx_st(Reax,  Mebp, inf_SCR02(cvyos_lo(nx)))                      \
+        shrwn_ri(Reax,  IB(31))                                             \
+        movwx_st(Reax,  Mebp, inf_SCR02(cvyos_hi(nx)))
+
+#define cvuox_rx(nx) /* not portable, do not use outside */                 \
+        movwx_ld(Reax,  Mebp, inf_SCR01((nx)/2+Q*0x08))                     \
+        movwx_st(Reax,  Mebp, inf_SCR02(cvyos_lo(nx)))                      \
+        movwx_mi(Mebp,  inf_SCR02(cvyos_hi(nx)), IB(0))
+
+#define cvuon_rx(nx) /* not portable, do not use outside */                 \
+        movwx_ld(Reax,  Mebp, inf_SCR01((nx)/2+Q*0x08))                     \
+        movwx_st(Reax,  Mebp, inf_SCR02(cvyos_lo(nx)))                      \
+        shrwn_ri(Reax,  IB(31))                                             \
+        movwx_st(Reax,  Mebp, inf_SCR02(cvyos_hi(nx)))
+
+#define cvxqx_rx(nx) /* not portable, do not use outside */                 \
+        movwx_ld(Reax,  Mebp, inf_SCR01(cvyos_hi(nx)))                      \
+        movwx_rr(Recx,  Reax)                                               \
+        shrwn_ri(Reax,  IB(31))                                             \
+        notwx_rx(Reax)                                                      \
+        cvxqx_rc(nx)
+
+#define cvxqn_rx(nx) /* not portable, do not use outside */                 \
+        movwx_ld(Reax,  Mebp, inf_SCR01(cvyos_hi(nx)))                      \
+        movwx_ld(Recx,  Mebp, inf_SCR01(cvyos_lo(nx)))                      \
+        shrwn_ri(Recx,  IB(31))                                             \
+        xorwx_rr(Recx,  Reax)                                               \
+        shrwn_ri(Reax,  IB(31))                                             \
+        xorwx_ri(Reax,  IV(0x7FFFFFFF))                                     \
+        cvxqx_rc(nx)
+
+/* Recx holds the upper word xor-ed with its expected value, non-zero if out
+ * of range, then the lower word is replaced by the saturation value in Reax
+ * built from the sign of the upper word without branches */
+
+#define cvxqx_rc(nx) /* not portable, do not use outside */                 \
+        movwx_rr(Redx,  Recx)                                               \
+        negwx_rx(Redx)                                                      \
+        orrwx_rr(Recx,  Redx)                                               \
+        shrwn_ri(Recx,  IB(31))                                             \
+        movwx_ld(Redx,  Mebp, inf_SCR01(cvyos_lo(nx)))                      \
+        xorwx_rr(Reax,  Redx)                                               \
+        andwx_rr(Reax,  Recx)                                               \
+        xorwx_rr(Reax,  Redx)                                               \
+        movwx_st(Reax,  Mebp, inf_SCR02((nx)/2))
+
+/* muh (G = G * S), keeps upper half of the full-width product of 64-bit
+ * elements, unsigned-[x] or signed-[n], lower half is returned by mul
+ * muw (G = G * S), multiplies lower 32-bit halves of 64-bit elements into
+ * full 64-bit products, unsigned-[x] or signed-[n], upper halves are ignored
+ * targets without native mul-high use inf_SCR01/SCR02 and BASE-ops below */
+
+#if   (RT_SIMD == 256) && !(defined RT_SVEX1) && (defined muhdx_rr)
+
+#define muhqx_rr(XG, XS)                                                    \
+        muhdx_rr(W(XG), W(XS))
+
+#define muhqx_ld(XG, MS, DS)                                                \
+        muhdx_ld(W(XG), W(MS), W(DS))
+
+#define muhqn_rr(XG, XS)                                                    \
+        muhdn_rr(W(XG), W(XS))
+
+#define muhqn_ld(XG, MS, DS)                                                \
+        muhdn_ld(W(XG), W(MS), W(DS))
+
+#elif (RT_SIMD == 128) && !(defined RT_SVEX1) && (defined muhjx_rr)
+
+#define muhqx_rr(XG, XS)                                                    \
+        muhjx_rr(W(XG), W(XS))
+
+#define muhqx_ld(XG, MS, DS)                                                \
+        muhjx_ld(W(XG), W(MS), W(DS))
+
+#define muhqn_rr(XG, XS)                                                    \
+        muhjn_rr(W(XG), W(XS))
+
+#define muhqn_ld(XG, MS, DS)                                                \
+        muhjn_ld(W(XG), W(MS), W(DS))
 
-#define rsets_rr(XD, XS)                                                    \
-        sqrts_rr(W(XD), W(XS))                                              \
-        movts_st(W(XD), Mebp, inf_SCR02(0))                                 \
-        movts_ld(W(XD), Mebp, inf_GPC01_64)                                 \
-        divts_ld(W(XD), Mebp, inf_SCR02(0))
+#endif /* RT_SIMD: 256, 128 */
 
-#define rssts_rr(XG, XS) /* destroys XS */
+#if   (RT_SIMD == 256) && !(defined RT_SVEX1) && (defined muwdx_rr)
 
-#endif /* RT_SIMD_COMPAT_RSQ */
+#define muwqx_rr(XG, XS)                                                    \
+        muwdx_rr(W(XG), W(XS))
 
-/* fma (G = G + S * T) if (#G != #S && #G != #T)
- * NOTE: x87 fpu-fallbacks for fma/fms use round-to-nearest mode by default,
- * enable RT_SIMD_COMPAT_FMR for current SIMD rounding mode to be honoured */
+#define muwqx_ld(XG, MS, DS)                                                \
+        muwdx_ld(W(XG), W(MS), W(DS))
 
-#if RT_SIMD_COMPAT_FMA == 2
+#define muwqn_rr(XG, XS)                                                    \
+        muwdn_rr(W(XG), W(XS))
 
-#define fmats_rr(XG, XS, XT)                                                \
-        movts_st(W(XS), Mebp, inf_SCR01(0))                                 \
-        mults_rr(W(XS), W(XT))                                              \
-        addts_rr(W(XG), W(XS))                                              \
-        movts_ld(W(XS), Mebp, inf_SCR01(0))
+#define muwqn_ld(XG, MS, DS)                                                \
+        muwdn_ld(W(XG), W(MS), W(DS))
 
-#define fmats_ld(XG, XS, MT, DT)                                            \
-        movts_st(W(XS), Mebp, inf_SCR01(0))                                 \
-        mults_ld(W(XS), W(MT), W(DT))                                       \
-        addts_rr(W(XG), W(XS))                                              \
-        movts_ld(W(XS), Mebp, inf_SCR01(0))
+#elif (RT_SIMD == 128) && !(defined RT_SVEX1) && (defined muwjx_rr)
 
-#endif /* RT_SIMD_COMPAT_FMA */
+#define muwqx_rr(XG, XS)                                                    \
+        muwjx_rr(W(XG), W(XS))
 
-#define fmats3rr(XG, XS, XT)                                                \
-        fmats_rr(W(XG), W(XS), W(XT))
+#define muwqx_ld(XG, MS, DS)                                                \
+        muwjx_ld(W(XG), W(MS), W(DS))
 
-#define fmats3ld(XG, XS, MT, DT)                                            \
-        fmats_ld(W(XG), W(XS), W(MT), W(DT))
+#define muwqn_rr(XG, XS)                                                    \
+        muwjn_rr(W(XG), W(XS))
 
-/* fms (G = G - S * T) if (#G != #S && #G != #T)
- * NOTE: due to final negation being outside of rounding on all POWER systems
- * only symmetric rounding modes (RN, RZ) are compatible across all targets */
+#define muwqn_ld(XG, MS, DS)                                                \
+        muwjn_ld(W(XG), W(MS), W(DS))
 
-#if RT_SIMD_COMPAT_FMS == 2
+#endif /* RT_SIMD: 256, 128 */
 
-#define fmsts_rr(XG, XS, XT)                                                \
-        movts_st(W(XS), Mebp, inf_SCR01(0))                                 \
-        mults_rr(W(XS), W(XT))                                              \
-        subts_rr(W(XG), W(XS))                                              \
-        movts_ld(W(XS), Mebp, inf_SCR01(0))
+#ifndef muhqx_rr
 
-#define fmsts_ld(XG, XS, MT, DT)                                            \
-        movts_st(W(XS), Mebp, inf_SCR01(0))                                 \
-        mults_ld(W(XS), W(MT), W(DT))                                       \
-        subts_rr(W(XG), W(XS))                                              \
-        movts_ld(W(XS), Mebp, inf_SCR01(0))
+#define muhqx_rr(XG, XS)                                                    \
+        movqx_st(W(XG), Mebp, inf_SCR01(0))                                 \
+        movqx_st(W(XS), Mebp, inf_SCR02(0))                                 \
+        cvyos_rs(muhqx_rx)                                                  \
+        movqx_ld(W(XG), Mebp, inf_SCR02(0))
+
+#define muhqx_ld(XG, MS, DS)                                                \
+        movqx_st(W(XG), Mebp, inf_SCR01(0))                                 \
+        movqx_ld(W(XG), W(MS), W(DS))                                       \
+        movqx_st(W(XG), Mebp, inf_SCR02(0))                                 \
+        cvyos_rs(muhqx_rx)                                                  \
+        movqx_ld(W(XG), Mebp, inf_SCR02(0))
+
+#define muhqn_rr(XG, XS)                                                    \
+        movqx_st(W(XG), Mebp, inf_SCR01(0))                                 \
+        movqx_st(W(XS), Mebp, inf_SCR02(0))                                 \
+        cvyos_rs(muhqn_rx)                                                  \
+        movqx_ld(W(XG), Mebp, inf_SCR02(0))
 
-#endif /* RT_SIMD_COMPAT_FMS */
+#define muhqn_ld(XG, MS, DS)                                                \
+        movqx_st(W(XG), Mebp, inf_SCR01(0))                                 \
+        movqx_ld(W(XG), W(MS), W(DS))                                       \
+        movqx_st(W(XG), Mebp, inf_SCR02(0))                                 \
+        cvyos_rs(muhqn_rx)                                                  \
+        movqx_ld(W(XG), Mebp, inf_SCR02(0))
 
-#define fmsts3rr(XG, XS, XT)                                                \
-        fmsts_rr(W(XG), W(XS), W(XT))
+#endif /* muhqx_rr */
 
-#define fmsts3ld(XG, XS, MT, DT)                                            \
-        fmsts_ld(W(XG), W(XS), W(MT), W(DT))
+#ifndef muwqx_rr
+
+#define muwqx_rr(XG, XS)                                                    \
+        movqx_st(W(XG), Mebp, inf_SCR01(0))                                 \
+        movqx_st(W(XS), Mebp, inf_SCR02(0))                                 \
+        cvyos_rs(muwqx_rx)                                                  \
+        movqx_ld(W(XG), Mebp, inf_SCR02(0))
+
+#define muwqx_ld(XG, MS, DS)                                                \
+        movqx_st(W(XG), Mebp, inf_SCR01(0))                                 \
+        movqx_ld(W(XG), W(MS), W(DS))                                       \
+        movqx_st(W(XG), Mebp, inf_SCR02(0))                                 \
+        cvyos_rs(muwqx_rx)                                                  \
+        movqx_ld(W(XG), Mebp, inf_SCR02(0))
+
+#define muwqn_rr(XG, XS)                                                    \
+        movqx_st(W(XG), Mebp, inf_SCR01(0))                                 \
+        movqx_st(W(XS), Mebp, inf_SCR02(0))                                 \
+        cvyos_rs(muwqn_rx)                                                  \
+        movqx_ld(W(XG), Mebp, inf_SCR02(0))
+
+#define muwqn_ld(XG, MS, DS)                                                \
+        movqx_st(W(XG), Mebp, inf_SCR01(0))                                 \
+        movqx_ld(W(XG), W(MS), W(DS))                                       \
+        movqx_st(W(XG), Mebp, inf_SCR02(0))                                 \
+        cvyos_rs(muwqn_rx)                                                  \
+        movqx_ld(W(XG), Mebp, inf_SCR02(0))
+
+#endif /* muwqx_rr */
+
+/* 64-bit mul-high uses the double-width BASE multiply with Redx:Reax per
+ * element, which is cheaper than combining four 32-bit partial products in
+ * SIMD registers on targets without a native 64-bit mul-high,
+ * targets with 32-bit BASE registers combine 32-bit partial products
+ * (signed: upper words as signed, cross-products corrected to signed) */
+
+#if (defined mulzx_xm)
+
+#define muhqx_rx(nx) /* not portable, do not use outside */                 \
+        movzx_ld(Reax,  Mebp, inf_SCR01(nx))                                \
+        mulzx_xm(Mebp,  inf_SCR02(nx))                                      \
+        movzx_st(Redx,  Mebp, inf_SCR02(nx))
+
+#define muhqn_rx(nx) /* not portable, do not use outside */                 \
+        movzx_ld(Reax,  Mebp, inf_SCR01(nx))                                \
+        mulzn_xm(Mebp,  inf_SCR02(nx))                                      \
+        movzx_st(Redx,  Mebp, inf_SCR02(nx))
+
+#else  /* !(defined mulzx_xm) */
+
+#define muhqx_rx(nx) /* not portable, do not use outside */                 \
+        movwx_ld(Reax,  Mebp, inf_SCR01(cvyos_lo(nx)))                      \
+        mulwx_xm(Mebp,  inf_SCR02(cvyos_lo(nx)))                            \
+        movwx_rr(Recx,  Redx)                                               \
+        movwx_ld(Reax,  Mebp, inf_SCR01(cvyos_hi(nx)))                      \
+        mulwx_xm(Mebp,  inf_SCR02(cvyos_lo(nx)))                            \
+        movwx_st(Redx,  Mebp, inf_SCR02(cvyos_lo(nx)))                      \
+        muhqx_ra(Mebp,  inf_SCR02(cvyos_lo(nx)))                            \
+        movwx_ld(Reax,  Mebp, inf_SCR01(cvyos_lo(nx)))                      \
+        mulwx_xm(Mebp,  inf_SCR02(cvyos_hi(nx)))                            \
+        movwx_st(Redx,  Mebp, inf_SCR01(cvyos_lo(nx)))                      \
+        muhqx_ra(Mebp,  inf_SCR01(cvyos_lo(nx)))                            \
+        movwx_ld(Reax,  Mebp, inf_SCR01(cvyos_hi(nx)))                      \
+        mulwx_xm(Mebp,  inf_SCR02(cvyos_hi(nx)))                            \
+        movwx_st(Redx,  Mebp, inf_SCR01(cvyos_hi(nx)))                      \
+        muhqx_rh(nx)
+
+#define muhqn_rx(nx) /* not portable, do not use outside */                 \
+        movwx_ld(Reax,  Mebp, inf_SCR01(cvyos_lo(nx)))                      \
+        mulwx_xm(Mebp,  inf_SCR02(cvyos_lo(nx)))                            \
+        movwx_rr(Recx,  Redx)                                               \
+        movwx_ld(Reax,  Mebp, inf_SCR01(cvyos_hi(nx)))                      \
+        mulwx_xm(Mebp,  inf_SCR02(cvyos_lo(nx)))                            \
+        movwx_ld(Rebx,  Mebp, inf_SCR01(cvyos_hi(nx)))                      \
+        shrwn_ri(Rebx,  IB(31))                                             \
+        andwx_ld(Rebx,  Mebp, inf_SCR02(cvyos_lo(nx)))                      \
+        subwx_rr(Redx,  Rebx)                                               \
+        movwx_st(Redx,  Mebp, inf_SCR02(cvyos_lo(nx)))                      \
+        muhqx_ra(Mebp,  inf_SCR02(cvyos_lo(nx)))                            \
+        movwx_ld(Reax,  Mebp, inf_SCR01(cvyos_lo(nx)))                      \
+        mulwx_xm(Mebp,  inf_SCR02(cvyos_hi(nx)))                            \
+        movwx_ld(Rebx,  Mebp, inf_SCR02(cvyos_hi(nx)))                      \
+        shrwn_ri(Rebx,  IB(31))                                             \
+        andwx_ld(Rebx,  Mebp, inf_SCR01(cvyos_lo(nx)))                      \
+        subwx_rr(Redx,  Rebx)                                               \
+        movwx_st(Redx,  Mebp, inf_SCR01(cvyos_lo(nx)))                      \
+        muhqx_ra(Mebp,  inf_SCR01(cvyos_lo(nx)))                            \
+        movwx_ld(Reax,  Mebp, inf_SCR01(cvyos_hi(nx)))                      \
+        mulwn_xm(Mebp,  inf_SCR02(cvyos_hi(nx)))                            \
+        movwx_st(Redx,  Mebp, inf_SCR01(cvyos_hi(nx)))                      \
+        movwx_ld(Rebx,  Mebp, inf_SCR02(cvyos_lo(nx)))                      \
+        shrwn_ri(Rebx,  IB(31))                                             \
+        addwx_st(Rebx,  Mebp, inf_SCR01(cvyos_hi(nx)))                      \
+        movwx_ld(Rebx,  Mebp, inf_SCR01(cvyos_lo(nx)))                      \
+        shrwn_ri(Rebx,  IB(31))                                             \
+        addwx_st(Rebx,  Mebp, inf_SCR01(cvyos_hi(nx)))                      \
+        muhqx_rh(nx)
+
+/* combine (hi * hi) from Redx:Reax (Redx already in SCR01 upper word) with
+ * upper halves of cross-products (+ carries) kept in lower words of SCR02 and
+ * SCR01, write the resulting upper half of the full product to SCR02 */
+
+#define muhqx_rh(nx) /* not portable, do not use outside */                 \
+        movwx_rr(Recx,  Reax)                                               \
+        movwx_ld(Reax,  Mebp, inf_SCR02(cvyos_lo(nx)))                      \
+        muhqx_ra(Mebp,  inf_SCR01(cvyos_hi(nx)))                            \
+        movwx_ld(Reax,  Mebp, inf_SCR01(cvyos_lo(nx)))                      \
+        muhqx_ra(Mebp,  inf_SCR01(cvyos_hi(nx)))                            \
+        movwx_st(Recx,  Mebp, inf_SCR02(cvyos_lo(nx)))                      \
+        movwx_ld(Reax,  Mebp, inf_SCR01(cvyos_hi(nx)))                      \
+        movwx_st(Reax,  Mebp, inf_SCR02(cvyos_hi(nx)))
+
+/* add Reax to Recx, then add carry-out to word in memory without branches,
+ * carry = ((x & y) | ((x | y) & ~(x + y))) >> 31, destroys Reax, Rebx, Redx */
+
+#define muhqx_ra(MG, DG) /* not portable, do not use outside */             \
+        movwx_rr(Redx,  Recx)                                               \
+        addwx_rr(Recx,  Reax)                                               \
+        movwx_rr(Rebx,  Redx)                                               \
+        andwx_rr(Rebx,  Reax)                                               \
+        orrwx_rr(Reax,  Redx)                                               \
+        movwx_rr(Redx,  Recx)                                               \
+        notwx_rx(Redx)                                                      \
+        andwx_rr(Reax,  Redx)                                               \
+        orrwx_rr(Rebx,  Reax)                                               \
+        shrwx_ri(Rebx,  IB(31))                                             \
+        addwx_st(Rebx,  W(MG),  W(DG))
+
+#endif /* !(defined mulzx_xm) */
+
+#define muwqx_rx(nx) /* not portable, do not use outside */                 \
+        movwx_ld(Reax,  Mebp, inf_SCR01(cvyos_lo(nx)))                      \
+        mulwx_xm(Mebp,  inf_SCR02(cvyos_lo(nx)))                            \
+        movwx_st(Reax,  Mebp, inf_SCR02(cvyos_lo(nx)))                      \
+        movwx_st(Redx,  Mebp, inf_SCR02(cvyos_hi(nx)))
+
+#define muwqn_rx(nx) /* not portable, do not use outside */                 \
+        movwx_ld(Reax,  Mebp, inf_SCR01(cvyos_lo(nx)))                      \
+        mulwn_xm(Mebp,  inf_SCR02(cvyos_lo(nx)))                            \
+        movwx_st(Reax,  Mebp, inf_SCR02(cvyos_lo(nx)))                      \
+        movwx_st(Redx,  Mebp, inf_SCR02(cvyos_hi(nx)))
 
 /******************************************************************************/
 /**** var-len **** SIMD instructions with fixed-16-bit element **** 256-bit ***/
@@ -1057,6 +4353,25 @@
 #define mmvmb_st(XS, MG, DG)                                                \
         mmvab_st(W(XS), W(MG), W(DG))
 
+/* tbl (G = G[S]), (D = S[T]) if (#D != #T) look up bytes within 128-bit lanes
+ * indices 0-15 pick bytes in the same lane, 0x80-0xFF produce zero bytes */
+
+#if (defined tblab3rr)
+
+#define tblmb_rr(XG, XS)                                                    \
+        tblab_rr(W(XG), W(XS))
+
+#define tblmb_ld(XG, MS, DS)                                                \
+        tblab_ld(W(XG), W(MS), W(DS))
+
+#define tblmb3rr(XD, XS, XT)                                                \
+        tblab3rr(W(XD), W(XS), W(XT))
+
+#define tblmb3ld(XD, XS, MT, DT)                                            \
+        tblab3ld(W(XD), W(XS), W(MT), W(DT))
+
+#endif /* tblab3rr */
+
 /* and (G = G & S), (D = S & T) if (#D != #T) */
 
 #define andmx_rr(XG, XS)                                                    \
@@ -2292,6 +5607,25 @@
 #define mmvmb_st(XS, MG, DG)                                                \
         mmvgb_st(W(XS), W(MG), W(DG))
 
+/* tbl (G = G[S]), (D = S[T]) if (#D != #T) look up bytes within 128-bit lanes
+ * indices 0-15 pick bytes in the same lane, 0x80-0xFF produce zero bytes */
+
+#if (defined tblgb3rr)
+
+#define tblmb_rr(XG, XS)                                                    \
+        tblgb_rr(W(XG), W(XS))
+
+#define tblmb_ld(XG, MS, DS)                                                \
+        tblgb_ld(W(XG), W(MS), W(DS))
+
+#define tblmb3rr(XD, XS, XT)                                                \
+        tblgb3rr(W(XD), W(XS), W(XT))
+
+#define tblmb3ld(XD, XS, MT, DT)                                            \
+        tblgb3ld(W(XD), W(XS), W(MT), W(DT))
+
+#endif /* tblgb3rr */
+
 /* and (G = G & S), (D = S & T) if (#D != #T) */
 
 #define andmx_rr(XG, XS)                                                    \
@@ -3482,6 +6816,97 @@
 
 #endif /* RT_SIMD: 256, 128 */
 
+#if (defined movmx_st) && !(defined tblmb3rr)
+
+/* tbl (G = G[S]), (D = S[T]) if (#D != #T) look up bytes within 128-bit lanes
+ * indices 0-15 pick bytes in the same lane, 0x80-0xFF produce zero bytes
+ * targets without native byte lookups use inf_SCR01/SCR02 and BASE-loads */
+
+#define tblmb_rr(XG, XS)                                                    \
+        tblmb3rr(W(XG), W(XG), W(XS))
+
+#define tblmb_ld(XG, MS, DS)                                                \
+        tblmb3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define tblmb3rr(XD, XS, XT)                                                \
+        movmx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movmx_st(W(XT), Mebp, inf_SCR02(0))                                 \
+        stack_st(Reax)                                                      \
+        stack_st(Recx)                                                      \
+        tblmb_rn(0x00)                                                      \
+        stack_ld(Recx)                                                      \
+        stack_ld(Reax)                                                      \
+        movmx_ld(W(XD), Mebp, inf_SCR02(0))
+
+#define tblmb3ld(XD, XS, MT, DT)                                            \
+        movmx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movmx_ld(W(XD), W(MT), W(DT))                                       \
+        movmx_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        stack_st(Reax)                                                      \
+        stack_st(Recx)                                                      \
+        tblmb_rn(0x00)                                                      \
+        stack_ld(Recx)                                                      \
+        stack_ld(Reax)                                                      \
+        movmx_ld(W(XD), Mebp, inf_SCR02(0))
+
+#define tblmb_rx(cx, nx) /* not portable, do not use outside */             \
+        movbz_ld(Reax,  Mebp, inf_SCR02(nx))                                \
+        movwx_rr(Recx,  Reax)                                               \
+        shrwx_ri(Recx,  IB(7))                                              \
+        subwx_ri(Recx,  IB(1))                                              \
+        andwx_ri(Reax,  IB(15))                                             \
+        movbz_ld(Reax,  Iebp, inf_SCR01(cx))                                \
+        andwx_rr(Reax,  Recx)                                               \
+        movbx_st(Reax,  Mebp, inf_SCR02(nx))
+
+#define tblmb_r1(nx) /* not portable, do not use outside */                 \
+        tblmb_rx(nx, nx+0x00)                                               \
+        tblmb_rx(nx, nx+0x01)                                               \
+        tblmb_rx(nx, nx+0x02)                                               \
+        tblmb_rx(nx, nx+0x03)                                               \
+        tblmb_rx(nx, nx+0x04)                                               \
+        tblmb_rx(nx, nx+0x05)                                               \
+        tblmb_rx(nx, nx+0x06)                                               \
+        tblmb_rx(nx, nx+0x07)                                               \
+        tblmb_rx(nx, nx+0x08)                                               \
+        tblmb_rx(nx, nx+0x09)                                               \
+        tblmb_rx(nx, nx+0x0A)                                               \
+        tblmb_rx(nx, nx+0x0B)                                               \
+        tblmb_rx(nx, nx+0x0C)                                               \
+        tblmb_rx(nx, nx+0x0D)                                               \
+        tblmb_rx(nx, nx+0x0E)                                               \
+        tblmb_rx(nx, nx+0x0F)
+
+#define tblmb_r2(nx) /* not portable, do not use outside */                 \
+        tblmb_r1(nx+0x00)                                                   \
+        tblmb_r1(nx+0x10)
+
+#define tblmb_r3(nx) /* not portable, do not use outside */                 \
+        tblmb_r2(nx+0x00)                                                   \
+        tblmb_r2(nx+0x20)
+
+#define tblmb_r4(nx) /* not portable, do not use outside */                 \
+        tblmb_r3(nx+0x00)                                                   \
+        tblmb_r3(nx+0x40)
+
+#define tblmb_r5(nx) /* not portable, do not use outside */                 \
+        tblmb_r4(nx+0x00)                                                   \
+        tblmb_r4(nx+0x80)
+
+#if   (RT_SIMD == 2048)
+#define tblmb_rn(nx)        tblmb_r5(nx)
+#elif (RT_SIMD == 1024)
+#define tblmb_rn(nx)        tblmb_r4(nx)
+#elif (RT_SIMD == 512)
+#define tblmb_rn(nx)        tblmb_r3(nx)
+#elif (RT_SIMD == 256)
+#define tblmb_rn(nx)        tblmb_r2(nx)
+#elif (RT_SIMD == 128)
+#define tblmb_rn(nx)        tblmb_r1(nx)
+#endif /* RT_SIMD: 2048, 1024, 512, 256, 128 */
+
+#endif /* tblmb3rr */
+
 /******************************************************************************/
 /**** var-len **** SIMD instructions with fixed-32-bit element **** 256-bit ***/
 /******************************************************************************/
@@ -7119,6 +10544,129 @@
 #define mmvpx_st(XS, MG, DG)                                                \
         mmvox_st(W(XS), W(MG), W(DG))
 
+/* gat (D = [M + S]) gather elements at per-lane indices S from M/DS,
+ * indices are in elements within [0, 2^31) (VSIB sign-extends 32-bit ones),
+ * M*** or Oeax, but not indexed modes (I***, ...), XD/XS differ,
+ * SIMD registers other than XD are preserved (masks are internal) */
+
+#define gatpx_ld(XD, XS, MS, DS)                                            \
+        gatox_ld(W(XD), W(XS), W(MS), W(DS))
+
+/* sct (M + T = S) scatter elements of S to per-lane indices T at M/DD,
+ * indices are in elements within [0, 2^31) (VSIB sign-extends 32-bit ones),
+ * M*** or Oeax, but not indexed modes (I***, ...),
+ * colliding indices are written in lane order (the highest lane wins) */
+
+#define sctpx_st(XS, XT, MD, DD)                                            \
+        sctox_st(W(XS), W(XT), W(MD), W(DD))
+
+/* mtl (D = S) move the first RS lanes only (loop tails), 0 <= RS <= S
+ * load zeroes the remaining lanes of XD, store keeps memory past RS lanes,
+ * memory past RS lanes is never accessed, RS holds the count as cmdw value,
+ * uses Xmm0 implicitly as a temp mask register, destroys Xmm0, XD/XS != Xmm0 */
+
+#define mtlpx_ld(XD, RS, MS, DS)                                            \
+        mtlox_ld(W(XD), W(RS), W(MS), W(DS))
+
+#define mtlpx_st(XS, RS, MD, DD)                                            \
+        mtlox_st(W(XS), W(RS), W(MD), W(DD))
+
+/* stn (D = S) non-temporal store, bypasses caches on the way to memory
+ * weakly-ordered, place sfnce_xx before [D] is read by other threads */
+
+#define stnpx_st(XS, MD, DD)                                                \
+        stnox_st(W(XS), W(MD), W(DD))
+
+/* bcs (D = [M]) broadcast scalar element from memory into all SIMD elements
+ * bcs (D = S) broadcast element-sized BASE register S into all SIMD elements */
+
+#define bcspx_ld(XD, MS, DS)                                                \
+        bcsox_ld(W(XD), W(MS), W(DS))
+
+#define bcspx_rr(XD, RS)                                                    \
+        bcsox_rr(W(XD), W(RS))
+
+/* shf (G = G[IS]), (D = S[IT]) shuffle elements within each 128-bit lane
+ * immediate fields select elements in each 128-bit lane (2-bit/1-bit wide) */
+
+#define shfpx_ri(XG, IS)                                                    \
+        shfox_ri(W(XG), W(IS))
+
+#define shfpx3ri(XD, XS, IT)                                                \
+        shfox3ri(W(XD), W(XS), W(IT))
+
+/* tbl (G = G[S]), (D = S[T]) permute elements across the SIMD register
+ * indices are in elements, taken modulo the number of elements in SIMD */
+
+#define tblpx_rr(XG, XS)                                                    \
+        tblox_rr(W(XG), W(XS))
+
+#define tblpx3rr(XD, XS, XT)                                                \
+        tblox3rr(W(XD), W(XS), W(XT))
+
+/* adi/ade (sum), mni/mxi (min/max) inclusive/exclusive prefix scans of S
+ * uses Xmm0 implicitly as a temp register, destroys Xmm0, XD/XS != Xmm0 */
+
+#define adips_rr(XD, XS)                                                    \
+        adios_rr(W(XD), W(XS))
+
+#define adipx_rr(XD, XS)                                                    \
+        adiox_rr(W(XD), W(XS))
+
+#define adeps_rr(XD, XS)                                                    \
+        adeos_rr(W(XD), W(XS))
+
+#define adepx_rr(XD, XS)                                                    \
+        adeox_rr(W(XD), W(XS))
+
+#define mnips_rr(XD, XS)                                                    \
+        mnios_rr(W(XD), W(XS))
+
+#define mnipx_rr(XD, XS)                                                    \
+        mniox_rr(W(XD), W(XS))
+
+#define mnipn_rr(XD, XS)                                                    \
+        mnion_rr(W(XD), W(XS))
+
+#define mxips_rr(XD, XS)                                                    \
+        mxios_rr(W(XD), W(XS))
+
+#define mxipx_rr(XD, XS)                                                    \
+        mxiox_rr(W(XD), W(XS))
+
+#define mxipn_rr(XD, XS)                                                    \
+        mxion_rr(W(XD), W(XS))
+
+/* cnt (D = number of bits set in each element of S), population count
+ * clz (D = number of leading zeroes in each element of S), elem-size if 0
+ * ctz (D = number of trailing zeroes in each element of S), elem-size if 0 */
+
+#define cntpx_rr(XD, XS)                                                    \
+        cntox_rr(W(XD), W(XS))
+
+#define cntpx_ld(XD, MS, DS)                                                \
+        cntox_ld(W(XD), W(MS), W(DS))
+
+#define clzpx_rr(XD, XS)                                                    \
+        clzox_rr(W(XD), W(XS))
+
+#define clzpx_ld(XD, MS, DS)                                                \
+        clzox_ld(W(XD), W(MS), W(DS))
+
+#define ctzpx_rr(XD, XS)                                                    \
+        ctzox_rr(W(XD), W(XS))
+
+#define ctzpx_ld(XD, MS, DS)                                                \
+        ctzox_ld(W(XD), W(MS), W(DS))
+
+/* bsw (D = S with the order of bytes reversed in each element), byte-swap */
+
+#define bswpx_rr(XD, XS)                                                    \
+        bswox_rr(W(XD), W(XS))
+
+#define bswpx_ld(XD, MS, DS)                                                \
+        bswox_ld(W(XD), W(MS), W(DS))
+
 /* and (G = G & S), (D = S & T) if (#D != #T) */
 
 #define andpx_rr(XG, XS)                                                    \
@@ -7693,6 +11241,21 @@
 #define mulpx3ld(XD, XS, MT, DT)                                            \
         mulox3ld(W(XD), W(XS), W(MT), W(DT))
 
+/* muh (G = G * S), keeps upper half of the full-width product of elements
+ * unsigned-[x] or signed-[n], lower half is returned by mul */
+
+#define muhpx_rr(XG, XS)                                                    \
+        muhox_rr(W(XG), W(XS))
+
+#define muhpx_ld(XG, MS, DS)                                                \
+        muhox_ld(W(XG), W(MS), W(DS))
+
+#define muhpn_rr(XG, XS)                                                    \
+        muhon_rr(W(XG), W(XS))
+
+#define muhpn_ld(XG, MS, DS)                                                \
+        muhon_ld(W(XG), W(MS), W(DS))
+
 /* shl (G = G << S), (D = S << T) if (#D != #T) - plain, unsigned
  * for maximum compatibility: shift count must be modulo elem-size */
 
@@ -10063,6 +13626,129 @@
 #define mmvpx_st(XS, MG, DG)                                                \
         mmvqx_st(W(XS), W(MG), W(DG))
 
+/* gat (D = [M + S]) gather elements at per-lane indices S from M/DS,
+ * indices are 64-bit in elements (only RT_ADDRESS bits are used when 32),
+ * M*** or Oeax, but not indexed modes (I***, ...), XD/XS differ,
+ * SIMD registers other than XD are preserved (masks are internal) */
+
+#define gatpx_ld(XD, XS, MS, DS)                                            \
+        gatqx_ld(W(XD), W(XS), W(MS), W(DS))
+
+/* sct (M + T = S) scatter elements of S to per-lane indices T at M/DD,
+ * indices are 64-bit in elements (only RT_ADDRESS bits are used when 32),
+ * M*** or Oeax, but not indexed modes (I***, ...),
+ * colliding indices are written in lane order (the highest lane wins) */
+
+#define sctpx_st(XS, XT, MD, DD)                                            \
+        sctqx_st(W(XS), W(XT), W(MD), W(DD))
+
+/* mtl (D = S) move the first RS lanes only (loop tails), 0 <= RS <= S
+ * load zeroes the remaining lanes of XD, store keeps memory past RS lanes,
+ * memory past RS lanes is never accessed, RS holds the count as cmdw value,
+ * uses Xmm0 implicitly as a temp mask register, destroys Xmm0, XD/XS != Xmm0 */
+
+#define mtlpx_ld(XD, RS, MS, DS)                                            \
+        mtlqx_ld(W(XD), W(RS), W(MS), W(DS))
+
+#define mtlpx_st(XS, RS, MD, DD)                                            \
+        mtlqx_st(W(XS), W(RS), W(MD), W(DD))
+
+/* stn (D = S) non-temporal store, bypasses caches on the way to memory
+ * weakly-ordered, place sfnce_xx before [D] is read by other threads */
+
+#define stnpx_st(XS, MD, DD)                                                \
+        stnqx_st(W(XS), W(MD), W(DD))
+
+/* bcs (D = [M]) broadcast scalar element from memory into all SIMD elements
+ * bcs (D = S) broadcast element-sized BASE register S into all SIMD elements */
+
+#define bcspx_ld(XD, MS, DS)                                                \
+        bcsqx_ld(W(XD), W(MS), W(DS))
+
+#define bcspx_rr(XD, RS)                                                    \
+        bcsqx_rr(W(XD), W(RS))
+
+/* shf (G = G[IS]), (D = S[IT]) shuffle elements within each 128-bit lane
+ * immediate fields select elements in each 128-bit lane (2-bit/1-bit wide) */
+
+#define shfpx_ri(XG, IS)                                                    \
+        shfqx_ri(W(XG), W(IS))
+
+#define shfpx3ri(XD, XS, IT)                                                \
+        shfqx3ri(W(XD), W(XS), W(IT))
+
+/* tbl (G = G[S]), (D = S[T]) permute elements across the SIMD register
+ * indices are in elements, taken modulo the number of elements in SIMD */
+
+#define tblpx_rr(XG, XS)                                                    \
+        tblqx_rr(W(XG), W(XS))
+
+#define tblpx3rr(XD, XS, XT)                                                \
+        tblqx3rr(W(XD), W(XS), W(XT))
+
+/* adi/ade (sum), mni/mxi (min/max) inclusive/exclusive prefix scans of S
+ * uses Xmm0 implicitly as a temp register, destroys Xmm0, XD/XS != Xmm0 */
+
+#define adips_rr(XD, XS)                                                    \
+        adiqs_rr(W(XD), W(XS))
+
+#define adipx_rr(XD, XS)                                                    \
+        adiqx_rr(W(XD), W(XS))
+
+#define adeps_rr(XD, XS)                                                    \
+        adeqs_rr(W(XD), W(XS))
+
+#define adepx_rr(XD, XS)                                                    \
+        adeqx_rr(W(XD), W(XS))
+
+#define mnips_rr(XD, XS)                                                    \
+        mniqs_rr(W(XD), W(XS))
+
+#define mnipx_rr(XD, XS)                                                    \
+        mniqx_rr(W(XD), W(XS))
+
+#define mnipn_rr(XD, XS)                                                    \
+        mniqn_rr(W(XD), W(XS))
+
+#define mxips_rr(XD, XS)                                                    \
+        mxiqs_rr(W(XD), W(XS))
+
+#define mxipx_rr(XD, XS)                                                    \
+        mxiqx_rr(W(XD), W(XS))
+
+#define mxipn_rr(XD, XS)                                                    \
+        mxiqn_rr(W(XD), W(XS))
+
+/* cnt (D = number of bits set in each element of S), population count
+ * clz (D = number of leading zeroes in each element of S), elem-size if 0
+ * ctz (D = number of trailing zeroes in each element of S), elem-size if 0 */
+
+#define cntpx_rr(XD, XS)                                                    \
+        cntqx_rr(W(XD), W(XS))
+
+#define cntpx_ld(XD, MS, DS)                                                \
+        cntqx_ld(W(XD), W(MS), W(DS))
+
+#define clzpx_rr(XD, XS)                                                    \
+        clzqx_rr(W(XD), W(XS))
+
+#define clzpx_ld(XD, MS, DS)                                                \
+        clzqx_ld(W(XD), W(MS), W(DS))
+
+#define ctzpx_rr(XD, XS)                                                    \
+        ctzqx_rr(W(XD), W(XS))
+
+#define ctzpx_ld(XD, MS, DS)                                                \
+        ctzqx_ld(W(XD), W(MS), W(DS))
+
+/* bsw (D = S with the order of bytes reversed in each element), byte-swap */
+
+#define bswpx_rr(XD, XS)                                                    \
+        bswqx_rr(W(XD), W(XS))
+
+#define bswpx_ld(XD, MS, DS)                                                \
+        bswqx_ld(W(XD), W(MS), W(DS))
+
 /* and (G = G & S), (D = S & T) if (#D != #T) */
 
 #define andpx_rr(XG, XS)                                                    \
@@ -10637,6 +14323,21 @@
 #define mulpx3ld(XD, XS, MT, DT)                                            \
         mulqx3ld(W(XD), W(XS), W(MT), W(DT))
 
+/* muh (G = G * S), keeps upper half of the full-width product of elements
+ * unsigned-[x] or signed-[n], lower half is returned by mul */
+
+#define muhpx_rr(XG, XS)                                                    \
+        muhqx_rr(W(XG), W(XS))
+
+#define muhpx_ld(XG, MS, DS)                                                \
+        muhqx_ld(W(XG), W(MS), W(DS))
+
+#define muhpn_rr(XG, XS)                                                    \
+        muhqn_rr(W(XG), W(XS))
+
+#define muhpn_ld(XG, MS, DS)                                                \
+        muhqn_ld(W(XG), W(MS), W(DS))
+
 /* shl (G = G << S), (D = S << T) if (#D != #T) - plain, unsigned
  * for maximum compatibility: shift count must be modulo elem-size */
 
@@ -13778,6 +17479,38 @@
 #define remxn_xm(MS, DS)    /* to be placed immediately after divxn_xm */   \
         remwn_xm(W(MS), W(DS))       /* to produce remainder Redx<-rem */
 
+/* cnt (D = number of bits set in S), population count
+ * clz (D = number of leading zeroes in S), 32 if S is 0
+ * ctz (D = number of trailing zeroes in S), 32 if S is 0
+ * set-flags: undefined */
+
+#define cntxx_rr(RD, RS)                                                    \
+        cntwx_rr(W(RD), W(RS))
+
+#define cntxx_ld(RD, MS, DS)                                                \
+        cntwx_ld(W(RD), W(MS), W(DS))
+
+#define clzxx_rr(RD, RS)                                                    \
+        clzwx_rr(W(RD), W(RS))
+
+#define clzxx_ld(RD, MS, DS)                                                \
+        clzwx_ld(W(RD), W(MS), W(DS))
+
+#define ctzxx_rr(RD, RS)                                                    \
+        ctzwx_rr(W(RD), W(RS))
+
+#define ctzxx_ld(RD, MS, DS)                                                \
+        ctzwx_ld(W(RD), W(MS), W(DS))
+
+/* bsw (D = S with the order of bytes reversed), byte-swap
+ * set-flags: no */
+
+#define bswxx_rr(RD, RS)                                                    \
+        bswwx_rr(W(RD), W(RS))
+
+#define bswxx_ld(RD, MS, DS)                                                \
+        bswwx_ld(W(RD), W(MS), W(DS))
+
 /* arj (G = G op S, if cc G then jump lb)
  * set-flags: undefined
  * refer to individual instruction descriptions
@@ -14571,6 +18304,38 @@
 #define remxn_xm(MS, DS)    /* to be placed immediately after divxn_xm */   \
         remzn_xm(W(MS), W(DS))       /* to produce remainder Redx<-rem */
 
+/* cnt (D = number of bits set in S), population count
+ * clz (D = number of leading zeroes in S), 64 if S is 0
+ * ctz (D = number of trailing zeroes in S), 64 if S is 0
+ * set-flags: undefined */
+
+#define cntxx_rr(RD, RS)                                                    \
+        cntzx_rr(W(RD), W(RS))
+
+#define cntxx_ld(RD, MS, DS)                                                \
+        cntzx_ld(W(RD), W(MS), W(DS))
+
+#define clzxx_rr(RD, RS)                                                    \
+        clzzx_rr(W(RD), W(RS))
+
+#define clzxx_ld(RD, MS, DS)                                                \
+        clzzx_ld(W(RD), W(MS), W(DS))
+
+#define ctzxx_rr(RD, RS)                                                    \
+        ctzzx_rr(W(RD), W(RS))
+
+#define ctzxx_ld(RD, MS, DS)                                                \
+        ctzzx_ld(W(RD), W(MS), W(DS))
+
+/* bsw (D = S with the order of bytes reversed), byte-swap
+ * set-flags: no */
+
+#define bswxx_rr(RD, RS)                                                    \
+        bswzx_rr(W(RD), W(RS))
+
+#define bswxx_ld(RD, MS, DS)                                                \
+        bswzx_ld(W(RD), W(MS), W(DS))
+
 /* arj (G = G op S, if cc G then jump lb)
  * set-flags: undefined
  * refer to individual instruction descriptions
@@ -15366,6 +19131,38 @@
 #define remyn_xm(MS, DS)    /* to be placed immediately after divyn_xm */   \
         remwn_xm(W(MS), W(DS))       /* to produce remainder Redx<-rem */
 
+/* cnt (D = number of bits set in S), population count
+ * clz (D = number of leading zeroes in S), 32 if S is 0
+ * ctz (D = number of trailing zeroes in S), 32 if S is 0
+ * set-flags: undefined */
+
+#define cntyx_rr(RD, RS)                                                    \
+        cntwx_rr(W(RD), W(RS))
+
+#define cntyx_ld(RD, MS, DS)                                                \
+        cntwx_ld(W(RD), W(MS), W(DS))
+
+#define clzyx_rr(RD, RS)                                                    \
+        clzwx_rr(W(RD), W(RS))
+
+#define clzyx_ld(RD, MS, DS)                                                \
+        clzwx_ld(W(RD), W(MS), W(DS))
+
+#define ctzyx_rr(RD, RS)                                                    \
+        ctzwx_rr(W(RD), W(RS))
+
+#define ctzyx_ld(RD, MS, DS)                                                \
+        ctzwx_ld(W(RD), W(MS), W(DS))
+
+/* bsw (D = S with the order of bytes reversed), byte-swap
+ * set-flags: no */
+
+#define bswyx_rr(RD, RS)                                                    \
+        bswwx_rr(W(RD), W(RS))
+
+#define bswyx_ld(RD, MS, DS)                                                \
+        bswwx_ld(W(RD), W(MS), W(DS))
+
 /* arj (G = G op S, if cc G then jump lb)
  * set-flags: undefined
  * refer to individual instruction descriptions
@@ -16118,6 +19915,38 @@
 #define remyn_xm(MS, DS)    /* to be placed immediately after divyn_xm */   \
         remzn_xm(W(MS), W(DS))       /* to produce remainder Redx<-rem */
 
+/* cnt (D = number of bits set in S), population count
+ * clz (D = number of leading zeroes in S), 64 if S is 0
+ * ctz (D = number of trailing zeroes in S), 64 if S is 0
+ * set-flags: undefined */
+
+#define cntyx_rr(RD, RS)                                                    \
+        cntzx_rr(W(RD), W(RS))
+
+#define cntyx_ld(RD, MS, DS)                                                \
+        cntzx_ld(W(RD), W(MS), W(DS))
+
+#define clzyx_rr(RD, RS)                                                    \
+        clzzx_rr(W(RD), W(RS))
+
+#define clzyx_ld(RD, MS, DS)                                                \
+        clzzx_ld(W(RD), W(MS), W(DS))
+
+#define ctzyx_rr(RD, RS)                                                    \
+        ctzzx_rr(W(RD), W(RS))
+
+#define ctzyx_ld(RD, MS, DS)                                                \
+        ctzzx_ld(W(RD), W(MS), W(DS))
+
+/* bsw (D = S with the order of bytes reversed), byte-swap
+ * set-flags: no */
+
+#define bswyx_rr(RD, RS)                                                    \
+        bswzx_rr(W(RD), W(RS))
+
+#define bswyx_ld(RD, MS, DS)                                                \
+        bswzx_ld(W(RD), W(MS), W(DS))
+
 /* arj (G = G op S, if cc G then jump lb)
  * set-flags: undefined
  * refer to individual instruction descriptions
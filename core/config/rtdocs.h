@@ -159,6 +159,18 @@
  * expressed in the same terms as Q (1/2/4/8/16), but is different from Q as it
  * always reflects the currently active SIMD width and not the maximal
  * SIMD width defined for the build.
+ *
+ * Within UniSIMD itself the same is streamlined with "core/config/rtmult.h",
+ * which derives target-specific namespace (RT_SIMD_SPACE) and SIMD target mask
+ * (RT_SIMD_MASK) from makefile flags for each object of a multi-target build,
+ * while the generic section picks the widest target supported at runtime from
+ * the result of verxx_xx() with mult_pick(), or the fastest one measured with
+ * a short calibration run at startup with mult_tune(). The choice can be pinned
+ * with RT_SIMD_TARGET environment variable (target name or SIMD target mask).
+ * Alternatively to RT_SIMD_QUADS, each object may keep its own Q
+ * if rtbase.h is included into the namespace.
+ * The test framework can be built that way too (simd_test.x64fat), in which
+ * case all x64 targets supported by the processor are tested from one binary.
  */
 
 /******************************************************************************/
@@ -198,8 +210,12 @@
  * Potential future improvement is to use an array instead of structure to avoid
  * possible paddings that compiler may introduce for its own needs (alignment),
  * in which case some parts of the assembler will need to be redesigned.
- * ASM_ENTER/LEAVE macros can be converted into just-in-time compilation along
- * with EMITW/EMITH/EMITB/LBL to avoid possible compiler issues with inline ASM.
+ * On x32/x64 targets ASM_ENTER/LEAVE along with EMITW/EMITH/EMITB can be
+ * switched to runtime code generation with RT_RUNTIME=1 in makefiles, in which
+ * case machine code is emitted into executable buffer and called from there
+ * (see "core/config/rtcode.h"), avoiding possible issues with inline ASM.
+ * Generated sections are cached per call site and SIMD target mask (ver),
+ * so that each kernel is only generated once (see RT_CODE_CACHE/LIMIT).
  * The order of arithmetic and shifts within internal definitions can be
  * hardened by using extra parentheses (in a form of round brackets).
  *
@@ -223,6 +239,22 @@
  * L*** definitions. Reax is also used for plain addressing mode (Oeax) without
  * displacement in which case PLAIN is passed as a displacement to cmd**_ld/st
  * instructions.
+ *
+ * As ASM_ENTER/LEAVE save/load all BASE and SIMD registers on every call,
+ * small ASM sections called in tight loops can use ASM_ENTER_R/LEAVE_R instead,
+ * which take two extra masks built with RM() from registers the section uses,
+ * like RM(Recx) | RM(Resi) for BASE and RM(Xmm0) | RM(Xmm1) for SIMD, and only
+ * save/load those (see sub-test 53 and -o option in "test/simd_test.cpp").
+ * Currently only x32/x64 targets honour the masks, others save all registers.
+ *
+ * Alternatively, a chain of small kernels can run within a single ASM section
+ * with a command queue (rt_SIMD_CMDQ in rtbase.h), where each command record
+ * (rt_SIMD_CMD) holds kernel id, size and argument pointers. Kernel bodies are
+ * registered with cmdqx_lb in a per-call table (rt_SIMD_CMDT in info-struct),
+ * which keeps the queue itself read-only and shareable across threads and
+ * code instances, cmdqx_go then dispatches each record to its kernel (Recx
+ * points to the record), which returns to the loop with cmdqx_nx
+ * (see sub-test 54 in "test/simd_test.cpp").
  */
 
 /******************************************************************************/
@@ -0,0 +1,316 @@
+/******************************************************************************/
+/* Copyright (c) 2013-2023 VectorChief (at github, bitbucket, sourceforge)    */
+/* Distributed under the MIT software license, see the accompanying           */
+/* file COPYING or http://www.opensource.org/licenses/mit-license.php         */
+/******************************************************************************/
+
+#ifndef RT_RTMULT_H
+#define RT_RTMULT_H
+
+/* system headers used by UniSIMD are included here (at global scope),
+ * so that rtbase.h included from within a target namespace doesn't */
+#include <math.h>
+#include <float.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#if   (defined RT_WIN32) || (defined RT_WIN64) /* Win32, MSVC -- Win64, GCC - */
+
+#include <windows.h>
+#include <io.h>
+
+#elif (defined RT_LINUX) /* Linux, GCC -------------------------------------- */
+
+#include <sys/mman.h>
+#include <dlfcn.h>
+
+#endif /* ------------- OS specific ----------------------------------------- */
+
+/******************************************************************************/
+/*********************************   LEGEND   *********************************/
+/******************************************************************************/
+
+/*
+ * rtmult.h: Multi-target configuration file (include before rtbase.h).
+ *
+ * A multi-target binary is linked from several objects compiled from the same
+ * portable code-base, one object per SIMD target, each with its own set of
+ * target flags in makefiles (RT_128/RT_256/RT_512/..., RT_SIMD_COMPAT_SSE).
+ * Every such object includes this header first and then wraps the rest of
+ * the code-base (including rtbase.h) into a target-specific namespace:
+ *
+ * #include "rtmult.h"
+ * namespace RT_SIMD_SPACE
+ * {
+ * #include "rtbase.h"
+ * ..
+ * }
+ *
+ * RT_SIMD_SPACE is derived from target flags as simd_<width>[r8]v<variant>,
+ * for example: simd_128v4 (SSE4), simd_128v4s2 (SSE2 with compat flag),
+ * simd_256v1 (AVX1), simd_256v2 (AVX2), simd_512v1 (AVX-512F) and so on.
+ * As all types and backend structures (rt_SIMD_INFO, rt_SIMD_REGS) are then
+ * declared within the namespace, each target keeps its own SIMD width (Q)
+ * without conflicts between objects. Alternatively, RT_MAXQ can be used to
+ * define backend structures for the maximal SIMD width in all objects.
+ *
+ * RT_SIMD_MASK is the bit (or bits) in rt_SIMD_INFO->ver format (rtzero.h)
+ * corresponding to the chosen target. Each target defines mult_mask(), which
+ * returns RT_SIMD_MASK bits present in rt_SIMD_INFO->ver detected by target's
+ * own verxx_xx(), 0 if the target is not supported by the running processor.
+ * Note that ASM section calling verxx_xx() shouldn't save SIMD registers
+ * (sregs_sa/sregs_la) or set SIMD control register, so that it can run on
+ * any processor of given arch, ASM_ENTER_B/ASM_LEAVE_B are provided for that.
+ *
+ * The generic section (compiled into one of the objects outside of target
+ * namespaces) declares target entry points with RT_SIMD_DECL, lists targets
+ * from narrowest to widest with RT_SIMD_ITEM and selects the widest target
+ * supported at runtime with mult_pick(), then calls the entry point via
+ * a cast of rt_SIMD_MULT->func to its original type.
+ *
+ * As the widest target isn't always the fastest (wider SIMD may lower clocks,
+ * which short kernels fail to amortize), mult_tune() can be used instead of
+ * mult_pick() to calibrate the selection at startup. Each target then defines
+ * mult_bench(cycles), which runs a representative kernel of the application
+ * given number of times, the target with the lowest time of RT_MULT_TUNE runs
+ * wins (the best of RT_MULT_RUNS attempts is taken to reduce noise). The runs
+ * should loop inside one ASM section, otherwise the per-call cost of saving
+ * SIMD registers in ASM_ENTER (highest for the widest targets) is measured
+ * instead of the kernel. Time is taken with a monotonic wall clock. Its mask
+ * from rt_SIMD_MULT->mask() is then used as the chosen SIMD target mask.
+ *
+ * Both selections can be overridden for reproducibility with RT_SIMD_TARGET
+ * environment variable (RT_MULT_PIN) set to target namespace (simd_256v2)
+ * or SIMD target mask in rt_SIMD_INFO->ver format (0x200), which is ignored
+ * if the pinned target is not found among supported targets of the binary.
+ */
+
+/******************************************************************************/
+/*******************************   DEFINITIONS   ******************************/
+/******************************************************************************/
+
+#ifndef RT_MULT_TUNE
+#define RT_MULT_TUNE        1000    /* kernel runs per calibration attempt */
+#endif /* RT_MULT_TUNE */
+
+#define RT_MULT_RUNS        3       /* calibration attempts per target */
+
+#define RT_MULT_PIN         "RT_SIMD_TARGET" /* env var to pin the target */
+
+#define RT_SIMD_NAME(pfx, var)      RT_SIMD_NAME_(pfx, var)
+#define RT_SIMD_NAME_(pfx, var)     pfx##var
+
+/*
+ * Determine SIMD width of the target (same as in rtbase.h).
+ */
+#if (defined RT_SIMD)
+/* RT_SIMD is already defined outside */
+#elif           (RT_2K8_R8)
+#define RT_SIMD 2048
+#elif (RT_1K4 || RT_1K4_R8)
+#define RT_SIMD 1024
+#elif (RT_512 || RT_512_R8)
+#define RT_SIMD 512
+#elif (RT_256 || RT_256_R8)
+#define RT_SIMD 256
+#elif (RT_128)
+#define RT_SIMD 128
+#endif /* RT_SIMD: 2048, 1024, 512, 256, 128 */
+
+/*
+ * Determine target namespace and SIMD target mask (in rt_SIMD_INFO->ver).
+ */
+#if   (defined RT_SIMD_SPACE)
+/* RT_SIMD_SPACE is already defined outside */
+#elif (RT_2K8_R8) && (RT_SIMD == 2048)
+#define RT_SIMD_SPACE   RT_SIMD_NAME(simd_2K8r8v, RT_2K8_R8)
+#define RT_SIMD_MASK    ((RT_2K8_R8) << 0x1C)
+#elif (RT_1K4)    && (RT_SIMD == 1024)
+#define RT_SIMD_SPACE   RT_SIMD_NAME(simd_1K4v, RT_1K4)
+#define RT_SIMD_MASK    ((RT_1K4) << 0x18)
+#elif (RT_1K4_R8) && (RT_SIMD == 1024)
+#define RT_SIMD_SPACE   RT_SIMD_NAME(simd_1K4r8v, RT_1K4_R8)
+#define RT_SIMD_MASK    ((RT_1K4_R8) << 0x14)
+#elif (RT_512)    && (RT_SIMD == 512)
+#define RT_SIMD_SPACE   RT_SIMD_NAME(simd_512v, RT_512)
+#define RT_SIMD_MASK    ((RT_512) << 0x10)
+#elif (RT_512_R8) && (RT_SIMD == 512)
+#define RT_SIMD_SPACE   RT_SIMD_NAME(simd_512r8v, RT_512_R8)
+#define RT_SIMD_MASK    ((RT_512_R8) << 0x0C)
+#elif (RT_256)    && (RT_SIMD == 256)
+#define RT_SIMD_SPACE   RT_SIMD_NAME(simd_256v, RT_256)
+#define RT_SIMD_MASK    ((RT_256) << 0x08)
+#elif (RT_256_R8) && (RT_SIMD == 256)
+#define RT_SIMD_SPACE   RT_SIMD_NAME(simd_256r8v, RT_256_R8)
+#define RT_SIMD_MASK    ((RT_256_R8) << 0x04)
+#elif (RT_128)    && (RT_SIMD == 128) && (RT_SIMD_COMPAT_SSE == 2)
+#define RT_SIMD_SPACE   RT_SIMD_NAME(RT_SIMD_NAME(simd_128v, RT_128), s2)
+#define RT_SIMD_MASK    ((RT_128) << 0x00)
+#elif (RT_128)    && (RT_SIMD == 128)
+#define RT_SIMD_SPACE   RT_SIMD_NAME(simd_128v, RT_128)
+#define RT_SIMD_MASK    ((RT_128) << 0x00)
+#else  /* report an error if target namespace is not selected */
+#error "couldn't select appropriate SIMD target, check build flags"
+#endif /* RT_SIMD: 2048, 1024, 512, 256, 128 */
+
+/*
+ * Declare target's entry point "decl" along with mult_mask()/mult_bench().
+ */
+#define RT_SIMD_DECL(space, decl)                                           \
+namespace space                                                             \
+{                                                                           \
+    unsigned int mult_mask();                                               \
+    void mult_bench(int cycles);                                            \
+    decl;                                                                   \
+}
+
+/*
+ * Fill in multi-target descriptor for entry point "func" in "space".
+ */
+#define RT_SIMD_ITEM(space, func)                                           \
+    { #space, space::mult_mask, space::mult_bench, (rt_FUNC_MULT)space::func }
+
+typedef unsigned int (*rt_FUNC_MASK)();
+typedef void (*rt_FUNC_TUNE)(int cycles);
+typedef void (*rt_FUNC_MULT)();
+
+/*
+ * Multi-target descriptor, used in generic section of the binary.
+ */
+struct rt_SIMD_MULT
+{
+    const char     *name;   /* target namespace name */
+    rt_FUNC_MASK    mask;   /* target's mult_mask(), 0 - not supported */
+    rt_FUNC_TUNE    tune;   /* target's mult_bench() for calibration */
+    rt_FUNC_MULT    func;   /* target's entry point (cast to actual type) */
+};
+
+/*
+ * Return index of the target pinned with RT_SIMD_TARGET environment variable,
+ * -1 if the variable isn't set or the pinned target is not supported.
+ */
+static
+int mult_pin(const rt_SIMD_MULT *list, int num)
+{
+    const char *pin = getenv(RT_MULT_PIN);
+    char *end = NULL;
+    unsigned int mask, m;
+    int i;
+
+    if (pin == NULL || pin[0] == '\0')
+    {
+        return -1;
+    }
+
+    mask = (unsigned int)strtoul(pin, &end, 0);
+
+    for (i = num - 1; i >= 0; i--)
+    {
+        m = list[i].mask();
+        if (m != 0 && (strcmp(list[i].name, pin) == 0
+                   || (end != pin && *end == '\0' && (m & mask) != 0)))
+        {
+            break;
+        }
+    }
+
+    return i;
+}
+
+/*
+ * Return index of the widest target supported by the running processor,
+ * "list" is ordered from narrowest to widest, -1 if none is supported.
+ */
+static
+int mult_pick(const rt_SIMD_MULT *list, int num)
+{
+    int i = mult_pin(list, num);
+
+    if (i >= 0)
+    {
+        return i;
+    }
+
+    for (i = num - 1; i >= 0; i--)
+    {
+        if (list[i].mask() != 0)
+        {
+            break;
+        }
+    }
+
+    return i;
+}
+
+/*
+ * Get monotonic wall-clock time in seconds for calibration
+ * (clock() measures process CPU time, which misses stalls and wait states).
+ */
+static
+double mult_time()
+{
+#if   (defined RT_WIN32) || (defined RT_WIN64) /* Win32, MSVC -- Win64, GCC - */
+
+    LARGE_INTEGER fr, tm;
+    QueryPerformanceFrequency(&fr);
+    QueryPerformanceCounter(&tm);
+    return (double)tm.QuadPart / (double)fr.QuadPart;
+
+#else /* Linux, GCC -------------------------------------------------------- */
+
+    struct timespec tm;
+    clock_gettime(CLOCK_MONOTONIC, &tm);
+    return (double)tm.tv_sec + (double)tm.tv_nsec * 1.0e-9;
+
+#endif /* ------------- OS specific ----------------------------------------- */
+}
+
+/*
+ * Return index of the fastest target supported by the running processor
+ * as measured with targets' mult_bench(), the wider target wins on a tie,
+ * -1 if none is supported.
+ */
+static
+int mult_tune(const rt_SIMD_MULT *list, int num)
+{
+    double best = 0.0, time, t;
+    int i, j, k = mult_pin(list, num);
+
+    if (k >= 0)
+    {
+        return k;
+    }
+
+    for (i = 0; i < num; i++)
+    {
+        if (list[i].mask() == 0)
+        {
+            continue;
+        }
+
+        for (time = 0, j = 0; j < RT_MULT_RUNS; j++)
+        {
+            t = mult_time();
+            list[i].tune(RT_MULT_TUNE);
+            t = mult_time() - t;
+
+            time = (j == 0 || t < time) ? t : time;
+        }
+
+        if (k < 0 || time <= best)
+        {
+            best = time;
+            k = i;
+        }
+    }
+
+    return k;
+}
+
+#endif /* RT_RTMULT_H */
+
+/******************************************************************************/
+/******************************************************************************/
+/******************************************************************************/
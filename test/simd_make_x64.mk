@@ -13,6 +13,8 @@ LIB_LIST =                              \
 
 build: build_x64 build_x64avx build_x64avx512
 clang: clang_x64 clang_x64avx clang_x64avx512
+runtime: build_x64rt
+fat: build_x64fat
 
 strip:
 	strip simd_test.x64*
@@ -124,6 +126,62 @@ simd_test_x64f64avx512:
       ${INC_PATH} ${SRC_LIST} ${LIB_PATH} ${LIB_LIST} -o simd_test.x64f64avx512
 
 
+build_x64rt: simd_test_x64f32rt simd_test_x64f64rt
+
+simd_test_x64f32rt:
+	g++ -O3 -g \
+        -DRT_LINUX -DRT_X64 -DRT_256_R8=4 -DRT_RUNTIME=1 -DRT_DEBUG=0 \
+        -DRT_POINTER=64 -DRT_ADDRESS=64 -DRT_ELEMENT=32 -DRT_ENDIAN=0 \
+      ${INC_PATH} ${SRC_LIST} ${LIB_PATH} ${LIB_LIST} -o simd_test.x64f32rt
+
+simd_test_x64f64rt:
+	g++ -O3 -g \
+        -DRT_LINUX -DRT_X64 -DRT_256_R8=4 -DRT_RUNTIME=1 -DRT_DEBUG=0 \
+        -DRT_POINTER=64 -DRT_ADDRESS=64 -DRT_ELEMENT=64 -DRT_ENDIAN=0 \
+      ${INC_PATH} ${SRC_LIST} ${LIB_PATH} ${LIB_LIST} -o simd_test.x64f64rt
+
+
+build_x64fat: simd_test_x64fat
+
+simd_test_x64fat:
+	g++ -O3 -g -c \
+        -DRT_LINUX -DRT_X64 -DRT_128=4 -DRT_SIMD_COMPAT_SSE=2 -DRT_DEBUG=0 \
+        -DRT_POINTER=64 -DRT_ADDRESS=64 -DRT_ELEMENT=32 -DRT_ENDIAN=0 \
+        -DRT_SIMD_MULT=2 \
+      ${INC_PATH} ${SRC_LIST} -o simd_test.x64fat_128v4s2.o
+	g++ -O3 -g -c \
+        -DRT_LINUX -DRT_X64 -DRT_128=4 -DRT_DEBUG=0 \
+        -DRT_POINTER=64 -DRT_ADDRESS=64 -DRT_ELEMENT=32 -DRT_ENDIAN=0 \
+        -DRT_SIMD_MULT=1 \
+      ${INC_PATH} ${SRC_LIST} -o simd_test.x64fat_128v4.o
+	g++ -O3 -g -c \
+        -DRT_LINUX -DRT_X64 -DRT_256=1 -DRT_DEBUG=0 \
+        -DRT_POINTER=64 -DRT_ADDRESS=64 -DRT_ELEMENT=32 -DRT_ENDIAN=0 \
+        -DRT_SIMD_MULT=1 \
+      ${INC_PATH} ${SRC_LIST} -o simd_test.x64fat_256v1.o
+	g++ -O3 -g -c \
+        -DRT_LINUX -DRT_X64 -DRT_256=2 -DRT_DEBUG=0 \
+        -DRT_POINTER=64 -DRT_ADDRESS=64 -DRT_ELEMENT=32 -DRT_ENDIAN=0 \
+        -DRT_SIMD_MULT=1 \
+      ${INC_PATH} ${SRC_LIST} -o simd_test.x64fat_256v2.o
+	g++ -O3 -g -c \
+        -DRT_LINUX -DRT_X64 -DRT_512=1 -DRT_DEBUG=0 \
+        -DRT_POINTER=64 -DRT_ADDRESS=64 -DRT_ELEMENT=32 -DRT_ENDIAN=0 \
+        -DRT_SIMD_MULT=1 \
+      ${INC_PATH} ${SRC_LIST} -o simd_test.x64fat_512v1.o
+	g++ -O3 -g -c \
+        -DRT_LINUX -DRT_X64 -DRT_512=2 -DRT_DEBUG=0 \
+        -DRT_POINTER=64 -DRT_ADDRESS=64 -DRT_ELEMENT=32 -DRT_ENDIAN=0 \
+        -DRT_SIMD_MULT=1 \
+      ${INC_PATH} ${SRC_LIST} -o simd_test.x64fat_512v2.o
+	g++ -O3 -g \
+      simd_test.x64fat_128v4s2.o simd_test.x64fat_128v4.o \
+      simd_test.x64fat_256v1.o simd_test.x64fat_256v2.o \
+      simd_test.x64fat_512v1.o simd_test.x64fat_512v2.o \
+      ${LIB_PATH} ${LIB_LIST} -o simd_test.x64fat
+	rm simd_test.x64fat_*.o
+
+
 clang_x64: simd_test.x64_32 simd_test.x64_64 simd_test.x64f32 simd_test.x64f64
 
 simd_test.x64_32:
@@ -261,6 +319,7 @@ simd_test.x64f64avx512:
 # For 512-bit AVX512DQ build use (replace): RT_512=2        (15 SIMD registers)
 # For 512-bit AVX512F  build use (replace): RT_512=4        (30 SIMD registers)
 # For 512-bit AVX512DQ build use (replace): RT_512=8        (30 SIMD registers)
+# For AVX512-VNNI dph/dpb use (add): RT_SIMD_COMPAT_DOT=1 (RT_256=8, RT_512=2/8)
 
 # For 1024-bit AVX512F  build use (replace): RT_1K4=1       (15 SIMD reg-pairs)
 # For 1024-bit AVX512DQ build use (replace): RT_1K4=2       (15 SIMD reg-pairs)
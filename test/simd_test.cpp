@@ -90,17 +90,36 @@
 #define RT_DATA 1
 #endif /* RT_OFFS_DATA */
 
+#ifdef RT_SIMD_MULT /* multi-target build, one object per SIMD target */
+#include "rtmult.h"
+#if (defined RT_LINUX)
+#include <sys/time.h>
+#endif /* RT_LINUX */
+namespace RT_SIMD_SPACE
+{
+#endif /* RT_SIMD_MULT */
+
 #include "rtbase.h"
 
 /******************************************************************************/
 /*******************************   DEFINITIONS   ******************************/
 /******************************************************************************/
 
-#define SUB_TEST            51
+#define SUB_TEST            70
 #define CYC_SIZE            1000000
+#define OVH_SIZE            1000000 /* calls per overhead test, ms = ns/call */
+#define RED_RUNS            16 /* reduction passes per call in sub-test 60 */
 
 #define ARR_SIZE            S*3 /* hardcoded in ASM sections, S = SIMD elems */
+#define STR_SIZE            0x100000 /* bytes in streaming array, pow of 2 */
+#define STR_WIND            0x40 /* 4-vector windows per streaming call */
+#define STR_STEP            (Q*0x1040) /* bytes between windows in array */
+#define STR_DIST            16 /* windows to prefetch ahead in the array */
+#define STR_WORK            16 /* dependent work per window in -s benchmark */
+#define STR_PASS            4 /* passes over the array per -s measurement */
+#define STR_BLCK            (Q*0x100) /* bytes per block in output array */
 #define MASK                (RT_SIMD_ALIGN - 1) /* SIMD alignment mask */
+#define ZCL_MASK            (MASK | 0x7F) /* 128-byte alignment for zcl */
 
 /* NOTE: floating point values are not tested for equality precisely due to
  * the slight difference in SIMD/FPU implementations across supported targets */
@@ -128,6 +147,12 @@ rt_si32     n_done      = SUB_TEST-1;   /* subtest-done (from command-line) */
 rt_si32     t_diff      = 2;          /* diff-threshold (from command-line) */
 rt_si32     r_test      = CYC_SIZE;   /* test-redundant (from command-line) */
 rt_bool     v_mode      = RT_FALSE;     /* verbose mode (from command-line) */
+rt_bool     o_mode      = RT_FALSE;   /* overhead test (from command-line) */
+rt_si32     s_size      = 0;      /* prefetch test MiB (from command-line) */
+
+#if RT_RUNTIME != 0 && RT_CODE_CACHE != 0
+rt_pstr     c_file      = RT_NULL;  /* code cache file (from command-line) */
+#endif /* RT_RUNTIME, RT_CODE_CACHE */
 
 /*
  * Get system time in milliseconds.
@@ -230,6 +255,45 @@ struct rt_SIMD_INFOX : public rt_SIMD_INFO
     rt_half*hso2;
 #define inf_HSO2            DS(Q*0x100 + Q*RT_OFFS_DATA + 0x010+0x040*P+E)
 
+    /* command queue */
+
+    rt_SIMD_CMDQ *cmdq;
+#define inf_CMDQ            DS(Q*0x100 + Q*RT_OFFS_DATA + 0x010+0x044*P+E)
+
+    /* gather indices */
+
+    rt_elem*idx0;
+#define inf_IDX0            DS(Q*0x100 + Q*RT_OFFS_DATA + 0x010+0x048*P+E)
+
+    /* streaming array */
+
+    rt_real*sar0;
+#define inf_SAR0            DS(Q*0x100 + Q*RT_OFFS_DATA + 0x010+0x04C*P+E)
+
+    rt_real*sptr;
+#define inf_SPTR            DS(Q*0x100 + Q*RT_OFFS_DATA + 0x010+0x050*P+E)
+
+    /* streaming output array */
+
+    rt_real*sar1;
+#define inf_SAR1            DS(Q*0x100 + Q*RT_OFFS_DATA + 0x010+0x054*P+E)
+
+    rt_real*sptw;
+#define inf_SPTW            DS(Q*0x100 + Q*RT_OFFS_DATA + 0x010+0x058*P+E)
+
+    /* prefetch benchmark */
+
+    rt_si32 smsk;
+#define inf_SMSK            DS(Q*0x100 + Q*RT_OFFS_DATA + 0x010+0x05C*P+0x000)
+
+    rt_si32 sdst;
+#define inf_SDST            DS(Q*0x100 + Q*RT_OFFS_DATA + 0x010+0x05C*P+0x004)
+
+    /* command-queue executor table (per call) */
+
+    rt_SIMD_CMDT cmdt;
+#define inf_CMDT            DS(Q*0x100 + Q*RT_OFFS_DATA + 0x010+0x05C*P+0x008)
+
 };
 
 /*
@@ -7662,165 +7726,3336 @@ rt_void p_test51(rt_SIMD_INFOX *info)
 #endif /* SUB_TEST 51 */
 
 /******************************************************************************/
-/*********************************   TABLES   *********************************/
+/*******************************   SUB TEST 52   ******************************/
 /******************************************************************************/
 
-typedef rt_void (*testXX)(rt_SIMD_INFOX *);
+#if SUB_TEST >= 52
 
-volatile
-testXX c_test[SUB_TEST] =
+rt_void c_test52(rt_SIMD_INFOX *info)
 {
-#if SUB_TEST >=  1
-    c_test01,
-#endif /* SUB_TEST  1 */
+    rt_si32 j, n = info->size;
 
-#if SUB_TEST >=  2
-    c_test02,
-#endif /* SUB_TEST  2 */
+    rt_real *far0 = info->far0 + S*RT_OFFS_SIMD;
+    rt_real *fco1 = info->fco1 + S*RT_OFFS_SIMD;
+    rt_real *fco2 = info->fco2 + S*RT_OFFS_SIMD;
 
-#if SUB_TEST >=  3
-    c_test03,
-#endif /* SUB_TEST  3 */
+    j = n;
+    while (j-->0)
+    {
+        fco1[j] = far0[j];
+        fco2[j] = far0[j] + far0[j];
+    }
+}
 
-#if SUB_TEST >=  4
-    c_test04,
-#endif /* SUB_TEST  4 */
+/*
+ * As ASM_ENTER/ASM_LEAVE save/load a sizeable portion of registers onto/from
+ * the stack, they are considered heavy and therefore best suited for compute
+ * intensive parts of the program, in which case the ASM overhead is minimized.
+ * The test code below was designed mainly for assembler validation purposes
+ * and therefore may not fully represent its unlocked performance potential.
+ * For optimal results keep ASM sections in separate functions away from
+ * complex C/C++ logic, while making sure those functions are not inlined.
+ * This is needed for better compatibility with modern optimizing compilers.
+ */
+rt_void s_test52(rt_SIMD_INFOX *info)
+{
+    ASM_ENTER_K(info, info->size)
 
-#if SUB_TEST >=  5
-    c_test05,
-#endif /* SUB_TEST  5 */
+        movxx_ld(Recx, Mebp, inf_FAR0)
+        movxx_ld(Redx, Mebp, inf_FSO1)
+        movxx_ld(Rebx, Mebp, inf_FSO2)
+        movwx_rk(Resi, inf_SIZE, info->size)
 
-#if SUB_TEST >=  6
-    c_test06,
-#endif /* SUB_TEST  6 */
+    LBL(100500) /* loc_beg */
 
-#if SUB_TEST >=  7
-    c_test07,
-#endif /* SUB_TEST  7 */
+        movpx_ld(Xmm0, Mecx, AJ0)
+        movpx_rr(Xmm1, Xmm0)
+        addps_rr(Xmm1, Xmm0)
+        movpx_st(Xmm0, Medx, AJ0)
+        movpx_st(Xmm1, Mebx, AJ0)
 
-#if SUB_TEST >=  8
-    c_test08,
-#endif /* SUB_TEST  8 */
+        addxx_ri(Recx, IH(Q*0x10))
+        addxx_ri(Redx, IH(Q*0x10))
+        addxx_ri(Rebx, IH(Q*0x10))
+        subwx_ri(Resi, IB(S))
+        cmjwx_rz(Resi,
+        /* if */ GT_x, 100500b) /* loc_beg */
 
-#if SUB_TEST >=  9
-    c_test09,
-#endif /* SUB_TEST  9 */
+    ASM_LEAVE_K(info)
+}
 
-#if SUB_TEST >= 10
-    c_test10,
-#endif /* SUB_TEST 10 */
+rt_void p_test52(rt_SIMD_INFOX *info)
+{
+    rt_si32 j, n = info->size;
 
-#if SUB_TEST >= 11
-    c_test11,
-#endif /* SUB_TEST 11 */
+    rt_real *far0 = info->far0 + S*RT_OFFS_SIMD;
+    rt_real *fco1 = info->fco1 + S*RT_OFFS_SIMD;
+    rt_real *fco2 = info->fco2 + S*RT_OFFS_SIMD;
+    rt_real *fso1 = info->fso1 + S*RT_OFFS_SIMD;
+    rt_real *fso2 = info->fso2 + S*RT_OFFS_SIMD;
 
-#if SUB_TEST >= 12
-    c_test12,
-#endif /* SUB_TEST 12 */
+    j = n;
+    while (j-->0)
+    {
+        if (FEQ(fco1[j], fso1[j]) && FEQ(fco2[j], fso2[j]) && !v_mode)
+        {
+            continue;
+        }
 
-#if SUB_TEST >= 13
-    c_test13,
-#endif /* SUB_TEST 13 */
+        RT_LOGI("farr[%d] = %e\n",
+                j, far0[j]);
+#ifdef RT_PRINT_CPP
+        RT_LOGI("C farr[%d] = %e, farr[%d]+farr[%d] = %e\n",
+                j, fco1[j], j, j, fco2[j]);
+#endif /* RT_PRINT_CPP */
+#ifdef RT_PRINT_ASM
+        RT_LOGI("S farr[%d] = %e, farr[%d]+farr[%d] = %e\n",
+                j, fso1[j], j, j, fso2[j]);
+#endif /* RT_PRINT_ASM */
+    }
+}
 
-#if SUB_TEST >= 14
-    c_test14,
-#endif /* SUB_TEST 14 */
+#endif /* SUB_TEST 52 */
 
-#if SUB_TEST >= 15
-    c_test15,
-#endif /* SUB_TEST 15 */
+/******************************************************************************/
+/*******************************   SUB TEST 53   ******************************/
+/******************************************************************************/
 
-#if SUB_TEST >= 16
-    c_test16,
-#endif /* SUB_TEST 16 */
+#if SUB_TEST >= 53
 
-#if SUB_TEST >= 17
-    c_test17,
-#endif /* SUB_TEST 17 */
+/* registers used in s_test53 and o_enter_r, saved/loaded by ASM_ENTER_R */
+#define BASE53  (RM(Recx) | RM(Redx) | RM(Rebx) | RM(Resi))
+#define SIMD53  (RM(Xmm0) | RM(Xmm1))
 
-#if SUB_TEST >= 18
-    c_test18,
-#endif /* SUB_TEST 18 */
+rt_void c_test53(rt_SIMD_INFOX *info)
+{
+    rt_si32 j, n = info->size;
 
-#if SUB_TEST >= 19
-    c_test19,
-#endif /* SUB_TEST 19 */
+    rt_real *far0 = info->far0 + S*RT_OFFS_SIMD;
+    rt_real *fco1 = info->fco1 + S*RT_OFFS_SIMD;
+    rt_real *fco2 = info->fco2 + S*RT_OFFS_SIMD;
 
-#if SUB_TEST >= 20
-    c_test20,
-#endif /* SUB_TEST 20 */
+    j = n;
+    while (j-->0)
+    {
+        fco1[j] = far0[j] + far0[j];
+        fco2[j] = far0[j] * far0[j];
+    }
+}
 
-#if SUB_TEST >= 21
-    c_test21,
-#endif /* SUB_TEST 21 */
+/*
+ * ASM_ENTER_R/ASM_LEAVE_R only save/load registers declared in the masks,
+ * which reduces per-call overhead of small sections called in tight loops,
+ * compare times of "o_enter" and "o_enter_r" below (-o command-line option).
+ */
+rt_void s_test53(rt_SIMD_INFOX *info)
+{
+    ASM_ENTER_R(info, BASE53, SIMD53)
 
-#if SUB_TEST >= 22
-    c_test22,
-#endif /* SUB_TEST 22 */
+        movxx_ld(Recx, Mebp, inf_FAR0)
+        movxx_ld(Redx, Mebp, inf_FSO1)
+        movxx_ld(Rebx, Mebp, inf_FSO2)
+        movwx_ld(Resi, Mebp, inf_SIZE)
 
-#if SUB_TEST >= 23
-    c_test23,
-#endif /* SUB_TEST 23 */
+    LBL(100530) /* loc_beg */
 
-#if SUB_TEST >= 24
-    c_test24,
-#endif /* SUB_TEST 24 */
+        movpx_ld(Xmm0, Mecx, AJ0)
+        movpx_rr(Xmm1, Xmm0)
+        addps_rr(Xmm0, Xmm1)
+        mulps_rr(Xmm1, Xmm1)
+        movpx_st(Xmm0, Medx, AJ0)
+        movpx_st(Xmm1, Mebx, AJ0)
 
-#if SUB_TEST >= 25
-    c_test25,
-#endif /* SUB_TEST 25 */
+        addxx_ri(Recx, IH(Q*0x10))
+        addxx_ri(Redx, IH(Q*0x10))
+        addxx_ri(Rebx, IH(Q*0x10))
+        subwx_ri(Resi, IB(S))
+        cmjwx_rz(Resi,
+        /* if */ GT_x, 100530b) /* loc_beg */
 
-#if SUB_TEST >= 26
-    c_test26,
-#endif /* SUB_TEST 26 */
+    ASM_LEAVE_R(info, BASE53, SIMD53)
+}
 
-#if SUB_TEST >= 27
-    c_test27,
-#endif /* SUB_TEST 27 */
+rt_void p_test53(rt_SIMD_INFOX *info)
+{
+    rt_si32 j, n = info->size;
 
-#if SUB_TEST >= 28
-    c_test28,
-#endif /* SUB_TEST 28 */
+    rt_real *far0 = info->far0 + S*RT_OFFS_SIMD;
+    rt_real *fco1 = info->fco1 + S*RT_OFFS_SIMD;
+    rt_real *fco2 = info->fco2 + S*RT_OFFS_SIMD;
+    rt_real *fso1 = info->fso1 + S*RT_OFFS_SIMD;
+    rt_real *fso2 = info->fso2 + S*RT_OFFS_SIMD;
 
-#if SUB_TEST >= 29
-    c_test29,
-#endif /* SUB_TEST 29 */
+    j = n;
+    while (j-->0)
+    {
+        if (FEQ(fco1[j], fso1[j]) && FEQ(fco2[j], fso2[j]) && !v_mode)
+        {
+            continue;
+        }
 
-#if SUB_TEST >= 30
-    c_test30,
-#endif /* SUB_TEST 30 */
+        RT_LOGI("farr[%d] = %e\n",
+                j, far0[j]);
+#ifdef RT_PRINT_CPP
+        RT_LOGI("C farr[%d]+farr[%d] = %e, farr[%d]*farr[%d] = %e\n",
+                j, j, fco1[j], j, j, fco2[j]);
+#endif /* RT_PRINT_CPP */
+#ifdef RT_PRINT_ASM
+        RT_LOGI("S farr[%d]+farr[%d] = %e, farr[%d]*farr[%d] = %e\n",
+                j, j, fso1[j], j, j, fso2[j]);
+#endif /* RT_PRINT_ASM */
+    }
+}
 
-#if SUB_TEST >= 31
-    c_test31,
-#endif /* SUB_TEST 31 */
+/*
+ * Empty ASM sections for measuring per-call overhead of ASM_ENTER/ASM_LEAVE,
+ * which save/load all registers, against ASM_ENTER_R/ASM_LEAVE_R,
+ * which only save/load registers used in s_test53 (BASE53, SIMD53).
+ */
+rt_void o_enter(rt_SIMD_INFOX *info)
+{
+    ASM_ENTER(info)
+    ASM_LEAVE(info)
+}
 
-#if SUB_TEST >= 32
-    c_test32,
-#endif /* SUB_TEST 32 */
+rt_void o_enter_r(rt_SIMD_INFOX *info)
+{
+    ASM_ENTER_R(info, BASE53, SIMD53)
+    ASM_LEAVE_R(info, BASE53, SIMD53)
+}
 
-#if SUB_TEST >= 33
-    c_test33,
-#endif /* SUB_TEST 33 */
+#endif /* SUB_TEST 53 */
 
-#if SUB_TEST >= 34
-    c_test34,
-#endif /* SUB_TEST 34 */
+/******************************************************************************/
+/*******************************   SUB TEST 54   ******************************/
+/******************************************************************************/
 
-#if SUB_TEST >= 35
-    c_test35,
-#endif /* SUB_TEST 35 */
+#if SUB_TEST >= 54
 
-#if SUB_TEST >= 36
-    c_test36,
-#endif /* SUB_TEST 36 */
+rt_void c_test54(rt_SIMD_INFOX *info)
+{
+    rt_si32 j, n = info->size;
 
-#if SUB_TEST >= 37
-    c_test37,
-#endif /* SUB_TEST 37 */
+    rt_real *far0 = info->far0 + S*RT_OFFS_SIMD;
+    rt_real *fco1 = info->fco1 + S*RT_OFFS_SIMD;
+    rt_real *fco2 = info->fco2 + S*RT_OFFS_SIMD;
 
-#if SUB_TEST >= 38
-    c_test38,
-#endif /* SUB_TEST 38 */
+    j = n;
+    while (j-->0)
+    {
+        fco1[j] = far0[j] + far0[j];
+        fco2[j] = fco1[j] * far0[j];
+    }
+}
+
+/*
+ * Command-queue executor runs chained kernels 0 and 1 for each SIMD-wide batch
+ * of the arrays as listed in info->cmdq (set up in main) within a single
+ * ASM_ENTER/ASM_LEAVE pair, instead of entering a section for each command.
+ * Kernel labels go to the per-call info->cmdt, the last record's kernel id
+ * is out of range and ends the run.
+ */
+rt_void s_test54(rt_SIMD_INFOX *info)
+{
+    ASM_ENTER(info)
+
+        cmdqx_ld(Mebp, inf_CMDQ, Mebp, inf_CMDT)
+        cmdqx_lb(0, 100541) /* knl_add */
+        cmdqx_lb(1, 100542) /* knl_mul */
+        cmdqx_go(100540, 100549) /* cmd_dsp, cmd_end */
+
+    LBL(100541) /* knl_add: arg1 = arg0 + arg0 */
+
+        movxx_ld(Redx, Mecx, cmd_ARG0)
+        movxx_ld(Resi, Mecx, cmd_ARG1)
+        movwx_ld(Redi, Mecx, cmd_SIZE)
+
+    LBL(100543) /* add_beg */
+
+        movpx_ld(Xmm0, Medx, AJ0)
+        addps_rr(Xmm0, Xmm0)
+        movpx_st(Xmm0, Mesi, AJ0)
+
+        addxx_ri(Redx, IH(Q*0x10))
+        addxx_ri(Resi, IH(Q*0x10))
+        subwx_ri(Redi, IB(S))
+        cmjwx_rz(Redi,
+        /* if */ GT_x, 100543b) /* add_beg */
+
+        cmdqx_nx(100540) /* cmd_dsp */
+
+    LBL(100542) /* knl_mul: arg2 = arg1 * arg0 */
+
+        movxx_ld(Redx, Mecx, cmd_ARG0)
+        movxx_ld(Resi, Mecx, cmd_ARG1)
+        movxx_ld(Redi, Mecx, cmd_ARG2)
+        movwx_ld(Reax, Mecx, cmd_SIZE)
+        movwx_st(Reax, Mebp, inf_LOC)
+
+    LBL(100544) /* mul_beg */
+
+        movpx_ld(Xmm0, Mesi, AJ0)
+        mulps_ld(Xmm0, Medx, AJ0)
+        movpx_st(Xmm0, Medi, AJ0)
+
+        addxx_ri(Redx, IH(Q*0x10))
+        addxx_ri(Resi, IH(Q*0x10))
+        addxx_ri(Redi, IH(Q*0x10))
+        subwx_mi(Mebp, inf_LOC, IB(S))
+        cmjwx_mz(Mebp, inf_LOC,
+        /* if */ GT_x, 100544b) /* mul_beg */
+
+        cmdqx_nx(100540) /* cmd_dsp */
+
+    LBL(100549) /* cmd_end */
+
+    ASM_LEAVE(info)
+}
+
+rt_void p_test54(rt_SIMD_INFOX *info)
+{
+    rt_si32 j, n = info->size;
+
+    rt_real *far0 = info->far0 + S*RT_OFFS_SIMD;
+    rt_real *fco1 = info->fco1 + S*RT_OFFS_SIMD;
+    rt_real *fco2 = info->fco2 + S*RT_OFFS_SIMD;
+    rt_real *fso1 = info->fso1 + S*RT_OFFS_SIMD;
+    rt_real *fso2 = info->fso2 + S*RT_OFFS_SIMD;
+
+    j = n;
+    while (j-->0)
+    {
+        if (FEQ(fco1[j], fso1[j]) && FEQ(fco2[j], fso2[j]) && !v_mode)
+        {
+            continue;
+        }
+
+        RT_LOGI("farr[%d] = %e\n",
+                j, far0[j]);
+#ifdef RT_PRINT_CPP
+        RT_LOGI("C farr[%d]+farr[%d] = %e, (2*farr[%d])*farr[%d] = %e\n",
+                j, j, fco1[j], j, j, fco2[j]);
+#endif /* RT_PRINT_CPP */
+#ifdef RT_PRINT_ASM
+        RT_LOGI("S farr[%d]+farr[%d] = %e, (2*farr[%d])*farr[%d] = %e\n",
+                j, j, fso1[j], j, j, fso2[j]);
+#endif /* RT_PRINT_ASM */
+    }
+}
+
+#endif /* SUB_TEST 54 */
+
+/******************************************************************************/
+/*******************************   SUB TEST 55   ******************************/
+/******************************************************************************/
+
+#if SUB_TEST >= 55
+
+rt_void c_test55(rt_SIMD_INFOX *info)
+{
+    rt_si32 j, n = info->size;
+
+    rt_real *far0 = info->far0 + S*RT_OFFS_SIMD;
+    rt_real *fco1 = info->fco1 + S*RT_OFFS_SIMD;
+    rt_real *fco2 = info->fco2 + S*RT_OFFS_SIMD;
+
+    rt_elem *iar0 = info->iar0 + S*RT_OFFS_SIMD;
+    rt_elem *ico1 = info->ico1 + S*RT_OFFS_SIMD;
+    rt_elem *ico2 = info->ico2 + S*RT_OFFS_SIMD;
+
+    rt_elem *idx0 = info->idx0 + S*RT_OFFS_SIMD;
+
+    j = n;
+    while (j-->0)
+    {
+        fco1[j] = far0[idx0[j]];
+        fco2[j] = far0[idx0[j]] * far0[j];
+        ico1[j] = iar0[idx0[j]];
+        ico2[j] = iar0[idx0[j]] + iar0[j];
+    }
+}
+
+/*
+ * Gather loads fetch SIMD elements from per-lane indices held in a register,
+ * which are native on AVX2/AVX-512 and emulated via inf_SCR01/inf_SCR02
+ * on other targets. Xmm0 is kept live across the floating-point gathers
+ * and serves as XD for the integer ones, as masks are internal to the op.
+ */
+rt_void s_test55(rt_SIMD_INFOX *info)
+{
+    ASM_ENTER(info)
+
+        movxx_ld(Resi, Mebp, inf_IDX0)
+
+        movxx_ld(Recx, Mebp, inf_FAR0)
+        movxx_ld(Redx, Mebp, inf_FSO1)
+        movxx_ld(Rebx, Mebp, inf_FSO2)
+
+        movpx_ld(Xmm0, Mecx, AJ0)
+        movpx_ld(Xmm1, Mesi, AJ0)
+        gatpx_ld(Xmm2, Xmm1, Mecx, AJ0)
+        movpx_st(Xmm2, Medx, AJ0)
+        mulps_rr(Xmm2, Xmm0)
+        movpx_st(Xmm2, Mebx, AJ0)
+
+        movpx_ld(Xmm0, Mecx, AJ1)
+        movpx_ld(Xmm1, Mesi, AJ1)
+        gatpx_ld(Xmm2, Xmm1, Mecx, AJ0)
+        movpx_st(Xmm2, Medx, AJ1)
+        mulps_rr(Xmm2, Xmm0)
+        movpx_st(Xmm2, Mebx, AJ1)
+
+        movpx_ld(Xmm0, Mecx, AJ2)
+        movpx_ld(Xmm1, Mesi, AJ2)
+        gatpx_ld(Xmm2, Xmm1, Mecx, AJ0)
+        movpx_st(Xmm2, Medx, AJ2)
+        mulps_rr(Xmm2, Xmm0)
+        movpx_st(Xmm2, Mebx, AJ2)
+
+        movxx_ld(Recx, Mebp, inf_IAR0)
+        movxx_ld(Redx, Mebp, inf_ISO1)
+        movxx_ld(Rebx, Mebp, inf_ISO2)
+
+        movpx_ld(Xmm1, Mesi, AJ0)
+        gatpx_ld(Xmm0, Xmm1, Mecx, AJ0)
+        movpx_st(Xmm0, Medx, AJ0)
+        addpx_ld(Xmm0, Mecx, AJ0)
+        movpx_st(Xmm0, Mebx, AJ0)
+
+        movpx_ld(Xmm1, Mesi, AJ1)
+        gatpx_ld(Xmm0, Xmm1, Mecx, AJ0)
+        movpx_st(Xmm0, Medx, AJ1)
+        addpx_ld(Xmm0, Mecx, AJ1)
+        movpx_st(Xmm0, Mebx, AJ1)
+
+        movpx_ld(Xmm1, Mesi, AJ2)
+        gatpx_ld(Xmm0, Xmm1, Mecx, AJ0)
+        movpx_st(Xmm0, Medx, AJ2)
+        addpx_ld(Xmm0, Mecx, AJ2)
+        movpx_st(Xmm0, Mebx, AJ2)
+
+    ASM_LEAVE(info)
+}
+
+rt_void p_test55(rt_SIMD_INFOX *info)
+{
+    rt_si32 j, n = info->size;
+
+    rt_real *far0 = info->far0 + S*RT_OFFS_SIMD;
+    rt_real *fco1 = info->fco1 + S*RT_OFFS_SIMD;
+    rt_real *fco2 = info->fco2 + S*RT_OFFS_SIMD;
+    rt_real *fso1 = info->fso1 + S*RT_OFFS_SIMD;
+    rt_real *fso2 = info->fso2 + S*RT_OFFS_SIMD;
+
+    rt_elem *iar0 = info->iar0 + S*RT_OFFS_SIMD;
+    rt_elem *ico1 = info->ico1 + S*RT_OFFS_SIMD;
+    rt_elem *ico2 = info->ico2 + S*RT_OFFS_SIMD;
+    rt_elem *iso1 = info->iso1 + S*RT_OFFS_SIMD;
+    rt_elem *iso2 = info->iso2 + S*RT_OFFS_SIMD;
+
+    rt_elem *idx0 = info->idx0 + S*RT_OFFS_SIMD;
+
+    j = n;
+    while (j-->0)
+    {
+        if (FEQ(fco1[j], fso1[j]) && FEQ(fco2[j], fso2[j])
+        &&  IEQ(ico1[j], iso1[j]) && IEQ(ico2[j], iso2[j]) && !v_mode)
+        {
+            continue;
+        }
+
+        RT_LOGI("farr[%d] = %e, iarr[%d] = %" PR_L "d, idx[%d] = %" PR_L "d\n",
+                j, far0[j], j, iar0[j], j, idx0[j]);
+#ifdef RT_PRINT_CPP
+        RT_LOGI("C farr[idx[%d]] = %e, farr[idx[%d]]*farr[%d] = %e\n",
+                j, fco1[j], j, j, fco2[j]);
+        RT_LOGI("C iarr[idx[%d]] = %" PR_L "d, "
+                  "iarr[idx[%d]]+iarr[%d] = %" PR_L "d\n",
+                j, ico1[j], j, j, ico2[j]);
+#endif /* RT_PRINT_CPP */
+#ifdef RT_PRINT_ASM
+        RT_LOGI("S farr[idx[%d]] = %e, farr[idx[%d]]*farr[%d] = %e\n",
+                j, fso1[j], j, j, fso2[j]);
+        RT_LOGI("S iarr[idx[%d]] = %" PR_L "d, "
+                  "iarr[idx[%d]]+iarr[%d] = %" PR_L "d\n",
+                j, iso1[j], j, j, iso2[j]);
+#endif /* RT_PRINT_ASM */
+    }
+}
+
+#endif /* SUB_TEST 55 */
+
+/******************************************************************************/
+/*******************************   SUB TEST 56   ******************************/
+/******************************************************************************/
+
+#if SUB_TEST >= 56
+
+rt_void c_test56(rt_SIMD_INFOX *info)
+{
+    rt_si32 j, n = info->size;
+
+    rt_real *far0 = info->far0 + S*RT_OFFS_SIMD;
+    rt_real *fco1 = info->fco1 + S*RT_OFFS_SIMD;
+    rt_real *fco2 = info->fco2 + S*RT_OFFS_SIMD;
+
+    rt_elem *iar0 = info->iar0 + S*RT_OFFS_SIMD;
+    rt_elem *ico1 = info->ico1 + S*RT_OFFS_SIMD;
+    rt_elem *ico2 = info->ico2 + S*RT_OFFS_SIMD;
+
+    rt_elem *idx0 = info->idx0 + S*RT_OFFS_SIMD;
+
+    j = n;
+    while (j-->0)
+    {
+        fco2[j] = 0.0;
+        ico2[j] = 0;
+    }
+
+    for (j = 0; j < n; j++)
+    {
+        fco1[idx0[j]] = far0[j];
+        fco2[idx0[j] >> 1] = far0[j];
+        ico1[idx0[j]] = iar0[j];
+        ico2[idx0[j] >> 1] = iar0[j];
+    }
+}
+
+/*
+ * Scatter stores write SIMD elements to per-lane indices held in a register,
+ * which are native on AVX-512 and emulated via inf_SCR01/inf_SCR02 elsewhere.
+ * Halved indices collide in pairs, the highest lane (and chunk) must win.
+ */
+rt_void s_test56(rt_SIMD_INFOX *info)
+{
+    ASM_ENTER(info)
+
+        movxx_ld(Resi, Mebp, inf_IDX0)
+
+        movxx_ld(Recx, Mebp, inf_FAR0)
+        movxx_ld(Redx, Mebp, inf_FSO1)
+        movxx_ld(Rebx, Mebp, inf_FSO2)
+
+        xorpx_rr(Xmm2, Xmm2)
+        movpx_st(Xmm2, Mebx, AJ0)
+        movpx_st(Xmm2, Mebx, AJ1)
+        movpx_st(Xmm2, Mebx, AJ2)
+
+        movpx_ld(Xmm1, Mesi, AJ0)
+        movpx_ld(Xmm2, Mecx, AJ0)
+        sctpx_st(Xmm2, Xmm1, Medx, AJ0)
+        shrpx_ri(Xmm1, IB(1))
+        sctpx_st(Xmm2, Xmm1, Mebx, AJ0)
+
+        movpx_ld(Xmm1, Mesi, AJ1)
+        movpx_ld(Xmm2, Mecx, AJ1)
+        sctpx_st(Xmm2, Xmm1, Medx, AJ0)
+        shrpx_ri(Xmm1, IB(1))
+        sctpx_st(Xmm2, Xmm1, Mebx, AJ0)
+
+        movpx_ld(Xmm1, Mesi, AJ2)
+        movpx_ld(Xmm2, Mecx, AJ2)
+        sctpx_st(Xmm2, Xmm1, Medx, AJ0)
+        shrpx_ri(Xmm1, IB(1))
+        sctpx_st(Xmm2, Xmm1, Mebx, AJ0)
+
+        movxx_ld(Recx, Mebp, inf_IAR0)
+        movxx_ld(Redx, Mebp, inf_ISO1)
+        movxx_ld(Rebx, Mebp, inf_ISO2)
+
+        xorpx_rr(Xmm2, Xmm2)
+        movpx_st(Xmm2, Mebx, AJ0)
+        movpx_st(Xmm2, Mebx, AJ1)
+        movpx_st(Xmm2, Mebx, AJ2)
+
+        movpx_ld(Xmm1, Mesi, AJ0)
+        movpx_ld(Xmm2, Mecx, AJ0)
+        sctpx_st(Xmm2, Xmm1, Medx, AJ0)
+        shrpx_ri(Xmm1, IB(1))
+        sctpx_st(Xmm2, Xmm1, Mebx, AJ0)
+
+        movpx_ld(Xmm1, Mesi, AJ1)
+        movpx_ld(Xmm2, Mecx, AJ1)
+        sctpx_st(Xmm2, Xmm1, Medx, AJ0)
+        shrpx_ri(Xmm1, IB(1))
+        sctpx_st(Xmm2, Xmm1, Mebx, AJ0)
+
+        movpx_ld(Xmm1, Mesi, AJ2)
+        movpx_ld(Xmm2, Mecx, AJ2)
+        sctpx_st(Xmm2, Xmm1, Medx, AJ0)
+        shrpx_ri(Xmm1, IB(1))
+        sctpx_st(Xmm2, Xmm1, Mebx, AJ0)
+
+    ASM_LEAVE(info)
+}
+
+rt_void p_test56(rt_SIMD_INFOX *info)
+{
+    rt_si32 j, n = info->size;
+
+    rt_real *far0 = info->far0 + S*RT_OFFS_SIMD;
+    rt_real *fco1 = info->fco1 + S*RT_OFFS_SIMD;
+    rt_real *fco2 = info->fco2 + S*RT_OFFS_SIMD;
+    rt_real *fso1 = info->fso1 + S*RT_OFFS_SIMD;
+    rt_real *fso2 = info->fso2 + S*RT_OFFS_SIMD;
+
+    rt_elem *iar0 = info->iar0 + S*RT_OFFS_SIMD;
+    rt_elem *ico1 = info->ico1 + S*RT_OFFS_SIMD;
+    rt_elem *ico2 = info->ico2 + S*RT_OFFS_SIMD;
+    rt_elem *iso1 = info->iso1 + S*RT_OFFS_SIMD;
+    rt_elem *iso2 = info->iso2 + S*RT_OFFS_SIMD;
+
+    rt_elem *idx0 = info->idx0 + S*RT_OFFS_SIMD;
+
+    j = n;
+    while (j-->0)
+    {
+        if (FEQ(fco1[j], fso1[j]) && FEQ(fco2[j], fso2[j])
+        &&  IEQ(ico1[j], iso1[j]) && IEQ(ico2[j], iso2[j]) && !v_mode)
+        {
+            continue;
+        }
+
+        RT_LOGI("farr[%d] = %e, iarr[%d] = %" PR_L "d, idx[%d] = %" PR_L "d\n",
+                j, far0[j], j, iar0[j], j, idx0[j]);
+#ifdef RT_PRINT_CPP
+        RT_LOGI("C farr[%d] = %e, farr[%d] = %e (idx>>1)\n",
+                j, fco1[j], j, fco2[j]);
+        RT_LOGI("C iarr[%d] = %" PR_L "d, iarr[%d] = %" PR_L "d (idx>>1)\n",
+                j, ico1[j], j, ico2[j]);
+#endif /* RT_PRINT_CPP */
+#ifdef RT_PRINT_ASM
+        RT_LOGI("S farr[%d] = %e, farr[%d] = %e (idx>>1)\n",
+                j, fso1[j], j, fso2[j]);
+        RT_LOGI("S iarr[%d] = %" PR_L "d, iarr[%d] = %" PR_L "d (idx>>1)\n",
+                j, iso1[j], j, iso2[j]);
+#endif /* RT_PRINT_ASM */
+    }
+}
+
+#endif /* SUB_TEST 56 */
+
+/******************************************************************************/
+/*******************************   SUB TEST 57   ******************************/
+/******************************************************************************/
+
+#if SUB_TEST >= 57
+
+rt_void c_test57(rt_SIMD_INFOX *info)
+{
+    rt_si32 j, n = info->size;
+    rt_si32 m[3] = {S-1, 0, S}; /* lane counts of masked tails (AJ0-AJ2) */
+
+    rt_real *far0 = info->far0 + S*RT_OFFS_SIMD;
+    rt_real *fco1 = info->fco1 + S*RT_OFFS_SIMD;
+    rt_real *fco2 = info->fco2 + S*RT_OFFS_SIMD;
+
+    rt_elem *iar0 = info->iar0 + S*RT_OFFS_SIMD;
+    rt_elem *ico1 = info->ico1 + S*RT_OFFS_SIMD;
+    rt_elem *ico2 = info->ico2 + S*RT_OFFS_SIMD;
+
+    j = n;
+    while (j-->0)
+    {
+        if (j % S < m[j / S])
+        {
+            fco1[j] = far0[j];
+            fco2[j] = far0[j] * far0[j];
+            ico1[j] = iar0[j];
+            ico2[j] = iar0[j] + iar0[j];
+        }
+        else
+        {
+            fco1[j] = 0.0;
+            fco2[j] = far0[j];
+            ico1[j] = 0;
+            ico2[j] = iar0[j];
+        }
+    }
+}
+
+/*
+ * Masked tail moves touch only the first RS lanes given in a BASE register,
+ * which are native on AVX/AVX-512 and emulated via inf_SCR01/inf_SCR02
+ * elsewhere. Loads zero the remaining lanes, stores leave memory intact.
+ */
+rt_void s_test57(rt_SIMD_INFOX *info)
+{
+    ASM_ENTER(info)
+
+        movxx_ld(Recx, Mebp, inf_FAR0)
+        movxx_ld(Redx, Mebp, inf_FSO1)
+        movxx_ld(Rebx, Mebp, inf_FSO2)
+
+        movwx_ri(Resi, IB(S-1))
+        movpx_ld(Xmm1, Mecx, AJ0)
+        movpx_st(Xmm1, Mebx, AJ0)
+        mulps_rr(Xmm1, Xmm1)
+        mtlpx_st(Xmm1, Resi, Mebx, AJ0)
+        mtlpx_ld(Xmm2, Resi, Mecx, AJ0)
+        movpx_st(Xmm2, Medx, AJ0)
+
+        movwx_ri(Resi, IB(0))
+        movpx_ld(Xmm1, Mecx, AJ1)
+        movpx_st(Xmm1, Mebx, AJ1)
+        mulps_rr(Xmm1, Xmm1)
+        mtlpx_st(Xmm1, Resi, Mebx, AJ1)
+        mtlpx_ld(Xmm2, Resi, Mecx, AJ1)
+        movpx_st(Xmm2, Medx, AJ1)
+
+        movwx_ri(Resi, IB(S))
+        movpx_ld(Xmm1, Mecx, AJ2)
+        movpx_st(Xmm1, Mebx, AJ2)
+        mulps_rr(Xmm1, Xmm1)
+        mtlpx_st(Xmm1, Resi, Mebx, AJ2)
+        mtlpx_ld(Xmm2, Resi, Mecx, AJ2)
+        movpx_st(Xmm2, Medx, AJ2)
+
+        movxx_ld(Recx, Mebp, inf_IAR0)
+        movxx_ld(Redx, Mebp, inf_ISO1)
+        movxx_ld(Rebx, Mebp, inf_ISO2)
+
+        movwx_ri(Reax, IB(S-1))
+        movpx_ld(Xmm1, Mecx, AJ0)
+        movpx_st(Xmm1, Mebx, AJ0)
+        addpx_rr(Xmm1, Xmm1)
+        mtlpx_st(Xmm1, Reax, Mebx, AJ0)
+        mtlpx_ld(Xmm2, Reax, Mecx, AJ0)
+        movpx_st(Xmm2, Medx, AJ0)
+
+        movwx_ri(Reax, IB(0))
+        movpx_ld(Xmm1, Mecx, AJ1)
+        movpx_st(Xmm1, Mebx, AJ1)
+        addpx_rr(Xmm1, Xmm1)
+        mtlpx_st(Xmm1, Reax, Mebx, AJ1)
+        mtlpx_ld(Xmm2, Reax, Mecx, AJ1)
+        movpx_st(Xmm2, Medx, AJ1)
+
+        movwx_ri(Reax, IB(S))
+        movpx_ld(Xmm1, Mecx, AJ2)
+        movpx_st(Xmm1, Mebx, AJ2)
+        addpx_rr(Xmm1, Xmm1)
+        mtlpx_st(Xmm1, Reax, Mebx, AJ2)
+        mtlpx_ld(Xmm2, Reax, Mecx, AJ2)
+        movpx_st(Xmm2, Medx, AJ2)
+
+    ASM_LEAVE(info)
+}
+
+rt_void p_test57(rt_SIMD_INFOX *info)
+{
+    rt_si32 j, n = info->size;
+    rt_si32 m[3] = {S-1, 0, S}; /* lane counts of masked tails (AJ0-AJ2) */
+
+    rt_real *far0 = info->far0 + S*RT_OFFS_SIMD;
+    rt_real *fco1 = info->fco1 + S*RT_OFFS_SIMD;
+    rt_real *fco2 = info->fco2 + S*RT_OFFS_SIMD;
+    rt_real *fso1 = info->fso1 + S*RT_OFFS_SIMD;
+    rt_real *fso2 = info->fso2 + S*RT_OFFS_SIMD;
+
+    rt_elem *iar0 = info->iar0 + S*RT_OFFS_SIMD;
+    rt_elem *ico1 = info->ico1 + S*RT_OFFS_SIMD;
+    rt_elem *ico2 = info->ico2 + S*RT_OFFS_SIMD;
+    rt_elem *iso1 = info->iso1 + S*RT_OFFS_SIMD;
+    rt_elem *iso2 = info->iso2 + S*RT_OFFS_SIMD;
+
+    j = n;
+    while (j-->0)
+    {
+        if (FEQ(fco1[j], fso1[j]) && FEQ(fco2[j], fso2[j])
+        &&  IEQ(ico1[j], iso1[j]) && IEQ(ico2[j], iso2[j]) && !v_mode)
+        {
+            continue;
+        }
+
+        RT_LOGI("farr[%d] = %e, iarr[%d] = %" PR_L "d, lanes = %d\n",
+                j, far0[j], j, iar0[j], m[j / S]);
+#ifdef RT_PRINT_CPP
+        RT_LOGI("C farr[%d] = %e, farr[%d]*farr[%d] = %e\n",
+                j, fco1[j], j, j, fco2[j]);
+        RT_LOGI("C iarr[%d] = %" PR_L "d, iarr[%d]+iarr[%d] = %" PR_L "d\n",
+                j, ico1[j], j, j, ico2[j]);
+#endif /* RT_PRINT_CPP */
+#ifdef RT_PRINT_ASM
+        RT_LOGI("S farr[%d] = %e, farr[%d]*farr[%d] = %e\n",
+                j, fso1[j], j, j, fso2[j]);
+        RT_LOGI("S iarr[%d] = %" PR_L "d, iarr[%d]+iarr[%d] = %" PR_L "d\n",
+                j, iso1[j], j, j, iso2[j]);
+#endif /* RT_PRINT_ASM */
+    }
+}
+
+#endif /* SUB_TEST 57 */
+
+/******************************************************************************/
+/*******************************   SUB TEST 58   ******************************/
+/******************************************************************************/
+
+#if SUB_TEST >= 58
+
+rt_void c_test58(rt_SIMD_INFOX *info)
+{
+    rt_si32 j, n = info->size;
+
+    rt_real *far0 = info->far0 + S*RT_OFFS_SIMD;
+    rt_real *fco1 = info->fco1 + S*RT_OFFS_SIMD;
+    rt_real *fco2 = info->fco2 + S*RT_OFFS_SIMD;
+
+    rt_elem *iar0 = info->iar0 + S*RT_OFFS_SIMD;
+    rt_elem *ico1 = info->ico1 + S*RT_OFFS_SIMD;
+    rt_elem *ico2 = info->ico2 + S*RT_OFFS_SIMD;
+
+    j = n;
+    while (j-->0)
+    {
+        fco1[j] = far0[0] * far0[j];
+        fco2[j] = far0[S] * far0[j];
+        ico1[j] = iar0[0] + iar0[j];
+        ico2[j] = iar0[S] + iar0[j];
+    }
+}
+
+/*
+ * Broadcasts replicate a single element into all SIMD elements, either from
+ * memory (first element of AJ0) or from a BASE register (first element of AJ1
+ * loaded with movyx_ld), which are native on x86 and emulated elsewhere.
+ */
+rt_void s_test58(rt_SIMD_INFOX *info)
+{
+    ASM_ENTER(info)
+
+        movxx_ld(Recx, Mebp, inf_FAR0)
+        movxx_ld(Redx, Mebp, inf_FSO1)
+        movxx_ld(Rebx, Mebp, inf_FSO2)
+
+        bcspx_ld(Xmm1, Mecx, AJ0)
+        movyx_ld(Reax, Mecx, AJ1)
+        bcspx_rr(Xmm2, Reax)
+
+        movpx_rr(Xmm3, Xmm1)
+        mulps_ld(Xmm3, Mecx, AJ0)
+        movpx_st(Xmm3, Medx, AJ0)
+        movpx_rr(Xmm3, Xmm2)
+        mulps_ld(Xmm3, Mecx, AJ0)
+        movpx_st(Xmm3, Mebx, AJ0)
+
+        movpx_rr(Xmm3, Xmm1)
+        mulps_ld(Xmm3, Mecx, AJ1)
+        movpx_st(Xmm3, Medx, AJ1)
+        movpx_rr(Xmm3, Xmm2)
+        mulps_ld(Xmm3, Mecx, AJ1)
+        movpx_st(Xmm3, Mebx, AJ1)
+
+        movpx_rr(Xmm3, Xmm1)
+        mulps_ld(Xmm3, Mecx, AJ2)
+        movpx_st(Xmm3, Medx, AJ2)
+        movpx_rr(Xmm3, Xmm2)
+        mulps_ld(Xmm3, Mecx, AJ2)
+        movpx_st(Xmm3, Mebx, AJ2)
+
+        movxx_ld(Recx, Mebp, inf_IAR0)
+        movxx_ld(Redx, Mebp, inf_ISO1)
+        movxx_ld(Rebx, Mebp, inf_ISO2)
+
+        bcspx_ld(Xmm1, Mecx, AJ0)
+        movyx_ld(Reax, Mecx, AJ1)
+        bcspx_rr(Xmm2, Reax)
+
+        movpx_rr(Xmm3, Xmm1)
+        addpx_ld(Xmm3, Mecx, AJ0)
+        movpx_st(Xmm3, Medx, AJ0)
+        movpx_rr(Xmm3, Xmm2)
+        addpx_ld(Xmm3, Mecx, AJ0)
+        movpx_st(Xmm3, Mebx, AJ0)
+
+        movpx_rr(Xmm3, Xmm1)
+        addpx_ld(Xmm3, Mecx, AJ1)
+        movpx_st(Xmm3, Medx, AJ1)
+        movpx_rr(Xmm3, Xmm2)
+        addpx_ld(Xmm3, Mecx, AJ1)
+        movpx_st(Xmm3, Mebx, AJ1)
+
+        movpx_rr(Xmm3, Xmm1)
+        addpx_ld(Xmm3, Mecx, AJ2)
+        movpx_st(Xmm3, Medx, AJ2)
+        movpx_rr(Xmm3, Xmm2)
+        addpx_ld(Xmm3, Mecx, AJ2)
+        movpx_st(Xmm3, Mebx, AJ2)
+
+    ASM_LEAVE(info)
+}
+
+rt_void p_test58(rt_SIMD_INFOX *info)
+{
+    rt_si32 j, n = info->size;
+
+    rt_real *far0 = info->far0 + S*RT_OFFS_SIMD;
+    rt_real *fco1 = info->fco1 + S*RT_OFFS_SIMD;
+    rt_real *fco2 = info->fco2 + S*RT_OFFS_SIMD;
+    rt_real *fso1 = info->fso1 + S*RT_OFFS_SIMD;
+    rt_real *fso2 = info->fso2 + S*RT_OFFS_SIMD;
+
+    rt_elem *iar0 = info->iar0 + S*RT_OFFS_SIMD;
+    rt_elem *ico1 = info->ico1 + S*RT_OFFS_SIMD;
+    rt_elem *ico2 = info->ico2 + S*RT_OFFS_SIMD;
+    rt_elem *iso1 = info->iso1 + S*RT_OFFS_SIMD;
+    rt_elem *iso2 = info->iso2 + S*RT_OFFS_SIMD;
+
+    j = n;
+    while (j-->0)
+    {
+        if (FEQ(fco1[j], fso1[j]) && FEQ(fco2[j], fso2[j])
+        &&  IEQ(ico1[j], iso1[j]) && IEQ(ico2[j], iso2[j]) && !v_mode)
+        {
+            continue;
+        }
+
+        RT_LOGI("farr[%d] = %e, iarr[%d] = %" PR_L "d\n",
+                j, far0[j], j, iar0[j]);
+#ifdef RT_PRINT_CPP
+        RT_LOGI("C farr[0]*farr[%d] = %e, farr[S]*farr[%d] = %e\n",
+                j, fco1[j], j, fco2[j]);
+        RT_LOGI("C iarr[0]+iarr[%d] = %" PR_L "d, "
+                  "iarr[S]+iarr[%d] = %" PR_L "d\n",
+                j, ico1[j], j, ico2[j]);
+#endif /* RT_PRINT_CPP */
+#ifdef RT_PRINT_ASM
+        RT_LOGI("S farr[0]*farr[%d] = %e, farr[S]*farr[%d] = %e\n",
+                j, fso1[j], j, fso2[j]);
+        RT_LOGI("S iarr[0]+iarr[%d] = %" PR_L "d, "
+                  "iarr[S]+iarr[%d] = %" PR_L "d\n",
+                j, iso1[j], j, iso2[j]);
+#endif /* RT_PRINT_ASM */
+    }
+}
+
+#endif /* SUB_TEST 58 */
+
+/******************************************************************************/
+/*******************************   SUB TEST 59   ******************************/
+/******************************************************************************/
+
+#if SUB_TEST >= 59
+
+rt_void c_test59(rt_SIMD_INFOX *info)
+{
+    rt_si32 j, n = info->size;
+
+    rt_real *far0 = info->far0 + S*RT_OFFS_SIMD;
+    rt_real *fco1 = info->fco1 + S*RT_OFFS_SIMD;
+    rt_real *fco2 = info->fco2 + S*RT_OFFS_SIMD;
+
+    rt_elem *iar0 = info->iar0 + S*RT_OFFS_SIMD;
+    rt_elem *ico1 = info->ico1 + S*RT_OFFS_SIMD;
+    rt_elem *ico2 = info->ico2 + S*RT_OFFS_SIMD;
+
+    rt_elem *idx0 = info->idx0 + S*RT_OFFS_SIMD;
+
+    j = n;
+    while (j-->0)
+    {
+        fco1[j] = far0[j ^ (4/L-1)];
+        fco2[j] = far0[j - j % S + (idx0[j] & (S-1))];
+        ico1[j] = iar0[j ^ (4/L-1)];
+        ico2[j] = iar0[j - j % S + (idx0[j] & (S-1))];
+    }
+}
+
+/*
+ * Shuffles reverse elements within each 128-bit lane using an immediate
+ * pattern (0x1B for 32-bit, 0x01 for 64-bit elements), while permutes pick
+ * elements across the whole register with per-lane indices modulo S.
+ */
+rt_void s_test59(rt_SIMD_INFOX *info)
+{
+    ASM_ENTER(info)
+
+        movxx_ld(Resi, Mebp, inf_IDX0)
+
+        movxx_ld(Recx, Mebp, inf_FAR0)
+        movxx_ld(Redx, Mebp, inf_FSO1)
+        movxx_ld(Rebx, Mebp, inf_FSO2)
+
+        movpx_ld(Xmm1, Mecx, AJ0)
+        shfpx3ri(Xmm2, Xmm1, IB(0x1B >> ((L-1)*4)))
+        movpx_st(Xmm2, Medx, AJ0)
+        movpx_ld(Xmm3, Mesi, AJ0)
+        tblpx3rr(Xmm2, Xmm1, Xmm3)
+        movpx_st(Xmm2, Mebx, AJ0)
+
+        movpx_ld(Xmm1, Mecx, AJ1)
+        movpx_rr(Xmm2, Xmm1)
+        shfpx_ri(Xmm2, IB(0x1B >> ((L-1)*4)))
+        movpx_st(Xmm2, Medx, AJ1)
+        movpx_ld(Xmm3, Mesi, AJ1)
+        tblpx_rr(Xmm1, Xmm3)
+        movpx_st(Xmm1, Mebx, AJ1)
+
+        movpx_ld(Xmm1, Mecx, AJ2)
+        shfpx3ri(Xmm2, Xmm1, IB(0x1B >> ((L-1)*4)))
+        movpx_st(Xmm2, Medx, AJ2)
+        movpx_ld(Xmm3, Mesi, AJ2)
+        tblpx3rr(Xmm2, Xmm1, Xmm3)
+        movpx_st(Xmm2, Mebx, AJ2)
+
+        movxx_ld(Recx, Mebp, inf_IAR0)
+        movxx_ld(Redx, Mebp, inf_ISO1)
+        movxx_ld(Rebx, Mebp, inf_ISO2)
+
+        movpx_ld(Xmm1, Mecx, AJ0)
+        shfpx3ri(Xmm2, Xmm1, IB(0x1B >> ((L-1)*4)))
+        movpx_st(Xmm2, Medx, AJ0)
+        movpx_ld(Xmm3, Mesi, AJ0)
+        tblpx3rr(Xmm2, Xmm1, Xmm3)
+        movpx_st(Xmm2, Mebx, AJ0)
+
+        movpx_ld(Xmm1, Mecx, AJ1)
+        movpx_rr(Xmm2, Xmm1)
+        shfpx_ri(Xmm2, IB(0x1B >> ((L-1)*4)))
+        movpx_st(Xmm2, Medx, AJ1)
+        movpx_ld(Xmm3, Mesi, AJ1)
+        tblpx_rr(Xmm1, Xmm3)
+        movpx_st(Xmm1, Mebx, AJ1)
+
+        movpx_ld(Xmm1, Mecx, AJ2)
+        shfpx3ri(Xmm2, Xmm1, IB(0x1B >> ((L-1)*4)))
+        movpx_st(Xmm2, Medx, AJ2)
+        movpx_ld(Xmm3, Mesi, AJ2)
+        tblpx3rr(Xmm2, Xmm1, Xmm3)
+        movpx_st(Xmm2, Mebx, AJ2)
+
+    ASM_LEAVE(info)
+}
+
+rt_void p_test59(rt_SIMD_INFOX *info)
+{
+    rt_si32 j, n = info->size;
+
+    rt_real *far0 = info->far0 + S*RT_OFFS_SIMD;
+    rt_real *fco1 = info->fco1 + S*RT_OFFS_SIMD;
+    rt_real *fco2 = info->fco2 + S*RT_OFFS_SIMD;
+    rt_real *fso1 = info->fso1 + S*RT_OFFS_SIMD;
+    rt_real *fso2 = info->fso2 + S*RT_OFFS_SIMD;
+
+    rt_elem *iar0 = info->iar0 + S*RT_OFFS_SIMD;
+    rt_elem *ico1 = info->ico1 + S*RT_OFFS_SIMD;
+    rt_elem *ico2 = info->ico2 + S*RT_OFFS_SIMD;
+    rt_elem *iso1 = info->iso1 + S*RT_OFFS_SIMD;
+    rt_elem *iso2 = info->iso2 + S*RT_OFFS_SIMD;
+
+    rt_elem *idx0 = info->idx0 + S*RT_OFFS_SIMD;
+
+    j = n;
+    while (j-->0)
+    {
+        if (FEQ(fco1[j], fso1[j]) && FEQ(fco2[j], fso2[j])
+        &&  IEQ(ico1[j], iso1[j]) && IEQ(ico2[j], iso2[j]) && !v_mode)
+        {
+            continue;
+        }
+
+        RT_LOGI("farr[%d] = %e, iarr[%d] = %" PR_L "d, idx[%d] = %" PR_L "d\n",
+                j, far0[j], j, iar0[j], j, idx0[j]);
+#ifdef RT_PRINT_CPP
+        RT_LOGI("C shf farr[%d] = %e, tbl farr[%d] = %e\n",
+                j, fco1[j], j, fco2[j]);
+        RT_LOGI("C shf iarr[%d] = %" PR_L "d, tbl iarr[%d] = %" PR_L "d\n",
+                j, ico1[j], j, ico2[j]);
+#endif /* RT_PRINT_CPP */
+#ifdef RT_PRINT_ASM
+        RT_LOGI("S shf farr[%d] = %e, tbl farr[%d] = %e\n",
+                j, fso1[j], j, fso2[j]);
+        RT_LOGI("S shf iarr[%d] = %" PR_L "d, tbl iarr[%d] = %" PR_L "d\n",
+                j, iso1[j], j, iso2[j]);
+#endif /* RT_PRINT_ASM */
+    }
+}
+
+#endif /* SUB_TEST 59 */
+
+/******************************************************************************/
+/*******************************   SUB TEST 60   ******************************/
+/******************************************************************************/
+
+#if SUB_TEST >= 60
+
+rt_void c_test60(rt_SIMD_INFOX *info)
+{
+    rt_si32 i, j, k, n = info->size;
+    rt_real s, t, u, v;
+
+    rt_real *far0 = info->far0 + S*RT_OFFS_SIMD;
+    rt_real *fco1 = info->fco1 + S*RT_OFFS_SIMD;
+    rt_real *fco2 = info->fco2 + S*RT_OFFS_SIMD;
+
+    j = n;
+    while (j-->0)
+    {
+        k = j - j % S;
+        s = 0.0f;
+        t = v = RT_SQRT(far0[k]) * RT_SQRT(far0[(k + S) % n]);
+        i = S;
+        while (i-->0)
+        {
+            u = RT_SQRT(far0[k+i]) * RT_SQRT(far0[(k+i + S) % n]);
+            s += u;
+            t = RT_MAX(t, u);
+            v = RT_MIN(v, u);
+        }
+        fco1[j] = s;
+        fco2[j] = t - v;
+    }
+}
+
+/*
+ * Horizontal reductions (adh, mxh, mnh) of a dot-product style loop, where
+ * the full sum (and the range) of each SIMD register is broadcast into all
+ * elements of the destination, native targets reduce within registers.
+ * The same pass is repeated RED_RUNS times within the section, so that
+ * the timing isn't dominated by the per-call cost of ASM_ENTER/ASM_LEAVE.
+ */
+rt_void s_test60(rt_SIMD_INFOX *info)
+{
+    ASM_ENTER(info)
+
+        movwx_mi(Mebp, inf_LOC, IB(RED_RUNS))
+
+    LBL(100600) /* loc_run */
+
+        movxx_ld(Recx, Mebp, inf_FAR0)
+        movxx_ld(Redx, Mebp, inf_FSO1)
+        movxx_ld(Rebx, Mebp, inf_FSO2)
+
+        movpx_ld(Xmm0, Mecx, AJ0)
+        sqrps_rr(Xmm0, Xmm0)
+        movpx_ld(Xmm1, Mecx, AJ1)
+        sqrps_rr(Xmm1, Xmm1)
+        mulps_rr(Xmm0, Xmm1)
+        adhps_rr(Xmm2, Xmm0)
+        movpx_st(Xmm2, Medx, AJ0)
+        mxhps_rr(Xmm3, Xmm0)
+        mnhps_rr(Xmm0, Xmm0)
+        subps_rr(Xmm3, Xmm0)
+        movpx_st(Xmm3, Mebx, AJ0)
+
+        movpx_ld(Xmm0, Mecx, AJ1)
+        sqrps_rr(Xmm0, Xmm0)
+        movpx_ld(Xmm1, Mecx, AJ2)
+        sqrps_rr(Xmm1, Xmm1)
+        mulps_rr(Xmm0, Xmm1)
+        adhps_rr(Xmm2, Xmm0)
+        movpx_st(Xmm2, Medx, AJ1)
+        mxhps_rr(Xmm3, Xmm0)
+        mnhps_rr(Xmm0, Xmm0)
+        subps_rr(Xmm3, Xmm0)
+        movpx_st(Xmm3, Mebx, AJ1)
+
+        movpx_ld(Xmm0, Mecx, AJ2)
+        sqrps_rr(Xmm0, Xmm0)
+        movpx_ld(Xmm1, Mecx, AJ0)
+        sqrps_rr(Xmm1, Xmm1)
+        mulps_rr(Xmm0, Xmm1)
+        adhps_rr(Xmm2, Xmm0)
+        movpx_st(Xmm2, Medx, AJ2)
+        mxhps_rr(Xmm3, Xmm0)
+        mnhps_rr(Xmm0, Xmm0)
+        subps_rr(Xmm3, Xmm0)
+        movpx_st(Xmm3, Mebx, AJ2)
+
+        subwx_mi(Mebp, inf_LOC, IB(1))
+        cmjwx_mz(Mebp, inf_LOC,
+        /* if */ GT_x, 100600b) /* loc_run */
+
+    ASM_LEAVE(info)
+}
+
+rt_void p_test60(rt_SIMD_INFOX *info)
+{
+    rt_si32 j, n = info->size;
+
+    rt_real *far0 = info->far0 + S*RT_OFFS_SIMD;
+    rt_real *fco1 = info->fco1 + S*RT_OFFS_SIMD;
+    rt_real *fco2 = info->fco2 + S*RT_OFFS_SIMD;
+    rt_real *fso1 = info->fso1 + S*RT_OFFS_SIMD;
+    rt_real *fso2 = info->fso2 + S*RT_OFFS_SIMD;
+
+    j = n;
+    while (j-->0)
+    {
+        if (FEQ(fco1[j], fso1[j]) && FEQ(fco2[j], fso2[j]) && !v_mode)
+        {
+            continue;
+        }
+
+        RT_LOGI("farr[%d] = %e, farr[%d] = %e\n",
+                j, far0[j], (j + S) % n, far0[(j + S) % n]);
+#ifdef RT_PRINT_CPP
+        RT_LOGI("C adh farr[%d] = %e, mxh-mnh farr[%d] = %e\n",
+                j, fco1[j], j, fco2[j]);
+#endif /* RT_PRINT_CPP */
+#ifdef RT_PRINT_ASM
+        RT_LOGI("S adh farr[%d] = %e, mxh-mnh farr[%d] = %e\n",
+                j, fso1[j], j, fso2[j]);
+#endif /* RT_PRINT_ASM */
+    }
+}
+
+#endif /* SUB_TEST 60 */
+
+/******************************************************************************/
+/*******************************   SUB TEST 61   ******************************/
+/******************************************************************************/
+
+#if SUB_TEST >= 61
+
+rt_void c_test61(rt_SIMD_INFOX *info)
+{
+    rt_si32 i, j, k, m, n = info->size;
+    rt_real s, t, v;
+    rt_elem a, b, c;
+
+    rt_real *far0 = info->far0 + S*RT_OFFS_SIMD;
+    rt_real *fco1 = info->fco1 + S*RT_OFFS_SIMD;
+    rt_real *fco2 = info->fco2 + S*RT_OFFS_SIMD;
+
+    rt_elem *iar0 = info->iar0 + S*RT_OFFS_SIMD;
+    rt_elem *ico1 = info->ico1 + S*RT_OFFS_SIMD;
+    rt_elem *ico2 = info->ico2 + S*RT_OFFS_SIMD;
+
+    j = n;
+    while (j-->0)
+    {
+        k = j - j % S;
+        m = (j / S) % 3;
+        s = 0.0f;
+        t = v = far0[j];
+        a = 0;
+        b = c = iar0[j];
+        for (i = k; i < j; i++)
+        {
+            s += far0[i];
+            t = RT_MAX(t, far0[i]);
+            v = RT_MIN(v, far0[i]);
+            a += iar0[i];
+            b = RT_MAX(b, iar0[i]);
+            c = RT_MIN(c, iar0[i]);
+        }
+        fco1[j] = m == 1 ? s : s + far0[j];
+        fco2[j] = m == 1 ? v : t;
+        ico1[j] = m == 1 ? a : a + iar0[j];
+        ico2[j] = m == 0 ? b : m == 1 ? c : - b - c;
+    }
+}
+
+/*
+ * Prefix scans within each SIMD register: inclusive sum and max (AJ0),
+ * exclusive sum and inclusive min (AJ1), in-place inclusive sum and signed
+ * min plus max of negated integers (AJ2), integer results are exact.
+ */
+rt_void s_test61(rt_SIMD_INFOX *info)
+{
+    ASM_ENTER(info)
+
+        movxx_ld(Recx, Mebp, inf_FAR0)
+        movxx_ld(Redx, Mebp, inf_FSO1)
+        movxx_ld(Rebx, Mebp, inf_FSO2)
+
+        movpx_ld(Xmm1, Mecx, AJ0)
+        adips_rr(Xmm2, Xmm1)
+        movpx_st(Xmm2, Medx, AJ0)
+        mxips_rr(Xmm3, Xmm1)
+        movpx_st(Xmm3, Mebx, AJ0)
+
+        movpx_ld(Xmm1, Mecx, AJ1)
+        adeps_rr(Xmm2, Xmm1)
+        movpx_st(Xmm2, Medx, AJ1)
+        mnips_rr(Xmm3, Xmm1)
+        movpx_st(Xmm3, Mebx, AJ1)
+
+        movpx_ld(Xmm1, Mecx, AJ2)
+        mxips_rr(Xmm3, Xmm1)
+        movpx_st(Xmm3, Mebx, AJ2)
+        adips_rr(Xmm1, Xmm1)
+        movpx_st(Xmm1, Medx, AJ2)
+
+        movxx_ld(Recx, Mebp, inf_IAR0)
+        movxx_ld(Redx, Mebp, inf_ISO1)
+        movxx_ld(Rebx, Mebp, inf_ISO2)
+
+        movpx_ld(Xmm1, Mecx, AJ0)
+        adipx_rr(Xmm2, Xmm1)
+        movpx_st(Xmm2, Medx, AJ0)
+        mxipx_rr(Xmm3, Xmm1)
+        movpx_st(Xmm3, Mebx, AJ0)
+
+        movpx_ld(Xmm1, Mecx, AJ1)
+        adepx_rr(Xmm2, Xmm1)
+        movpx_st(Xmm2, Medx, AJ1)
+        mnipx_rr(Xmm3, Xmm1)
+        movpx_st(Xmm3, Mebx, AJ1)
+
+        movpx_ld(Xmm1, Mecx, AJ2)
+        xorpx_rr(Xmm4, Xmm4)
+        subpx_rr(Xmm4, Xmm1)
+        mnipn_rr(Xmm3, Xmm4)
+        mxipn_rr(Xmm5, Xmm4)
+        addpx_rr(Xmm3, Xmm5)
+        movpx_st(Xmm3, Mebx, AJ2)
+        adipx_rr(Xmm1, Xmm1)
+        movpx_st(Xmm1, Medx, AJ2)
+
+    ASM_LEAVE(info)
+}
+
+rt_void p_test61(rt_SIMD_INFOX *info)
+{
+    rt_si32 j, n = info->size;
+
+    rt_real *far0 = info->far0 + S*RT_OFFS_SIMD;
+    rt_real *fco1 = info->fco1 + S*RT_OFFS_SIMD;
+    rt_real *fco2 = info->fco2 + S*RT_OFFS_SIMD;
+    rt_real *fso1 = info->fso1 + S*RT_OFFS_SIMD;
+    rt_real *fso2 = info->fso2 + S*RT_OFFS_SIMD;
+
+    rt_elem *iar0 = info->iar0 + S*RT_OFFS_SIMD;
+    rt_elem *ico1 = info->ico1 + S*RT_OFFS_SIMD;
+    rt_elem *ico2 = info->ico2 + S*RT_OFFS_SIMD;
+    rt_elem *iso1 = info->iso1 + S*RT_OFFS_SIMD;
+    rt_elem *iso2 = info->iso2 + S*RT_OFFS_SIMD;
+
+    j = n;
+    while (j-->0)
+    {
+        if (FEQ(fco1[j], fso1[j]) && FEQ(fco2[j], fso2[j])
+        &&  IEQ(ico1[j], iso1[j]) && IEQ(ico2[j], iso2[j]) && !v_mode)
+        {
+            continue;
+        }
+
+        RT_LOGI("farr[%d] = %e, iarr[%d] = %" PR_L "d\n",
+                j, far0[j], j, iar0[j]);
+#ifdef RT_PRINT_CPP
+        RT_LOGI("C sum farr[%d] = %e, min/max farr[%d] = %e\n",
+                j, fco1[j], j, fco2[j]);
+        RT_LOGI("C sum iarr[%d] = %" PR_L "d, min/max iarr[%d] = %" PR_L "d\n",
+                j, ico1[j], j, ico2[j]);
+#endif /* RT_PRINT_CPP */
+#ifdef RT_PRINT_ASM
+        RT_LOGI("S sum farr[%d] = %e, min/max farr[%d] = %e\n",
+                j, fso1[j], j, fso2[j]);
+        RT_LOGI("S sum iarr[%d] = %" PR_L "d, min/max iarr[%d] = %" PR_L "d\n",
+                j, iso1[j], j, iso2[j]);
+#endif /* RT_PRINT_ASM */
+    }
+}
+
+#endif /* SUB_TEST 61 */
+
+/******************************************************************************/
+/*******************************   SUB TEST 62   ******************************/
+/******************************************************************************/
+
+#if SUB_TEST >= 62
+
+rt_void c_test62(rt_SIMD_INFOX *info)
+{
+    rt_si32 i, j;
+
+    rt_real *sar0 = info->sar0;
+    rt_real *sptr = info->sptr;
+
+    rt_real *fco1 = info->fco1 + S*RT_OFFS_SIMD;
+
+    for (j = 0; j < S; j++)
+    {
+        fco1[S*0 + j] = 0.0f;
+        fco1[S*1 + j] = 0.0f;
+        fco1[S*2 + j] = 0.0f;
+    }
+
+    for (i = 0; i < STR_WIND; i++)
+    {
+        for (j = 0; j < S; j++)
+        {
+            fco1[S*0 + j] += sptr[S*0 + j] + sptr[S*1 + j];
+            fco1[S*1 + j] += sptr[S*2 + j] + sptr[S*3 + j];
+            fco1[S*2 + j] += sptr[S*0 + j] + sptr[S*3 + j];
+        }
+        sptr = sar0 + ((sptr - sar0 + STR_STEP/sizeof(rt_real))
+                                    & (STR_SIZE/sizeof(rt_real) - 1));
+    }
+
+    info->sptr = sptr;
+}
+
+/*
+ * Streaming sums over an array (STR_SIZE bytes) in 4-vector windows,
+ * each call continues from where the previous one stopped (inf_SPTR) and
+ * wraps at the end of the array, windows are STR_STEP bytes apart crossing
+ * pages, where hardware prefetchers stop, so the window STR_DIST steps ahead
+ * is prefetched with all four locality hints (one per vector). The array is
+ * kept small to check encodings, for timing see o_strm (-s option) below.
+ */
+rt_void s_test62(rt_SIMD_INFOX *info)
+{
+    ASM_ENTER(info)
+
+        movxx_ld(Rebx, Mebp, inf_SAR0)
+        movxx_ld(Recx, Mebp, inf_SPTR)
+        movwx_ri(Redi, IB(STR_WIND))
+
+        xorpx_rr(Xmm1, Xmm1)
+        xorpx_rr(Xmm2, Xmm2)
+        xorpx_rr(Xmm3, Xmm3)
+
+    LBL(100500) /* str_beg */
+
+        movxx_rr(Redx, Recx)
+        addxx_ri(Redx, IV(STR_STEP*STR_DIST))
+        subxx_rr(Redx, Rebx)
+        andxx_ri(Redx, IV(STR_SIZE-1))
+        addxx_rr(Redx, Rebx)
+
+        pf0xx_ld(Medx, DP(Q*0x000))
+        pf1xx_ld(Medx, DP(Q*0x010))
+        pf2xx_ld(Medx, DP(Q*0x020))
+        pfnxx_ld(Medx, DP(Q*0x030))
+
+        movpx_ld(Xmm4, Mecx, DP(Q*0x000))
+        movpx_ld(Xmm5, Mecx, DP(Q*0x010))
+        movpx_ld(Xmm6, Mecx, DP(Q*0x020))
+        movpx_ld(Xmm7, Mecx, DP(Q*0x030))
+
+        movpx_rr(Xmm0, Xmm4)
+        addps_rr(Xmm0, Xmm5)
+        addps_rr(Xmm1, Xmm0)
+        movpx_rr(Xmm0, Xmm6)
+        addps_rr(Xmm0, Xmm7)
+        addps_rr(Xmm2, Xmm0)
+        addps_rr(Xmm4, Xmm7)
+        addps_rr(Xmm3, Xmm4)
+
+        addxx_ri(Recx, IV(STR_STEP))
+        subxx_rr(Recx, Rebx)
+        andxx_ri(Recx, IV(STR_SIZE-1))
+        addxx_rr(Recx, Rebx)
+        subwx_ri(Redi, IB(1))
+        cmjwx_rz(Redi,
+        /* if */ GT_x, 100500b) /* str_beg */
+
+        movxx_st(Recx, Mebp, inf_SPTR)
+
+        movxx_ld(Redx, Mebp, inf_FSO1)
+        movpx_st(Xmm1, Medx, AJ0)
+        movpx_st(Xmm2, Medx, AJ1)
+        movpx_st(Xmm3, Medx, AJ2)
+
+    ASM_LEAVE(info)
+}
+
+rt_void p_test62(rt_SIMD_INFOX *info)
+{
+    rt_si32 j, n = info->size;
+
+    rt_real *far0 = info->far0 + S*RT_OFFS_SIMD;
+    rt_real *fco1 = info->fco1 + S*RT_OFFS_SIMD;
+    rt_real *fso1 = info->fso1 + S*RT_OFFS_SIMD;
+
+    j = n;
+    while (j-->0)
+    {
+        if (FEQ(fco1[j], fso1[j]) && !v_mode)
+        {
+            continue;
+        }
+
+        RT_LOGI("farr[%d] = %e\n",
+                j % S, far0[j % S]);
+#ifdef RT_PRINT_CPP
+        RT_LOGI("C sum sarr[%d] = %e\n",
+                j, fco1[j]);
+#endif /* RT_PRINT_CPP */
+#ifdef RT_PRINT_ASM
+        RT_LOGI("S sum sarr[%d] = %e\n",
+                j, fso1[j]);
+#endif /* RT_PRINT_ASM */
+    }
+}
+
+/*
+ * Prefetch benchmark (-s option) over an array larger than caches (smsk+1),
+ * windows are walked as in s_test62, but each is followed by STR_WORK rounds
+ * of work depending on its data (multiply by 1.0), so that the reorder buffer
+ * is filled with it and loads of the next windows are not issued early,
+ * prefetch distance (sdst) of 0 targets the current window (no prefetch)
+ * keeping the same number of instructions for comparison.
+ */
+rt_void o_strm(rt_SIMD_INFOX *info)
+{
+    ASM_ENTER(info)
+
+        movxx_ld(Rebx, Mebp, inf_SAR0)
+        movxx_ld(Recx, Mebp, inf_SPTR)
+        movwx_ld(Resi, Mebp, inf_SMSK)
+        movwx_ld(Reax, Mebp, inf_SDST)
+        movwx_ri(Redi, IB(STR_WIND))
+
+        xorpx_rr(Xmm1, Xmm1)
+        xorpx_rr(Xmm2, Xmm2)
+        xorpx_rr(Xmm3, Xmm3)
+
+    LBL(100500) /* str_beg */
+
+        movxx_rr(Redx, Recx)
+        addxx_rr(Redx, Reax)
+        subxx_rr(Redx, Rebx)
+        andxx_rr(Redx, Resi)
+        addxx_rr(Redx, Rebx)
+
+        pf0xx_ld(Medx, DP(Q*0x000))
+        pf1xx_ld(Medx, DP(Q*0x010))
+        pf2xx_ld(Medx, DP(Q*0x020))
+        pfnxx_ld(Medx, DP(Q*0x030))
+
+        movpx_ld(Xmm4, Mecx, DP(Q*0x000))
+        movpx_ld(Xmm5, Mecx, DP(Q*0x010))
+        movpx_ld(Xmm6, Mecx, DP(Q*0x020))
+        movpx_ld(Xmm7, Mecx, DP(Q*0x030))
+
+        movwx_ri(Redx, IB(STR_WORK))
+
+    LBL(100501) /* wrk_beg */
+
+        mulps_ld(Xmm4, Mebp, inf_GPC01)
+        mulps_ld(Xmm5, Mebp, inf_GPC01)
+        mulps_ld(Xmm6, Mebp, inf_GPC01)
+        mulps_ld(Xmm7, Mebp, inf_GPC01)
+        subwx_ri(Redx, IB(1))
+        cmjwx_rz(Redx,
+        /* if */ GT_x, 100501b) /* wrk_beg */
+
+        movpx_rr(Xmm0, Xmm4)
+        addps_rr(Xmm0, Xmm5)
+        addps_rr(Xmm1, Xmm0)
+        movpx_rr(Xmm0, Xmm6)
+        addps_rr(Xmm0, Xmm7)
+        addps_rr(Xmm2, Xmm0)
+        addps_rr(Xmm4, Xmm7)
+        addps_rr(Xmm3, Xmm4)
+
+        addxx_ri(Recx, IV(STR_STEP))
+        subxx_rr(Recx, Rebx)
+        andxx_rr(Recx, Resi)
+        addxx_rr(Recx, Rebx)
+        subwx_ri(Redi, IB(1))
+        cmjwx_rz(Redi,
+        /* if */ GT_x, 100500b) /* str_beg */
+
+        movxx_st(Recx, Mebp, inf_SPTR)
+
+        movxx_ld(Redx, Mebp, inf_FSO1)
+        movpx_st(Xmm1, Medx, AJ0)
+        movpx_st(Xmm2, Medx, AJ1)
+        movpx_st(Xmm3, Medx, AJ2)
+
+    ASM_LEAVE(info)
+}
+
+#endif /* SUB_TEST 62 */
+
+/******************************************************************************/
+/*******************************   SUB TEST 63   ******************************/
+/******************************************************************************/
+
+#if SUB_TEST >= 63
+
+rt_void c_test63(rt_SIMD_INFOX *info)
+{
+    rt_si32 i, j;
+
+    rt_real *sar1 = info->sar1;
+    rt_real *sptw = info->sptw;
+    rt_real *sblk = sptw;
+
+    rt_real *far0 = info->far0 + S*RT_OFFS_SIMD;
+    rt_real *fco1 = info->fco1 + S*RT_OFFS_SIMD;
+
+    for (i = 0; i < STR_WIND; i++)
+    {
+        memset(sptw, 0, STR_BLCK/2);
+
+        for (j = 0; j < S; j++)
+        {
+            sptw[S*0x8 + j] = far0[S*0 + j];
+            sptw[S*0x9 + j] = far0[S*1 + j];
+            sptw[S*0xA + j] = far0[S*2 + j];
+            sptw[S*0xB + j] = far0[S*0 + j] + far0[S*1 + j];
+        }
+        sblk = sptw;
+        sptw = sar1 + ((sptw - sar1 + STR_BLCK/sizeof(rt_real))
+                                    & (STR_SIZE/sizeof(rt_real) - 1));
+    }
+
+    for (j = 0; j < S; j++)
+    {
+        fco1[S*0 + j] = sblk[S*0x8 + j] + sblk[S*0x0 + j];
+        fco1[S*1 + j] = sblk[S*0x9 + j] + sblk[S*0x7 + j];
+        fco1[S*2 + j] = sblk[S*0xA + j] + sblk[S*0xB + j];
+    }
+
+    info->sptw = sptw;
+}
+
+/*
+ * Streaming writes to a large array (STR_SIZE bytes) in STR_BLCK-sized blocks,
+ * each call continues from where the previous one stopped (inf_SPTW) and
+ * wraps at the end of the array, the first half of each block is cleared
+ * with cache-line zeroing (zcl), then 4 vectors are stored non-temporally
+ * (stn) into the second half, the last block is read back after the fence.
+ */
+rt_void s_test63(rt_SIMD_INFOX *info)
+{
+    ASM_ENTER(info)
+
+        movxx_ld(Rebx, Mebp, inf_SAR1)
+        movxx_ld(Recx, Mebp, inf_SPTW)
+        movwx_ri(Redi, IB(STR_WIND))
+
+        movxx_ld(Redx, Mebp, inf_FAR0)
+        movpx_ld(Xmm1, Medx, AJ0)
+        movpx_ld(Xmm2, Medx, AJ1)
+        movpx_ld(Xmm3, Medx, AJ2)
+        movpx_rr(Xmm4, Xmm1)
+        addps_rr(Xmm4, Xmm2)
+
+    LBL(100500) /* str_beg */
+
+        movxx_rr(Redx, Recx)
+        movwx_ri(Resi, IB(Q))
+
+    LBL(100501) /* zcl_beg */
+
+        zclxx_st(Medx, DP(0x000))
+        addxx_ri(Redx, IB(0x80))
+        subwx_ri(Resi, IB(1))
+        cmjwx_rz(Resi,
+        /* if */ GT_x, 100501b) /* zcl_beg */
+
+        stnpx_st(Xmm1, Mecx, DP(Q*0x080))
+        stnpx_st(Xmm2, Mecx, DP(Q*0x090))
+        stnpx_st(Xmm3, Mecx, DP(Q*0x0A0))
+        stnpx_st(Xmm4, Mecx, DP(Q*0x0B0))
+
+        movxx_rr(Redx, Recx)
+        addxx_ri(Recx, IV(STR_BLCK))
+        subxx_rr(Recx, Rebx)
+        andxx_ri(Recx, IV(STR_SIZE-1))
+        addxx_rr(Recx, Rebx)
+        subwx_ri(Redi, IB(1))
+        cmjwx_rz(Redi,
+        /* if */ GT_x, 100500b) /* str_beg */
+
+        sfnce_xx()
+
+        movxx_st(Recx, Mebp, inf_SPTW)
+
+        movpx_ld(Xmm1, Medx, DP(Q*0x080))
+        addps_ld(Xmm1, Medx, DP(Q*0x000))
+        movpx_ld(Xmm2, Medx, DP(Q*0x090))
+        addps_ld(Xmm2, Medx, DP(Q*0x070))
+        movpx_ld(Xmm3, Medx, DP(Q*0x0A0))
+        addps_ld(Xmm3, Medx, DP(Q*0x0B0))
+
+        movxx_ld(Redx, Mebp, inf_FSO1)
+        movpx_st(Xmm1, Medx, AJ0)
+        movpx_st(Xmm2, Medx, AJ1)
+        movpx_st(Xmm3, Medx, AJ2)
+
+    ASM_LEAVE(info)
+}
+
+rt_void p_test63(rt_SIMD_INFOX *info)
+{
+    rt_si32 j, n = info->size;
+
+    rt_real *far0 = info->far0 + S*RT_OFFS_SIMD;
+    rt_real *fco1 = info->fco1 + S*RT_OFFS_SIMD;
+    rt_real *fso1 = info->fso1 + S*RT_OFFS_SIMD;
+
+    j = n;
+    while (j-->0)
+    {
+        if (FEQ(fco1[j], fso1[j]) && !v_mode)
+        {
+            continue;
+        }
+
+        RT_LOGI("farr[%d] = %e\n",
+                j, far0[j]);
+#ifdef RT_PRINT_CPP
+        RT_LOGI("C blk sarr[%d] = %e\n",
+                j, fco1[j]);
+#endif /* RT_PRINT_CPP */
+#ifdef RT_PRINT_ASM
+        RT_LOGI("S blk sarr[%d] = %e\n",
+                j, fso1[j]);
+#endif /* RT_PRINT_ASM */
+    }
+}
+
+#endif /* SUB_TEST 63 */
+
+/******************************************************************************/
+/*******************************   SUB TEST 64   ******************************/
+/******************************************************************************/
+
+#if SUB_TEST >= 64
+
+rt_void c_test64(rt_SIMD_INFOX *info)
+{
+    rt_si32 j, k, n = info->size;
+
+    rt_elem *iar0 = info->iar0 + S*RT_OFFS_SIMD;
+    rt_elem *ico1 = info->ico1 + S*RT_OFFS_SIMD;
+    rt_elem *ico2 = info->ico2 + S*RT_OFFS_SIMD;
+
+    rt_half *har0 = info->har0 + N*RT_OFFS_SIMD;
+    rt_half *hco1 = info->hco1 + N*RT_OFFS_SIMD;
+
+    j = n;
+    while (j-->0)
+    {
+        rt_uelm y = (rt_uelm)iar0[j] & ((rt_uelm)iar0[j] >> 8);
+        rt_uelm c = 0, l = RT_ELEMENT, t = RT_ELEMENT;
+
+        for (k = 0; k < RT_ELEMENT; k++)
+        {
+            if (y & ((rt_uelm)1 << k))
+            {
+                c += 1;
+                l  = RT_ELEMENT-1 - k;
+                t  = RT_MIN(t, (rt_uelm)k);
+            }
+        }
+
+        ico1[j] = (rt_elem)(c | l << 8 | t << 16);
+        ico2[j] = (rt_elem)(c | l << 8 | t << 16);
+    }
+
+    n = (info->size * sizeof(rt_elem)) / sizeof(rt_half);
+
+    j = n;
+    while (j-->0)
+    {
+        rt_half y = har0[j] & (har0[j] >> 4);
+        rt_half c = 0, l = 16, t = 16;
+
+        for (k = 0; k < 16; k++)
+        {
+            if (y & (1 << k))
+            {
+                c += 1;
+                l  = 15 - k;
+                t  = RT_MIN(t, (rt_half)k);
+            }
+        }
+
+        hco1[j] = c | l << 5 | t << 10;
+    }
+}
+
+/*
+ * Bit-counts (cnt/clz/ctz) of y = x & (x >> 8) for each element, where zero
+ * inputs return the element size for clz/ctz, results are packed into 8-bit
+ * fields (cnt | clz << 8 | ctz << 16), SIMD (cmdp) and BASE (cmdy) forms
+ * are checked separately, 16-bit elements (cmdm) use 5-bit fields instead.
+ */
+rt_void s_test64(rt_SIMD_INFOX *info)
+{
+    ASM_ENTER(info)
+
+        movxx_ld(Recx, Mebp, inf_IAR0)
+        movxx_ld(Redx, Mebp, inf_ISO1)
+
+        movpx_ld(Xmm1, Mecx, AJ0)
+        movpx_rr(Xmm0, Xmm1)
+        shrpx_ri(Xmm0, IB(8))
+        andpx_rr(Xmm1, Xmm0)
+        movpx_st(Xmm1, Medx, AJ0)
+        cntpx_rr(Xmm2, Xmm1)
+        clzpx_ld(Xmm3, Medx, AJ0)
+        ctzpx_rr(Xmm4, Xmm1)
+        shlpx_ri(Xmm3, IB(8))
+        shlpx_ri(Xmm4, IB(16))
+        orrpx_rr(Xmm2, Xmm3)
+        orrpx_rr(Xmm2, Xmm4)
+        movpx_st(Xmm2, Medx, AJ0)
+
+        movpx_ld(Xmm1, Mecx, AJ1)
+        movpx_rr(Xmm0, Xmm1)
+        shrpx_ri(Xmm0, IB(8))
+        andpx_rr(Xmm1, Xmm0)
+        movpx_st(Xmm1, Medx, AJ1)
+        cntpx_ld(Xmm2, Medx, AJ1)
+        clzpx_rr(Xmm3, Xmm1)
+        ctzpx_ld(Xmm4, Medx, AJ1)
+        shlpx_ri(Xmm3, IB(8))
+        shlpx_ri(Xmm4, IB(16))
+        orrpx_rr(Xmm2, Xmm3)
+        orrpx_rr(Xmm2, Xmm4)
+        movpx_st(Xmm2, Medx, AJ1)
+
+        movpx_ld(Xmm1, Mecx, AJ2)
+        movpx_rr(Xmm0, Xmm1)
+        shrpx_ri(Xmm0, IB(8))
+        andpx_rr(Xmm1, Xmm0)
+        cntpx_rr(Xmm2, Xmm1)
+        clzpx_rr(Xmm3, Xmm1)
+        ctzpx_rr(Xmm4, Xmm1)
+        shlpx_ri(Xmm3, IB(8))
+        shlpx_ri(Xmm4, IB(16))
+        orrpx_rr(Xmm2, Xmm3)
+        orrpx_rr(Xmm2, Xmm4)
+        movpx_st(Xmm2, Medx, AJ2)
+
+        movxx_ld(Rebx, Mebp, inf_ISO2)
+        movwx_ld(Redi, Mebp, inf_SIZE)
+
+    LBL(100500) /* cnt_beg */
+
+        movyx_ld(Reax, Mecx, AJ0)
+        movyx_rr(Redx, Reax)
+        shryx_ri(Redx, IB(8))
+        andyx_rr(Reax, Redx)
+        movyx_st(Reax, Mebx, AJ0)
+        cntyx_rr(Redx, Reax)
+        clzyx_ld(Resi, Mebx, AJ0)
+        shlyx_ri(Resi, IB(8))
+        orryx_rr(Redx, Resi)
+        ctzyx_rr(Resi, Reax)
+        shlyx_ri(Resi, IB(16))
+        orryx_rr(Redx, Resi)
+        movyx_st(Redx, Mebx, AJ0)
+
+        addxx_ri(Recx, IB(4*L))
+        addxx_ri(Rebx, IB(4*L))
+        subwx_ri(Redi, IB(1))
+        cmjwx_rz(Redi,
+        /* if */ GT_x, 100500b) /* cnt_beg */
+
+        movxx_ld(Recx, Mebp, inf_HAR0)
+        movxx_ld(Redx, Mebp, inf_HSO1)
+
+        movmx_ld(Xmm1, Mecx, AJ0)
+        movmx_rr(Xmm0, Xmm1)
+        shrmx_ri(Xmm0, IB(4))
+        andmx_rr(Xmm1, Xmm0)
+        movmx_st(Xmm1, Medx, AJ0)
+        cntmx_rr(Xmm2, Xmm1)
+        clzmx_ld(Xmm3, Medx, AJ0)
+        ctzmx_rr(Xmm4, Xmm1)
+        shlmx_ri(Xmm3, IB(5))
+        shlmx_ri(Xmm4, IB(10))
+        orrmx_rr(Xmm2, Xmm3)
+        orrmx_rr(Xmm2, Xmm4)
+        movmx_st(Xmm2, Medx, AJ0)
+
+        movmx_ld(Xmm1, Mecx, AJ1)
+        movmx_rr(Xmm0, Xmm1)
+        shrmx_ri(Xmm0, IB(4))
+        andmx_rr(Xmm1, Xmm0)
+        movmx_st(Xmm1, Medx, AJ1)
+        cntmx_ld(Xmm2, Medx, AJ1)
+        clzmx_rr(Xmm3, Xmm1)
+        ctzmx_ld(Xmm4, Medx, AJ1)
+        shlmx_ri(Xmm3, IB(5))
+        shlmx_ri(Xmm4, IB(10))
+        orrmx_rr(Xmm2, Xmm3)
+        orrmx_rr(Xmm2, Xmm4)
+        movmx_st(Xmm2, Medx, AJ1)
+
+        movmx_ld(Xmm1, Mecx, AJ2)
+        movmx_rr(Xmm0, Xmm1)
+        shrmx_ri(Xmm0, IB(4))
+        andmx_rr(Xmm1, Xmm0)
+        cntmx_rr(Xmm2, Xmm1)
+        clzmx_rr(Xmm3, Xmm1)
+        ctzmx_rr(Xmm4, Xmm1)
+        shlmx_ri(Xmm3, IB(5))
+        shlmx_ri(Xmm4, IB(10))
+        orrmx_rr(Xmm2, Xmm3)
+        orrmx_rr(Xmm2, Xmm4)
+        movmx_st(Xmm2, Medx, AJ2)
+
+    ASM_LEAVE(info)
+}
+
+rt_void p_test64(rt_SIMD_INFOX *info)
+{
+    rt_si32 j, n = info->size;
+
+    rt_elem *iar0 = info->iar0 + S*RT_OFFS_SIMD;
+    rt_elem *ico1 = info->ico1 + S*RT_OFFS_SIMD;
+    rt_elem *ico2 = info->ico2 + S*RT_OFFS_SIMD;
+    rt_elem *iso1 = info->iso1 + S*RT_OFFS_SIMD;
+    rt_elem *iso2 = info->iso2 + S*RT_OFFS_SIMD;
+
+    rt_half *har0 = info->har0 + N*RT_OFFS_SIMD;
+    rt_half *hco1 = info->hco1 + N*RT_OFFS_SIMD;
+    rt_half *hso1 = info->hso1 + N*RT_OFFS_SIMD;
+
+    j = n;
+    while (j-->0)
+    {
+        if (IEQ(ico1[j], iso1[j]) && IEQ(ico2[j], iso2[j]) && !v_mode)
+        {
+            continue;
+        }
+
+        RT_LOGI("iarr[%d] = %" PR_L "d\n",
+                j, iar0[j]);
+#ifdef RT_PRINT_CPP
+        RT_LOGI("C SIMD bit-counts[%d] = %" PR_L "X, "
+                  "BASE bit-counts[%d] = %" PR_L "X\n",
+                j, ico1[j], j, ico2[j]);
+#endif /* RT_PRINT_CPP */
+#ifdef RT_PRINT_ASM
+        RT_LOGI("S SIMD bit-counts[%d] = %" PR_L "X, "
+                  "BASE bit-counts[%d] = %" PR_L "X\n",
+                j, iso1[j], j, iso2[j]);
+#endif /* RT_PRINT_ASM */
+    }
+
+    n = (info->size * sizeof(rt_elem)) / sizeof(rt_half);
+
+    j = n;
+    while (j-->0)
+    {
+        if (IEQ(hco1[j], hso1[j]) && !v_mode)
+        {
+            continue;
+        }
+
+        RT_LOGI("harr[%d] = %d\n",
+                j, (rt_si32)har0[j]);
+#ifdef RT_PRINT_CPP
+        RT_LOGI("C half bit-counts[%d] = %X\n",
+                j, (rt_si32)hco1[j]);
+#endif /* RT_PRINT_CPP */
+#ifdef RT_PRINT_ASM
+        RT_LOGI("S half bit-counts[%d] = %X\n",
+                j, (rt_si32)hso1[j]);
+#endif /* RT_PRINT_ASM */
+    }
+}
+
+#endif /* SUB_TEST 64 */
+
+/******************************************************************************/
+/*******************************   SUB TEST 65   ******************************/
+/******************************************************************************/
+
+#if SUB_TEST >= 65
+
+rt_void c_test65(rt_SIMD_INFOX *info)
+{
+    rt_si32 j, k, n = info->size;
+
+    rt_elem *iar0 = info->iar0 + S*RT_OFFS_SIMD;
+    rt_elem *ico1 = info->ico1 + S*RT_OFFS_SIMD;
+    rt_elem *ico2 = info->ico2 + S*RT_OFFS_SIMD;
+
+    rt_half *har0 = info->har0 + N*RT_OFFS_SIMD;
+    rt_half *hco1 = info->hco1 + N*RT_OFFS_SIMD;
+
+    j = n;
+    while (j-->0)
+    {
+        rt_uelm x = (rt_uelm)iar0[j], y = 0;
+
+        for (k = 0; k < (rt_si32)sizeof(rt_elem); k++)
+        {
+            y = y << 8 | (x >> 8*k & 0xFF);
+        }
+
+        ico1[j] = (rt_elem)y;
+        ico2[j] = (rt_elem)(y + y);
+    }
+
+    n = (info->size * sizeof(rt_elem)) / sizeof(rt_half);
+
+    j = n;
+    while (j-->0)
+    {
+        hco1[j] = (rt_half)(har0[j] << 8 | har0[j] >> 8);
+    }
+}
+
+/*
+ * Byte-swaps reverse the order of bytes within each element, for example
+ * to convert big-endian file or network data on little-endian targets
+ * (and vice versa), SIMD (cmdp/cmdm) forms are checked against C directly,
+ * BASE (cmdy) register and memory forms are summed together.
+ */
+rt_void s_test65(rt_SIMD_INFOX *info)
+{
+    ASM_ENTER(info)
+
+        movxx_ld(Recx, Mebp, inf_IAR0)
+        movxx_ld(Redx, Mebp, inf_ISO1)
+
+        movpx_ld(Xmm1, Mecx, AJ0)
+        bswpx_rr(Xmm2, Xmm1)
+        movpx_st(Xmm2, Medx, AJ0)
+
+        bswpx_ld(Xmm2, Mecx, AJ1)
+        movpx_st(Xmm2, Medx, AJ1)
+
+        movpx_ld(Xmm2, Mecx, AJ2)
+        bswpx_rr(Xmm2, Xmm2)
+        movpx_st(Xmm2, Medx, AJ2)
+
+        movxx_ld(Rebx, Mebp, inf_ISO2)
+        movwx_ld(Redi, Mebp, inf_SIZE)
+
+    LBL(100500) /* bsw_beg */
+
+        movyx_ld(Reax, Mecx, AJ0)
+        bswyx_rr(Redx, Reax)
+        bswyx_ld(Resi, Mecx, AJ0)
+        addyx_rr(Redx, Resi)
+        movyx_st(Redx, Mebx, AJ0)
+
+        addxx_ri(Recx, IB(4*L))
+        addxx_ri(Rebx, IB(4*L))
+        subwx_ri(Redi, IB(1))
+        cmjwx_rz(Redi,
+        /* if */ GT_x, 100500b) /* bsw_beg */
+
+        movxx_ld(Recx, Mebp, inf_HAR0)
+        movxx_ld(Redx, Mebp, inf_HSO1)
+
+        movmx_ld(Xmm1, Mecx, AJ0)
+        bswmx_rr(Xmm2, Xmm1)
+        movmx_st(Xmm2, Medx, AJ0)
+
+        bswmx_ld(Xmm2, Mecx, AJ1)
+        movmx_st(Xmm2, Medx, AJ1)
+
+        movmx_ld(Xmm2, Mecx, AJ2)
+        bswmx_rr(Xmm2, Xmm2)
+        movmx_st(Xmm2, Medx, AJ2)
+
+    ASM_LEAVE(info)
+}
+
+rt_void p_test65(rt_SIMD_INFOX *info)
+{
+    rt_si32 j, n = info->size;
+
+    rt_elem *iar0 = info->iar0 + S*RT_OFFS_SIMD;
+    rt_elem *ico1 = info->ico1 + S*RT_OFFS_SIMD;
+    rt_elem *ico2 = info->ico2 + S*RT_OFFS_SIMD;
+    rt_elem *iso1 = info->iso1 + S*RT_OFFS_SIMD;
+    rt_elem *iso2 = info->iso2 + S*RT_OFFS_SIMD;
+
+    rt_half *har0 = info->har0 + N*RT_OFFS_SIMD;
+    rt_half *hco1 = info->hco1 + N*RT_OFFS_SIMD;
+    rt_half *hso1 = info->hso1 + N*RT_OFFS_SIMD;
+
+    j = n;
+    while (j-->0)
+    {
+        if (IEQ(ico1[j], iso1[j]) && IEQ(ico2[j], iso2[j]) && !v_mode)
+        {
+            continue;
+        }
+
+        RT_LOGI("iarr[%d] = %" PR_L "X\n",
+                j, iar0[j]);
+#ifdef RT_PRINT_CPP
+        RT_LOGI("C SIMD bswap[%d] = %" PR_L "X, "
+                  "BASE bswap*2[%d] = %" PR_L "X\n",
+                j, ico1[j], j, ico2[j]);
+#endif /* RT_PRINT_CPP */
+#ifdef RT_PRINT_ASM
+        RT_LOGI("S SIMD bswap[%d] = %" PR_L "X, "
+                  "BASE bswap*2[%d] = %" PR_L "X\n",
+                j, iso1[j], j, iso2[j]);
+#endif /* RT_PRINT_ASM */
+    }
+
+    n = (info->size * sizeof(rt_elem)) / sizeof(rt_half);
+
+    j = n;
+    while (j-->0)
+    {
+        if (IEQ(hco1[j], hso1[j]) && !v_mode)
+        {
+            continue;
+        }
+
+        RT_LOGI("harr[%d] = %X\n",
+                j, (rt_si32)har0[j]);
+#ifdef RT_PRINT_CPP
+        RT_LOGI("C half bswap[%d] = %X\n",
+                j, (rt_si32)hco1[j]);
+#endif /* RT_PRINT_CPP */
+#ifdef RT_PRINT_ASM
+        RT_LOGI("S half bswap[%d] = %X\n",
+                j, (rt_si32)hso1[j]);
+#endif /* RT_PRINT_ASM */
+    }
+}
+
+#endif /* SUB_TEST 65 */
+
+/******************************************************************************/
+/*******************************   SUB TEST 66   ******************************/
+/******************************************************************************/
+
+#if SUB_TEST >= 66
+
+rt_void c_test66(rt_SIMD_INFOX *info)
+{
+    rt_si32 j, k, n = (info->size * sizeof(rt_elem)) / sizeof(rt_si32);
+
+    rt_si32 *iar0 = (rt_si32 *)(info->iar0 + S*RT_OFFS_SIMD);
+    rt_si32 *ico1 = (rt_si32 *)(info->ico1 + S*RT_OFFS_SIMD);
+    rt_si32 *ico2 = (rt_si32 *)(info->ico2 + S*RT_OFFS_SIMD);
+
+    rt_shrt *hsrc = (rt_shrt *)(info->iar0 + S*RT_OFFS_SIMD);
+    rt_shrt *htgt = (rt_shrt *)(info->har0 + N*RT_OFFS_SIMD);
+    rt_byte *bsrc = (rt_byte *)(info->iar0 + S*RT_OFFS_SIMD);
+    rt_byte *btgt = (rt_byte *)(info->har0 + N*RT_OFFS_SIMD);
+
+    j = n;
+    while (j-->0)
+    {
+        rt_ui32 h = (rt_ui32)iar0[j], b = (rt_ui32)iar0[j];
+
+        for (k = 0; k < 2; k++)
+        {
+            h += (rt_ui32)((rt_si32)hsrc[j*2+k] * (rt_si32)htgt[j*2+k]);
+        }
+
+        for (k = 0; k < 4; k++)
+        {
+            b += (rt_ui32)((rt_si32)bsrc[j*4+k] *
+                          (((rt_si32)btgt[j*4+k] ^ 0x80) - 0x80));
+        }
+
+        ico1[j] = (rt_si32)h;
+        ico2[j] = (rt_si32)b;
+    }
+}
+
+/*
+ * Dot-products accumulate 16-bit pairs (dph) and unsigned-by-signed 8-bit
+ * quads (dpb) into 32-bit elements, which is the inner loop of quantized
+ * (int16/int8) matrix multiplication, iarr is used as both accumulator and
+ * first source (S), harr is reinterpreted as second source (T).
+ */
+rt_void s_test66(rt_SIMD_INFOX *info)
+{
+    ASM_ENTER(info)
+
+        movxx_ld(Recx, Mebp, inf_IAR0)
+        movxx_ld(Rebx, Mebp, inf_HAR0)
+        movxx_ld(Redx, Mebp, inf_ISO1)
+        movxx_ld(Resi, Mebp, inf_ISO2)
+
+        movox_ld(Xmm0, Mecx, AJ0)
+        movox_ld(Xmm1, Mebx, AJ0)
+        movox_rr(Xmm2, Xmm0)
+        dphox_rr(Xmm2, Xmm0, Xmm1)
+        movox_st(Xmm2, Medx, AJ0)
+        movox_rr(Xmm3, Xmm0)
+        dpbox_rr(Xmm3, Xmm0, Xmm1)
+        movox_st(Xmm3, Mesi, AJ0)
+
+        movox_ld(Xmm0, Mecx, AJ1)
+        movox_rr(Xmm2, Xmm0)
+        dphox_ld(Xmm2, Xmm0, Mebx, AJ1)
+        movox_st(Xmm2, Medx, AJ1)
+        movox_rr(Xmm3, Xmm0)
+        dpbox_ld(Xmm3, Xmm0, Mebx, AJ1)
+        movox_st(Xmm3, Mesi, AJ1)
+
+        movox_ld(Xmm4, Mecx, AJ2)
+        movox_ld(Xmm5, Mebx, AJ2)
+        movox_rr(Xmm6, Xmm4)
+        dphox_rr(Xmm6, Xmm4, Xmm5)
+        movox_st(Xmm6, Medx, AJ2)
+        movox_rr(Xmm7, Xmm4)
+        dpbox_rr(Xmm7, Xmm4, Xmm5)
+        movox_st(Xmm7, Mesi, AJ2)
+
+    ASM_LEAVE(info)
+}
+
+rt_void p_test66(rt_SIMD_INFOX *info)
+{
+    rt_si32 j, n = (info->size * sizeof(rt_elem)) / sizeof(rt_si32);
+
+    rt_si32 *iar0 = (rt_si32 *)(info->iar0 + S*RT_OFFS_SIMD);
+    rt_si32 *ico1 = (rt_si32 *)(info->ico1 + S*RT_OFFS_SIMD);
+    rt_si32 *ico2 = (rt_si32 *)(info->ico2 + S*RT_OFFS_SIMD);
+    rt_si32 *iso1 = (rt_si32 *)(info->iso1 + S*RT_OFFS_SIMD);
+    rt_si32 *iso2 = (rt_si32 *)(info->iso2 + S*RT_OFFS_SIMD);
+
+    rt_si32 *hwrd = (rt_si32 *)(info->har0 + N*RT_OFFS_SIMD);
+
+    j = n;
+    while (j-->0)
+    {
+        if (IEQ(ico1[j], iso1[j]) && IEQ(ico2[j], iso2[j]) && !v_mode)
+        {
+            continue;
+        }
+
+        RT_LOGI("iarr[%d] = %X, harr-word[%d] = %X\n",
+                j, iar0[j], j, hwrd[j]);
+#ifdef RT_PRINT_CPP
+        RT_LOGI("C dph[%d] = %X, dpb[%d] = %X\n",
+                j, ico1[j], j, ico2[j]);
+#endif /* RT_PRINT_CPP */
+#ifdef RT_PRINT_ASM
+        RT_LOGI("S dph[%d] = %X, dpb[%d] = %X\n",
+                j, iso1[j], j, iso2[j]);
+#endif /* RT_PRINT_ASM */
+    }
+}
+
+#endif /* SUB_TEST 66 */
+
+/******************************************************************************/
+/*******************************   SUB TEST 67   ******************************/
+/******************************************************************************/
+
+#if SUB_TEST >= 67
+
+rt_void c_test67(rt_SIMD_INFOX *info)
+{
+    rt_si32 j, k, n = (info->size * sizeof(rt_elem)) / sizeof(rt_ui32);
+    rt_si32 w = n / 3; /* number of 32-bit elements in one SIMD register */
+
+    rt_ui32 *fwrd = (rt_ui32 *)(info->far0 + S*RT_OFFS_SIMD);
+    rt_ui32 *ico1 = (rt_ui32 *)(info->ico1 + S*RT_OFFS_SIMD);
+
+    rt_half *har0 = info->har0 + N*RT_OFFS_SIMD;
+    rt_half *hco1 = info->hco1 + N*RT_OFFS_SIMD;
+
+    j = n;
+    while (j-->0)
+    {
+        rt_ui32 h = har0[(j / w) * 2*w + j % w];
+        rt_ui32 e = h >> 10 & 0x1F, m = h & 0x3FF, y;
+
+        if (e == 0x1F)
+        {
+            y = 0x7F800000 | m << 13 | (m != 0 ? 0x00400000 : 0);
+        }
+        else
+        if (e != 0)
+        {
+            y = (e + 112) << 23 | m << 13;
+        }
+        else
+        if (m != 0)
+        {
+            for (e = 113; (m & 0x400) == 0; e--)
+            {
+                m <<= 1;
+            }
+            y = e << 23 | (m & 0x3FF) << 13;
+        }
+        else
+        {
+            y = 0;
+        }
+
+        ico1[j] = y | (h & 0x8000) << 16;
+    }
+
+    j = n;
+    while (j-->0)
+    {
+        rt_ui32 x = fwrd[j], a = x & 0x7FFFFFFF, y;
+
+        if (a > 0x7F800000)
+        {
+            y = 0x7E00 | (a >> 13 & 0x3FF);
+        }
+        else
+        if (a >= 0x477FF000)
+        {
+            y = 0x7C00;
+        }
+        else
+        if (a >= 0x38800000)
+        {
+            y = a - 0x38000000;
+            y = (y + 0xFFF + (y >> 13 & 1)) >> 13;
+        }
+        else
+        if (a >= 0x33000000)
+        {
+            rt_ui32 s = 126 - (a >> 23), r = (a & 0x7FFFFF) | 0x800000;
+            y = r >> s;
+            r = r & ((1 << s) - 1);
+            y += (r > (1u << (s - 1)) || (r == (1u << (s - 1)) && (y & 1)));
+        }
+        else
+        {
+            y = 0;
+        }
+
+        k = (j / w) * 2*w + j % w;
+        hco1[k] = (rt_half)(y | (x >> 16 & 0x8000));
+        hco1[k + w] = 0;
+    }
+}
+
+/*
+ * Half-precision converters widen the lower half of fp16 elements of cmdm
+ * register (or memory) to fp32 in cmdo register, and narrow fp32 elements
+ * to the lower half of cmdm (upper half is 0), harr is reinterpreted as
+ * fp16 bit-patterns (subnormals, NaN), farr words as fp32 bit-patterns,
+ * the C reference rounds to nearest-even and quiets NaNs as hardware does.
+ */
+rt_void s_test67(rt_SIMD_INFOX *info)
+{
+    ASM_ENTER(info)
+
+        movxx_ld(Rebx, Mebp, inf_HAR0)
+        movxx_ld(Redx, Mebp, inf_ISO1)
+
+        movmx_ld(Xmm0, Mebx, AJ0)
+        cvyms_rr(Xmm1, Xmm0)
+        movox_st(Xmm1, Medx, AJ0)
+
+        cvyms_ld(Xmm1, Mebx, AJ1)
+        movox_st(Xmm1, Medx, AJ1)
+
+        movmx_ld(Xmm2, Mebx, AJ2)
+        cvyms_rr(Xmm2, Xmm2)
+        movox_st(Xmm2, Medx, AJ2)
+
+        movxx_ld(Recx, Mebp, inf_FAR0)
+        movxx_ld(Redx, Mebp, inf_HSO1)
+
+        movox_ld(Xmm0, Mecx, AJ0)
+        cvxos_rr(Xmm1, Xmm0)
+        movmx_st(Xmm1, Medx, AJ0)
+
+        xormx_rr(Xmm2, Xmm2)
+        movmx_st(Xmm2, Medx, AJ1)
+        movox_ld(Xmm1, Mecx, AJ1)
+        cvxos_st(Xmm1, Medx, AJ1)
+
+        movox_ld(Xmm2, Mecx, AJ2)
+        cvxos_rr(Xmm2, Xmm2)
+        movmx_st(Xmm2, Medx, AJ2)
+
+    ASM_LEAVE(info)
+}
+
+rt_void p_test67(rt_SIMD_INFOX *info)
+{
+    rt_si32 j, k, n = (info->size * sizeof(rt_elem)) / sizeof(rt_ui32);
+    rt_si32 w = n / 3; /* number of 32-bit elements in one SIMD register */
+
+    rt_ui32 *fwrd = (rt_ui32 *)(info->far0 + S*RT_OFFS_SIMD);
+    rt_ui32 *ico1 = (rt_ui32 *)(info->ico1 + S*RT_OFFS_SIMD);
+    rt_ui32 *iso1 = (rt_ui32 *)(info->iso1 + S*RT_OFFS_SIMD);
+
+    rt_half *har0 = info->har0 + N*RT_OFFS_SIMD;
+    rt_half *hco1 = info->hco1 + N*RT_OFFS_SIMD;
+    rt_half *hso1 = info->hso1 + N*RT_OFFS_SIMD;
+
+    j = n;
+    while (j-->0)
+    {
+        k = (j / w) * 2*w + j % w;
+
+        if (IEQ(ico1[j], iso1[j]) && IEQ(hco1[k], hso1[k])
+        &&  IEQ(hco1[k + w], hso1[k + w]) && !v_mode)
+        {
+            continue;
+        }
+
+        RT_LOGI("harr[%d] = %X, farr-word[%d] = %X\n",
+                k, (rt_si32)har0[k], j, fwrd[j]);
+#ifdef RT_PRINT_CPP
+        RT_LOGI("C fp16-to-fp32[%d] = %X, fp32-to-fp16[%d] = %X (%X)\n",
+                j, ico1[j], k, (rt_si32)hco1[k], (rt_si32)hco1[k + w]);
+#endif /* RT_PRINT_CPP */
+#ifdef RT_PRINT_ASM
+        RT_LOGI("S fp16-to-fp32[%d] = %X, fp32-to-fp16[%d] = %X (%X)\n",
+                j, iso1[j], k, (rt_si32)hso1[k], (rt_si32)hso1[k + w]);
+#endif /* RT_PRINT_ASM */
+    }
+}
+
+#endif /* SUB_TEST 67 */
+
+/******************************************************************************/
+/*******************************   SUB TEST 68   ******************************/
+/******************************************************************************/
+
+#if SUB_TEST >= 68
+
+rt_void c_test68(rt_SIMD_INFOX *info)
+{
+    rt_si32 j, k, n = (info->size * sizeof(rt_elem)) / sizeof(rt_ui64);
+    rt_si32 w = n / 3; /* number of 64-bit elements in one SIMD register */
+
+    rt_ui32 *fwrd = (rt_ui32 *)(info->far0 + S*RT_OFFS_SIMD);
+    rt_ui32 *iwrd = (rt_ui32 *)(info->iar0 + S*RT_OFFS_SIMD);
+    rt_ui64 *fqwd = (rt_ui64 *)(info->far0 + S*RT_OFFS_SIMD);
+    rt_ui64 *iqwd = (rt_ui64 *)(info->iar0 + S*RT_OFFS_SIMD);
+    rt_ui64 *ico1 = (rt_ui64 *)(info->ico1 + S*RT_OFFS_SIMD);
+    rt_ui32 *ico2 = (rt_ui32 *)(info->ico2 + S*RT_OFFS_SIMD);
+
+    j = n;
+    while (j-->0)
+    {
+        k = j / w;
+        rt_ui32 x = k == 0 ? fwrd[j % w + 0*w] :
+                    k == 1 ? iwrd[j % w + 2*w] : fwrd[j % w + 5*w];
+        rt_ui32 e = x >> 23 & 0xFF, m = x & 0x7FFFFF;
+        rt_ui64 y;
+
+        if (e == 0xFF)
+        {
+            y = (rt_ui64)(0x7FF00 | (m != 0 ? 0x8 : 0)) << 44 | (rt_ui64)m << 29;
+        }
+        else
+        if (e != 0)
+        {
+            y = (rt_ui64)(e + 896) << 52 | (rt_ui64)m << 29;
+        }
+        else
+        if (m != 0)
+        {
+            for (e = 897; (m & 0x800000) == 0; e--)
+            {
+                m <<= 1;
+            }
+            y = (rt_ui64)e << 52 | (rt_ui64)(m & 0x7FFFFF) << 29;
+        }
+        else
+        {
+            y = 0;
+        }
+
+        ico1[j] = y | (rt_ui64)(x >> 31) << 63;
+    }
+
+    j = n;
+    while (j-->0)
+    {
+        k = j / w;
+        rt_ui64 x = k == 1 ? iqwd[j] : fqwd[j], a = x << 1 >> 1, r;
+        rt_ui32 e = (rt_ui32)(a >> 52), s, y;
+
+        if (a > (rt_ui64)0x7FF00000 << 32)
+        {
+            y = 0x7FC00000 | (rt_ui32)(a >> 29 & 0x7FFFFF);
+        }
+        else
+        if (e >= 1151)
+        {
+            y = 0x7F800000;
+        }
+        else
+        if (e >= 897)
+        {
+            r = a - ((rt_ui64)896 << 52);
+            y = (rt_ui32)(r >> 29);
+            r = r & 0x1FFFFFFF;
+            y += (r > 0x10000000 || (r == 0x10000000 && (y & 1)));
+        }
+        else
+        if (e >= 872)
+        {
+            s = 926 - e;
+            r = (a & (((rt_ui64)1 << 52) - 1)) | ((rt_ui64)1 << 52);
+            y = (rt_ui32)(r >> s);
+            r = r & (((rt_ui64)1 << s) - 1);
+            y += (r > ((rt_ui64)1 << (s - 1))
+              || (r == ((rt_ui64)1 << (s - 1)) && (y & 1)));
+        }
+        else
+        {
+            y = 0;
+        }
+
+        ico2[(j / w) * 2*w + j % w] = y | (rt_ui32)(x >> 63) << 31;
+        ico2[(j / w) * 2*w + j % w + w] = 0;
+    }
+}
+
+/*
+ * Single/double-precision converters widen the lower (or upper) half of fp32
+ * elements of cmdo register (or memory) to fp64 in cmdq register, and narrow
+ * fp64 elements to the lower half of cmdo (upper half is 0), farr/iarr words
+ * are reinterpreted as fp32 bit-patterns (small integers become subnormals),
+ * farr/iarr pairs of words are reinterpreted as fp64 bit-patterns,
+ * the C reference rounds to nearest-even and quiets NaNs as hardware does.
+ */
+rt_void s_test68(rt_SIMD_INFOX *info)
+{
+    ASM_ENTER(info)
+
+        movxx_ld(Recx, Mebp, inf_FAR0)
+        movxx_ld(Rebx, Mebp, inf_IAR0)
+        movxx_ld(Redx, Mebp, inf_ISO1)
+
+        movox_ld(Xmm0, Mecx, AJ0)
+        cvyos_rr(Xmm1, Xmm0)
+        movqx_st(Xmm1, Medx, AJ0)
+
+        cvyos_ld(Xmm1, Mebx, AJ1)
+        movqx_st(Xmm1, Medx, AJ1)
+
+        movox_ld(Xmm2, Mecx, AJ2)
+        cvuos_rr(Xmm2, Xmm2)
+        movqx_st(Xmm2, Medx, AJ2)
+
+        movxx_ld(Redx, Mebp, inf_ISO2)
+
+        movqx_ld(Xmm0, Mecx, AJ0)
+        cvxqs_rr(Xmm1, Xmm0)
+        movox_st(Xmm1, Medx, AJ0)
+
+        xorox_rr(Xmm2, Xmm2)
+        movox_st(Xmm2, Medx, AJ1)
+        movqx_ld(Xmm1, Mebx, AJ1)
+        cvxqs_st(Xmm1, Medx, AJ1)
+
+        movqx_ld(Xmm2, Mecx, AJ2)
+        cvxqs_rr(Xmm2, Xmm2)
+        movox_st(Xmm2, Medx, AJ2)
+
+    ASM_LEAVE(info)
+}
+
+rt_void p_test68(rt_SIMD_INFOX *info)
+{
+    rt_si32 j, k, n = (info->size * sizeof(rt_elem)) / sizeof(rt_ui64);
+    rt_si32 w = n / 3; /* number of 64-bit elements in one SIMD register */
+
+    rt_ui64 *fqwd = (rt_ui64 *)(info->far0 + S*RT_OFFS_SIMD);
+    rt_ui64 *iqwd = (rt_ui64 *)(info->iar0 + S*RT_OFFS_SIMD);
+    rt_ui64 *ico1 = (rt_ui64 *)(info->ico1 + S*RT_OFFS_SIMD);
+    rt_ui64 *iso1 = (rt_ui64 *)(info->iso1 + S*RT_OFFS_SIMD);
+    rt_ui32 *ico2 = (rt_ui32 *)(info->ico2 + S*RT_OFFS_SIMD);
+    rt_ui32 *iso2 = (rt_ui32 *)(info->iso2 + S*RT_OFFS_SIMD);
+
+    j = n;
+    while (j-->0)
+    {
+        k = (j / w) * 2*w + j % w;
+
+        if (IEQ(ico1[j], iso1[j]) && IEQ(ico2[k], iso2[k])
+        &&  IEQ(ico2[k + w], iso2[k + w]) && !v_mode)
+        {
+            continue;
+        }
+
+        RT_LOGI("farr-quad[%d] = %016" PR_Z "X, iarr-quad[%d] = %016" PR_Z "X\n",
+                j, (rt_full)fqwd[j], j, (rt_full)iqwd[j]);
+#ifdef RT_PRINT_CPP
+        RT_LOGI("C fp32-to-fp64[%d] = %016" PR_Z "X, "
+                  "fp64-to-fp32[%d] = %X (%X)\n",
+                j, (rt_full)ico1[j], k, ico2[k], ico2[k + w]);
+#endif /* RT_PRINT_CPP */
+#ifdef RT_PRINT_ASM
+        RT_LOGI("S fp32-to-fp64[%d] = %016" PR_Z "X, "
+                  "fp64-to-fp32[%d] = %X (%X)\n",
+                j, (rt_full)iso1[j], k, iso2[k], iso2[k + w]);
+#endif /* RT_PRINT_ASM */
+    }
+}
+
+#endif /* SUB_TEST 68 */
+
+/******************************************************************************/
+/*******************************   SUB TEST 69   ******************************/
+/******************************************************************************/
+
+#if SUB_TEST >= 69
+
+rt_void c_test69(rt_SIMD_INFOX *info)
+{
+    rt_si32 j, n = (info->size * sizeof(rt_elem)) / 3; /* bytes per SIMD reg */
+    rt_si64 v, x;
+
+    rt_byte *hbyt = (rt_byte *)(info->har0 + N*RT_OFFS_SIMD);
+    rt_half *har0 = info->har0 + N*RT_OFFS_SIMD;
+    rt_half *hco1 = info->hco1 + N*RT_OFFS_SIMD;
+    rt_half *hco2 = info->hco2 + N*RT_OFFS_SIMD;
+    rt_byte *hcb2 = (rt_byte *)(info->hco2 + N*RT_OFFS_SIMD);
+
+    rt_ui32 *iwrd = (rt_ui32 *)(info->iar0 + S*RT_OFFS_SIMD);
+    rt_ui32 *ico1 = (rt_ui32 *)(info->ico1 + S*RT_OFFS_SIMD);
+    rt_ui32 *ico2 = (rt_ui32 *)(info->ico2 + S*RT_OFFS_SIMD);
+    rt_half *ich2 = (rt_half *)(info->ico2 + S*RT_OFFS_SIMD);
+
+    rt_ui64 *fco1 = (rt_ui64 *)(info->fco1 + S*RT_OFFS_SIMD);
+    rt_ui64 *fco2 = (rt_ui64 *)(info->fco2 + S*RT_OFFS_SIMD);
+    rt_ui32 *fcw2 = (rt_ui32 *)(info->fco2 + S*RT_OFFS_SIMD);
+
+    j = n / 2;
+    while (j-->0)
+    {
+        hco1[j + 0*n/2] = hbyt[j + 0*n];
+        hco1[j + 1*n/2] = hbyt[j + 1*n + n/2];
+        hco1[j + 2*n/2] = (rt_half)((hbyt[j + 2*n] ^ 0x80) - 0x80);
+        hco2[j + 0*n/2] = (rt_half)((hbyt[j + 0*n + n/2] ^ 0x80) - 0x80);
+
+        v = (har0[j + 1*n/2] ^ 0x8000) - 0x8000;
+        hcb2[j + 1*n] = (rt_byte)(v < 0 ? 0 : v > 255 ? 255 : v);
+        hcb2[j + 1*n + n/2] = 0;
+
+        v = (har0[j + 2*n/2] ^ 0x8000) - 0x8000;
+        hcb2[j + 2*n] = (rt_byte)(v < -128 ? -128 : v > 127 ? 127 : v);
+        hcb2[j + 2*n + n/2] = 0;
+    }
+
+    j = n / 4;
+    while (j-->0)
+    {
+        ico1[j + 0*n/4] = har0[j + 0*n/2];
+        ico1[j + 1*n/4] = har0[j + 1*n/2 + n/4];
+        ico1[j + 2*n/4] = (rt_ui32)((har0[j + 2*n/2] ^ 0x8000) - 0x8000);
+        ico2[j + 0*n/4] = (rt_ui32)((har0[j + 0*n/2 + n/4] ^ 0x8000) - 0x8000);
+
+        v = ((har0[j + 1*n/2] ^ 0x8000) - 0x8000) * 256;
+        v = v < 0 ? 0 : v > 65535 ? 65535 : v;
+        ich2[j + 1*n/2] = (rt_half)v;
+        ich2[j + 1*n/2 + n/4] = 0;
+
+        v = ((har0[j + 2*n/2] ^ 0x8000) - 0x8000) * 256;
+        v = v < -32768 ? -32768 : v > 32767 ? 32767 : v;
+        ich2[j + 2*n/2] = (rt_half)v;
+        ich2[j + 2*n/2 + n/4] = 0;
+    }
+
+    x = (rt_si64)1 << 32;
+
+    j = n / 8;
+    while (j-->0)
+    {
+        fco1[j + 0*n/8] = iwrd[j + 0*n/4];
+        fco1[j + 1*n/8] = iwrd[j + 1*n/4 + n/8];
+        v = ((rt_si64)har0[j + 2*n/2] ^ 0x8000) - 0x8000;
+        fco1[j + 2*n/8] = (rt_ui64)v;
+        v = ((rt_si64)har0[j + 0*n/2 + n/8] ^ 0x8000) - 0x8000;
+        fco2[j + 0*n/8] = (rt_ui64)v;
+
+        v = (((rt_si64)har0[j + 1*n/2] ^ 0x8000) - 0x8000) * (1 << 20);
+        v = v < 0 ? 0 : v > x - 1 ? x - 1 : v;
+        fcw2[j + 1*n/4] = (rt_ui32)v;
+        fcw2[j + 1*n/4 + n/8] = 0;
+
+        v = (((rt_si64)har0[j + 2*n/2] ^ 0x8000) - 0x8000) * (1 << 20);
+        v = v < -x/2 ? -x/2 : v > x/2 - 1 ? x/2 - 1 : v;
+        fcw2[j + 2*n/4] = (rt_ui32)v;
+        fcw2[j + 2*n/4 + n/8] = 0;
+    }
+}
+
+/*
+ * Integer pack/unpack widens the lower (or upper) half of 8/16/32-bit elements
+ * with zero/sign-extension into 16/32/64-bit elements, and narrows signed
+ * 16/32/64-bit elements with unsigned/signed saturation into the lower half
+ * (upper half is 0), narrowing inputs are sign-extended harr values shifted
+ * left to cover in-range and saturated results, farr outputs hold integers.
+ */
+rt_void s_test69(rt_SIMD_INFOX *info)
+{
+    rt_si32 j, n = (info->size * sizeof(rt_elem)) / 3; /* bytes per SIMD reg */
+
+    rt_half *har0 = info->har0 + N*RT_OFFS_SIMD;
+    rt_ui64 *fso2 = (rt_ui64 *)(info->fso2 + S*RT_OFFS_SIMD);
+
+    /* 64-bit SIMD shifts are not available on all targets,
+     * prepare shifted quad inputs for narrowing in place */
+    j = n / 8;
+    while (j-->0)
+    {
+        fso2[j + 1*n/8] = (rt_ui64)(((har0[j + 1*n/2] ^ 0x8000) - 0x8000)
+                                                        * ((rt_si64)1 << 20));
+        fso2[j + 2*n/8] = (rt_ui64)(((har0[j + 2*n/2] ^ 0x8000) - 0x8000)
+                                                        * ((rt_si64)1 << 20));
+    }
+
+    ASM_ENTER(info)
+
+        movxx_ld(Recx, Mebp, inf_HAR0)
+        movxx_ld(Rebx, Mebp, inf_IAR0)
+        movxx_ld(Redx, Mebp, inf_HSO1)
+
+        movmx_ld(Xmm0, Mecx, AJ0)
+        cvymb_rr(Xmm1, Xmm0)
+        movmx_st(Xmm1, Medx, AJ0)
+
+        movmx_ld(Xmm0, Mecx, AJ1)
+        cvumb_rr(Xmm1, Xmm0)
+        movmx_st(Xmm1, Medx, AJ1)
+
+        movmx_ld(Xmm2, Mecx, AJ2)
+        cvymc_rr(Xmm2, Xmm2)
+        movmx_st(Xmm2, Medx, AJ2)
+
+        movxx_ld(Redx, Mebp, inf_HSO2)
+
+        movmx_ld(Xmm0, Mecx, AJ0)
+        cvumc_rr(Xmm1, Xmm0)
+        movmx_st(Xmm1, Medx, AJ0)
+
+        movmx_ld(Xmm0, Mecx, AJ1)
+        cvxmx_rr(Xmm1, Xmm0)
+        movmx_st(Xmm1, Medx, AJ1)
+
+        movmx_ld(Xmm2, Mecx, AJ2)
+        cvxmn_rr(Xmm2, Xmm2)
+        movmx_st(Xmm2, Medx, AJ2)
+
+        movxx_ld(Redx, Mebp, inf_ISO1)
+
+        movmx_ld(Xmm0, Mecx, AJ0)
+        cvymx_rr(Xmm1, Xmm0)
+        movox_st(Xmm1, Medx, AJ0)
+
+        movmx_ld(Xmm0, Mecx, AJ1)
+        cvumx_rr(Xmm1, Xmm0)
+        movox_st(Xmm1, Medx, AJ1)
+
+        movmx_ld(Xmm2, Mecx, AJ2)
+        cvymn_rr(Xmm2, Xmm2)
+        movox_st(Xmm2, Medx, AJ2)
+
+        movxx_ld(Redx, Mebp, inf_ISO2)
+
+        movmx_ld(Xmm0, Mecx, AJ0)
+        cvumn_rr(Xmm1, Xmm0)
+        movox_st(Xmm1, Medx, AJ0)
+
+        movmx_ld(Xmm0, Mecx, AJ1)
+        cvymn_rr(Xmm1, Xmm0)
+        shlox_ri(Xmm1, IB(8))
+        cvxox_rr(Xmm0, Xmm1)
+        movmx_st(Xmm0, Medx, AJ1)
+
+        movmx_ld(Xmm2, Mecx, AJ2)
+        cvymn_rr(Xmm2, Xmm2)
+        shlox_ri(Xmm2, IB(8))
+        cvxon_rr(Xmm2, Xmm2)
+        movmx_st(Xmm2, Medx, AJ2)
+
+        movxx_ld(Redx, Mebp, inf_FSO1)
+
+        movox_ld(Xmm0, Mebx, AJ0)
+        cvyox_rr(Xmm1, Xmm0)
+        movqx_st(Xmm1, Medx, AJ0)
+
+        movox_ld(Xmm0, Mebx, AJ1)
+        cvuox_rr(Xmm1, Xmm0)
+        movqx_st(Xmm1, Medx, AJ1)
+
+        movmx_ld(Xmm2, Mecx, AJ2)
+        cvymn_rr(Xmm2, Xmm2)
+        cvyon_rr(Xmm2, Xmm2)
+        movqx_st(Xmm2, Medx, AJ2)
+
+        movxx_ld(Redx, Mebp, inf_FSO2)
+
+        movmx_ld(Xmm0, Mecx, AJ0)
+        cvymn_rr(Xmm1, Xmm0)
+        cvuon_rr(Xmm0, Xmm1)
+        movqx_st(Xmm0, Medx, AJ0)
+
+        movqx_ld(Xmm0, Medx, AJ1)
+        cvxqx_rr(Xmm1, Xmm0)
+        movox_st(Xmm1, Medx, AJ1)
+
+        movqx_ld(Xmm2, Medx, AJ2)
+        cvxqn_rr(Xmm2, Xmm2)
+        movox_st(Xmm2, Medx, AJ2)
+
+    ASM_LEAVE(info)
+}
+
+rt_void p_test69(rt_SIMD_INFOX *info)
+{
+    rt_si32 j, n = (info->size * sizeof(rt_elem)) / 3; /* bytes per SIMD reg */
+
+    rt_half *har0 = info->har0 + N*RT_OFFS_SIMD;
+    rt_half *hco1 = info->hco1 + N*RT_OFFS_SIMD;
+    rt_half *hco2 = info->hco2 + N*RT_OFFS_SIMD;
+    rt_half *hso1 = info->hso1 + N*RT_OFFS_SIMD;
+    rt_half *hso2 = info->hso2 + N*RT_OFFS_SIMD;
+
+    rt_ui32 *ico1 = (rt_ui32 *)(info->ico1 + S*RT_OFFS_SIMD);
+    rt_ui32 *ico2 = (rt_ui32 *)(info->ico2 + S*RT_OFFS_SIMD);
+    rt_ui32 *iso1 = (rt_ui32 *)(info->iso1 + S*RT_OFFS_SIMD);
+    rt_ui32 *iso2 = (rt_ui32 *)(info->iso2 + S*RT_OFFS_SIMD);
+
+    rt_ui64 *fco1 = (rt_ui64 *)(info->fco1 + S*RT_OFFS_SIMD);
+    rt_ui64 *fco2 = (rt_ui64 *)(info->fco2 + S*RT_OFFS_SIMD);
+    rt_ui64 *fso1 = (rt_ui64 *)(info->fso1 + S*RT_OFFS_SIMD);
+    rt_ui64 *fso2 = (rt_ui64 *)(info->fso2 + S*RT_OFFS_SIMD);
+
+    j = 3 * n / 2;
+    while (j-->0)
+    {
+        if (IEQ(hco1[j], hso1[j]) && IEQ(hco2[j], hso2[j]) && !v_mode)
+        {
+            continue;
+        }
+
+        RT_LOGI("harr[%d] = %X\n",
+                j, (rt_si32)har0[j]);
+#ifdef RT_PRINT_CPP
+        RT_LOGI("C byte-to-half[%d] = %X, half-to-byte[%d] = %X\n",
+                j, (rt_si32)hco1[j], j, (rt_si32)hco2[j]);
+#endif /* RT_PRINT_CPP */
+#ifdef RT_PRINT_ASM
+        RT_LOGI("S byte-to-half[%d] = %X, half-to-byte[%d] = %X\n",
+                j, (rt_si32)hso1[j], j, (rt_si32)hso2[j]);
+#endif /* RT_PRINT_ASM */
+    }
+
+    j = 3 * n / 4;
+    while (j-->0)
+    {
+        if (IEQ(ico1[j], iso1[j]) && IEQ(ico2[j], iso2[j]) && !v_mode)
+        {
+            continue;
+        }
+
+        RT_LOGI("harr-word[%d] = %X\n",
+                j, ((rt_ui32 *)har0)[j]);
+#ifdef RT_PRINT_CPP
+        RT_LOGI("C half-to-word[%d] = %X, word-to-half[%d] = %X\n",
+                j, ico1[j], j, ico2[j]);
+#endif /* RT_PRINT_CPP */
+#ifdef RT_PRINT_ASM
+        RT_LOGI("S half-to-word[%d] = %X, word-to-half[%d] = %X\n",
+                j, iso1[j], j, iso2[j]);
+#endif /* RT_PRINT_ASM */
+    }
+
+    j = 3 * n / 8;
+    while (j-->0)
+    {
+        if (IEQ(fco1[j], fso1[j]) && IEQ(fco2[j], fso2[j]) && !v_mode)
+        {
+            continue;
+        }
+
+        RT_LOGI("harr-quad[%d] = %016" PR_Z "X\n",
+                j, (rt_full)((rt_ui64 *)har0)[j]);
+#ifdef RT_PRINT_CPP
+        RT_LOGI("C word-to-quad[%d] = %016" PR_Z "X, "
+                  "quad-to-word[%d] = %016" PR_Z "X\n",
+                j, (rt_full)fco1[j], j, (rt_full)fco2[j]);
+#endif /* RT_PRINT_CPP */
+#ifdef RT_PRINT_ASM
+        RT_LOGI("S word-to-quad[%d] = %016" PR_Z "X, "
+                  "quad-to-word[%d] = %016" PR_Z "X\n",
+                j, (rt_full)fso1[j], j, (rt_full)fso2[j]);
+#endif /* RT_PRINT_ASM */
+    }
+}
+
+#endif /* SUB_TEST 69 */
+
+/******************************************************************************/
+/*******************************   SUB TEST 70   ******************************/
+/******************************************************************************/
+
+#if SUB_TEST >= 70
+
+/*
+ * Reference upper half of the full 128-bit product of 64-bit elements,
+ * combined from 32-bit partial products, signed if (s != 0).
+ */
+rt_ui64 mulh_test70(rt_ui64 a, rt_ui64 b, rt_si32 s)
+{
+    rt_ui64 u, v, x, h;
+
+    u = (a & 0xFFFFFFFF) * (b & 0xFFFFFFFF);
+    v = (a >> 32) * (b & 0xFFFFFFFF) + (u >> 32);
+    x = (a & 0xFFFFFFFF) * (b >> 32) + (v & 0xFFFFFFFF);
+    h = (a >> 32) * (b >> 32) + (v >> 32) + (x >> 32);
+
+    if (s != 0)
+    {
+        h -= (rt_si64)a < 0 ? b : 0;
+        h -= (rt_si64)b < 0 ? a : 0;
+    }
+
+    return h;
+}
+
+rt_void c_test70(rt_SIMD_INFOX *info)
+{
+    rt_si32 j, n = (info->size * sizeof(rt_elem)) / 3; /* bytes per SIMD reg */
+    rt_si64 a, b;
+    rt_ui64 u, v;
+
+    rt_half *har0 = info->har0 + N*RT_OFFS_SIMD;
+    rt_half *hco1 = info->hco1 + N*RT_OFFS_SIMD;
+    rt_half *hco2 = info->hco2 + N*RT_OFFS_SIMD;
+
+    rt_ui32 *hwrd = (rt_ui32 *)(info->har0 + N*RT_OFFS_SIMD);
+    rt_ui32 *iwrd = (rt_ui32 *)(info->iar0 + S*RT_OFFS_SIMD);
+    rt_ui32 *ico1 = (rt_ui32 *)(info->ico1 + S*RT_OFFS_SIMD);
+    rt_ui32 *ico2 = (rt_ui32 *)(info->ico2 + S*RT_OFFS_SIMD);
+
+    rt_ui64 *hqud = (rt_ui64 *)(info->har0 + N*RT_OFFS_SIMD);
+    rt_ui64 *iqud = (rt_ui64 *)(info->iar0 + S*RT_OFFS_SIMD);
+    rt_ui64 *fco1 = (rt_ui64 *)(info->fco1 + S*RT_OFFS_SIMD);
+    rt_ui64 *fco2 = (rt_ui64 *)(info->fco2 + S*RT_OFFS_SIMD);
+
+    j = n / 2;
+    while (j-->0)
+    {
+        a = har0[j + 0*n/2];
+        b = har0[j + 1*n/2];
+        hco1[j + 0*n/2] = (rt_half)((a * b) >> 16);
+
+        a = (har0[j + 1*n/2] ^ 0x8000) - 0x8000;
+        b = (har0[j + 2*n/2] ^ 0x8000) - 0x8000;
+        hco1[j + 1*n/2] = (rt_half)((rt_ui64)(a * b) >> 16);
+
+        a = har0[j + 2*n/2];
+        b = har0[j + 0*n/2];
+        hco1[j + 2*n/2] = (rt_half)((a * b) >> 16);
+
+        a = (har0[j + 0*n/2] ^ 0x8000) - 0x8000;
+        b = (har0[j + 2*n/2] ^ 0x8000) - 0x8000;
+        hco2[j + 0*n/2] = (rt_half)((rt_ui64)(a * b) >> 16);
+
+        a = (har0[j + 1*n/2] ^ 0x8000) - 0x8000;
+        hco2[j + 1*n/2] = (rt_half)((rt_ui64)(a * a) >> 16);
+
+        a = har0[j + 2*n/2];
+        hco2[j + 2*n/2] = (rt_half)((a * a) >> 16);
+    }
+
+    j = n / 4;
+    while (j-->0)
+    {
+        u = hwrd[j + 0*n/4];
+        v = hwrd[j + 1*n/4];
+        ico1[j + 0*n/4] = (rt_ui32)((u * v) >> 32);
+
+        a = (rt_si64)(hwrd[j + 1*n/4] ^ 0x80000000) - 0x80000000;
+        b = (rt_si64)(~hwrd[j + 2*n/4] ^ 0x80000000) - 0x80000000;
+        ico1[j + 1*n/4] = (rt_ui32)((rt_ui64)(a * b) >> 32);
+
+        u = hwrd[j + 2*n/4];
+        v = iwrd[j + 0*n/4];
+        ico1[j + 2*n/4] = (rt_ui32)((u * v) >> 32);
+
+        a = (rt_si64)(~hwrd[j + 0*n/4] ^ 0x80000000) - 0x80000000;
+        b = (rt_si64)(hwrd[j + 2*n/4] ^ 0x80000000) - 0x80000000;
+        ico2[j + 0*n/4] = (rt_ui32)((rt_ui64)(a * b) >> 32);
+
+        a = (rt_si64)(hwrd[j + 1*n/4] ^ 0x80000000) - 0x80000000;
+        ico2[j + 1*n/4] = (rt_ui32)((rt_ui64)(a * a) >> 32);
+
+        u = (rt_ui32)~hwrd[j + 2*n/4];
+        ico2[j + 2*n/4] = (rt_ui32)((u * u) >> 32);
+    }
+
+    j = n / 8;
+    while (j-->0)
+    {
+        fco1[j + 0*n/8] = mulh_test70(hqud[j + 0*n/8], hqud[j + 1*n/8], 0);
+        fco1[j + 1*n/8] = mulh_test70(hqud[j + 1*n/8], ~hqud[j + 2*n/8], 1);
+        fco1[j + 2*n/8] = mulh_test70(hqud[j + 2*n/8], iqud[j + 0*n/8], 1);
+
+        u = ~hqud[j + 0*n/8] & 0xFFFFFFFF;
+        v = hqud[j + 2*n/8] & 0xFFFFFFFF;
+        fco2[j + 0*n/8] = u * v;
+
+        a = (rt_si64)((rt_ui32)hqud[j + 1*n/8] ^ 0x80000000) - 0x80000000;
+        b = (rt_si64)((rt_ui32)~hqud[j + 0*n/8] ^ 0x80000000) - 0x80000000;
+        fco2[j + 1*n/8] = (rt_ui64)(a * b);
+
+        a = (rt_si64)((rt_ui32)~hqud[j + 2*n/8] ^ 0x80000000) - 0x80000000;
+        b = (rt_si64)((rt_ui32)iqud[j + 1*n/8] ^ 0x80000000) - 0x80000000;
+        fco2[j + 2*n/8] = (rt_ui64)(a * b);
+    }
+}
+
+/*
+ * Integer mul-high keeps the upper half of the full-width product of 16/32/64
+ * bit elements (unsigned/signed), lower half being produced by regular mul,
+ * widening mul multiplies lower 32-bit halves of 64-bit elements into full
+ * 64-bit products, harr values are reinterpreted as words/quads and inverted
+ * to cover negative operands, self-multiply checks register aliasing.
+ */
+rt_void s_test70(rt_SIMD_INFOX *info)
+{
+    ASM_ENTER(info)
+
+        movxx_ld(Recx, Mebp, inf_HAR0)
+        movxx_ld(Rebx, Mebp, inf_IAR0)
+        movxx_ld(Redx, Mebp, inf_HSO1)
+
+        movmx_ld(Xmm0, Mecx, AJ0)
+        movmx_ld(Xmm1, Mecx, AJ1)
+        muhmx_rr(Xmm0, Xmm1)
+        movmx_st(Xmm0, Medx, AJ0)
+
+        movmx_ld(Xmm1, Mecx, AJ1)
+        movmx_ld(Xmm2, Mecx, AJ2)
+        muhmn_rr(Xmm1, Xmm2)
+        movmx_st(Xmm1, Medx, AJ1)
+
+        movmx_ld(Xmm2, Mecx, AJ2)
+        muhmx_ld(Xmm2, Mecx, AJ0)
+        movmx_st(Xmm2, Medx, AJ2)
+
+        movxx_ld(Redx, Mebp, inf_HSO2)
+
+        movmx_ld(Xmm0, Mecx, AJ0)
+        muhmn_ld(Xmm0, Mecx, AJ2)
+        movmx_st(Xmm0, Medx, AJ0)
+
+        movmx_ld(Xmm1, Mecx, AJ1)
+        muhmn_rr(Xmm1, Xmm1)
+        movmx_st(Xmm1, Medx, AJ1)
+
+        movmx_ld(Xmm2, Mecx, AJ2)
+        muhmx_rr(Xmm2, Xmm2)
+        movmx_st(Xmm2, Medx, AJ2)
+
+        movxx_ld(Redx, Mebp, inf_ISO1)
+
+        movox_ld(Xmm0, Mecx, AJ0)
+        movox_ld(Xmm1, Mecx, AJ1)
+        muhox_rr(Xmm0, Xmm1)
+        movox_st(Xmm0, Medx, AJ0)
+
+        movox_ld(Xmm1, Mecx, AJ1)
+        movox_ld(Xmm2, Mecx, AJ2)
+        notox_rx(Xmm2)
+        muhon_rr(Xmm1, Xmm2)
+        movox_st(Xmm1, Medx, AJ1)
+
+        movox_ld(Xmm2, Mecx, AJ2)
+        muhox_ld(Xmm2, Mebx, AJ0)
+        movox_st(Xmm2, Medx, AJ2)
+
+        movxx_ld(Redx, Mebp, inf_ISO2)
+
+        movox_ld(Xmm0, Mecx, AJ0)
+        notox_rx(Xmm0)
+        muhon_ld(Xmm0, Mecx, AJ2)
+        movox_st(Xmm0, Medx, AJ0)
+
+        movox_ld(Xmm1, Mecx, AJ1)
+        muhon_rr(Xmm1, Xmm1)
+        movox_st(Xmm1, Medx, AJ1)
+
+        movox_ld(Xmm2, Mecx, AJ2)
+        notox_rx(Xmm2)
+        muhox_rr(Xmm2, Xmm2)
+        movox_st(Xmm2, Medx, AJ2)
+
+        movxx_ld(Redx, Mebp, inf_FSO1)
+
+        movqx_ld(Xmm0, Mecx, AJ0)
+        movqx_ld(Xmm1, Mecx, AJ1)
+        muhqx_rr(Xmm0, Xmm1)
+        movqx_st(Xmm0, Medx, AJ0)
+
+        movqx_ld(Xmm1, Mecx, AJ1)
+        movqx_ld(Xmm2, Mecx, AJ2)
+        notqx_rx(Xmm2)
+        muhqn_rr(Xmm1, Xmm2)
+        movqx_st(Xmm1, Medx, AJ1)
+
+        movqx_ld(Xmm2, Mecx, AJ2)
+        muhqn_ld(Xmm2, Mebx, AJ0)
+        movqx_st(Xmm2, Medx, AJ2)
+
+        movxx_ld(Redx, Mebp, inf_FSO2)
+
+        movqx_ld(Xmm0, Mecx, AJ0)
+        notqx_rx(Xmm0)
+        movqx_ld(Xmm2, Mecx, AJ2)
+        muwqx_rr(Xmm0, Xmm2)
+        movqx_st(Xmm0, Medx, AJ0)
+
+        movqx_ld(Xmm1, Mecx, AJ1)
+        movqx_ld(Xmm0, Mecx, AJ0)
+        notqx_rx(Xmm0)
+        muwqn_rr(Xmm1, Xmm0)
+        movqx_st(Xmm1, Medx, AJ1)
+
+        movqx_ld(Xmm2, Mecx, AJ2)
+        notqx_rx(Xmm2)
+        muwqn_ld(Xmm2, Mebx, AJ1)
+        movqx_st(Xmm2, Medx, AJ2)
+
+    ASM_LEAVE(info)
+}
+
+rt_void p_test70(rt_SIMD_INFOX *info)
+{
+    rt_si32 j, n = (info->size * sizeof(rt_elem)) / 3; /* bytes per SIMD reg */
+
+    rt_half *har0 = info->har0 + N*RT_OFFS_SIMD;
+    rt_half *hco1 = info->hco1 + N*RT_OFFS_SIMD;
+    rt_half *hco2 = info->hco2 + N*RT_OFFS_SIMD;
+    rt_half *hso1 = info->hso1 + N*RT_OFFS_SIMD;
+    rt_half *hso2 = info->hso2 + N*RT_OFFS_SIMD;
+
+    rt_ui32 *ico1 = (rt_ui32 *)(info->ico1 + S*RT_OFFS_SIMD);
+    rt_ui32 *ico2 = (rt_ui32 *)(info->ico2 + S*RT_OFFS_SIMD);
+    rt_ui32 *iso1 = (rt_ui32 *)(info->iso1 + S*RT_OFFS_SIMD);
+    rt_ui32 *iso2 = (rt_ui32 *)(info->iso2 + S*RT_OFFS_SIMD);
+
+    rt_ui64 *fco1 = (rt_ui64 *)(info->fco1 + S*RT_OFFS_SIMD);
+    rt_ui64 *fco2 = (rt_ui64 *)(info->fco2 + S*RT_OFFS_SIMD);
+    rt_ui64 *fso1 = (rt_ui64 *)(info->fso1 + S*RT_OFFS_SIMD);
+    rt_ui64 *fso2 = (rt_ui64 *)(info->fso2 + S*RT_OFFS_SIMD);
+
+    j = 3 * n / 2;
+    while (j-->0)
+    {
+        if (IEQ(hco1[j], hso1[j]) && IEQ(hco2[j], hso2[j]) && !v_mode)
+        {
+            continue;
+        }
+
+        RT_LOGI("harr[%d] = %X\n",
+                j, (rt_si32)har0[j]);
+#ifdef RT_PRINT_CPP
+        RT_LOGI("C half-mulh-1[%d] = %X, half-mulh-2[%d] = %X\n",
+                j, (rt_si32)hco1[j], j, (rt_si32)hco2[j]);
+#endif /* RT_PRINT_CPP */
+#ifdef RT_PRINT_ASM
+        RT_LOGI("S half-mulh-1[%d] = %X, half-mulh-2[%d] = %X\n",
+                j, (rt_si32)hso1[j], j, (rt_si32)hso2[j]);
+#endif /* RT_PRINT_ASM */
+    }
+
+    j = 3 * n / 4;
+    while (j-->0)
+    {
+        if (IEQ(ico1[j], iso1[j]) && IEQ(ico2[j], iso2[j]) && !v_mode)
+        {
+            continue;
+        }
+
+        RT_LOGI("harr-word[%d] = %X\n",
+                j, ((rt_ui32 *)har0)[j]);
+#ifdef RT_PRINT_CPP
+        RT_LOGI("C word-mulh-1[%d] = %X, word-mulh-2[%d] = %X\n",
+                j, ico1[j], j, ico2[j]);
+#endif /* RT_PRINT_CPP */
+#ifdef RT_PRINT_ASM
+        RT_LOGI("S word-mulh-1[%d] = %X, word-mulh-2[%d] = %X\n",
+                j, iso1[j], j, iso2[j]);
+#endif /* RT_PRINT_ASM */
+    }
+
+    j = 3 * n / 8;
+    while (j-->0)
+    {
+        if (IEQ(fco1[j], fso1[j]) && IEQ(fco2[j], fso2[j]) && !v_mode)
+        {
+            continue;
+        }
+
+        RT_LOGI("harr-quad[%d] = %016" PR_Z "X\n",
+                j, (rt_full)((rt_ui64 *)har0)[j]);
+#ifdef RT_PRINT_CPP
+        RT_LOGI("C quad-mulh[%d] = %016" PR_Z "X, "
+                  "word-mulw[%d] = %016" PR_Z "X\n",
+                j, (rt_full)fco1[j], j, (rt_full)fco2[j]);
+#endif /* RT_PRINT_CPP */
+#ifdef RT_PRINT_ASM
+        RT_LOGI("S quad-mulh[%d] = %016" PR_Z "X, "
+                  "word-mulw[%d] = %016" PR_Z "X\n",
+                j, (rt_full)fso1[j], j, (rt_full)fso2[j]);
+#endif /* RT_PRINT_ASM */
+    }
+}
+
+#endif /* SUB_TEST 70 */
+
+/******************************************************************************/
+/*********************************   TABLES   *********************************/
+/******************************************************************************/
+
+typedef rt_void (*testXX)(rt_SIMD_INFOX *);
+
+volatile
+testXX c_test[SUB_TEST] =
+{
+#if SUB_TEST >=  1
+    c_test01,
+#endif /* SUB_TEST  1 */
+
+#if SUB_TEST >=  2
+    c_test02,
+#endif /* SUB_TEST  2 */
+
+#if SUB_TEST >=  3
+    c_test03,
+#endif /* SUB_TEST  3 */
+
+#if SUB_TEST >=  4
+    c_test04,
+#endif /* SUB_TEST  4 */
+
+#if SUB_TEST >=  5
+    c_test05,
+#endif /* SUB_TEST  5 */
+
+#if SUB_TEST >=  6
+    c_test06,
+#endif /* SUB_TEST  6 */
+
+#if SUB_TEST >=  7
+    c_test07,
+#endif /* SUB_TEST  7 */
+
+#if SUB_TEST >=  8
+    c_test08,
+#endif /* SUB_TEST  8 */
+
+#if SUB_TEST >=  9
+    c_test09,
+#endif /* SUB_TEST  9 */
+
+#if SUB_TEST >= 10
+    c_test10,
+#endif /* SUB_TEST 10 */
+
+#if SUB_TEST >= 11
+    c_test11,
+#endif /* SUB_TEST 11 */
+
+#if SUB_TEST >= 12
+    c_test12,
+#endif /* SUB_TEST 12 */
+
+#if SUB_TEST >= 13
+    c_test13,
+#endif /* SUB_TEST 13 */
+
+#if SUB_TEST >= 14
+    c_test14,
+#endif /* SUB_TEST 14 */
+
+#if SUB_TEST >= 15
+    c_test15,
+#endif /* SUB_TEST 15 */
+
+#if SUB_TEST >= 16
+    c_test16,
+#endif /* SUB_TEST 16 */
+
+#if SUB_TEST >= 17
+    c_test17,
+#endif /* SUB_TEST 17 */
+
+#if SUB_TEST >= 18
+    c_test18,
+#endif /* SUB_TEST 18 */
+
+#if SUB_TEST >= 19
+    c_test19,
+#endif /* SUB_TEST 19 */
+
+#if SUB_TEST >= 20
+    c_test20,
+#endif /* SUB_TEST 20 */
+
+#if SUB_TEST >= 21
+    c_test21,
+#endif /* SUB_TEST 21 */
+
+#if SUB_TEST >= 22
+    c_test22,
+#endif /* SUB_TEST 22 */
+
+#if SUB_TEST >= 23
+    c_test23,
+#endif /* SUB_TEST 23 */
+
+#if SUB_TEST >= 24
+    c_test24,
+#endif /* SUB_TEST 24 */
+
+#if SUB_TEST >= 25
+    c_test25,
+#endif /* SUB_TEST 25 */
+
+#if SUB_TEST >= 26
+    c_test26,
+#endif /* SUB_TEST 26 */
+
+#if SUB_TEST >= 27
+    c_test27,
+#endif /* SUB_TEST 27 */
+
+#if SUB_TEST >= 28
+    c_test28,
+#endif /* SUB_TEST 28 */
+
+#if SUB_TEST >= 29
+    c_test29,
+#endif /* SUB_TEST 29 */
+
+#if SUB_TEST >= 30
+    c_test30,
+#endif /* SUB_TEST 30 */
+
+#if SUB_TEST >= 31
+    c_test31,
+#endif /* SUB_TEST 31 */
+
+#if SUB_TEST >= 32
+    c_test32,
+#endif /* SUB_TEST 32 */
+
+#if SUB_TEST >= 33
+    c_test33,
+#endif /* SUB_TEST 33 */
+
+#if SUB_TEST >= 34
+    c_test34,
+#endif /* SUB_TEST 34 */
+
+#if SUB_TEST >= 35
+    c_test35,
+#endif /* SUB_TEST 35 */
+
+#if SUB_TEST >= 36
+    c_test36,
+#endif /* SUB_TEST 36 */
+
+#if SUB_TEST >= 37
+    c_test37,
+#endif /* SUB_TEST 37 */
+
+#if SUB_TEST >= 38
+    c_test38,
+#endif /* SUB_TEST 38 */
 
 #if SUB_TEST >= 39
     c_test39,
@@ -7873,6 +11108,81 @@ testXX c_test[SUB_TEST] =
 #if SUB_TEST >= 51
     c_test51,
 #endif /* SUB_TEST 51 */
+
+#if SUB_TEST >= 52
+    c_test52,
+#endif /* SUB_TEST 52 */
+
+#if SUB_TEST >= 53
+    c_test53,
+#endif /* SUB_TEST 53 */
+
+#if SUB_TEST >= 54
+    c_test54,
+#endif /* SUB_TEST 54 */
+
+#if SUB_TEST >= 55
+    c_test55,
+#endif /* SUB_TEST 55 */
+
+#if SUB_TEST >= 56
+    c_test56,
+#endif /* SUB_TEST 56 */
+
+#if SUB_TEST >= 57
+    c_test57,
+#endif /* SUB_TEST 57 */
+
+#if SUB_TEST >= 58
+    c_test58,
+#endif /* SUB_TEST 58 */
+
+#if SUB_TEST >= 59
+    c_test59,
+#endif /* SUB_TEST 59 */
+
+#if SUB_TEST >= 60
+    c_test60,
+#endif /* SUB_TEST 60 */
+
+#if SUB_TEST >= 61
+    c_test61,
+#endif /* SUB_TEST 61 */
+
+#if SUB_TEST >= 62
+    c_test62,
+#endif /* SUB_TEST 62 */
+
+#if SUB_TEST >= 63
+    c_test63,
+#endif /* SUB_TEST 63 */
+
+#if SUB_TEST >= 64
+    c_test64,
+#endif /* SUB_TEST 64 */
+
+#if SUB_TEST >= 65
+    c_test65,
+#endif /* SUB_TEST 65 */
+
+#if SUB_TEST >= 66
+    c_test66,
+#endif /* SUB_TEST 66 */
+
+#if SUB_TEST >= 67
+    c_test67,
+#endif /* SUB_TEST 67 */
+
+#if SUB_TEST >= 68
+    c_test68,
+#endif /* SUB_TEST 68 */
+
+#if SUB_TEST >= 69
+    c_test69,
+#endif /* SUB_TEST 69 */
+#if SUB_TEST >= 70
+    c_test70,
+#endif /* SUB_TEST 70 */
 };
 
 volatile
@@ -8081,6 +11391,81 @@ testXX s_test[SUB_TEST] =
 #if SUB_TEST >= 51
     s_test51,
 #endif /* SUB_TEST 51 */
+
+#if SUB_TEST >= 52
+    s_test52,
+#endif /* SUB_TEST 52 */
+
+#if SUB_TEST >= 53
+    s_test53,
+#endif /* SUB_TEST 53 */
+
+#if SUB_TEST >= 54
+    s_test54,
+#endif /* SUB_TEST 54 */
+
+#if SUB_TEST >= 55
+    s_test55,
+#endif /* SUB_TEST 55 */
+
+#if SUB_TEST >= 56
+    s_test56,
+#endif /* SUB_TEST 56 */
+
+#if SUB_TEST >= 57
+    s_test57,
+#endif /* SUB_TEST 57 */
+
+#if SUB_TEST >= 58
+    s_test58,
+#endif /* SUB_TEST 58 */
+
+#if SUB_TEST >= 59
+    s_test59,
+#endif /* SUB_TEST 59 */
+
+#if SUB_TEST >= 60
+    s_test60,
+#endif /* SUB_TEST 60 */
+
+#if SUB_TEST >= 61
+    s_test61,
+#endif /* SUB_TEST 61 */
+
+#if SUB_TEST >= 62
+    s_test62,
+#endif /* SUB_TEST 62 */
+
+#if SUB_TEST >= 63
+    s_test63,
+#endif /* SUB_TEST 63 */
+
+#if SUB_TEST >= 64
+    s_test64,
+#endif /* SUB_TEST 64 */
+
+#if SUB_TEST >= 65
+    s_test65,
+#endif /* SUB_TEST 65 */
+
+#if SUB_TEST >= 66
+    s_test66,
+#endif /* SUB_TEST 66 */
+
+#if SUB_TEST >= 67
+    s_test67,
+#endif /* SUB_TEST 67 */
+
+#if SUB_TEST >= 68
+    s_test68,
+#endif /* SUB_TEST 68 */
+
+#if SUB_TEST >= 69
+    s_test69,
+#endif /* SUB_TEST 69 */
+#if SUB_TEST >= 70
+    s_test70,
+#endif /* SUB_TEST 70 */
 };
 
 volatile
@@ -8289,8 +11674,94 @@ testXX p_test[SUB_TEST] =
 #if SUB_TEST >= 51
     p_test51,
 #endif /* SUB_TEST 51 */
+
+#if SUB_TEST >= 52
+    p_test52,
+#endif /* SUB_TEST 52 */
+
+#if SUB_TEST >= 53
+    p_test53,
+#endif /* SUB_TEST 53 */
+
+#if SUB_TEST >= 54
+    p_test54,
+#endif /* SUB_TEST 54 */
+
+#if SUB_TEST >= 55
+    p_test55,
+#endif /* SUB_TEST 55 */
+
+#if SUB_TEST >= 56
+    p_test56,
+#endif /* SUB_TEST 56 */
+
+#if SUB_TEST >= 57
+    p_test57,
+#endif /* SUB_TEST 57 */
+
+#if SUB_TEST >= 58
+    p_test58,
+#endif /* SUB_TEST 58 */
+
+#if SUB_TEST >= 59
+    p_test59,
+#endif /* SUB_TEST 59 */
+
+#if SUB_TEST >= 60
+    p_test60,
+#endif /* SUB_TEST 60 */
+
+#if SUB_TEST >= 61
+    p_test61,
+#endif /* SUB_TEST 61 */
+
+#if SUB_TEST >= 62
+    p_test62,
+#endif /* SUB_TEST 62 */
+
+#if SUB_TEST >= 63
+    p_test63,
+#endif /* SUB_TEST 63 */
+
+#if SUB_TEST >= 64
+    p_test64,
+#endif /* SUB_TEST 64 */
+
+#if SUB_TEST >= 65
+    p_test65,
+#endif /* SUB_TEST 65 */
+
+#if SUB_TEST >= 66
+    p_test66,
+#endif /* SUB_TEST 66 */
+
+#if SUB_TEST >= 67
+    p_test67,
+#endif /* SUB_TEST 67 */
+
+#if SUB_TEST >= 68
+    p_test68,
+#endif /* SUB_TEST 68 */
+
+#if SUB_TEST >= 69
+    p_test69,
+#endif /* SUB_TEST 69 */
+#if SUB_TEST >= 70
+    p_test70,
+#endif /* SUB_TEST 70 */
 };
 
+#if SUB_TEST >= 53
+
+volatile
+testXX o_test[2] =
+{
+    o_enter,
+    o_enter_r,
+};
+
+#endif /* SUB_TEST 53 */
+
 /******************************************************************************/
 /**********************************   MAIN   **********************************/
 /******************************************************************************/
@@ -8307,17 +11778,118 @@ testXX p_test[SUB_TEST] =
  * with optimization levels higher than O0 (tested both clang and g++).
  * Using separate functions for ASM and C/C++ resolves the issue
  * if the ASM function is not inlined (thus calling it via function pointer).
+ * The probe doesn't touch SIMD registers (BASE-only section), so that
+ * multi-target builds can run it for targets not supported by the processor.
  */
 rt_void simd_version(rt_SIMD_INFOX *s_inf)
 {
-    ASM_ENTER(s_inf)
+    ASM_ENTER_B(s_inf)
         verxx_xx()
-    ASM_LEAVE(s_inf)
+    ASM_LEAVE_B(s_inf)
 }
 
 volatile
 testXX v_simd = simd_version;
 
+#ifdef RT_SIMD_MULT
+
+/*
+ * Return target's mask bits found by its own verxx_xx (0 if not supported),
+ * called from the generic section of multi-target build before main.
+ */
+rt_ui32 mult_mask()
+{
+    rt_pntr info = sys_alloc(sizeof(rt_SIMD_INFOX) + MASK);
+    rt_SIMD_INFOX *inf0 = (rt_SIMD_INFOX *)(((rt_full)info + MASK) & ~MASK);
+
+    memset(inf0, 0, sizeof(rt_SIMD_INFOX));
+
+    v_simd(inf0);
+
+    rt_ui32 mask = inf0->ver & RT_SIMD_MASK;
+
+    sys_free(info, sizeof(rt_SIMD_INFOX) + MASK);
+
+    return mask;
+}
+
+#define TUNE_SIZE           0x400 /* elements in calibration arrays */
+
+/*
+ * Kernel of sub-test 52 repeated inf_CYC times within one ASM section,
+ * so that calibration isn't dominated by the per-call cost of ASM_ENTER.
+ */
+rt_void t_test52(rt_SIMD_INFOX *info)
+{
+    ASM_ENTER(info)
+
+        movwx_ld(Redi, Mebp, inf_CYC)
+
+    LBL(100520) /* loc_cyc */
+
+        movxx_ld(Recx, Mebp, inf_FAR0)
+        movxx_ld(Redx, Mebp, inf_FSO1)
+        movxx_ld(Rebx, Mebp, inf_FSO2)
+        movwx_ld(Resi, Mebp, inf_SIZE)
+
+    LBL(100521) /* loc_beg */
+
+        movpx_ld(Xmm0, Mecx, AJ0)
+        movpx_rr(Xmm1, Xmm0)
+        addps_rr(Xmm1, Xmm0)
+        movpx_st(Xmm0, Medx, AJ0)
+        movpx_st(Xmm1, Mebx, AJ0)
+
+        addxx_ri(Recx, IH(Q*0x10))
+        addxx_ri(Redx, IH(Q*0x10))
+        addxx_ri(Rebx, IH(Q*0x10))
+        subwx_ri(Resi, IB(S))
+        cmjwx_rz(Resi,
+        /* if */ GT_x, 100521b) /* loc_beg */
+
+        subwx_ri(Redi, IB(1))
+        cmjwx_rz(Redi,
+        /* if */ GT_x, 100520b) /* loc_cyc */
+
+    ASM_LEAVE(info)
+}
+
+/*
+ * Run representative kernel (sub-test 52 over short arrays) "cycles" times,
+ * called from the generic section of multi-target build for calibration.
+ */
+rt_void mult_bench(rt_si32 cycles)
+{
+    rt_pntr info = sys_alloc(sizeof(rt_SIMD_INFOX) + MASK);
+    rt_SIMD_INFOX *inf0 = (rt_SIMD_INFOX *)(((rt_full)info + MASK) & ~MASK);
+
+    rt_pntr regs = sys_alloc(sizeof(rt_SIMD_REGS) + MASK);
+    rt_SIMD_REGS *reg0 = (rt_SIMD_REGS *)(((rt_full)regs + MASK) & ~MASK);
+
+    rt_pntr marr = sys_alloc(3*TUNE_SIZE*sizeof(rt_real) + MASK);
+    rt_real *mar0 = (rt_real *)(((rt_full)marr + MASK) & ~MASK);
+
+    memset(mar0, 0, 3*TUNE_SIZE*sizeof(rt_real));
+
+    ASM_INIT(inf0, reg0)
+
+    inf0->far0 = mar0 + TUNE_SIZE*0x0;
+    inf0->fso1 = mar0 + TUNE_SIZE*0x1;
+    inf0->fso2 = mar0 + TUNE_SIZE*0x2;
+    inf0->size = TUNE_SIZE;
+    inf0->cyc  = cycles;
+
+    if (cycles > 0) t_test52(inf0);
+
+    ASM_DONE(inf0)
+
+    sys_free(marr, 3*TUNE_SIZE*sizeof(rt_real) + MASK);
+    sys_free(regs, sizeof(rt_SIMD_REGS) + MASK);
+    sys_free(info, sizeof(rt_SIMD_INFOX) + MASK);
+}
+
+#endif /* RT_SIMD_MULT */
+
 rt_time get_time();
 
 /*
@@ -8360,6 +11932,11 @@ rt_si32 main(rt_si32 argc, rt_char *argv[])
         RT_LOGI(" -d n, override diff-threshold for qualification, n >= 0\n");
         RT_LOGI(" -c n, override counter of redundant test cycles, n >= 1\n");
         RT_LOGI(" -v, enable verbose mode, always print values from tests\n");
+        RT_LOGI(" -o, measure per-call overhead of ASM_ENTER/ASM_ENTER_R\n");
+        RT_LOGI(" -s n, measure prefetch gain on n MiB array, n = 2^k\n");
+#if RT_RUNTIME != 0 && RT_CODE_CACHE != 0
+        RT_LOGI(" -j f, load/store generated code from/to code cache file\n");
+#endif /* RT_RUNTIME, RT_CODE_CACHE */
         RT_LOGI("all options can be used together\n");
         RT_LOGI("--------------------------------------------------------\n");
     }
@@ -8439,15 +12016,45 @@ rt_si32 main(rt_si32 argc, rt_char *argv[])
             v_mode = RT_TRUE;
             RT_LOGI("Verbose mode enabled\n");
         }
+        if (k < argc && strcmp(argv[k], "-o") == 0 && !o_mode)
+        {
+            o_mode = RT_TRUE;
+            RT_LOGI("Overhead test enabled\n");
+        }
+        if (k < argc && strcmp(argv[k], "-s") == 0 && ++k < argc)
+        {
+            for (l = strlen(argv[k]), r = 1, t = 0; l > 0; l--, r *= 10)
+            {
+                t += (argv[k][l-1] - '0') * r;
+            }
+            if (t >= 1 && t <= 1024 && (t & (t - 1)) == 0)
+            {
+                RT_LOGI("Prefetch test enabled: %d MiB\n", t);
+                s_size = t;
+            }
+            else
+            {
+                RT_LOGI("Prefetch test size out of range\n");
+                return 0;
+            }
+        }
+#if RT_RUNTIME != 0 && RT_CODE_CACHE != 0
+        if (k < argc && strcmp(argv[k], "-j") == 0 && ++k < argc)
+        {
+            c_file = argv[k];
+            RT_LOGI("Code cache file: %s, kernels loaded: %d\n",
+                    c_file, code_load(c_file));
+        }
+#endif /* RT_RUNTIME, RT_CODE_CACHE */
     }
 
 #if RT_OFFS_ALLOC
-    rt_pntr marr = sys_alloc(15*ARR_SIZE*sizeof(rt_elem)+Q*RT_OFFS_DATA + MASK);
-    memset(marr, 0, 15*ARR_SIZE*sizeof(rt_elem)+Q*RT_OFFS_DATA + MASK);
+    rt_pntr marr = sys_alloc(16*ARR_SIZE*sizeof(rt_elem)+Q*RT_OFFS_DATA + MASK);
+    memset(marr, 0, 16*ARR_SIZE*sizeof(rt_elem)+Q*RT_OFFS_DATA + MASK);
     rt_pntr mar0 = (rt_pntr)(((rt_uptr)marr + MASK) & ~MASK);
 #else /* RT_OFFS_ALLOC */
-    rt_pntr marr = sys_alloc(15*ARR_SIZE*sizeof(rt_elem) + MASK);
-    memset(marr, 0, 15*ARR_SIZE*sizeof(rt_elem) + MASK);
+    rt_pntr marr = sys_alloc(16*ARR_SIZE*sizeof(rt_elem) + MASK);
+    memset(marr, 0, 16*ARR_SIZE*sizeof(rt_elem) + MASK);
     rt_pntr mar0 = (rt_pntr)(((rt_uptr)marr-Q*RT_OFFS_DATA + MASK) & ~MASK);
 #endif /* RT_OFFS_ALLOC */
 
@@ -8569,6 +12176,13 @@ rt_si32 main(rt_si32 argc, rt_char *argv[])
         memcpy(hbr0 + N*RT_OFFS_SIMD + RT_ARR_SIZE(harr)*k, harr, sizeof(harr));
     }
 
+    rt_elem *idx0 = (rt_elem *)mar0 + ARR_SIZE*0xF;
+
+    for (k = 0; k < ARR_SIZE; k++)
+    {
+        idx0[S*RT_OFFS_SIMD + k] = (k * 7 + 5) % (ARR_SIZE);
+    }
+
     rt_pntr info = sys_alloc(sizeof(rt_SIMD_INFOX) + MASK);
     rt_SIMD_INFOX *inf0 = (rt_SIMD_INFOX *)(((rt_full)info + MASK) & ~MASK);
 
@@ -8595,10 +12209,73 @@ rt_si32 main(rt_si32 argc, rt_char *argv[])
     inf0->hso1 = (rt_half *)hso1;
     inf0->hso2 = (rt_half *)hso2;
 
+    inf0->idx0 = idx0;
+
     inf0->cyc  = r_test;
     inf0->size = ARR_SIZE;
     inf0->tail = (rt_pntr)0xABCDEF01;
 
+#if SUB_TEST >= 54
+    /* command queue for sub-test 54: add, then mul, for each batch of S */
+    rt_pntr cmdq = sys_alloc(sizeof(rt_SIMD_CMDQ) + 7*sizeof(rt_SIMD_CMD)
+                                                                    + MASK);
+    rt_SIMD_CMDQ *cmq0 = (rt_SIMD_CMDQ *)(((rt_full)cmdq + MASK) & ~MASK);
+    rt_SIMD_CMD  *cmd0 = (rt_SIMD_CMD *)(cmq0 + 1);
+
+    for (k = 0; k < 3; k++)
+    {
+        cmd0[2*k+0].kern = 0;
+        cmd0[2*k+0].size = S;
+        cmd0[2*k+0].arg0 = far0 + S*k;
+        cmd0[2*k+0].arg1 = fso1 + S*k;
+        cmd0[2*k+0].arg2 = RT_NULL;
+
+        cmd0[2*k+1].kern = 1;
+        cmd0[2*k+1].size = S;
+        cmd0[2*k+1].arg0 = far0 + S*k;
+        cmd0[2*k+1].arg1 = fso1 + S*k;
+        cmd0[2*k+1].arg2 = fso2 + S*k;
+    }
+
+    cmd0[6].kern = RT_CMDQ_KERN;
+    cmd0[6].size = 0;
+    cmd0[6].arg0 = RT_NULL;
+    cmd0[6].arg1 = RT_NULL;
+    cmd0[6].arg2 = RT_NULL;
+
+    cmq0->list = cmd0;
+    cmq0->size = 7;
+    inf0->cmdq = cmq0;
+#endif /* SUB_TEST 54 */
+
+#if SUB_TEST >= 62
+    /* streaming array for sub-test 62: far0 scaled by 1-4 in every window */
+    rt_pntr sarr = sys_alloc(STR_SIZE + MASK);
+    rt_real *sar0 = (rt_real *)(((rt_uptr)sarr + MASK) & ~MASK);
+
+    for (k = 0; k < (rt_si32)(STR_SIZE/sizeof(rt_real)); k++)
+    {
+        sar0[k] = far0[S*RT_OFFS_SIMD + k % S] * (k / S % 4 + 1);
+    }
+
+    inf0->sar0 = sar0;
+    inf0->sptr = sar0;
+#endif /* SUB_TEST 62 */
+
+#if SUB_TEST >= 63
+    /* streaming output array for sub-test 63: 128-byte aligned for zcl */
+    rt_pntr sarw = sys_alloc(STR_SIZE + ZCL_MASK);
+    rt_real *sar1 = (rt_real *)(((rt_uptr)sarw + ZCL_MASK) & ~ZCL_MASK);
+
+    for (k = 0; k < (rt_si32)(STR_SIZE/sizeof(rt_real)); k++)
+    {
+        sar1[k] = far0[S*RT_OFFS_SIMD + k % S];
+    }
+
+    inf0->sar1 = sar1;
+    inf0->sptw = sar1;
+#endif /* SUB_TEST 63 */
+
     rt_si32 simd = 0;
 
     v_simd(inf0);
@@ -8697,8 +12374,85 @@ rt_si32 main(rt_si32 argc, rt_char *argv[])
 #endif /* RT_PRINT_NUM */
     }
 
+#if SUB_TEST >= 53
+    /* OVH_SIZE calls of empty sections, time in ms is equal to ns per call */
+    for (i = 0; i < 2 && o_mode && n_done >= 0; i++)
+    {
+        time1 = get_time();
+
+        j = OVH_SIZE;
+        while (j-->0) o_test[i](inf0);
+
+        time2 = get_time();
+        tS = time2 - time1;
+
+        RT_LOGI("Call overhead %s = %d ns (%4dx%dv%d)\n",
+                i == 0 ? "ASM_ENTER  " : "ASM_ENTER_R", (rt_si32)tS,
+                (simd & 0xFF) * 128, (simd >> 16) & 0xFF, (simd >> 8) & 0xFF);
+    }
+#endif /* SUB_TEST 53 */
+
+#if SUB_TEST >= 62
+    /* STR_PASS passes over s_size MiB array without and with prefetch */
+    rt_size ssiz = (rt_size)s_size << 20;
+    rt_pntr sarb = RT_NULL;
+
+    if (s_size != 0 && n_done >= 0)
+    {
+        sarb = sys_alloc(ssiz + MASK);
+        sar0 = (rt_real *)(((rt_uptr)sarb + MASK) & ~MASK);
+        memset(sar0, 0, ssiz);
+
+        inf0->sar0 = sar0;
+        inf0->smsk = (rt_si32)(ssiz - 1);
+    }
+
+    for (i = 0; i < 2 && sarb != RT_NULL; i++)
+    {
+        inf0->sptr = sar0;
+        inf0->sdst = i * STR_STEP * STR_DIST;
+
+        time1 = get_time();
+
+        j = (rt_si32)(STR_PASS * (ssiz / (Q*0x40) / STR_WIND));
+        while (j-->0) o_strm(inf0);
+
+        time2 = get_time();
+        tS = time2 - time1;
+
+        RT_LOGI("Streaming %s = %d ms (%4dx%dv%d)\n",
+                i == 0 ? "w/o prefetch" : "w/  prefetch", (rt_si32)tS,
+                (simd & 0xFF) * 128, (simd >> 16) & 0xFF, (simd >> 8) & 0xFF);
+    }
+
+    if (sarb != RT_NULL)
+    {
+        sys_free(sarb, ssiz + MASK);
+    }
+#endif /* SUB_TEST 62 */
+
     ASM_DONE(inf0)
 
+#if RT_RUNTIME != 0 && RT_CODE_CACHE != 0
+    if (c_file != RT_NULL)
+    {
+        RT_LOGI("Code cache file: %s, kernels stored: %d\n",
+                c_file, code_store(c_file));
+    }
+#endif /* RT_RUNTIME, RT_CODE_CACHE */
+
+#if SUB_TEST >= 54
+    sys_free(cmdq, sizeof(rt_SIMD_CMDQ) + 7*sizeof(rt_SIMD_CMD) + MASK);
+#endif /* SUB_TEST 54 */
+
+#if SUB_TEST >= 62
+    sys_free(sarr, STR_SIZE + MASK);
+#endif /* SUB_TEST 62 */
+
+#if SUB_TEST >= 63
+    sys_free(sarw, STR_SIZE + ZCL_MASK);
+#endif /* SUB_TEST 63 */
+
     sys_free(regs, sizeof(rt_SIMD_REGS) + MASK);
     sys_free(info, sizeof(rt_SIMD_INFOX) + MASK);
     sys_free(marr, 10 * ARR_SIZE * sizeof(rt_ui32) + MASK);
@@ -8940,6 +12694,85 @@ rt_void sys_free(rt_pntr ptr, rt_size size)
 
 #endif /* ------------- OS specific ----------------------------------------- */
 
+#ifdef RT_SIMD_MULT
+
+} /* namespace RT_SIMD_SPACE */
+
+/******************************************************************************/
+/*********************************   GENERIC   ********************************/
+/******************************************************************************/
+
+/*
+ * Generic section of multi-target build is compiled into one of the objects
+ * (RT_SIMD_MULT=2), it runs the test for each target linked into the binary
+ * and supported by the running processor (from narrowest to widest) after
+ * reporting the widest and the calibrated (fastest) targets' selection.
+ */
+#if RT_SIMD_MULT == 2
+
+typedef int (*rt_FUNC_MAIN)(int argc, char *argv[]);
+
+#if   (defined RT_X32) || (defined RT_X64)
+
+RT_SIMD_DECL(simd_128v4s2, int main(int argc, char *argv[]))
+RT_SIMD_DECL(simd_128v4,   int main(int argc, char *argv[]))
+RT_SIMD_DECL(simd_256v1,   int main(int argc, char *argv[]))
+RT_SIMD_DECL(simd_256v2,   int main(int argc, char *argv[]))
+RT_SIMD_DECL(simd_512v1,   int main(int argc, char *argv[]))
+RT_SIMD_DECL(simd_512v2,   int main(int argc, char *argv[]))
+
+rt_SIMD_MULT m_list[] =
+{
+    RT_SIMD_ITEM(simd_128v4s2, main),
+    RT_SIMD_ITEM(simd_128v4,   main),
+    RT_SIMD_ITEM(simd_256v1,   main),
+    RT_SIMD_ITEM(simd_256v2,   main),
+    RT_SIMD_ITEM(simd_512v1,   main),
+    RT_SIMD_ITEM(simd_512v2,   main),
+};
+
+#else  /* report an error if multi-target list is not defined */
+#error "multi-target build is not defined for this arch, check build flags"
+#endif /* RT_X32, RT_X64 */
+
+int main(int argc, char *argv[])
+{
+    int i, n = RT_ARR_SIZE(m_list), k = mult_pick(m_list, n), t;
+
+    RT_LOGI("Multi-target build, widest supported target: %s\n",
+                                        k >= 0 ? m_list[k].name : "none");
+
+    t = mult_tune(m_list, n);
+
+    RT_LOGI("Multi-target build, fastest supported target: %s, mask: %08X\n",
+            t >= 0 ? m_list[t].name : "none", t >= 0 ? m_list[t].mask() : 0);
+
+    if (getenv(RT_MULT_PIN) != NULL && getenv(RT_MULT_PIN)[0] != '\0')
+    {
+        RT_LOGI("Target pinned with %s=%s\n", RT_MULT_PIN, getenv(RT_MULT_PIN));
+    }
+
+    for (i = 0; i < n; i++)
+    {
+        RT_LOGI("========================================================\n");
+
+        if (m_list[i].mask() == 0)
+        {
+            RT_LOGI("Target %s is not supported, skipping\n", m_list[i].name);
+            continue;
+        }
+
+        RT_LOGI("Target %s is supported, running tests\n", m_list[i].name);
+        ((rt_FUNC_MAIN)m_list[i].func)(argc, argv);
+    }
+
+    return 0;
+}
+
+#endif /* RT_SIMD_MULT == 2 */
+
+#endif /* RT_SIMD_MULT */
+
 /******************************************************************************/
 /******************************************************************************/
 /******************************************************************************/